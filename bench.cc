@@ -0,0 +1,331 @@
+// Load generator for keyvaluestore.
+//
+// Drives a GET/PUT workload from many concurrent clients, each keeping a
+// number of asynchronous requests in flight, and prints throughput and
+// latency percentiles as one JSON object on stdout. Progress goes to stderr.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/text_format.h>
+#include <google/protobuf/util/json_util.h>
+#include <grpcpp/grpcpp.h>
+
+#include "histogram.h"
+#include "keyvaluestore.grpc.pb.h"
+
+using google::protobuf::TextFormat;
+using grpc::ClientContext;
+using grpc::Status;
+using keyvaluestore::BenchConfig;
+using keyvaluestore::GetRequest;
+using keyvaluestore::GetResponse;
+using keyvaluestore::Histogram;
+using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiPutRequest;
+using keyvaluestore::PutRequest;
+using keyvaluestore::WriteToken;
+
+using Clock = std::chrono::steady_clock;
+
+// Keys written per MultiPut while loading.
+constexpr int kLoadBatchSize = 500;
+// Deadline of each request.
+constexpr std::chrono::seconds kRequestTimeout(10);
+
+// Picks key indexes in [0, num_of_keys) with a Zipfian distribution, as in
+// YCSB (Gray et al., "Quickly Generating Billion-Record Synthetic
+// Databases"). The rank is hashed, so that the hot keys are spread over the
+// key space instead of being the lowest indexes.
+class ZipfianGenerator {
+ public:
+  ZipfianGenerator(uint64_t num_of_keys, double theta)
+      : num_of_keys_(num_of_keys), theta_(theta) {
+    double zeta_2 = 1 + std::pow(0.5, theta);
+    for (uint64_t i = 1; i <= num_of_keys; ++i) {
+      zeta_n_ += 1 / std::pow(static_cast<double>(i), theta);
+    }
+    alpha_ = 1 / (1 - theta);
+    eta_ = (1 - std::pow(2.0 / num_of_keys, 1 - theta)) /
+           (1 - zeta_2 / zeta_n_);
+  }
+
+  uint64_t Next(std::mt19937_64* rng) const {
+    double u = std::uniform_real_distribution<double>(0, 1)(*rng);
+    double uz = u * zeta_n_;
+    uint64_t rank;
+    if (uz < 1) {
+      rank = 0;
+    } else if (uz < 1 + std::pow(0.5, theta_)) {
+      rank = 1;
+    } else {
+      rank = num_of_keys_ * std::pow(eta_ * u - eta_ + 1, alpha_);
+    }
+    rank = std::min(rank, num_of_keys_ - 1);
+    return Fnv1a(rank) % num_of_keys_;
+  }
+
+ private:
+  static uint64_t Fnv1a(uint64_t value) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < 8; ++i) {
+      hash ^= (value >> (8 * i)) & 0xFF;
+      hash *= 0x100000001B3ull;
+    }
+    return hash;
+  }
+
+  const uint64_t num_of_keys_;
+  const double theta_;
+  double zeta_n_ = 0;
+  double alpha_;
+  double eta_;
+};
+
+// Results of one client, or of all of them once merged.
+struct Results {
+  Histogram reads;
+  Histogram writes;
+  uint64_t num_of_not_found = 0;
+  uint64_t num_of_errors = 0;
+
+  void Merge(const Results& other) {
+    reads.Merge(other.reads);
+    writes.Merge(other.writes);
+    num_of_not_found += other.num_of_not_found;
+    num_of_errors += other.num_of_errors;
+  }
+};
+
+class Bench {
+ public:
+  explicit Bench(const BenchConfig& config) : config_(config) {
+    if (config_.distribution() == "zipfian") {
+      zipfian_ = std::make_unique<ZipfianGenerator>(config_.num_keys(),
+                                                    config_.zipf_theta());
+    }
+    value_ = std::string(config_.value_size(), 'v');
+    for (int i = 0; i < config_.num_clients(); ++i) {
+      // A distinct channel argument keeps clients off a shared connection.
+      grpc::ChannelArguments args;
+      args.SetInt("keyvaluestore.bench_client", i);
+      const std::string& server =
+          config_.server(i % config_.server_size());
+      auto client = std::make_unique<Client>();
+      client->stub = KeyValueStore::NewStub(grpc::CreateCustomChannel(
+          server, grpc::InsecureChannelCredentials(), args));
+      client->rng.seed(config_.seed() + i);
+      clients_.push_back(std::move(client));
+    }
+  }
+
+  // Writes every key once. Returns false if a MultiPut failed.
+  bool Load() {
+    for (int first = 0; first < config_.num_keys(); first += kLoadBatchSize) {
+      MultiPutRequest request;
+      for (int i = first;
+           i < std::min(first + kLoadBatchSize, config_.num_keys()); ++i) {
+        PutRequest* pair = request.add_pairs();
+        pair->set_key(Key(i));
+        pair->set_value(value_);
+      }
+      ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + kRequestTimeout);
+      WriteToken response;
+      Status status =
+          clients_[0]->stub->MultiPut(&context, request, &response);
+      if (!status.ok()) {
+        std::cerr << "Load failed: " << status.error_message() << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Runs the workload for warmup_s plus duration_s, and returns the
+  // results of the measured part.
+  Results Run() {
+    auto start = Clock::now();
+    measure_from_ = start + std::chrono::seconds(config_.warmup_s());
+    end_ = measure_from_ + std::chrono::seconds(config_.duration_s());
+    num_of_in_flight_ = config_.num_clients() * config_.outstanding();
+    for (auto& client : clients_) {
+      for (int i = 0; i < config_.outstanding(); ++i) Issue(client.get());
+    }
+    {
+      std::unique_lock<std::mutex> lock(done_mtx_);
+      done_cv_.wait(lock, [this] { return num_of_in_flight_ == 0; });
+    }
+    Results results;
+    for (auto& client : clients_) results.Merge(client->results);
+    return results;
+  }
+
+ private:
+  struct Client {
+    std::unique_ptr<KeyValueStore::Stub> stub;
+    // Guards rng and results; callbacks of one client may run concurrently.
+    std::mutex mtx;
+    std::mt19937_64 rng;
+    Results results;
+  };
+  // One request in flight.
+  struct Call {
+    ClientContext context;
+    Clock::time_point start;
+    GetRequest get_request;
+    GetResponse get_response;
+    PutRequest put_request;
+    WriteToken put_response;
+  };
+
+  static std::string Key(uint64_t index) {
+    return "key" + std::to_string(index);
+  }
+
+  // Sends the next request of client, unless the run is over.
+  void Issue(Client* client) {
+    if (Clock::now() >= end_) {
+      std::lock_guard<std::mutex> lock(done_mtx_);
+      if (--num_of_in_flight_ == 0) done_cv_.notify_all();
+      return;
+    }
+    bool is_read;
+    uint64_t index;
+    {
+      std::lock_guard<std::mutex> lock(client->mtx);
+      is_read = std::uniform_real_distribution<double>(0, 1)(client->rng) <
+                config_.read_ratio();
+      index = zipfian_ != nullptr
+                  ? zipfian_->Next(&client->rng)
+                  : std::uniform_int_distribution<uint64_t>(
+                        0, config_.num_keys() - 1)(client->rng);
+    }
+    auto* call = new Call();
+    call->context.set_deadline(std::chrono::system_clock::now() +
+                               kRequestTimeout);
+    call->start = Clock::now();
+    if (is_read) {
+      call->get_request.set_key(Key(index));
+      client->stub->async()->GetValue(
+          &call->context, &call->get_request, &call->get_response,
+          [this, client, call](Status status) {
+            Done(client, call, /*is_read=*/true, status);
+          });
+    } else {
+      call->put_request.set_key(Key(index));
+      call->put_request.set_value(value_);
+      client->stub->async()->PutPair(
+          &call->context, &call->put_request, &call->put_response,
+          [this, client, call](Status status) {
+            Done(client, call, /*is_read=*/false, status);
+          });
+    }
+  }
+
+  void Done(Client* client, Call* call, bool is_read, const Status& status) {
+    auto now = Clock::now();
+    if (call->start >= measure_from_ && now <= end_) {
+      uint64_t latency_us =
+          std::chrono::duration_cast<std::chrono::microseconds>(now -
+                                                                call->start)
+              .count();
+      std::lock_guard<std::mutex> lock(client->mtx);
+      if (status.error_code() == grpc::StatusCode::NOT_FOUND) {
+        ++client->results.num_of_not_found;
+      } else if (!status.ok()) {
+        ++client->results.num_of_errors;
+      }
+      if (status.ok() || status.error_code() == grpc::StatusCode::NOT_FOUND) {
+        (is_read ? client->results.reads : client->results.writes)
+            .Record(latency_us);
+      }
+    }
+    delete call;
+    Issue(client);
+  }
+
+  const BenchConfig config_;
+  std::unique_ptr<ZipfianGenerator> zipfian_;
+  std::string value_;
+  std::vector<std::unique_ptr<Client>> clients_;
+  Clock::time_point measure_from_;
+  Clock::time_point end_;
+  int num_of_in_flight_ = 0;
+  std::mutex done_mtx_;
+  std::condition_variable done_cv_;
+};
+
+int main(int argc, char** argv) {
+  if (argc <= 1) {
+    std::cerr << "Usage: `./bench \"server:'<addr>' ... server:'<addr>' "
+                 "num_clients:<int> outstanding:<int> duration_s:<int> "
+                 "read_ratio:<double> num_keys:<int> value_size:<int> "
+                 "distribution:'uniform|zipfian'\"`"
+              << std::endl
+              << "Like this:" << std::endl
+              << "`./bench \"server:'0.0.0.0:8000' server:'0.0.0.0:8001' "
+                 "num_clients:32 outstanding:4 duration_s:10 read_ratio:0.95 "
+                 "distribution:'zipfian'\"`"
+              << std::endl;
+    return -1;
+  }
+  BenchConfig config;
+  // The Zipfian generator divides by 1 - zipf_theta.
+  if (!TextFormat::ParseFromString(std::string(argv[1]), &config) ||
+      config.server_size() == 0 || config.zipf_theta() >= 1) {
+    std::cerr << "Invalid BenchConfig: " << argv[1] << std::endl;
+    return -1;
+  }
+  if (config.num_clients() <= 0) config.set_num_clients(16);
+  if (config.outstanding() <= 0) config.set_outstanding(1);
+  if (config.duration_s() <= 0) config.set_duration_s(10);
+  if (config.num_keys() <= 0) config.set_num_keys(10000);
+  if (config.value_size() <= 0) config.set_value_size(100);
+  if (config.distribution().empty()) config.set_distribution("uniform");
+  if (config.zipf_theta() <= 0) config.set_zipf_theta(0.99);
+  if (config.distribution() != "uniform" &&
+      config.distribution() != "zipfian") {
+    std::cerr << "Unknown distribution: " << config.distribution()
+              << std::endl;
+    return -1;
+  }
+
+  Bench bench(config);
+  if (!config.skip_load()) {
+    std::cerr << "Loading " << config.num_keys() << " keys." << std::endl;
+    if (!bench.Load()) return 1;
+  }
+  std::cerr << "Running for " << config.warmup_s() << "s warmup + "
+            << config.duration_s() << "s." << std::endl;
+  Results results = bench.Run();
+
+  uint64_t num_of_ops = results.reads.Count() + results.writes.Count();
+  Histogram all = results.reads;
+  all.Merge(results.writes);
+  std::string config_json;
+  google::protobuf::util::JsonPrintOptions json_options;
+  json_options.preserve_proto_field_names = true;
+  google::protobuf::util::MessageToJsonString(config, &config_json,
+                                              json_options);
+  printf(
+      "{\"config\": %s, \"ops\": %llu, \"ops_per_sec\": %.1f, "
+      "\"not_found\": %llu, \"errors\": %llu, \"latency_us\": {\"all\": %s, "
+      "\"read\": %s, \"write\": %s}}\n",
+      config_json.c_str(), static_cast<unsigned long long>(num_of_ops),
+      static_cast<double>(num_of_ops) / config.duration_s(),
+      static_cast<unsigned long long>(results.num_of_not_found),
+      static_cast<unsigned long long>(results.num_of_errors),
+      all.ToJson().c_str(), results.reads.ToJson().c_str(),
+      results.writes.ToJson().c_str());
+  return 0;
+}
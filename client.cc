@@ -1,7 +1,7 @@
 // Client side of keyvaluestore.
 
+#include <chrono>
 #include <iostream>
-#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -9,77 +9,135 @@
 #include <grpcpp/grpcpp.h>
 
 #include "keyvaluestore.grpc.pb.h"
+#include "kv-store-client.h"
 #include "time_log.h"
 
-using grpc::Channel;
 using grpc::ClientContext;
 using grpc::Status;
-using keyvaluestore::DeleteRequest;
 using keyvaluestore::EmptyMessage;
-using keyvaluestore::GetRequest;
-using keyvaluestore::GetResponse;
-using keyvaluestore::KeyValueStore;
-using keyvaluestore::PutRequest;
+using keyvaluestore::KeyValue;
+using keyvaluestore::KeyValueStoreClient;
+using keyvaluestore::MultiPaxos;
+using keyvaluestore::StatsResponse;
+using keyvaluestore::WriteResponse;
 
 // #define TIME_LOG() std::cout << TimeNow();
 
-class KeyValueStoreClient {
- public:
-  KeyValueStoreClient(std::shared_ptr<Channel> channel)
-      : stub_(KeyValueStore::NewStub(channel)) {}
-
-  // Requests a key and displays the key and its corresponding value as a pair
-  void GetValue(const std::string& key) {
-    // Context for the client.
-    ClientContext context;
-    GetRequest request;
-    request.set_key(key);
-    GetResponse response;
-    Status status = stub_->GetValue(&context, request, &response);
-    if (!status.ok()) {
-      TIME_LOG << "Error Code " << status.error_code() << ". "
-               << status.error_message() << std::endl;
-    } else {
-      TIME_LOG << key << " : " << response.value() << std::endl;
-    }
+void PrintError(const Status& status) {
+  TIME_LOG << "Error Code " << status.error_code() << ". "
+           << status.error_message();
+}
+
+// Requests a key and displays the key and its corresponding value as a pair
+void GetValue(KeyValueStoreClient* client, const std::string& key) {
+  std::string value;
+  Status status = client->GetValue(key, &value);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << key << " : " << value;
+  }
+}
+
+// Put a (key, value) pair to the store.
+void PutPair(KeyValueStoreClient* client, const std::string& key,
+             const std::string& value) {
+  Status status = client->PutPair(key, value);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << "Pair (" << key << ", " << value
+             << ") is now added to the store.";
   }
-  // Put a (key, value) pair to the store.
-  void PutPair(const std::string& key, const std::string& value) {
-    // Context for the client.
-    ClientContext context;
-    PutRequest request;
-    request.set_key(key);
-    request.set_value(value);
-    EmptyMessage response;
-    Status status = stub_->PutPair(&context, request, &response);
-    if (!status.ok()) {
-      TIME_LOG << "Error Code " << status.error_code() << ". "
-               << status.error_message() << std::endl;
+}
+
+// Delete a (key, value) pair according to the given key.
+void DeletePair(KeyValueStoreClient* client, const std::string& key) {
+  Status status = client->DeletePair(key);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << "Key (" << key << ") is deleted.";
+  }
+}
+
+// Requests several keys and displays each with its value.
+void MultiGet(KeyValueStoreClient* client,
+              const std::vector<std::string>& keys) {
+  std::vector<KeyValue> pairs;
+  Status status = client->MultiGet(keys, &pairs);
+  if (!status.ok()) {
+    PrintError(status);
+    return;
+  }
+  for (const KeyValue& pair : pairs) {
+    if (pair.found()) {
+      TIME_LOG << pair.key() << " : " << pair.value();
     } else {
-      TIME_LOG << "Pair (" << request.key() << ", " << request.value()
-               << ") is now added to the store." << std::endl;
+      TIME_LOG << pair.key() << " is not found.";
     }
   }
+}
+
+// Put several (key, value) pairs to the store, atomically per group.
+void MultiPut(KeyValueStoreClient* client,
+              const std::vector<std::pair<std::string, std::string>>& pairs) {
+  Status status = client->MultiPut(pairs);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << pairs.size() << " pairs are now added to the store.";
+  }
+}
 
-  // Delete a (key, value) pair according to the given key.
-  void DeletePair(const std::string& key) {
-    // Context for the client.
-    ClientContext context;
-    DeleteRequest request;
-    request.set_key(key);
-    EmptyMessage response;
-    Status status = stub_->DeletePair(&context, request, &response);
-    if (!status.ok()) {
-      TIME_LOG << "Error Code " << status.error_code() << ". "
-               << status.error_message() << std::endl;
+// Delete several keys from the store, atomically per group.
+void MultiDelete(KeyValueStoreClient* client,
+                 const std::vector<std::string>& keys) {
+  Status status = client->MultiDelete(keys);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << keys.size() << " keys are deleted.";
+  }
+}
+
+// Streams (key, value) pairs to the store, one write each, without
+// waiting for a write to commit before sending the next.
+void StreamPut(KeyValueStoreClient* client,
+               const std::vector<std::pair<std::string, std::string>>& pairs) {
+  std::vector<WriteResponse> responses;
+  Status status = client->StreamPut(pairs, &responses);
+  int num_of_committed = 0;
+  for (const WriteResponse& response : responses) {
+    if (response.code() == grpc::StatusCode::OK) {
+      ++num_of_committed;
     } else {
-      TIME_LOG << "Key (" << request.key() << ") is deleted." << std::endl;
+      TIME_LOG << "Write " << response.id() << ": Error Code "
+               << response.code() << ". " << response.error_message();
     }
   }
+  if (!status.ok()) PrintError(status);
+  TIME_LOG << num_of_committed << " of " << pairs.size()
+           << " streamed pairs are now added to the store.";
+}
 
- private:
-  std::unique_ptr<KeyValueStore::Stub> stub_;
-};
+// Displays the counters and per-phase latencies of the replica whose Paxos
+// address is paxos_address.
+void PrintStats(const std::string& paxos_address) {
+  auto stub = MultiPaxos::NewStub(
+      grpc::CreateChannel(paxos_address, grpc::InsecureChannelCredentials()));
+  ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() +
+                       std::chrono::seconds(5));
+  EmptyMessage request;
+  StatsResponse response;
+  Status status = stub->Stats(&context, request, &response);
+  if (!status.ok()) {
+    PrintError(status);
+  } else {
+    TIME_LOG << "Stats of " << paxos_address << ":\n" << response.text();
+  }
+}
 
 std::string ToLowerCase(const std::string& s) {
   std::string lower(s);
@@ -95,15 +153,14 @@ void Prepopulate(KeyValueStoreClient* client) {
       {"apple", "red"},      {"lemon", "yellow"},     {"orange", "orange"},
       {"strawberry", "red"}, {"watermelon", "green"}, {"grape", "purple"},
       {"coconut", "brown"},  {"avocado", "green"}};
-  TIME_LOG << "************************************************" << std::endl;
-  TIME_LOG << "Prepopulating key value store." << std::endl;
-  TIME_LOG << "------------------------------------------------" << std::endl;
-  // Send PUT Requests.
+  TIME_LOG << "************************************************";
+  TIME_LOG << "Prepopulating key value store.";
+  TIME_LOG << "------------------------------------------------";
+  // Send all pairs in one MULTI-PUT Request.
   for (auto item : key_values) {
-    TIME_LOG << "Prepopulating: " << item.first << " " << item.second
-             << std::endl;
-    client->PutPair(item.first, item.second);
+    TIME_LOG << "Prepopulating: " << item.first << " " << item.second;
   }
+  MultiPut(client, key_values);
 }
 
 // Run some tests.
@@ -114,57 +171,60 @@ void TestRuns(KeyValueStoreClient* client) {
       {"blueberry", "blue"},
       {"kiwi", "brown"},
       {"apple", "green"}};
-  TIME_LOG << "************************************************" << std::endl;
-  TIME_LOG << "Start testing PUT, GET, DELETE operations." << std::endl;
-  TIME_LOG << "------------------------------------------------" << std::endl;
+  TIME_LOG << "************************************************";
+  TIME_LOG << "Start testing PUT, GET, DELETE operations.";
+  TIME_LOG << "------------------------------------------------";
   // Send DELETE Requests.
   for (auto item : key_values) {
-    TIME_LOG << "Sending request: DELETE " << item.first << std::endl;
-    client->DeletePair(item.first);
+    TIME_LOG << "Sending request: DELETE " << item.first;
+    DeletePair(client, item.first);
   }
-  TIME_LOG << "------------------------------------------------" << std::endl;
+  TIME_LOG << "------------------------------------------------";
   // Send GET Requests.
   for (auto item : key_values) {
-    TIME_LOG << "Sending request: GET " << item.first << std::endl;
-    client->GetValue(item.first);
+    TIME_LOG << "Sending request: GET " << item.first;
+    GetValue(client, item.first);
   }
-  TIME_LOG << "------------------------------------------------" << std::endl;
+  TIME_LOG << "------------------------------------------------";
   // Send PUT Requests.
   for (auto item : key_values) {
-    TIME_LOG << "Sending request: PUT " << item.first << " " << item.second
-             << std::endl;
-    client->PutPair(item.first, item.second);
+    TIME_LOG << "Sending request: PUT " << item.first << " " << item.second;
+    PutPair(client, item.first, item.second);
   }
-  TIME_LOG << "------------------------------------------------" << std::endl;
+  TIME_LOG << "------------------------------------------------";
   // Send GET Requests.
   for (auto item : key_values) {
-    TIME_LOG << "Sending request: GET " << item.first << std::endl;
-    client->GetValue(item.first);
+    TIME_LOG << "Sending request: GET " << item.first;
+    GetValue(client, item.first);
   }
 
-  TIME_LOG << "------------------------------------------------" << std::endl;
-  TIME_LOG << "End of test." << std::endl;
-  TIME_LOG << "************************************************" << std::endl;
+  TIME_LOG << "------------------------------------------------";
+  TIME_LOG << "End of test.";
+  TIME_LOG << "************************************************";
 }
 
-void RunClient(const std::string& server_address, bool auto_run) {
-  TIME_LOG << "Listening to server_address: " << server_address << std::endl;
-  // Instantiate the client.
-  KeyValueStoreClient client(
-      grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials()));
+void RunClient(const std::vector<std::string>& server_addresses,
+               bool auto_run, bool session_reads) {
+  for (const std::string& server_address : server_addresses) {
+    TIME_LOG << "Listening to server_address: " << server_address;
+  }
+  // Instantiate the client. It sends requests straight to the Coordinators,
+  // or reads to its replica with session_reads.
+  KeyValueStoreClient client(server_addresses, session_reads);
   if (auto_run) {
     // Prepopulate the key value store.
     Prepopulate(&client);
     // Send a number of requests automatically.
     TestRuns(&client);
   }
-  TIME_LOG << "Please enter your request: (Separate words with a white space.)"
-           << std::endl;
+  TIME_LOG << "Please enter your request: (Separate words with a white space.)";
   TIME_LOG
-      << "Query examples: (Keywords GET/PUT/DELETE are NOT case-sensitive.)"
-      << std::endl;
-  TIME_LOG << "\"GET apple\" / \"PUT apple red\" / \"DELETE apple\""
-           << std::endl;
+      << "Query examples: (Keywords GET/PUT/DELETE are NOT case-sensitive.)";
+  TIME_LOG << "\"GET apple\" / \"PUT apple red\" / \"DELETE apple\"";
+  TIME_LOG << "Several keys at once: \"MGET apple lemon\" / "
+              "\"MPUT apple red lemon yellow\" / \"MDELETE apple lemon\" / "
+              "\"SPUT apple red lemon yellow\" (streamed)";
+  TIME_LOG << "Replica stats by Paxos address: \"STATS 0.0.0.0:9000\"";
   while (true) {
     std::string query;
     std::getline(std::cin, query);
@@ -176,17 +236,39 @@ void RunClient(const std::string& server_address, bool auto_run) {
       args.push_back(std::move(item));
     }
     if (args.size() == 2 && ToLowerCase(args[0]) == "get") {
-      TIME_LOG << "Sending request: GET " << args[1] << std::endl;
-      client.GetValue(args[1]);
+      TIME_LOG << "Sending request: GET " << args[1];
+      GetValue(&client, args[1]);
     } else if (args.size() == 3 && ToLowerCase(args[0]) == "put") {
-      TIME_LOG << "Sending request: PUT " << args[1] << " " << args[2]
-               << std::endl;
-      client.PutPair(args[1], args[2]);
+      TIME_LOG << "Sending request: PUT " << args[1] << " " << args[2];
+      PutPair(&client, args[1], args[2]);
     } else if (args.size() == 2 && ToLowerCase(args[0]) == "delete") {
-      TIME_LOG << "Sending request: DELETE " << args[1] << std::endl;
-      client.DeletePair(args[1]);
+      TIME_LOG << "Sending request: DELETE " << args[1];
+      DeletePair(&client, args[1]);
+    } else if (args.size() >= 2 && ToLowerCase(args[0]) == "mget") {
+      TIME_LOG << "Sending request: MGET " << args.size() - 1 << " keys";
+      MultiGet(&client, {args.begin() + 1, args.end()});
+    } else if (args.size() >= 2 && ToLowerCase(args[0]) == "mdelete") {
+      TIME_LOG << "Sending request: MDELETE " << args.size() - 1 << " keys";
+      MultiDelete(&client, {args.begin() + 1, args.end()});
+    } else if (args.size() >= 3 && args.size() % 2 == 1 &&
+               (ToLowerCase(args[0]) == "mput" ||
+                ToLowerCase(args[0]) == "sput")) {
+      std::vector<std::pair<std::string, std::string>> pairs;
+      for (size_t i = 1; i < args.size(); i += 2) {
+        pairs.emplace_back(args[i], args[i + 1]);
+      }
+      if (ToLowerCase(args[0]) == "mput") {
+        TIME_LOG << "Sending request: MPUT " << pairs.size() << " pairs";
+        MultiPut(&client, pairs);
+      } else {
+        TIME_LOG << "Sending request: SPUT " << pairs.size() << " pairs";
+        StreamPut(&client, pairs);
+      }
+    } else if (args.size() == 2 && ToLowerCase(args[0]) == "stats") {
+      TIME_LOG << "Sending request: STATS " << args[1];
+      PrintStats(args[1]);
     } else {
-      TIME_LOG << "Invalid command." << std::endl;
+      TIME_LOG << "Invalid command.";
     }
   }
 }
@@ -195,12 +277,20 @@ int main(int argc, char** argv) {
   // Set server address.
   std::string server_address = "localhost:8000";
   bool auto_run = false;
-  if (argc <= 2) {
-    std::cerr << "Usage: `./client <server_address> <auto_run>`" << std::endl
+  bool session_reads = false;
+  if (argc <= 2 || argc > 4 ||
+      (argc == 4 && ToLowerCase(std::string(argv[3])) != "session")) {
+    std::cerr << "Usage: `./client <server_address>[,...] <auto_run> "
+                 "[session]`"
+              << std::endl
               << "Like this:" << std::endl
-              << "`./client 0.0.0.0:8000 true`" << std::endl;
+              << "`./client 0.0.0.0:8000,0.0.0.0:8001 true`" << std::endl
+              << "With `session`, reads are served by the replica from its "
+                 "own store, once it has the client's writes."
+              << std::endl;
     return -1;
   } else {
+    session_reads = argc == 4;
     server_address = argv[1];
     std::string auto_run_str = ToLowerCase(std::string(argv[2]));
     if (auto_run_str == "true") {
@@ -208,15 +298,28 @@ int main(int argc, char** argv) {
     } else if (auto_run_str == "false") {
       auto_run = false;
     } else {
-      std::cerr << "Usage: `./client <server_address> <auto_run>`" << std::endl
+      std::cerr << "Usage: `./client <server_address>[,...] <auto_run>`"
+                << std::endl
                 << "Like this:" << std::endl
-                << "`./client 0.0.0.0:8000 true`" << std::endl;
+                << "`./client 0.0.0.0:8000,0.0.0.0:8001 true`" << std::endl;
       return -1;
     }
   }
-  TIME_LOG << "Server address set to " << server_address << std::endl;
+  TIME_LOG << "Server address set to " << server_address;
+  // Any replica serves; the others are asked when it does not answer.
+  std::vector<std::string> server_addresses;
+  std::stringstream address_stream(server_address);
+  std::string address;
+  while (std::getline(address_stream, address, ',')) {
+    if (!address.empty()) server_addresses.push_back(address);
+  }
+  if (server_addresses.empty()) {
+    std::cerr << "No server address given in `" << server_address << "`."
+              << std::endl;
+    return -1;
+  }
 
-  RunClient(server_address, auto_run);
+  RunClient(server_addresses, auto_run, session_reads);
 
   return 0;
 }
@@ -0,0 +1,347 @@
+// Consensus benchmark on a cluster run inside one process.
+//
+// Runs every replica in this process, drives a GET/PUT workload against
+// them while crashing and restarting replicas on a script, and prints
+// throughput, latency percentiles and how long each crash stalled writes as
+// one JSON object on stdout. Progress and the replicas' Stats go to stderr.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <google/protobuf/text_format.h>
+#include <google/protobuf/util/json_util.h>
+#include <grpcpp/grpcpp.h>
+
+#include "cluster.h"
+#include "histogram.h"
+#include "keyvaluestore.grpc.pb.h"
+#include "time_log.h"
+
+using google::protobuf::TextFormat;
+using grpc::ClientContext;
+using grpc::Status;
+using keyvaluestore::Cluster;
+using keyvaluestore::ClusterBenchConfig;
+using keyvaluestore::ClusterEvent;
+using keyvaluestore::GetRequest;
+using keyvaluestore::GetResponse;
+using keyvaluestore::Histogram;
+using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiPutRequest;
+using keyvaluestore::PutRequest;
+using keyvaluestore::WriteToken;
+
+using Clock = std::chrono::steady_clock;
+
+// Keys written per MultiPut while loading.
+constexpr int kLoadBatchSize = 500;
+// Deadline of each request.
+constexpr std::chrono::seconds kRequestTimeout(10);
+
+// Results of one client, or of all of them once merged.
+struct Results {
+  Histogram reads;
+  Histogram writes;
+  uint64_t num_of_errors = 0;
+  // Start and end of every successful write, in microseconds since the run
+  // started.
+  std::vector<std::pair<int64_t, int64_t>> writes_done;
+
+  void Merge(const Results& other) {
+    reads.Merge(other.reads);
+    writes.Merge(other.writes);
+    num_of_errors += other.num_of_errors;
+    writes_done.insert(writes_done.end(), other.writes_done.begin(),
+                       other.writes_done.end());
+  }
+};
+
+// A scripted event as it happened.
+struct EventResult {
+  ClusterEvent event;
+  int replica = -1;
+  // When the event started, and how long the crash or restart took, in
+  // milliseconds.
+  double started_ms = 0;
+  double took_ms = 0;
+  bool ok = false;
+};
+
+static std::string Key(uint64_t index) {
+  return "key" + std::to_string(index);
+}
+
+static int64_t MicrosSince(Clock::time_point start, Clock::time_point now) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(now - start)
+      .count();
+}
+
+class ClusterBench {
+ public:
+  ClusterBench(const ClusterBenchConfig& config, Cluster* cluster)
+      : config_(config),
+        cluster_(cluster),
+        value_(config.value_size(), 'v') {}
+
+  // Writes every key once. Returns false if a MultiPut failed.
+  bool Load() {
+    auto stub = KeyValueStore::NewStub(cluster_->GetChannel(0));
+    for (int first = 0; first < config_.num_keys(); first += kLoadBatchSize) {
+      MultiPutRequest request;
+      for (int i = first;
+           i < std::min(first + kLoadBatchSize, config_.num_keys()); ++i) {
+        PutRequest* pair = request.add_pairs();
+        pair->set_key(Key(i));
+        pair->set_value(value_);
+      }
+      ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + kRequestTimeout);
+      WriteToken response;
+      Status status = stub->MultiPut(&context, request, &response);
+      if (!status.ok()) {
+        std::cerr << "Load failed: " << status.error_message() << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Runs the workload and the events for duration_s.
+  Results Run(std::vector<EventResult>* events) {
+    start_ = Clock::now();
+    end_ = start_ + std::chrono::seconds(config_.duration_s());
+    std::vector<Results> results(config_.num_clients());
+    std::vector<std::thread> clients;
+    for (int i = 0; i < config_.num_clients(); ++i) {
+      clients.emplace_back(&ClusterBench::RunClient, this, i, &results[i]);
+    }
+    RunEvents(events);
+    for (auto& client : clients) client.join();
+    Results all;
+    for (const Results& client_results : results) all.Merge(client_results);
+    return all;
+  }
+
+ private:
+  // Sends one request at a time to the replica of the client. Moves on to
+  // the next replica while that one is down.
+  void RunClient(int id, Results* results) {
+    std::mt19937_64 rng(config_.seed() + id);
+    int target = id % cluster_->size();
+    // The slots of the client's writes, for session_reads.
+    WriteToken session;
+    while (Clock::now() < end_) {
+      auto channel = cluster_->GetChannel(target);
+      if (channel == nullptr) {
+        target = (target + 1) % cluster_->size();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      auto stub = KeyValueStore::NewStub(channel);
+      bool is_read = std::uniform_real_distribution<double>(0, 1)(rng) <
+                     config_.read_ratio();
+      std::string key = Key(std::uniform_int_distribution<uint64_t>(
+          0, config_.num_keys() - 1)(rng));
+      ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + kRequestTimeout);
+      auto start = Clock::now();
+      Status status;
+      if (is_read) {
+        GetRequest request;
+        request.set_key(key);
+        if (config_.session_reads()) *request.mutable_min_version() = session;
+        GetResponse response;
+        status = stub->GetValue(&context, request, &response);
+      } else {
+        PutRequest request;
+        request.set_key(key);
+        request.set_value(value_);
+        WriteToken response;
+        status = stub->PutPair(&context, request, &response);
+        for (const auto& slot : response.slots()) {
+          int& session_slot = (*session.mutable_slots())[slot.first];
+          session_slot = std::max(session_slot, slot.second);
+        }
+      }
+      auto now = Clock::now();
+      if (!status.ok() && status.error_code() != grpc::StatusCode::NOT_FOUND) {
+        ++results->num_of_errors;
+        if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
+          target = (target + 1) % cluster_->size();
+        }
+        continue;
+      }
+      uint64_t latency_us = MicrosSince(start, now);
+      if (is_read) {
+        results->reads.Record(latency_us);
+      } else {
+        results->writes.Record(latency_us);
+        results->writes_done.emplace_back(MicrosSince(start_, start),
+                                          MicrosSince(start_, now));
+      }
+    }
+  }
+
+  void RunEvents(std::vector<EventResult>* events) {
+    std::vector<ClusterEvent> script(config_.events().begin(),
+                                     config_.events().end());
+    std::stable_sort(script.begin(), script.end(),
+                     [](const ClusterEvent& a, const ClusterEvent& b) {
+                       return a.at_ms() < b.at_ms();
+                     });
+    int last_crashed = -1;
+    for (const ClusterEvent& event : script) {
+      std::this_thread::sleep_until(start_ +
+                                    std::chrono::milliseconds(event.at_ms()));
+      EventResult result;
+      result.event = event;
+      result.replica = event.replica();
+      if (result.replica < 0) {
+        result.replica =
+            event.restart() ? last_crashed : cluster_->GetCoordinatorIndex(0);
+      }
+      auto started = Clock::now();
+      result.started_ms = MicrosSince(start_, started) / 1000.0;
+      Status status;
+      if (result.replica < 0 || result.replica >= cluster_->size()) {
+        status = Status(grpc::StatusCode::INVALID_ARGUMENT, "No replica.");
+      } else if (event.restart()) {
+        status = cluster_->Restart(result.replica);
+      } else {
+        status = cluster_->Crash(result.replica);
+        if (status.ok()) last_crashed = result.replica;
+      }
+      result.took_ms = MicrosSince(started, Clock::now()) / 1000.0;
+      result.ok = status.ok();
+      std::cerr << "At " << result.started_ms << "ms: "
+                << (event.restart() ? "restart " : "crash ")
+                << cluster_->PaxosAddress(result.replica) << ": "
+                << (status.ok() ? "done" : status.error_message()) << " in "
+                << result.took_ms << "ms." << std::endl;
+      events->push_back(result);
+    }
+  }
+
+  const ClusterBenchConfig config_;
+  Cluster* cluster_;
+  const std::string value_;
+  Clock::time_point start_;
+  Clock::time_point end_;
+};
+
+// Returns how long after at_ms the first write sent at or after it
+// succeeded, in milliseconds, or -1 if none did.
+static double FirstWriteAfter(double at_ms, const Results& results) {
+  int64_t at_us = at_ms * 1000;
+  int64_t first_us = -1;
+  for (const auto& write : results.writes_done) {
+    if (write.first < at_us) continue;
+    if (first_us < 0 || write.second < first_us) first_us = write.second;
+  }
+  return first_us < 0 ? -1 : (first_us - at_us) / 1000.0;
+}
+
+int main(int argc, char** argv) {
+  if (argc <= 1) {
+    std::cerr << "Usage: `./cluster-bench \"num_replicas:<int> "
+                 "replica_config { fail_rate:<double> ... } num_clients:<int> "
+                 "duration_s:<int> read_ratio:<double> session_reads:<bool> "
+                 "events { at_ms:<int> replica:<int> restart:<bool> } ...\"`"
+              << std::endl
+              << "Like this:" << std::endl
+              << "`./cluster-bench \"num_replicas:5 num_clients:8 "
+                 "duration_s:10 read_ratio:0.5 events { at_ms:3000 "
+                 "replica:-1 } events { at_ms:6000 replica:-1 "
+                 "restart:true }\"`"
+              << std::endl;
+    return -1;
+  }
+  ClusterBenchConfig config;
+  if (!TextFormat::ParseFromString(std::string(argv[1]), &config)) {
+    std::cerr << "Invalid ClusterBenchConfig: " << argv[1] << std::endl;
+    return -1;
+  }
+  if (config.num_replicas() <= 0) config.set_num_replicas(5);
+  if (config.num_clients() <= 0) config.set_num_clients(8);
+  if (config.duration_s() <= 0) config.set_duration_s(10);
+  if (config.num_keys() <= 0) config.set_num_keys(1000);
+  if (config.value_size() <= 0) config.set_value_size(100);
+  // Logs share stdout with the result, so only problems are logged unless
+  // asked otherwise.
+  time_log::Level log_level = time_log::Level::kWarning;
+  if (!config.replica_config().log_level().empty() &&
+      !time_log::ParseLevel(config.replica_config().log_level(), &log_level)) {
+    std::cerr << "Unknown log_level: " << config.replica_config().log_level()
+              << std::endl;
+    return -1;
+  }
+  time_log::SetLevel(log_level);
+  time_log::StartAsync();
+  // Acceptors random-fail with rand().
+  srand(config.seed());
+
+  Cluster cluster(config.num_replicas(), config.replica_config(),
+                  config.wal_dir());
+  std::cerr << "Starting " << config.num_replicas() << " replicas."
+            << std::endl;
+  Status start_status = cluster.Start();
+  if (!start_status.ok()) {
+    std::cerr << "Start failed: " << start_status.error_message()
+              << std::endl;
+    return 1;
+  }
+  ClusterBench bench(config, &cluster);
+  std::cerr << "Loading " << config.num_keys() << " keys." << std::endl;
+  if (!bench.Load()) return 1;
+  std::cerr << "Running for " << config.duration_s() << "s." << std::endl;
+  std::vector<EventResult> events;
+  Results results = bench.Run(&events);
+  for (int i = 0; i < cluster.size(); ++i) {
+    if (!cluster.IsRunning(i)) continue;
+    std::cerr << "Stats of " << cluster.PaxosAddress(i) << ":" << std::endl
+              << cluster.GetStatsText(i);
+  }
+
+  uint64_t num_of_ops = results.reads.Count() + results.writes.Count();
+  Histogram all = results.reads;
+  all.Merge(results.writes);
+  std::string events_json;
+  for (const EventResult& event : events) {
+    char json[256];
+    snprintf(json, sizeof(json),
+             "%s{\"at_ms\": %.1f, \"replica\": %d, \"restart\": %s, "
+             "\"ok\": %s, \"took_ms\": %.1f, \"first_write_ms\": %.1f}",
+             events_json.empty() ? "" : ", ", event.started_ms, event.replica,
+             event.event.restart() ? "true" : "false",
+             event.ok ? "true" : "false", event.took_ms,
+             FirstWriteAfter(event.started_ms, results));
+    events_json += json;
+  }
+  std::string config_json;
+  google::protobuf::util::JsonPrintOptions json_options;
+  json_options.preserve_proto_field_names = true;
+  google::protobuf::util::MessageToJsonString(config, &config_json,
+                                              json_options);
+  time_log::Flush();
+  printf(
+      "{\"config\": %s, \"ops\": %llu, \"ops_per_sec\": %.1f, "
+      "\"errors\": %llu, \"latency_us\": {\"all\": %s, \"read\": %s, "
+      "\"write\": %s}, \"events\": [%s]}\n",
+      config_json.c_str(), static_cast<unsigned long long>(num_of_ops),
+      static_cast<double>(num_of_ops) / config.duration_s(),
+      static_cast<unsigned long long>(results.num_of_errors),
+      all.ToJson().c_str(), results.reads.ToJson().c_str(),
+      results.writes.ToJson().c_str(), events_json.c_str());
+  fflush(stdout);
+  return 0;
+}
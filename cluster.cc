@@ -0,0 +1,305 @@
+#include "cluster.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+
+#include "kv-database.h"
+#include "kv-store-service-impl.h"
+#include "liveness-tracker.h"
+#include "multi-paxos-router.h"
+#include "multi-paxos-service-impl.h"
+#include "paxos-group.h"
+#include "paxos-stubs-map.h"
+#include "server-stats.h"
+#include "time_log.h"
+#include "wal.h"
+
+namespace keyvaluestore {
+
+using grpc::Status;
+
+// Everything a server process holds, in the order it is built. Members are
+// destroyed in reverse, after the server is shut down.
+struct Cluster::Replica {
+  // One of each per Paxos group.
+  std::vector<std::unique_ptr<WriteAheadLog>> wals;
+  std::vector<std::unique_ptr<KeyValueDataBase>> kv_dbs;
+  std::vector<std::unique_ptr<PaxosStubsMap>> paxos_stubs_maps;
+  ServerStats stats;
+  std::unique_ptr<LivenessTracker> liveness_tracker;
+  std::unique_ptr<KeyValueStoreServiceImpl> keyvaluestore_service;
+  std::vector<std::unique_ptr<MultiPaxosServiceImpl>> multi_paxos_services;
+  std::unique_ptr<MultiPaxosRouter> multi_paxos_router;
+  std::unique_ptr<grpc::Server> server;
+};
+
+Cluster::Cluster(int num_of_replicas, const ServerConfig& replica_config,
+                 const std::string& wal_dir)
+    : num_of_replicas_(num_of_replicas),
+      replica_config_(replica_config),
+      wal_dir_(wal_dir),
+      num_of_groups_(replica_config.num_groups() > 0
+                         ? replica_config.num_groups()
+                         : 1),
+      replicas_(num_of_replicas),
+      initializing_(num_of_replicas),
+      teardowns_(num_of_replicas) {
+  char socket_dir[] = "/tmp/keyvaluestore-cluster-XXXXXX";
+  if (mkdtemp(socket_dir) == nullptr) {
+    TIME_LOG_ERROR << "[Cluster] Failed to create " << socket_dir << ".";
+  }
+  socket_dir_ = socket_dir;
+  for (int i = 0; i < num_of_replicas_; ++i) {
+    channels_.push_back(grpc::CreateChannel(
+        PaxosAddress(i), grpc::InsecureChannelCredentials()));
+  }
+}
+
+Cluster::~Cluster() {
+  for (int i = 0; i < num_of_replicas_; ++i) {
+    if (IsRunning(i)) Crash(i);
+    JoinTeardown(i);
+  }
+  // gRPC removes the socket files when the servers shut down.
+  rmdir(socket_dir_.c_str());
+}
+
+std::string Cluster::PaxosAddress(int index) const {
+  return "unix:" + socket_dir_ + "/replica-" + std::to_string(index) +
+         ".sock";
+}
+
+Status Cluster::Start() {
+  int phase1_quorum = 0;
+  int phase2_quorum = 0;
+  Status status = MultiPaxosServiceImpl::QuorumSizes(
+      num_of_replicas_, replica_config_.phase1_quorum(),
+      replica_config_.phase2_quorum(), &phase1_quorum, &phase2_quorum);
+  if (!status.ok()) return status;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (int i = 0; i < num_of_replicas_ && status.ok(); ++i) {
+      status = StartReplica(i);
+    }
+  }
+  for (int i = 0; i < num_of_replicas_; ++i) {
+    // Replicas left uninitialized after a failure can still be crashed.
+    if (status.ok()) {
+      status = InitializeReplica(i);
+    } else {
+      EndInitializing(i);
+    }
+  }
+  return status;
+}
+
+Status Cluster::Crash(int index) {
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    initialized_cv_.wait(lock, [this, index] { return !initializing_[index]; });
+    if (replicas_[index] == nullptr) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    PaxosAddress(index) + " is not running.");
+    }
+    // Shutting down waits for the handlers in flight, which may block for
+    // seconds on a replica that lost its quorum, so it runs in the
+    // background. The socket stops accepting calls as soon as it starts.
+    teardowns_[index] = std::thread(
+        [replica = std::move(replicas_[index])]() mutable {
+          // Cancels the calls in flight, like a process that died.
+          replica->server->Shutdown(std::chrono::system_clock::now());
+          replica.reset();
+        });
+  }
+  TIME_LOG << "[Cluster] Crashed " << PaxosAddress(index) << ".";
+  return Status::OK;
+}
+
+Status Cluster::Restart(int index) {
+  // The new server listens on the socket of the old one, so the old one
+  // must be gone first.
+  JoinTeardown(index);
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (replicas_[index] != nullptr) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    PaxosAddress(index) + " is already running.");
+    }
+    Status start_status = StartReplica(index);
+    if (!start_status.ok()) return start_status;
+  }
+  TIME_LOG << "[Cluster] Restarting " << PaxosAddress(index) << ".";
+  return InitializeReplica(index);
+}
+
+void Cluster::JoinTeardown(int index) {
+  std::thread teardown;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    teardown = std::move(teardowns_[index]);
+  }
+  if (teardown.joinable()) teardown.join();
+}
+
+bool Cluster::IsRunning(int index) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return replicas_[index] != nullptr;
+}
+
+int Cluster::GetCoordinatorIndex(int group) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  std::string coordinator;
+  int term = -1;
+  for (const auto& replica : replicas_) {
+    if (replica == nullptr) continue;
+    PaxosStubsMap* paxos_stubs_map = replica->paxos_stubs_maps[group].get();
+    int replica_term = paxos_stubs_map->GetCoordinatorTerm();
+    if (replica_term > term) {
+      term = replica_term;
+      coordinator = paxos_stubs_map->GetCoordinator();
+    }
+  }
+  for (int i = 0; i < num_of_replicas_; ++i) {
+    if (PaxosAddress(i) == coordinator) return i;
+  }
+  return -1;
+}
+
+std::shared_ptr<grpc::Channel> Cluster::GetChannel(int index) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return replicas_[index] != nullptr ? channels_[index] : nullptr;
+}
+
+std::string Cluster::GetStatsText(int index) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return replicas_[index] != nullptr ? replicas_[index]->stats.ToText() : "";
+}
+
+Status Cluster::StartReplica(int index) {
+  const ServerConfig& config = replica_config_;
+  const std::string paxos_address = PaxosAddress(index);
+  auto replica = std::make_unique<Replica>();
+  std::vector<PaxosStubsMap*> group_stubs_maps;
+  for (int group = 0; group < num_of_groups_; ++group) {
+    std::unique_ptr<WriteAheadLog> wal;
+    if (!wal_dir_.empty()) {
+      wal = std::make_unique<WriteAheadLog>(GroupWalPath(
+          wal_dir_ + "/replica-" + std::to_string(index) + ".wal", group));
+    }
+    replica->kv_dbs.push_back(std::make_unique<KeyValueDataBase>(wal.get()));
+    replica->wals.push_back(std::move(wal));
+    Status replay_status = replica->kv_dbs.back()->ReplayWal();
+    if (!replay_status.ok()) return replay_status;
+    PaxosStubs stubs;
+    for (int i = 0; i < num_of_replicas_; ++i) {
+      stubs[PaxosAddress(i)] =
+          MultiPaxos::NewStub(CreateGroupChannel(PaxosAddress(i), group));
+    }
+    replica->paxos_stubs_maps.push_back(
+        std::make_unique<PaxosStubsMap>(std::move(stubs)));
+    group_stubs_maps.push_back(replica->paxos_stubs_maps.back().get());
+  }
+  replica->liveness_tracker = std::make_unique<LivenessTracker>(
+      group_stubs_maps[0], &replica->stats,
+      std::chrono::milliseconds(config.heartbeat_interval_ms() > 0
+                                    ? config.heartbeat_interval_ms()
+                                    : 200),
+      std::chrono::milliseconds(config.heartbeat_timeout_ms() > 0
+                                    ? config.heartbeat_timeout_ms()
+                                    : 500),
+      /*suspicion_threshold=*/2);
+  replica->keyvaluestore_service = std::make_unique<KeyValueStoreServiceImpl>(
+      group_stubs_maps, &replica->stats, paxos_address, paxos_address,
+      config.follower_reads());
+  std::vector<MultiPaxosServiceImpl*> group_services;
+  for (int group = 0; group < num_of_groups_; ++group) {
+    replica->multi_paxos_services.push_back(
+        std::make_unique<MultiPaxosServiceImpl>(
+            group_stubs_maps[group], replica->liveness_tracker.get(),
+            replica->kv_dbs[group].get(), &replica->stats, paxos_address,
+            config.fail_rate(),
+            std::chrono::microseconds(config.batch_window_us()),
+            config.max_batch_size() > 0 ? config.max_batch_size() : 64,
+            config.pipeline_depth() > 0 ? config.pipeline_depth() : 4,
+            std::chrono::milliseconds(config.compaction_interval_ms() > 0
+                                          ? config.compaction_interval_ms()
+                                          : 1000),
+            config.compaction_retention() > 0 ? config.compaction_retention()
+                                              : 1000,
+            config.phase1_quorum(), config.phase2_quorum(),
+            config.thrifty_propose(),
+            std::chrono::milliseconds(config.thrifty_timeout_ms() > 0
+                                          ? config.thrifty_timeout_ms()
+                                          : 50)));
+    group_services.push_back(replica->multi_paxos_services.back().get());
+  }
+  replica->multi_paxos_router =
+      std::make_unique<MultiPaxosRouter>(std::move(group_services));
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(paxos_address, grpc::InsecureServerCredentials());
+  builder.RegisterService(replica->keyvaluestore_service.get());
+  builder.RegisterService(replica->multi_paxos_router.get());
+  replica->server = builder.BuildAndStart();
+  if (replica->server == nullptr) {
+    return Status(grpc::StatusCode::INTERNAL,
+                  "Failed to start " + paxos_address + ".");
+  }
+  replicas_[index] = std::move(replica);
+  initializing_[index] = true;
+  return Status::OK;
+}
+
+Status Cluster::InitializeReplica(int index) {
+  Replica* replica;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    replica = replicas_[index].get();
+  }
+  Status status = InitializeGroups(index, replica);
+  EndInitializing(index);
+  return status;
+}
+
+void Cluster::EndInitializing(int index) {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    initializing_[index] = false;
+  }
+  initialized_cv_.notify_all();
+}
+
+Status Cluster::InitializeGroups(int index, Replica* replica) {
+  // Learn which replicas are alive before taking part in Paxos runs.
+  replica->liveness_tracker->Start();
+  std::vector<std::string> replicas;
+  for (int i = 0; i < num_of_replicas_; ++i) {
+    replicas.push_back(PaxosAddress(i));
+  }
+  // Groups are initialized in parallel, like in a server. Each replica
+  // leads the groups it is the preferred leader of.
+  std::vector<Status> initialize_statuses(num_of_groups_);
+  std::vector<std::thread> initialize_threads;
+  for (int group = 0; group < num_of_groups_; ++group) {
+    bool lead = PreferredLeader(replicas, group) == PaxosAddress(index);
+    initialize_threads.emplace_back([&, group, lead]() {
+      initialize_statuses[group] =
+          replica->multi_paxos_services[group]->Initialize(lead);
+    });
+  }
+  for (auto& initialize_thread : initialize_threads) initialize_thread.join();
+  for (int group = 0; group < num_of_groups_; ++group) {
+    const Status& initialize_status = initialize_statuses[group];
+    if (!initialize_status.ok()) {
+      return Status(initialize_status.error_code(),
+                    PaxosAddress(index) + " failed to initialize group " +
+                        std::to_string(group) + ". " +
+                        initialize_status.error_message());
+    }
+  }
+  return Status::OK;
+}
+
+}  // namespace keyvaluestore
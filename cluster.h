@@ -0,0 +1,94 @@
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// Runs every replica of a keyvaluestore cluster in one process. Replicas
+// listen on Unix domain sockets in a private directory instead of ports, so
+// that runs need no network and never collide with other processes.
+//
+// Replicas can be crashed and restarted at any time. A crash shuts down the
+// replica's server and drops all of its state but its write-ahead log, if
+// any; a restart replays the log and rejoins like a restarted server.
+// Thread-safe.
+class Cluster {
+ public:
+  // replica_config holds the options of every replica, including the
+  // number of Paxos groups; its addresses and wal_path are ignored.
+  // Replicas keep their write-ahead logs in wal_dir, or no logs if it is
+  // empty.
+  Cluster(int num_of_replicas, const ServerConfig& replica_config,
+          const std::string& wal_dir);
+  ~Cluster();
+
+  // Starts every replica, then initializes them in order. The first one
+  // elects itself Coordinator.
+  grpc::Status Start();
+  // Waits for the replica at index to finish initializing, if it is.
+  grpc::Status Crash(int index);
+  grpc::Status Restart(int index);
+
+  int size() const { return num_of_replicas_; }
+  bool IsRunning(int index);
+  // Returns the index of the Coordinator of a Paxos group as seen by the
+  // running replicas, or -1 if none of them knows it.
+  int GetCoordinatorIndex(int group);
+  // Returns a channel to both services of a running replica, or nullptr if
+  // it is crashed.
+  std::shared_ptr<grpc::Channel> GetChannel(int index);
+  // Returns the Stats table of a running replica, or "" if it is crashed.
+  std::string GetStatsText(int index);
+
+  // Address both services of a replica listen on, e.g.
+  // "unix:/tmp/keyvaluestore-cluster-XXXXXX/replica-0.sock".
+  std::string PaxosAddress(int index) const;
+
+ private:
+  struct Replica;
+
+  // Builds and starts the replica at index, connects it with the others
+  // both ways, and marks it initializing. Requires mtx_.
+  grpc::Status StartReplica(int index);
+  // Initializes the replica at index, outside of mtx_: it talks to the
+  // others, which may call back into the cluster. Ends its initializing
+  // mark.
+  grpc::Status InitializeReplica(int index);
+  // Initializes every Paxos group of replica, in parallel.
+  grpc::Status InitializeGroups(int index, Replica* replica);
+  // Clears the initializing mark of the replica at index, and wakes Crash.
+  void EndInitializing(int index);
+  // Waits until the replica at index, if crashed, is fully torn down.
+  void JoinTeardown(int index);
+
+  const int num_of_replicas_;
+  const ServerConfig replica_config_;
+  const std::string wal_dir_;
+  const int num_of_groups_;
+  std::string socket_dir_;
+  // One channel per replica for the lifetime of the cluster. Like a channel
+  // to a remote server, it reconnects once a crashed replica restarts.
+  std::vector<std::shared_ptr<grpc::Channel>> channels_;
+  std::mutex mtx_;
+  std::vector<std::unique_ptr<Replica>> replicas_;
+  // Replicas started but not initialized yet. They are used outside of
+  // mtx_ meanwhile, so Crash waits for them.
+  std::vector<bool> initializing_;
+  std::condition_variable initialized_cv_;
+  // Threads tearing down crashed replicas, by index.
+  std::vector<std::thread> teardowns_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
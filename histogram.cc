@@ -0,0 +1,105 @@
+#include "histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace keyvaluestore {
+
+Histogram::Histogram() : counts_(kNumOfBuckets, 0) {}
+
+size_t Histogram::BucketIndex(uint64_t value) {
+  if (value < kSubBuckets) return value;
+  // value >> shift falls into [kSubBuckets, 2 * kSubBuckets).
+  int shift = 63 - __builtin_clzll(value) - kSubBucketBits;
+  return kSubBuckets * shift + (value >> shift);
+}
+
+uint64_t Histogram::BucketUpperBound(size_t index) {
+  if (index < kSubBuckets) return index;
+  int shift = index / kSubBuckets - 1;
+  uint64_t mantissa = index - kSubBuckets * shift;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void Histogram::Record(uint64_t value) {
+  ++counts_[BucketIndex(value)];
+  ++count_;
+  sum_ += value;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+}
+
+void Histogram::Merge(const Histogram& other) {
+  for (size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+  count_ += other.count_;
+  sum_ += other.sum_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+double Histogram::Mean() const {
+  return count_ > 0 ? static_cast<double>(sum_) / count_ : 0;
+}
+
+uint64_t Histogram::Percentile(double p) const {
+  if (count_ == 0) return 0;
+  uint64_t rank = std::max<uint64_t>(1, std::ceil(count_ * p / 100));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    seen += counts_[i];
+    if (seen >= rank) return std::min(BucketUpperBound(i), max_);
+  }
+  return max_;
+}
+
+std::string Histogram::ToJson() const {
+  char json[256];
+  snprintf(json, sizeof(json),
+           "{\"count\": %llu, \"mean\": %.1f, \"min\": %llu, \"p50\": %llu, "
+           "\"p90\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu}",
+           static_cast<unsigned long long>(count_), Mean(),
+           static_cast<unsigned long long>(Min()),
+           static_cast<unsigned long long>(Percentile(50)),
+           static_cast<unsigned long long>(Percentile(90)),
+           static_cast<unsigned long long>(Percentile(99)),
+           static_cast<unsigned long long>(Percentile(99.9)),
+           static_cast<unsigned long long>(max_));
+  return json;
+}
+
+ConcurrentHistogram::ConcurrentHistogram()
+    : counts_(new std::atomic<uint64_t>[Histogram::kNumOfBuckets]) {
+  for (size_t i = 0; i < Histogram::kNumOfBuckets; ++i) counts_[i] = 0;
+}
+
+void ConcurrentHistogram::Record(uint64_t value) {
+  counts_[Histogram::BucketIndex(value)].fetch_add(1,
+                                                   std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+  uint64_t min = min_.load(std::memory_order_relaxed);
+  while (value < min &&
+         !min_.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+  }
+  uint64_t max = max_.load(std::memory_order_relaxed);
+  while (value > max &&
+         !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+// Values recorded during the copy may be partly included, e.g. in sum_ but
+// not yet in their bucket. The count is taken from the buckets, so that
+// percentiles stay consistent.
+Histogram ConcurrentHistogram::Snapshot() const {
+  Histogram snapshot;
+  for (size_t i = 0; i < Histogram::kNumOfBuckets; ++i) {
+    snapshot.counts_[i] = counts_[i].load(std::memory_order_relaxed);
+    snapshot.count_ += snapshot.counts_[i];
+  }
+  snapshot.sum_ = sum_.load(std::memory_order_relaxed);
+  snapshot.min_ = min_.load(std::memory_order_relaxed);
+  snapshot.max_ = max_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+}  // namespace keyvaluestore
@@ -0,0 +1,77 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace keyvaluestore {
+
+// A histogram of non-negative values, e.g. latencies in microseconds.
+//
+// Buckets are log-linear: values below 2 * kSubBuckets get a bucket each, and
+// every higher power of two is split into kSubBuckets equal buckets. Memory
+// is fixed, and percentiles are accurate to within 1 / kSubBuckets (about 3%).
+// Not thread-safe.
+class Histogram {
+ public:
+  Histogram();
+
+  void Record(uint64_t value);
+  // Adds the values recorded in other.
+  void Merge(const Histogram& other);
+
+  uint64_t Count() const { return count_; }
+  uint64_t Min() const { return count_ > 0 ? min_ : 0; }
+  uint64_t Max() const { return max_; }
+  double Mean() const;
+  // Returns the value below which p percent of the values fall, p in
+  // [0, 100], rounded up to the bound of its bucket.
+  uint64_t Percentile(double p) const;
+
+  // Returns the summary as a JSON object of count, mean, min, p50, p90, p99,
+  // p999 and max.
+  std::string ToJson() const;
+
+ private:
+  friend class ConcurrentHistogram;
+
+  static constexpr int kSubBucketBits = 5;
+  static constexpr uint64_t kSubBuckets = 1 << kSubBucketBits;
+  // Values up to UINT64_MAX are shifted by at most 63 - kSubBucketBits.
+  static constexpr size_t kNumOfBuckets =
+      (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  static size_t BucketIndex(uint64_t value);
+  // Returns the largest value that falls into the bucket at index.
+  static uint64_t BucketUpperBound(size_t index);
+
+  std::vector<uint64_t> counts_;
+  uint64_t count_ = 0;
+  uint64_t sum_ = 0;
+  uint64_t min_ = UINT64_MAX;
+  uint64_t max_ = 0;
+};
+
+// A Histogram that many threads record into at once. Record is a few
+// relaxed atomic adds, without locks; Snapshot copies the values recorded so
+// far into a Histogram.
+class ConcurrentHistogram {
+ public:
+  ConcurrentHistogram();
+
+  void Record(uint64_t value);
+  Histogram Snapshot() const;
+
+ private:
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> min_{UINT64_MAX};
+  std::atomic<uint64_t> max_{0};
+};
+
+}  // namespace keyvaluestore
+
+#endif
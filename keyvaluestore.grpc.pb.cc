@@ -0,0 +1,768 @@
+#include "keyvaluestore.pb.h"
+#include "keyvaluestore.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
+
+namespace keyvaluestore {
+
+::grpc::Status KeyValueStore::Stub::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetValue_, context, request, response);
+}
+void KeyValueStore::Stub::async::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetValue_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetValue_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* KeyValueStore::Stub::PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::GetResponse, ::keyvaluestore::GetRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetValue_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* KeyValueStore::Stub::AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncGetValueRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status KeyValueStore::Stub::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::WriteToken* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::PutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PutPair_, context, request, response);
+}
+void KeyValueStore::Stub::async::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::PutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PutPair_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PutPair_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::WriteToken, ::keyvaluestore::PutRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PutPair_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncPutPairRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status KeyValueStore::Stub::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::WriteToken* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::DeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_DeletePair_, context, request, response);
+}
+void KeyValueStore::Stub::async::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::DeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeletePair_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeletePair_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::WriteToken, ::keyvaluestore::DeleteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_DeletePair_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncDeletePairRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status KeyValueStore::Stub::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MultiGet_, context, request, response);
+}
+void KeyValueStore::Stub::async::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGet_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGet_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* KeyValueStore::Stub::PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::MultiGetResponse, ::keyvaluestore::MultiGetRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MultiGet_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* KeyValueStore::Stub::AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncMultiGetRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status KeyValueStore::Stub::MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::keyvaluestore::WriteToken* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::MultiPutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MultiPut_, context, request, response);
+}
+void KeyValueStore::Stub::async::MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::MultiPutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiPut_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiPut_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::PrepareAsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::WriteToken, ::keyvaluestore::MultiPutRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MultiPut_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::AsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncMultiPutRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status KeyValueStore::Stub::MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::keyvaluestore::WriteToken* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::MultiDeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MultiDelete_, context, request, response);
+}
+void KeyValueStore::Stub::async::MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::MultiDeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiDelete_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiDelete_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::PrepareAsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::WriteToken, ::keyvaluestore::MultiDeleteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MultiDelete_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* KeyValueStore::Stub::AsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncMultiDeleteRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::ClientReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* KeyValueStore::Stub::WriteStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>::Create(channel_.get(), rpcmethod_WriteStream_, context);
+}
+void KeyValueStore::Stub::async::WriteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::keyvaluestore::WriteRequest,::keyvaluestore::WriteResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::keyvaluestore::WriteRequest,::keyvaluestore::WriteResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_WriteStream_, context, reactor);
+}
+::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* KeyValueStore::Stub::AsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>::Create(channel_.get(), cq, rpcmethod_WriteStream_, context, true, tag);
+}
+::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* KeyValueStore::Stub::PrepareAsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>::Create(channel_.get(), cq, rpcmethod_WriteStream_, context, false, nullptr);
+}
+::grpc::Status KeyValueStore::Stub::GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetLeaderResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetLeaderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetLeader_, context, request, response);
+}
+void KeyValueStore::Stub::async::GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetLeaderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetLeader_, context, request, response, std::move(f));
+}
+void KeyValueStore::Stub::async::GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetLeader_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>* KeyValueStore::Stub::PrepareAsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::GetLeaderResponse, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetLeader_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>* KeyValueStore::Stub::AsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncGetLeaderRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+static const char* KeyValueStore_method_names[] = {
+  "/keyvaluestore.KeyValueStore/GetValue",
+  "/keyvaluestore.KeyValueStore/PutPair",
+  "/keyvaluestore.KeyValueStore/DeletePair",
+  "/keyvaluestore.KeyValueStore/MultiGet",
+  "/keyvaluestore.KeyValueStore/MultiPut",
+  "/keyvaluestore.KeyValueStore/MultiDelete",
+  "/keyvaluestore.KeyValueStore/WriteStream",
+  "/keyvaluestore.KeyValueStore/GetLeader",
+};
+
+std::unique_ptr< KeyValueStore::Stub> KeyValueStore::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< KeyValueStore::Stub> stub(new KeyValueStore::Stub(channel, options));
+  return stub;
+}
+
+KeyValueStore::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetValue_(KeyValueStore_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_PutPair_(KeyValueStore_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_DeletePair_(KeyValueStore_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_MultiGet_(KeyValueStore_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_MultiPut_(KeyValueStore_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_MultiDelete_(KeyValueStore_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_WriteStream_(KeyValueStore_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel), rpcmethod_GetLeader_(KeyValueStore_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+KeyValueStore::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::GetRequest* req, ::keyvaluestore::GetResponse* resp) { return service->GetValue(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::PutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::PutRequest* req, ::keyvaluestore::WriteToken* resp) { return service->PutPair(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::DeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::DeleteRequest* req, ::keyvaluestore::WriteToken* resp) { return service->DeletePair(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::MultiGetRequest* req, ::keyvaluestore::MultiGetResponse* resp) { return service->MultiGet(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::MultiPutRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::MultiPutRequest* req, ::keyvaluestore::WriteToken* resp) { return service->MultiPut(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::MultiDeleteRequest, ::keyvaluestore::WriteToken, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::MultiDeleteRequest* req, ::keyvaluestore::WriteToken* resp) { return service->MultiDelete(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[6],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< KeyValueStore::Service, ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, ::grpc::ServerReaderWriter<::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* stream) { return service->WriteStream(ctx, stream); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetLeaderResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::EmptyMessage* req, ::keyvaluestore::GetLeaderResponse* resp) { return service->GetLeader(ctx, req, resp); }, this)));
+}
+
+KeyValueStore::Service::~Service() {
+}
+
+::grpc::Status KeyValueStore::Service::GetValue(::grpc::ServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::PutPair(::grpc::ServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::DeletePair(::grpc::ServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::MultiGet(::grpc::ServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::MultiPut(::grpc::ServerContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::MultiDelete(::grpc::ServerContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::WriteStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::GetLeader(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Stub::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetValue_, context, request, response);
+}
+void MultiPaxos::Stub::async::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetValue_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetValue_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* MultiPaxos::Stub::PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::GetResponse, ::keyvaluestore::GetRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetValue_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* MultiPaxos::Stub::AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncGetValueRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::CommitResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::PutRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PutPair_, context, request, response);
+}
+void MultiPaxos::Stub::async::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::PutRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PutPair_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PutPair_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::CommitResponse, ::keyvaluestore::PutRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PutPair_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncPutPairRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::CommitResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::DeleteRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_DeletePair_, context, request, response);
+}
+void MultiPaxos::Stub::async::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::DeleteRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeletePair_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeletePair_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::CommitResponse, ::keyvaluestore::DeleteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_DeletePair_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncDeletePairRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MultiGet_, context, request, response);
+}
+void MultiPaxos::Stub::async::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGet_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGet_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* MultiPaxos::Stub::PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::MultiGetResponse, ::keyvaluestore::MultiGetRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MultiGet_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* MultiPaxos::Stub::AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncMultiGetRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::keyvaluestore::CommitResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::WriteBatchRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_WriteBatch_, context, request, response);
+}
+void MultiPaxos::Stub::async::WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::WriteBatchRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteBatch_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_WriteBatch_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::PrepareAsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::CommitResponse, ::keyvaluestore::WriteBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_WriteBatch_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* MultiPaxos::Stub::AsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncWriteBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::keyvaluestore::EmptyMessage* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::ElectCoordinatorRequest, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ElectCoordinator_, context, request, response);
+}
+void MultiPaxos::Stub::async::ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::ElectCoordinatorRequest, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ElectCoordinator_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ElectCoordinator_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* MultiPaxos::Stub::PrepareAsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::EmptyMessage, ::keyvaluestore::ElectCoordinatorRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ElectCoordinator_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* MultiPaxos::Stub::AsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncElectCoordinatorRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetCoordinatorResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetCoordinatorResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetCoordinator_, context, request, response);
+}
+void MultiPaxos::Stub::async::GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetCoordinatorResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetCoordinator_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetCoordinator_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>* MultiPaxos::Stub::PrepareAsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::GetCoordinatorResponse, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetCoordinator_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>* MultiPaxos::Stub::AsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncGetCoordinatorRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::keyvaluestore::ReadIndexResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::ReadIndexRequest, ::keyvaluestore::ReadIndexResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReadIndex_, context, request, response);
+}
+void MultiPaxos::Stub::async::ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::ReadIndexRequest, ::keyvaluestore::ReadIndexResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadIndex_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReadIndex_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>* MultiPaxos::Stub::PrepareAsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::ReadIndexResponse, ::keyvaluestore::ReadIndexRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReadIndex_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>* MultiPaxos::Stub::AsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncReadIndexRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::keyvaluestore::PromiseResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::PrepareRequest, ::keyvaluestore::PromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Prepare_, context, request, response);
+}
+void MultiPaxos::Stub::async::Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::PrepareRequest, ::keyvaluestore::PromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Prepare_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Prepare_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>* MultiPaxos::Stub::PrepareAsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::PromiseResponse, ::keyvaluestore::PrepareRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Prepare_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>* MultiPaxos::Stub::AsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncPrepareRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::keyvaluestore::LeaderPromiseResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::LeaderPrepareRequest, ::keyvaluestore::LeaderPromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PrepareLeader_, context, request, response);
+}
+void MultiPaxos::Stub::async::PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::LeaderPrepareRequest, ::keyvaluestore::LeaderPromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PrepareLeader_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PrepareLeader_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>* MultiPaxos::Stub::PrepareAsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::LeaderPromiseResponse, ::keyvaluestore::LeaderPrepareRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PrepareLeader_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>* MultiPaxos::Stub::AsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncPrepareLeaderRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::keyvaluestore::AcceptResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::ProposeRequest, ::keyvaluestore::AcceptResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Propose_, context, request, response);
+}
+void MultiPaxos::Stub::async::Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::ProposeRequest, ::keyvaluestore::AcceptResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Propose_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Propose_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>* MultiPaxos::Stub::PrepareAsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::AcceptResponse, ::keyvaluestore::ProposeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Propose_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>* MultiPaxos::Stub::AsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncProposeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::keyvaluestore::InformResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::InformRequest, ::keyvaluestore::InformResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Inform_, context, request, response);
+}
+void MultiPaxos::Stub::async::Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::InformRequest, ::keyvaluestore::InformResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Inform_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Inform_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>* MultiPaxos::Stub::PrepareAsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::InformResponse, ::keyvaluestore::InformRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Inform_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>* MultiPaxos::Stub::AsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncInformRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::keyvaluestore::GetChosenResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::GetChosenRequest, ::keyvaluestore::GetChosenResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetChosen_, context, request, response);
+}
+void MultiPaxos::Stub::async::GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::GetChosenRequest, ::keyvaluestore::GetChosenResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChosen_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChosen_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>* MultiPaxos::Stub::PrepareAsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::GetChosenResponse, ::keyvaluestore::GetChosenRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetChosen_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>* MultiPaxos::Stub::AsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncGetChosenRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::Status MultiPaxos::Stub::Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::EmptyMessage* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Ping_, context, request, response);
+}
+void MultiPaxos::Stub::async::Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Ping_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Ping_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* MultiPaxos::Stub::PrepareAsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::EmptyMessage, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Ping_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* MultiPaxos::Stub::AsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncPingRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+::grpc::ClientReader< ::keyvaluestore::RecoverChunk>* MultiPaxos::Stub::RecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::keyvaluestore::RecoverChunk>::Create(channel_.get(), rpcmethod_Recover_, context, request);
+}
+void MultiPaxos::Stub::async::Recover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest* request, ::grpc::ClientReadReactor< ::keyvaluestore::RecoverChunk>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::keyvaluestore::RecoverChunk>::Create(stub_->channel_.get(), stub_->rpcmethod_Recover_, context, request, reactor);
+}
+::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>* MultiPaxos::Stub::AsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::keyvaluestore::RecoverChunk>::Create(channel_.get(), cq, rpcmethod_Recover_, context, request, true, tag);
+}
+::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>* MultiPaxos::Stub::PrepareAsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::keyvaluestore::RecoverChunk>::Create(channel_.get(), cq, rpcmethod_Recover_, context, request, false, nullptr);
+}
+::grpc::Status MultiPaxos::Stub::Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::StatsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Stats_, context, request, response);
+}
+void MultiPaxos::Stub::async::Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::keyvaluestore::EmptyMessage, ::keyvaluestore::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stats_, context, request, response, std::move(f));
+}
+void MultiPaxos::Stub::async::Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stats_, context, request, response, reactor);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>* MultiPaxos::Stub::PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::keyvaluestore::StatsResponse, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Stats_, context, request);
+}
+::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>* MultiPaxos::Stub::AsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) {
+  auto* result = this->PrepareAsyncStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+static const char* MultiPaxos_method_names[] = {
+  "/keyvaluestore.MultiPaxos/GetValue",
+  "/keyvaluestore.MultiPaxos/PutPair",
+  "/keyvaluestore.MultiPaxos/DeletePair",
+  "/keyvaluestore.MultiPaxos/MultiGet",
+  "/keyvaluestore.MultiPaxos/WriteBatch",
+  "/keyvaluestore.MultiPaxos/ElectCoordinator",
+  "/keyvaluestore.MultiPaxos/GetCoordinator",
+  "/keyvaluestore.MultiPaxos/ReadIndex",
+  "/keyvaluestore.MultiPaxos/Prepare",
+  "/keyvaluestore.MultiPaxos/PrepareLeader",
+  "/keyvaluestore.MultiPaxos/Propose",
+  "/keyvaluestore.MultiPaxos/Inform",
+  "/keyvaluestore.MultiPaxos/GetChosen",
+  "/keyvaluestore.MultiPaxos/Ping",
+  "/keyvaluestore.MultiPaxos/Recover",
+  "/keyvaluestore.MultiPaxos/Stats",
+};
+
+std::unique_ptr< MultiPaxos::Stub> MultiPaxos::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< MultiPaxos::Stub> stub(new MultiPaxos::Stub(channel, options));
+  return stub;
+}
+
+MultiPaxos::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetValue_(MultiPaxos_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_PutPair_(MultiPaxos_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_DeletePair_(MultiPaxos_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_MultiGet_(MultiPaxos_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_WriteBatch_(MultiPaxos_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_ElectCoordinator_(MultiPaxos_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_GetCoordinator_(MultiPaxos_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_ReadIndex_(MultiPaxos_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_Prepare_(MultiPaxos_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_PrepareLeader_(MultiPaxos_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_Propose_(MultiPaxos_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_Inform_(MultiPaxos_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_GetChosen_(MultiPaxos_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_Ping_(MultiPaxos_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel), rpcmethod_Recover_(MultiPaxos_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel), rpcmethod_Stats_(MultiPaxos_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+MultiPaxos::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::GetRequest* req, ::keyvaluestore::GetResponse* resp) { return service->GetValue(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::PutRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::PutRequest* req, ::keyvaluestore::CommitResponse* resp) { return service->PutPair(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::DeleteRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::DeleteRequest* req, ::keyvaluestore::CommitResponse* resp) { return service->DeletePair(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::MultiGetRequest* req, ::keyvaluestore::MultiGetResponse* resp) { return service->MultiGet(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::WriteBatchRequest, ::keyvaluestore::CommitResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::WriteBatchRequest* req, ::keyvaluestore::CommitResponse* resp) { return service->WriteBatch(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::ElectCoordinatorRequest, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::ElectCoordinatorRequest* req, ::keyvaluestore::EmptyMessage* resp) { return service->ElectCoordinator(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetCoordinatorResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::EmptyMessage* req, ::keyvaluestore::GetCoordinatorResponse* resp) { return service->GetCoordinator(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::ReadIndexRequest, ::keyvaluestore::ReadIndexResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::ReadIndexRequest* req, ::keyvaluestore::ReadIndexResponse* resp) { return service->ReadIndex(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::PrepareRequest, ::keyvaluestore::PromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::PrepareRequest* req, ::keyvaluestore::PromiseResponse* resp) { return service->Prepare(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::LeaderPrepareRequest, ::keyvaluestore::LeaderPromiseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::LeaderPrepareRequest* req, ::keyvaluestore::LeaderPromiseResponse* resp) { return service->PrepareLeader(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::ProposeRequest, ::keyvaluestore::AcceptResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::ProposeRequest* req, ::keyvaluestore::AcceptResponse* resp) { return service->Propose(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::InformRequest, ::keyvaluestore::InformResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::InformRequest* req, ::keyvaluestore::InformResponse* resp) { return service->Inform(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::GetChosenRequest, ::keyvaluestore::GetChosenResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::GetChosenRequest* req, ::keyvaluestore::GetChosenResponse* resp) { return service->GetChosen(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::EmptyMessage, ::keyvaluestore::EmptyMessage, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::EmptyMessage* req, ::keyvaluestore::EmptyMessage* resp) { return service->Ping(ctx, req, resp); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[14],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MultiPaxos::Service, ::keyvaluestore::RecoverRequest, ::keyvaluestore::RecoverChunk>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::RecoverRequest* req, ::grpc::ServerWriter<::keyvaluestore::RecoverChunk>* writer) { return service->Recover(ctx, req, writer); }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MultiPaxos_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MultiPaxos::Service, ::keyvaluestore::EmptyMessage, ::keyvaluestore::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MultiPaxos::Service* service, ::grpc::ServerContext* ctx, const ::keyvaluestore::EmptyMessage* req, ::keyvaluestore::StatsResponse* resp) { return service->Stats(ctx, req, resp); }, this)));
+}
+
+MultiPaxos::Service::~Service() {
+}
+
+::grpc::Status MultiPaxos::Service::GetValue(::grpc::ServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::PutPair(::grpc::ServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::DeletePair(::grpc::ServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::MultiGet(::grpc::ServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::WriteBatch(::grpc::ServerContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::ElectCoordinator(::grpc::ServerContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::GetCoordinator(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::ReadIndex(::grpc::ServerContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Prepare(::grpc::ServerContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::PrepareLeader(::grpc::ServerContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Propose(::grpc::ServerContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Inform(::grpc::ServerContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::GetChosen(::grpc::ServerContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Ping(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Recover(::grpc::ServerContext* context, const ::keyvaluestore::RecoverRequest* request, ::grpc::ServerWriter< ::keyvaluestore::RecoverChunk>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MultiPaxos::Service::Stats(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+}  // namespace keyvaluestore
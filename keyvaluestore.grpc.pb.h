@@ -0,0 +1,1513 @@
+#ifndef GRPC_keyvaluestore_2eproto__INCLUDED
+#define GRPC_keyvaluestore_2eproto__INCLUDED
+
+#include "keyvaluestore.pb.h"
+
+#include <functional>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
+
+namespace keyvaluestore {
+
+class KeyValueStore final {
+ public:
+  static constexpr char const* service_full_name() { return "keyvaluestore.KeyValueStore"; }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    virtual ::grpc::Status GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>> AsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>>(AsyncGetValueRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>> PrepareAsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>>(PrepareAsyncGetValueRaw(context, request, cq)); }
+    virtual ::grpc::Status PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::WriteToken* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> AsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(AsyncPutPairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> PrepareAsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(PrepareAsyncPutPairRaw(context, request, cq)); }
+    virtual ::grpc::Status DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::WriteToken* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> AsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(AsyncDeletePairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> PrepareAsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(PrepareAsyncDeletePairRaw(context, request, cq)); }
+    virtual ::grpc::Status MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>> AsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>>(AsyncMultiGetRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>> PrepareAsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>>(PrepareAsyncMultiGetRaw(context, request, cq)); }
+    virtual ::grpc::Status MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::keyvaluestore::WriteToken* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> AsyncMultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(AsyncMultiPutRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> PrepareAsyncMultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(PrepareAsyncMultiPutRaw(context, request, cq)); }
+    virtual ::grpc::Status MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::keyvaluestore::WriteToken* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> AsyncMultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(AsyncMultiDeleteRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>> PrepareAsyncMultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>>(PrepareAsyncMultiDeleteRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> WriteStream(::grpc::ClientContext* context) { return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(WriteStreamRaw(context)); }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> AsyncWriteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) { return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(AsyncWriteStreamRaw(context, cq, tag)); }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> PrepareAsyncWriteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(PrepareAsyncWriteStreamRaw(context, cq)); }
+    virtual ::grpc::Status GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetLeaderResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>> AsyncGetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>>(AsyncGetLeaderRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>> PrepareAsyncGetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>>(PrepareAsyncGetLeaderRaw(context, request, cq)); }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::keyvaluestore::WriteRequest,::keyvaluestore::WriteResponse>* reactor) = 0;
+      virtual void GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>* AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>* PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>* AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>* PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* AsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* PrepareAsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* AsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::WriteToken>* PrepareAsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* WriteStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* AsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* PrepareAsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>* AsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetLeaderResponse>* PrepareAsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>> AsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>>(AsyncGetValueRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>> PrepareAsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>>(PrepareAsyncGetValueRaw(context, request, cq)); }
+    ::grpc::Status PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::WriteToken* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> AsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(AsyncPutPairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> PrepareAsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(PrepareAsyncPutPairRaw(context, request, cq)); }
+    ::grpc::Status DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::WriteToken* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> AsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(AsyncDeletePairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> PrepareAsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(PrepareAsyncDeletePairRaw(context, request, cq)); }
+    ::grpc::Status MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>> AsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>>(AsyncMultiGetRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>> PrepareAsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>>(PrepareAsyncMultiGetRaw(context, request, cq)); }
+    ::grpc::Status MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::keyvaluestore::WriteToken* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> AsyncMultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(AsyncMultiPutRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> PrepareAsyncMultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(PrepareAsyncMultiPutRaw(context, request, cq)); }
+    ::grpc::Status MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::keyvaluestore::WriteToken* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> AsyncMultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(AsyncMultiDeleteRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>> PrepareAsyncMultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>>(PrepareAsyncMultiDeleteRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> WriteStream(::grpc::ClientContext* context) { return std::unique_ptr< ::grpc::ClientReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(WriteStreamRaw(context)); }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> AsyncWriteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) { return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(AsyncWriteStreamRaw(context, cq, tag)); }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>> PrepareAsyncWriteStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>>(PrepareAsyncWriteStreamRaw(context, cq)); }
+    ::grpc::Status GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetLeaderResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>> AsyncGetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>>(AsyncGetLeaderRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>> PrepareAsyncGetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>>(PrepareAsyncGetLeaderRaw(context, request, cq)); }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) override;
+      void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) override;
+      void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)>) override;
+      void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) override;
+      void MultiPut(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, std::function<void(::grpc::Status)>) override;
+      void MultiDelete(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::keyvaluestore::WriteRequest,::keyvaluestore::WriteResponse>* reactor) override;
+      void GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetLeader(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* AsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* PrepareAsyncMultiPutRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiPutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* AsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::WriteToken>* PrepareAsyncMultiDeleteRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* WriteStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* AsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* PrepareAsyncWriteStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>* AsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetLeaderResponse>* PrepareAsyncGetLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_GetValue_;
+    const ::grpc::internal::RpcMethod rpcmethod_PutPair_;
+    const ::grpc::internal::RpcMethod rpcmethod_DeletePair_;
+    const ::grpc::internal::RpcMethod rpcmethod_MultiGet_;
+    const ::grpc::internal::RpcMethod rpcmethod_MultiPut_;
+    const ::grpc::internal::RpcMethod rpcmethod_MultiDelete_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetLeader_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    virtual ::grpc::Status GetValue(::grpc::ServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response);
+    virtual ::grpc::Status PutPair(::grpc::ServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response);
+    virtual ::grpc::Status DeletePair(::grpc::ServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response);
+    virtual ::grpc::Status MultiGet(::grpc::ServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response);
+    virtual ::grpc::Status MultiPut(::grpc::ServerContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response);
+    virtual ::grpc::Status MultiDelete(::grpc::ServerContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response);
+    virtual ::grpc::Status WriteStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* stream);
+    virtual ::grpc::Status GetLeader(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetValue() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_GetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetValue(::grpc::ServerContext* context, ::keyvaluestore::GetRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::GetResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetValue() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response) { return this->GetValue(context, request, response); }));
+    }
+    ~WithCallbackMethod_GetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetValue(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_PutPair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PutPair() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_PutPair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutPair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPutPair(::grpc::ServerContext* context, ::keyvaluestore::PutRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::WriteToken>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_PutPair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PutPair() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::PutRequest, ::keyvaluestore::WriteToken>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::WriteToken* response) { return this->PutPair(context, request, response); }));
+    }
+    ~WithCallbackMethod_PutPair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutPair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* PutPair(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_DeletePair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_DeletePair() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_DeletePair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeletePair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDeletePair(::grpc::ServerContext* context, ::keyvaluestore::DeleteRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::WriteToken>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_DeletePair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_DeletePair() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::DeleteRequest, ::keyvaluestore::WriteToken>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::WriteToken* response) { return this->DeletePair(context, request, response); }));
+    }
+    ~WithCallbackMethod_DeletePair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeletePair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* DeletePair(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_MultiGet : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_MultiGet() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_MultiGet() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGet(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiGet(::grpc::ServerContext* context, ::keyvaluestore::MultiGetRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::MultiGetResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_MultiGet : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_MultiGet() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response) { return this->MultiGet(context, request, response); }));
+    }
+    ~WithCallbackMethod_MultiGet() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGet(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiGet(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_MultiPut : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_MultiPut() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_MultiPut() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiPut(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiPutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiPut(::grpc::ServerContext* context, ::keyvaluestore::MultiPutRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::WriteToken>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_MultiPut : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_MultiPut() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::MultiPutRequest, ::keyvaluestore::WriteToken>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::MultiPutRequest* request, ::keyvaluestore::WriteToken* response) { return this->MultiPut(context, request, response); }));
+    }
+    ~WithCallbackMethod_MultiPut() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiPut(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiPutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiPut(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::MultiPutRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_MultiDelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_MultiDelete() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_MultiDelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiDelete(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiDeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiDelete(::grpc::ServerContext* context, ::keyvaluestore::MultiDeleteRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::WriteToken>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_MultiDelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_MultiDelete() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::MultiDeleteRequest, ::keyvaluestore::WriteToken>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::MultiDeleteRequest* request, ::keyvaluestore::WriteToken* response) { return this->MultiDelete(context, request, response); }));
+    }
+    ~WithCallbackMethod_MultiDelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiDelete(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiDeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiDelete(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::MultiDeleteRequest* /*request*/, ::keyvaluestore::WriteToken* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteStream() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_WriteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* /*stream*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(6, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteStream() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackBidiHandler< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->WriteStream(context); }));
+    }
+    ~WithCallbackMethod_WriteStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::keyvaluestore::WriteResponse, ::keyvaluestore::WriteRequest>* /*stream*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::keyvaluestore::WriteRequest, ::keyvaluestore::WriteResponse>* WriteStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetLeader : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetLeader() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_GetLeader() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLeader(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetLeaderResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetLeader(::grpc::ServerContext* context, ::keyvaluestore::EmptyMessage* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::GetLeaderResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetLeader : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetLeader() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetLeaderResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetLeaderResponse* response) { return this->GetLeader(context, request, response); }));
+    }
+    ~WithCallbackMethod_GetLeader() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLeader(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetLeaderResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetLeader(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetLeaderResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithAsyncMethod_GetValue<WithAsyncMethod_PutPair<WithAsyncMethod_DeletePair<WithAsyncMethod_MultiGet<WithAsyncMethod_MultiPut<WithAsyncMethod_MultiDelete<WithAsyncMethod_WriteStream<WithAsyncMethod_GetLeader<Service > > > > > > > > AsyncService;
+  typedef WithCallbackMethod_GetValue<WithCallbackMethod_PutPair<WithCallbackMethod_DeletePair<WithCallbackMethod_MultiGet<WithCallbackMethod_MultiPut<WithCallbackMethod_MultiDelete<WithCallbackMethod_WriteStream<WithCallbackMethod_GetLeader<Service > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+};
+
+class MultiPaxos final {
+ public:
+  static constexpr char const* service_full_name() { return "keyvaluestore.MultiPaxos"; }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    virtual ::grpc::Status GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>> AsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>>(AsyncGetValueRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>> PrepareAsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>>(PrepareAsyncGetValueRaw(context, request, cq)); }
+    virtual ::grpc::Status PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::CommitResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> AsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(AsyncPutPairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> PrepareAsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(PrepareAsyncPutPairRaw(context, request, cq)); }
+    virtual ::grpc::Status DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::CommitResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> AsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(AsyncDeletePairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> PrepareAsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(PrepareAsyncDeletePairRaw(context, request, cq)); }
+    virtual ::grpc::Status MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>> AsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>>(AsyncMultiGetRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>> PrepareAsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>>(PrepareAsyncMultiGetRaw(context, request, cq)); }
+    virtual ::grpc::Status WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::keyvaluestore::CommitResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> AsyncWriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(AsyncWriteBatchRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>> PrepareAsyncWriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>>(PrepareAsyncWriteBatchRaw(context, request, cq)); }
+    virtual ::grpc::Status ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::keyvaluestore::EmptyMessage* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>> AsyncElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>>(AsyncElectCoordinatorRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>> PrepareAsyncElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>>(PrepareAsyncElectCoordinatorRaw(context, request, cq)); }
+    virtual ::grpc::Status GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetCoordinatorResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>> AsyncGetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>>(AsyncGetCoordinatorRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>> PrepareAsyncGetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>>(PrepareAsyncGetCoordinatorRaw(context, request, cq)); }
+    virtual ::grpc::Status ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::keyvaluestore::ReadIndexResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>> AsyncReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>>(AsyncReadIndexRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>> PrepareAsyncReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>>(PrepareAsyncReadIndexRaw(context, request, cq)); }
+    virtual ::grpc::Status Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::keyvaluestore::PromiseResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>> AsyncPrepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>>(AsyncPrepareRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>> PrepareAsyncPrepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>>(PrepareAsyncPrepareRaw(context, request, cq)); }
+    virtual ::grpc::Status PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::keyvaluestore::LeaderPromiseResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>> AsyncPrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>>(AsyncPrepareLeaderRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>> PrepareAsyncPrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>>(PrepareAsyncPrepareLeaderRaw(context, request, cq)); }
+    virtual ::grpc::Status Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::keyvaluestore::AcceptResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>> AsyncPropose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>>(AsyncProposeRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>> PrepareAsyncPropose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>>(PrepareAsyncProposeRaw(context, request, cq)); }
+    virtual ::grpc::Status Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::keyvaluestore::InformResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>> AsyncInform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>>(AsyncInformRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>> PrepareAsyncInform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>>(PrepareAsyncInformRaw(context, request, cq)); }
+    virtual ::grpc::Status GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::keyvaluestore::GetChosenResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>> AsyncGetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>>(AsyncGetChosenRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>> PrepareAsyncGetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>>(PrepareAsyncGetChosenRaw(context, request, cq)); }
+    virtual ::grpc::Status Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::EmptyMessage* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>> AsyncPing(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>>(AsyncPingRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>> PrepareAsyncPing(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>>(PrepareAsyncPingRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::keyvaluestore::RecoverChunk>> Recover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request) { return std::unique_ptr< ::grpc::ClientReaderInterface< ::keyvaluestore::RecoverChunk>>(RecoverRaw(context, request)); }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>> AsyncRecover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq, void* tag) { return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>>(AsyncRecoverRaw(context, request, cq, tag)); }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>> PrepareAsyncRecover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>>(PrepareAsyncRecoverRaw(context, request, cq)); }
+    virtual ::grpc::Status Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::StatsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>> AsyncStats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>>(AsyncStatsRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>> PrepareAsyncStats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>>(PrepareAsyncStatsRaw(context, request, cq)); }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Recover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest* request, ::grpc::ClientReadReactor< ::keyvaluestore::RecoverChunk>* reactor) = 0;
+      virtual void Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>* AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetResponse>* PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>* AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::MultiGetResponse>* PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* AsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::CommitResponse>* PrepareAsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>* AsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>* PrepareAsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>* AsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetCoordinatorResponse>* PrepareAsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>* AsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::ReadIndexResponse>* PrepareAsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>* AsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::PromiseResponse>* PrepareAsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>* AsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::LeaderPromiseResponse>* PrepareAsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>* AsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::AcceptResponse>* PrepareAsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>* AsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::InformResponse>* PrepareAsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>* AsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::GetChosenResponse>* PrepareAsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>* AsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::EmptyMessage>* PrepareAsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::keyvaluestore::RecoverChunk>* RecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>* AsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::keyvaluestore::RecoverChunk>* PrepareAsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>* AsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::keyvaluestore::StatsResponse>* PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::keyvaluestore::GetResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>> AsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>>(AsyncGetValueRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>> PrepareAsyncGetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>>(PrepareAsyncGetValueRaw(context, request, cq)); }
+    ::grpc::Status PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::keyvaluestore::CommitResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> AsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(AsyncPutPairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> PrepareAsyncPutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(PrepareAsyncPutPairRaw(context, request, cq)); }
+    ::grpc::Status DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::keyvaluestore::CommitResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> AsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(AsyncDeletePairRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> PrepareAsyncDeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(PrepareAsyncDeletePairRaw(context, request, cq)); }
+    ::grpc::Status MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::keyvaluestore::MultiGetResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>> AsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>>(AsyncMultiGetRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>> PrepareAsyncMultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>>(PrepareAsyncMultiGetRaw(context, request, cq)); }
+    ::grpc::Status WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::keyvaluestore::CommitResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> AsyncWriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(AsyncWriteBatchRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>> PrepareAsyncWriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>>(PrepareAsyncWriteBatchRaw(context, request, cq)); }
+    ::grpc::Status ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::keyvaluestore::EmptyMessage* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>> AsyncElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>>(AsyncElectCoordinatorRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>> PrepareAsyncElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>>(PrepareAsyncElectCoordinatorRaw(context, request, cq)); }
+    ::grpc::Status GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::GetCoordinatorResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>> AsyncGetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>>(AsyncGetCoordinatorRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>> PrepareAsyncGetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>>(PrepareAsyncGetCoordinatorRaw(context, request, cq)); }
+    ::grpc::Status ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::keyvaluestore::ReadIndexResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>> AsyncReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>>(AsyncReadIndexRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>> PrepareAsyncReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>>(PrepareAsyncReadIndexRaw(context, request, cq)); }
+    ::grpc::Status Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::keyvaluestore::PromiseResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>> AsyncPrepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>>(AsyncPrepareRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>> PrepareAsyncPrepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>>(PrepareAsyncPrepareRaw(context, request, cq)); }
+    ::grpc::Status PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::keyvaluestore::LeaderPromiseResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>> AsyncPrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>>(AsyncPrepareLeaderRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>> PrepareAsyncPrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>>(PrepareAsyncPrepareLeaderRaw(context, request, cq)); }
+    ::grpc::Status Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::keyvaluestore::AcceptResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>> AsyncPropose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>>(AsyncProposeRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>> PrepareAsyncPropose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>>(PrepareAsyncProposeRaw(context, request, cq)); }
+    ::grpc::Status Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::keyvaluestore::InformResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>> AsyncInform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>>(AsyncInformRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>> PrepareAsyncInform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>>(PrepareAsyncInformRaw(context, request, cq)); }
+    ::grpc::Status GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::keyvaluestore::GetChosenResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>> AsyncGetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>>(AsyncGetChosenRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>> PrepareAsyncGetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>>(PrepareAsyncGetChosenRaw(context, request, cq)); }
+    ::grpc::Status Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::EmptyMessage* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>> AsyncPing(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>>(AsyncPingRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>> PrepareAsyncPing(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>>(PrepareAsyncPingRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientReader< ::keyvaluestore::RecoverChunk>> Recover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request) { return std::unique_ptr< ::grpc::ClientReader< ::keyvaluestore::RecoverChunk>>(RecoverRaw(context, request)); }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>> AsyncRecover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq, void* tag) { return std::unique_ptr< ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>>(AsyncRecoverRaw(context, request, cq, tag)); }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>> PrepareAsyncRecover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>>(PrepareAsyncRecoverRaw(context, request, cq)); }
+    ::grpc::Status Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::keyvaluestore::StatsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>> AsyncStats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>>(AsyncStatsRaw(context, request, cq)); }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>> PrepareAsyncStats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) { return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>>(PrepareAsyncStatsRaw(context, request, cq)); }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetValue(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) override;
+      void PutPair(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) override;
+      void DeletePair(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, std::function<void(::grpc::Status)>) override;
+      void MultiGet(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, std::function<void(::grpc::Status)>) override;
+      void WriteBatch(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)>) override;
+      void ElectCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetCoordinator(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReadIndex(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, std::function<void(::grpc::Status)>) override;
+      void Prepare(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, std::function<void(::grpc::Status)>) override;
+      void PrepareLeader(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, std::function<void(::grpc::Status)>) override;
+      void Propose(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, std::function<void(::grpc::Status)>) override;
+      void Inform(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetChosen(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, std::function<void(::grpc::Status)>) override;
+      void Ping(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Recover(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest* request, ::grpc::ClientReadReactor< ::keyvaluestore::RecoverChunk>* reactor) override;
+      void Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, std::function<void(::grpc::Status)>) override;
+      void Stats(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* AsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetResponse>* PrepareAsyncGetValueRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* AsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* PrepareAsyncPutPairRaw(::grpc::ClientContext* context, const ::keyvaluestore::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* AsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* PrepareAsyncDeletePairRaw(::grpc::ClientContext* context, const ::keyvaluestore::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* AsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::MultiGetResponse>* PrepareAsyncMultiGetRaw(::grpc::ClientContext* context, const ::keyvaluestore::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* AsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::CommitResponse>* PrepareAsyncWriteBatchRaw(::grpc::ClientContext* context, const ::keyvaluestore::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* AsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* PrepareAsyncElectCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::ElectCoordinatorRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>* AsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetCoordinatorResponse>* PrepareAsyncGetCoordinatorRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>* AsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::ReadIndexResponse>* PrepareAsyncReadIndexRaw(::grpc::ClientContext* context, const ::keyvaluestore::ReadIndexRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>* AsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::PromiseResponse>* PrepareAsyncPrepareRaw(::grpc::ClientContext* context, const ::keyvaluestore::PrepareRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>* AsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::LeaderPromiseResponse>* PrepareAsyncPrepareLeaderRaw(::grpc::ClientContext* context, const ::keyvaluestore::LeaderPrepareRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>* AsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::AcceptResponse>* PrepareAsyncProposeRaw(::grpc::ClientContext* context, const ::keyvaluestore::ProposeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>* AsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::InformResponse>* PrepareAsyncInformRaw(::grpc::ClientContext* context, const ::keyvaluestore::InformRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>* AsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::GetChosenResponse>* PrepareAsyncGetChosenRaw(::grpc::ClientContext* context, const ::keyvaluestore::GetChosenRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* AsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::EmptyMessage>* PrepareAsyncPingRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::keyvaluestore::RecoverChunk>* RecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request) override;
+    ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>* AsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::keyvaluestore::RecoverChunk>* PrepareAsyncRecoverRaw(::grpc::ClientContext* context, const ::keyvaluestore::RecoverRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>* AsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::keyvaluestore::StatsResponse>* PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::keyvaluestore::EmptyMessage& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_GetValue_;
+    const ::grpc::internal::RpcMethod rpcmethod_PutPair_;
+    const ::grpc::internal::RpcMethod rpcmethod_DeletePair_;
+    const ::grpc::internal::RpcMethod rpcmethod_MultiGet_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_ElectCoordinator_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetCoordinator_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadIndex_;
+    const ::grpc::internal::RpcMethod rpcmethod_Prepare_;
+    const ::grpc::internal::RpcMethod rpcmethod_PrepareLeader_;
+    const ::grpc::internal::RpcMethod rpcmethod_Propose_;
+    const ::grpc::internal::RpcMethod rpcmethod_Inform_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetChosen_;
+    const ::grpc::internal::RpcMethod rpcmethod_Ping_;
+    const ::grpc::internal::RpcMethod rpcmethod_Recover_;
+    const ::grpc::internal::RpcMethod rpcmethod_Stats_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    virtual ::grpc::Status GetValue(::grpc::ServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response);
+    virtual ::grpc::Status PutPair(::grpc::ServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response);
+    virtual ::grpc::Status DeletePair(::grpc::ServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response);
+    virtual ::grpc::Status MultiGet(::grpc::ServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response);
+    virtual ::grpc::Status WriteBatch(::grpc::ServerContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response);
+    virtual ::grpc::Status ElectCoordinator(::grpc::ServerContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response);
+    virtual ::grpc::Status GetCoordinator(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response);
+    virtual ::grpc::Status ReadIndex(::grpc::ServerContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response);
+    virtual ::grpc::Status Prepare(::grpc::ServerContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response);
+    virtual ::grpc::Status PrepareLeader(::grpc::ServerContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response);
+    virtual ::grpc::Status Propose(::grpc::ServerContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response);
+    virtual ::grpc::Status Inform(::grpc::ServerContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response);
+    virtual ::grpc::Status GetChosen(::grpc::ServerContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response);
+    virtual ::grpc::Status Ping(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response);
+    virtual ::grpc::Status Recover(::grpc::ServerContext* context, const ::keyvaluestore::RecoverRequest* request, ::grpc::ServerWriter< ::keyvaluestore::RecoverChunk>* writer);
+    virtual ::grpc::Status Stats(::grpc::ServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetValue() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_GetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetValue(::grpc::ServerContext* context, ::keyvaluestore::GetRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::GetResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetValue() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::GetRequest, ::keyvaluestore::GetResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::GetRequest* request, ::keyvaluestore::GetResponse* response) { return this->GetValue(context, request, response); }));
+    }
+    ~WithCallbackMethod_GetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetValue(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::GetRequest* /*request*/, ::keyvaluestore::GetResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_PutPair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PutPair() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_PutPair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutPair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPutPair(::grpc::ServerContext* context, ::keyvaluestore::PutRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::CommitResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_PutPair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PutPair() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::PutRequest, ::keyvaluestore::CommitResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::PutRequest* request, ::keyvaluestore::CommitResponse* response) { return this->PutPair(context, request, response); }));
+    }
+    ~WithCallbackMethod_PutPair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PutPair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* PutPair(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::PutRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_DeletePair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_DeletePair() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_DeletePair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeletePair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDeletePair(::grpc::ServerContext* context, ::keyvaluestore::DeleteRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::CommitResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_DeletePair : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_DeletePair() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::DeleteRequest, ::keyvaluestore::CommitResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::DeleteRequest* request, ::keyvaluestore::CommitResponse* response) { return this->DeletePair(context, request, response); }));
+    }
+    ~WithCallbackMethod_DeletePair() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeletePair(::grpc::ServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* DeletePair(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::DeleteRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_MultiGet : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_MultiGet() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_MultiGet() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGet(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiGet(::grpc::ServerContext* context, ::keyvaluestore::MultiGetRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::MultiGetResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_MultiGet : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_MultiGet() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::MultiGetRequest, ::keyvaluestore::MultiGetResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::MultiGetRequest* request, ::keyvaluestore::MultiGetResponse* response) { return this->MultiGet(context, request, response); }));
+    }
+    ~WithCallbackMethod_MultiGet() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGet(::grpc::ServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiGet(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::MultiGetRequest* /*request*/, ::keyvaluestore::MultiGetResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteBatch() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_WriteBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatch(::grpc::ServerContext* /*context*/, const ::keyvaluestore::WriteBatchRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteBatch(::grpc::ServerContext* context, ::keyvaluestore::WriteBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::CommitResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteBatch() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::WriteBatchRequest, ::keyvaluestore::CommitResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::WriteBatchRequest* request, ::keyvaluestore::CommitResponse* response) { return this->WriteBatch(context, request, response); }));
+    }
+    ~WithCallbackMethod_WriteBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatch(::grpc::ServerContext* /*context*/, const ::keyvaluestore::WriteBatchRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* WriteBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::WriteBatchRequest* /*request*/, ::keyvaluestore::CommitResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ElectCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ElectCoordinator() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_ElectCoordinator() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ElectCoordinator(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ElectCoordinatorRequest* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestElectCoordinator(::grpc::ServerContext* context, ::keyvaluestore::ElectCoordinatorRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::EmptyMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ElectCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ElectCoordinator() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::ElectCoordinatorRequest, ::keyvaluestore::EmptyMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::ElectCoordinatorRequest* request, ::keyvaluestore::EmptyMessage* response) { return this->ElectCoordinator(context, request, response); }));
+    }
+    ~WithCallbackMethod_ElectCoordinator() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ElectCoordinator(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ElectCoordinatorRequest* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ElectCoordinator(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::ElectCoordinatorRequest* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetCoordinator() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_GetCoordinator() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetCoordinator(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetCoordinatorResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetCoordinator(::grpc::ServerContext* context, ::keyvaluestore::EmptyMessage* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::GetCoordinatorResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetCoordinator : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetCoordinator() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::EmptyMessage, ::keyvaluestore::GetCoordinatorResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::GetCoordinatorResponse* response) { return this->GetCoordinator(context, request, response); }));
+    }
+    ~WithCallbackMethod_GetCoordinator() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetCoordinator(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetCoordinatorResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetCoordinator(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::GetCoordinatorResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ReadIndex : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReadIndex() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_ReadIndex() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadIndex(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ReadIndexRequest* /*request*/, ::keyvaluestore::ReadIndexResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadIndex(::grpc::ServerContext* context, ::keyvaluestore::ReadIndexRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::ReadIndexResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadIndex : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadIndex() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::ReadIndexRequest, ::keyvaluestore::ReadIndexResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::ReadIndexRequest* request, ::keyvaluestore::ReadIndexResponse* response) { return this->ReadIndex(context, request, response); }));
+    }
+    ~WithCallbackMethod_ReadIndex() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadIndex(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ReadIndexRequest* /*request*/, ::keyvaluestore::ReadIndexResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReadIndex(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::ReadIndexRequest* /*request*/, ::keyvaluestore::ReadIndexResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Prepare : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Prepare() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_Prepare() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Prepare(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PrepareRequest* /*request*/, ::keyvaluestore::PromiseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPrepare(::grpc::ServerContext* context, ::keyvaluestore::PrepareRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::PromiseResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Prepare : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Prepare() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::PrepareRequest, ::keyvaluestore::PromiseResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::PrepareRequest* request, ::keyvaluestore::PromiseResponse* response) { return this->Prepare(context, request, response); }));
+    }
+    ~WithCallbackMethod_Prepare() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Prepare(::grpc::ServerContext* /*context*/, const ::keyvaluestore::PrepareRequest* /*request*/, ::keyvaluestore::PromiseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Prepare(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::PrepareRequest* /*request*/, ::keyvaluestore::PromiseResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_PrepareLeader : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PrepareLeader() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_PrepareLeader() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PrepareLeader(::grpc::ServerContext* /*context*/, const ::keyvaluestore::LeaderPrepareRequest* /*request*/, ::keyvaluestore::LeaderPromiseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPrepareLeader(::grpc::ServerContext* context, ::keyvaluestore::LeaderPrepareRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::LeaderPromiseResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_PrepareLeader : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PrepareLeader() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::LeaderPrepareRequest, ::keyvaluestore::LeaderPromiseResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::LeaderPrepareRequest* request, ::keyvaluestore::LeaderPromiseResponse* response) { return this->PrepareLeader(context, request, response); }));
+    }
+    ~WithCallbackMethod_PrepareLeader() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PrepareLeader(::grpc::ServerContext* /*context*/, const ::keyvaluestore::LeaderPrepareRequest* /*request*/, ::keyvaluestore::LeaderPromiseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* PrepareLeader(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::LeaderPrepareRequest* /*request*/, ::keyvaluestore::LeaderPromiseResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Propose : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Propose() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_Propose() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Propose(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ProposeRequest* /*request*/, ::keyvaluestore::AcceptResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPropose(::grpc::ServerContext* context, ::keyvaluestore::ProposeRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::AcceptResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Propose : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Propose() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::ProposeRequest, ::keyvaluestore::AcceptResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::ProposeRequest* request, ::keyvaluestore::AcceptResponse* response) { return this->Propose(context, request, response); }));
+    }
+    ~WithCallbackMethod_Propose() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Propose(::grpc::ServerContext* /*context*/, const ::keyvaluestore::ProposeRequest* /*request*/, ::keyvaluestore::AcceptResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Propose(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::ProposeRequest* /*request*/, ::keyvaluestore::AcceptResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Inform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Inform() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_Inform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Inform(::grpc::ServerContext* /*context*/, const ::keyvaluestore::InformRequest* /*request*/, ::keyvaluestore::InformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestInform(::grpc::ServerContext* context, ::keyvaluestore::InformRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::InformResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Inform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Inform() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::InformRequest, ::keyvaluestore::InformResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::InformRequest* request, ::keyvaluestore::InformResponse* response) { return this->Inform(context, request, response); }));
+    }
+    ~WithCallbackMethod_Inform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Inform(::grpc::ServerContext* /*context*/, const ::keyvaluestore::InformRequest* /*request*/, ::keyvaluestore::InformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Inform(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::InformRequest* /*request*/, ::keyvaluestore::InformResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetChosen : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetChosen() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_GetChosen() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChosen(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetChosenRequest* /*request*/, ::keyvaluestore::GetChosenResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetChosen(::grpc::ServerContext* context, ::keyvaluestore::GetChosenRequest* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::GetChosenResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetChosen : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetChosen() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::GetChosenRequest, ::keyvaluestore::GetChosenResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::GetChosenRequest* request, ::keyvaluestore::GetChosenResponse* response) { return this->GetChosen(context, request, response); }));
+    }
+    ~WithCallbackMethod_GetChosen() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChosen(::grpc::ServerContext* /*context*/, const ::keyvaluestore::GetChosenRequest* /*request*/, ::keyvaluestore::GetChosenResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetChosen(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::GetChosenRequest* /*request*/, ::keyvaluestore::GetChosenResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Ping() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_Ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Ping(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPing(::grpc::ServerContext* context, ::keyvaluestore::EmptyMessage* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::EmptyMessage>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Ping : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Ping() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::EmptyMessage, ::keyvaluestore::EmptyMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::EmptyMessage* response) { return this->Ping(context, request, response); }));
+    }
+    ~WithCallbackMethod_Ping() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Ping(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Ping(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::EmptyMessage* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Recover : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Recover() {
+      ::grpc::Service::MarkMethodAsync(14);
+    }
+    ~WithAsyncMethod_Recover() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Recover(::grpc::ServerContext* /*context*/, const ::keyvaluestore::RecoverRequest* /*request*/, ::grpc::ServerWriter< ::keyvaluestore::RecoverChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRecover(::grpc::ServerContext* context, ::keyvaluestore::RecoverRequest* request, ::grpc::ServerAsyncWriter< ::keyvaluestore::RecoverChunk>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(14, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Recover : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Recover() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::keyvaluestore::RecoverRequest, ::keyvaluestore::RecoverChunk>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::RecoverRequest* request) { return this->Recover(context, request); }));
+    }
+    ~WithCallbackMethod_Recover() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Recover(::grpc::ServerContext* /*context*/, const ::keyvaluestore::RecoverRequest* /*request*/, ::grpc::ServerWriter< ::keyvaluestore::RecoverChunk>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::keyvaluestore::RecoverChunk>* Recover(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::RecoverRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Stats() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStats(::grpc::ServerContext* context, ::keyvaluestore::EmptyMessage* request, ::grpc::ServerAsyncResponseWriter< ::keyvaluestore::StatsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Stats() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::keyvaluestore::EmptyMessage, ::keyvaluestore::StatsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::keyvaluestore::EmptyMessage* request, ::keyvaluestore::StatsResponse* response) { return this->Stats(context, request, response); }));
+    }
+    ~WithCallbackMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Stats(
+      ::grpc::CallbackServerContext* /*context*/, const ::keyvaluestore::EmptyMessage* /*request*/, ::keyvaluestore::StatsResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithAsyncMethod_GetValue<WithAsyncMethod_PutPair<WithAsyncMethod_DeletePair<WithAsyncMethod_MultiGet<WithAsyncMethod_WriteBatch<WithAsyncMethod_ElectCoordinator<WithAsyncMethod_GetCoordinator<WithAsyncMethod_ReadIndex<WithAsyncMethod_Prepare<WithAsyncMethod_PrepareLeader<WithAsyncMethod_Propose<WithAsyncMethod_Inform<WithAsyncMethod_GetChosen<WithAsyncMethod_Ping<WithAsyncMethod_Recover<WithAsyncMethod_Stats<Service > > > > > > > > > > > > > > > > AsyncService;
+  typedef WithCallbackMethod_GetValue<WithCallbackMethod_PutPair<WithCallbackMethod_DeletePair<WithCallbackMethod_MultiGet<WithCallbackMethod_WriteBatch<WithCallbackMethod_ElectCoordinator<WithCallbackMethod_GetCoordinator<WithCallbackMethod_ReadIndex<WithCallbackMethod_Prepare<WithCallbackMethod_PrepareLeader<WithCallbackMethod_Propose<WithCallbackMethod_Inform<WithCallbackMethod_GetChosen<WithCallbackMethod_Ping<WithCallbackMethod_Recover<WithCallbackMethod_Stats<Service > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+};
+
+}  // namespace keyvaluestore
+
+
+#endif  // GRPC_keyvaluestore_2eproto__INCLUDED
@@ -0,0 +1,14433 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: keyvaluestore.proto
+
+#include "keyvaluestore.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace keyvaluestore {
+PROTOBUF_CONSTEXPR EmptyMessage::EmptyMessage(
+    ::_pbi::ConstantInitialized) {}
+struct EmptyMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmptyMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmptyMessageDefaultTypeInternal() {}
+  union {
+    EmptyMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyMessageDefaultTypeInternal _EmptyMessage_default_instance_;
+PROTOBUF_CONSTEXPR ServerConfig::ServerConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.replica_)*/{}
+  , /*decltype(_impl_.my_addr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.my_paxos_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.wal_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_level_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.fail_rate_)*/0
+  , /*decltype(_impl_.heartbeat_interval_ms_)*/0
+  , /*decltype(_impl_.heartbeat_timeout_ms_)*/0
+  , /*decltype(_impl_.batch_window_us_)*/0
+  , /*decltype(_impl_.max_batch_size_)*/0
+  , /*decltype(_impl_.pipeline_depth_)*/0
+  , /*decltype(_impl_.compaction_interval_ms_)*/0
+  , /*decltype(_impl_.compaction_retention_)*/0
+  , /*decltype(_impl_.num_groups_)*/0
+  , /*decltype(_impl_.phase1_quorum_)*/0
+  , /*decltype(_impl_.phase2_quorum_)*/0
+  , /*decltype(_impl_.thrifty_timeout_ms_)*/0
+  , /*decltype(_impl_.thrifty_propose_)*/false
+  , /*decltype(_impl_.follower_reads_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerConfigDefaultTypeInternal() {}
+  union {
+    ServerConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerConfigDefaultTypeInternal _ServerConfig_default_instance_;
+PROTOBUF_CONSTEXPR BenchConfig::BenchConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.server_)*/{}
+  , /*decltype(_impl_.distribution_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_clients_)*/0
+  , /*decltype(_impl_.outstanding_)*/0
+  , /*decltype(_impl_.duration_s_)*/0
+  , /*decltype(_impl_.warmup_s_)*/0
+  , /*decltype(_impl_.read_ratio_)*/0
+  , /*decltype(_impl_.num_keys_)*/0
+  , /*decltype(_impl_.value_size_)*/0
+  , /*decltype(_impl_.zipf_theta_)*/0
+  , /*decltype(_impl_.seed_)*/int64_t{0}
+  , /*decltype(_impl_.skip_load_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BenchConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchConfigDefaultTypeInternal() {}
+  union {
+    BenchConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchConfigDefaultTypeInternal _BenchConfig_default_instance_;
+PROTOBUF_CONSTEXPR ClusterEvent::ClusterEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.at_ms_)*/0
+  , /*decltype(_impl_.replica_)*/0
+  , /*decltype(_impl_.restart_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClusterEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClusterEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClusterEventDefaultTypeInternal() {}
+  union {
+    ClusterEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClusterEventDefaultTypeInternal _ClusterEvent_default_instance_;
+PROTOBUF_CONSTEXPR ClusterBenchConfig::ClusterBenchConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.wal_dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.replica_config_)*/nullptr
+  , /*decltype(_impl_.num_replicas_)*/0
+  , /*decltype(_impl_.num_clients_)*/0
+  , /*decltype(_impl_.read_ratio_)*/0
+  , /*decltype(_impl_.duration_s_)*/0
+  , /*decltype(_impl_.num_keys_)*/0
+  , /*decltype(_impl_.value_size_)*/0
+  , /*decltype(_impl_.session_reads_)*/false
+  , /*decltype(_impl_.seed_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClusterBenchConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClusterBenchConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClusterBenchConfigDefaultTypeInternal() {}
+  union {
+    ClusterBenchConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClusterBenchConfigDefaultTypeInternal _ClusterBenchConfig_default_instance_;
+PROTOBUF_CONSTEXPR GetRequest::GetRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.min_version_)*/nullptr
+  , /*decltype(_impl_.min_slot_)*/0} {}
+struct GetRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetRequestDefaultTypeInternal() {}
+  union {
+    GetRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRequestDefaultTypeInternal _GetRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetResponse::GetResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetResponseDefaultTypeInternal() {}
+  union {
+    GetResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetResponseDefaultTypeInternal _GetResponse_default_instance_;
+PROTOBUF_CONSTEXPR PutRequest::PutRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutRequestDefaultTypeInternal() {}
+  union {
+    PutRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutRequestDefaultTypeInternal _PutRequest_default_instance_;
+PROTOBUF_CONSTEXPR DeleteRequest::DeleteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteRequestDefaultTypeInternal() {}
+  union {
+    DeleteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
+PROTOBUF_CONSTEXPR MultiGetRequest::MultiGetRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.min_version_)*/nullptr
+  , /*decltype(_impl_.min_slot_)*/0} {}
+struct MultiGetRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiGetRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiGetRequestDefaultTypeInternal() {}
+  union {
+    MultiGetRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiGetRequestDefaultTypeInternal _MultiGetRequest_default_instance_;
+PROTOBUF_CONSTEXPR KeyValue::KeyValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.found_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KeyValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KeyValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KeyValueDefaultTypeInternal() {}
+  union {
+    KeyValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+PROTOBUF_CONSTEXPR MultiGetResponse::MultiGetResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pairs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiGetResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiGetResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiGetResponseDefaultTypeInternal() {}
+  union {
+    MultiGetResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiGetResponseDefaultTypeInternal _MultiGetResponse_default_instance_;
+PROTOBUF_CONSTEXPR MultiPutRequest::MultiPutRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pairs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiPutRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiPutRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiPutRequestDefaultTypeInternal() {}
+  union {
+    MultiPutRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiPutRequestDefaultTypeInternal _MultiPutRequest_default_instance_;
+PROTOBUF_CONSTEXPR MultiDeleteRequest::MultiDeleteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiDeleteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiDeleteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiDeleteRequestDefaultTypeInternal() {}
+  union {
+    MultiDeleteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiDeleteRequestDefaultTypeInternal _MultiDeleteRequest_default_instance_;
+PROTOBUF_CONSTEXPR WriteRequest::WriteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteRequestDefaultTypeInternal() {}
+  union {
+    WriteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteRequestDefaultTypeInternal _WriteRequest_default_instance_;
+PROTOBUF_CONSTEXPR WriteResponse::WriteResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.token_)*/nullptr
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteResponseDefaultTypeInternal() {}
+  union {
+    WriteResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteResponseDefaultTypeInternal _WriteResponse_default_instance_;
+PROTOBUF_CONSTEXPR WriteBatchRequest::WriteBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteBatchRequestDefaultTypeInternal() {}
+  union {
+    WriteBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteBatchRequestDefaultTypeInternal _WriteBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR CommitResponse::CommitResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitResponseDefaultTypeInternal() {}
+  union {
+    CommitResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitResponseDefaultTypeInternal _CommitResponse_default_instance_;
+PROTOBUF_CONSTEXPR WriteToken_SlotsEntry_DoNotUse::WriteToken_SlotsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    WriteToken_SlotsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal _WriteToken_SlotsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR WriteToken::WriteToken(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteTokenDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteTokenDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteTokenDefaultTypeInternal() {}
+  union {
+    WriteToken _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteTokenDefaultTypeInternal _WriteToken_default_instance_;
+PROTOBUF_CONSTEXPR ElectCoordinatorRequest::ElectCoordinatorRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.coordinator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ElectCoordinatorRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ElectCoordinatorRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ElectCoordinatorRequestDefaultTypeInternal() {}
+  union {
+    ElectCoordinatorRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ElectCoordinatorRequestDefaultTypeInternal _ElectCoordinatorRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetCoordinatorResponse::GetCoordinatorResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.coordinator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetCoordinatorResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetCoordinatorResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetCoordinatorResponseDefaultTypeInternal() {}
+  union {
+    GetCoordinatorResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCoordinatorResponseDefaultTypeInternal _GetCoordinatorResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetLeaderResponse::GetLeaderResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.groups_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetLeaderResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetLeaderResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetLeaderResponseDefaultTypeInternal() {}
+  union {
+    GetLeaderResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetLeaderResponseDefaultTypeInternal _GetLeaderResponse_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexRequest::ReadIndexRequest(
+    ::_pbi::ConstantInitialized) {}
+struct ReadIndexRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexRequestDefaultTypeInternal() {}
+  union {
+    ReadIndexRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexRequestDefaultTypeInternal _ReadIndexRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexResponse::ReadIndexResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadIndexResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexResponseDefaultTypeInternal() {}
+  union {
+    ReadIndexResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexResponseDefaultTypeInternal _ReadIndexResponse_default_instance_;
+PROTOBUF_CONSTEXPR Operation::Operation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OperationDefaultTypeInternal() {}
+  union {
+    Operation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationDefaultTypeInternal _Operation_default_instance_;
+PROTOBUF_CONSTEXPR PrepareRequest::PrepareRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_.propose_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrepareRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrepareRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrepareRequestDefaultTypeInternal() {}
+  union {
+    PrepareRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrepareRequestDefaultTypeInternal _PrepareRequest_default_instance_;
+PROTOBUF_CONSTEXPR PromiseResponse::PromiseResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_.propose_id_)*/0
+  , /*decltype(_impl_.accepted_id_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PromiseResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PromiseResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PromiseResponseDefaultTypeInternal() {}
+  union {
+    PromiseResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PromiseResponseDefaultTypeInternal _PromiseResponse_default_instance_;
+PROTOBUF_CONSTEXPR ProposeRequest::ProposeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_.propose_id_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ProposeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProposeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProposeRequestDefaultTypeInternal() {}
+  union {
+    ProposeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProposeRequestDefaultTypeInternal _ProposeRequest_default_instance_;
+PROTOBUF_CONSTEXPR AcceptResponse::AcceptResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_.propose_id_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AcceptResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AcceptResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AcceptResponseDefaultTypeInternal() {}
+  union {
+    AcceptResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AcceptResponseDefaultTypeInternal _AcceptResponse_default_instance_;
+PROTOBUF_CONSTEXPR InformRequest::InformRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.acceptance_)*/nullptr
+  , /*decltype(_impl_.compactable_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InformRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InformRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InformRequestDefaultTypeInternal() {}
+  union {
+    InformRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InformRequestDefaultTypeInternal _InformRequest_default_instance_;
+PROTOBUF_CONSTEXPR InformResponse::InformResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.applied_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InformResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InformResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InformResponseDefaultTypeInternal() {}
+  union {
+    InformResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InformResponseDefaultTypeInternal _InformResponse_default_instance_;
+PROTOBUF_CONSTEXPR PaxosLog::PaxosLog(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.accepted_operations_)*/{}
+  , /*decltype(_impl_.accepted_value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.promised_id_)*/0
+  , /*decltype(_impl_.accepted_id_)*/0
+  , /*decltype(_impl_.accepted_type_)*/0
+  , /*decltype(_impl_.chosen_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PaxosLogDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PaxosLogDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PaxosLogDefaultTypeInternal() {}
+  union {
+    PaxosLog _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PaxosLogDefaultTypeInternal _PaxosLog_default_instance_;
+PROTOBUF_CONSTEXPR LeaderPrepareRequest::LeaderPrepareRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ballot_)*/0
+  , /*decltype(_impl_.from_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LeaderPrepareRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LeaderPrepareRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LeaderPrepareRequestDefaultTypeInternal() {}
+  union {
+    LeaderPrepareRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LeaderPrepareRequestDefaultTypeInternal _LeaderPrepareRequest_default_instance_;
+PROTOBUF_CONSTEXPR LeaderPromiseResponse_Accepted::LeaderPromiseResponse_Accepted(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.log_)*/nullptr
+  , /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LeaderPromiseResponse_AcceptedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LeaderPromiseResponse_AcceptedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LeaderPromiseResponse_AcceptedDefaultTypeInternal() {}
+  union {
+    LeaderPromiseResponse_Accepted _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LeaderPromiseResponse_AcceptedDefaultTypeInternal _LeaderPromiseResponse_Accepted_default_instance_;
+PROTOBUF_CONSTEXPR LeaderPromiseResponse::LeaderPromiseResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.accepted_)*/{}
+  , /*decltype(_impl_.ballot_)*/0
+  , /*decltype(_impl_.compacted_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LeaderPromiseResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LeaderPromiseResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LeaderPromiseResponseDefaultTypeInternal() {}
+  union {
+    LeaderPromiseResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LeaderPromiseResponseDefaultTypeInternal _LeaderPromiseResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetChosenRequest::GetChosenRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_slot_)*/0
+  , /*decltype(_impl_.to_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetChosenRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetChosenRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetChosenRequestDefaultTypeInternal() {}
+  union {
+    GetChosenRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetChosenRequestDefaultTypeInternal _GetChosenRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetChosenResponse::GetChosenResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slots_)*/{}
+  , /*decltype(_impl_.compacted_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetChosenResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetChosenResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetChosenResponseDefaultTypeInternal() {}
+  union {
+    GetChosenResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetChosenResponseDefaultTypeInternal _GetChosenResponse_default_instance_;
+PROTOBUF_CONSTEXPR RecoverRequest::RecoverRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.applied_slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecoverRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverRequestDefaultTypeInternal() {}
+  union {
+    RecoverRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverRequestDefaultTypeInternal _RecoverRequest_default_instance_;
+PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    RecoverChunk_PaxosLogs_LogsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal _RecoverChunk_PaxosLogs_LogsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogs::RecoverChunk_PaxosLogs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.logs_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecoverChunk_PaxosLogsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverChunk_PaxosLogsDefaultTypeInternal() {}
+  union {
+    RecoverChunk_PaxosLogs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverChunk_PaxosLogsDefaultTypeInternal _RecoverChunk_PaxosLogs_default_instance_;
+PROTOBUF_CONSTEXPR RecoverChunk_KvMapEntry_DoNotUse::RecoverChunk_KvMapEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    RecoverChunk_KvMapEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal _RecoverChunk_KvMapEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogsEntry_DoNotUse::RecoverChunk_PaxosLogsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    RecoverChunk_PaxosLogsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal _RecoverChunk_PaxosLogsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR RecoverChunk::RecoverChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kv_map_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.paxos_logs_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.applied_slot_)*/0
+  , /*decltype(_impl_.data_complete_)*/false
+  , /*decltype(_impl_.incremental_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecoverChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoverChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoverChunkDefaultTypeInternal() {}
+  union {
+    RecoverChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoverChunkDefaultTypeInternal _RecoverChunk_default_instance_;
+PROTOBUF_CONSTEXPR LatencySummary::LatencySummary(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.min_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencySummaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencySummaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencySummaryDefaultTypeInternal() {}
+  union {
+    LatencySummary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencySummaryDefaultTypeInternal _LatencySummary_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse_CountersEntry_DoNotUse::StatsResponse_CountersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    StatsResponse_CountersEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal _StatsResponse_CountersEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse_LatenciesUsEntry_DoNotUse::StatsResponse_LatenciesUsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    StatsResponse_LatenciesUsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal _StatsResponse_LatenciesUsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse::StatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.counters_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.latencies_us_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponseDefaultTypeInternal() {}
+  union {
+    StatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord_PaxosLogEntry::WalRecord_PaxosLogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_)*/nullptr
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalRecord_PaxosLogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecord_PaxosLogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecord_PaxosLogEntryDefaultTypeInternal() {}
+  union {
+    WalRecord_PaxosLogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecord_PaxosLogEntryDefaultTypeInternal _WalRecord_PaxosLogEntry_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord_Applied::WalRecord_Applied(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalRecord_AppliedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecord_AppliedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecord_AppliedDefaultTypeInternal() {}
+  union {
+    WalRecord_Applied _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecord_AppliedDefaultTypeInternal _WalRecord_Applied_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord_Snapshot_KvMapEntry_DoNotUse::WalRecord_Snapshot_KvMapEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    WalRecord_Snapshot_KvMapEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal _WalRecord_Snapshot_KvMapEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord_Snapshot::WalRecord_Snapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kv_map_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.applied_slot_)*/0
+  , /*decltype(_impl_.continued_)*/false
+  , /*decltype(_impl_.incomplete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalRecord_SnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecord_SnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecord_SnapshotDefaultTypeInternal() {}
+  union {
+    WalRecord_Snapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecord_SnapshotDefaultTypeInternal _WalRecord_Snapshot_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord_Compaction::WalRecord_Compaction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.round_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalRecord_CompactionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecord_CompactionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecord_CompactionDefaultTypeInternal() {}
+  union {
+    WalRecord_Compaction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecord_CompactionDefaultTypeInternal _WalRecord_Compaction_default_instance_;
+PROTOBUF_CONSTEXPR WalRecord::WalRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.record_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct WalRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalRecordDefaultTypeInternal() {}
+  union {
+    WalRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalRecordDefaultTypeInternal _WalRecord_default_instance_;
+}  // namespace keyvaluestore
+static ::_pb::Metadata file_level_metadata_keyvaluestore_2eproto[54];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_keyvaluestore_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_keyvaluestore_2eproto = nullptr;
+
+const uint32_t TableStruct_keyvaluestore_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::EmptyMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.my_addr_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.my_paxos_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.fail_rate_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.replica_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.heartbeat_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.heartbeat_timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.batch_window_us_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.max_batch_size_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.pipeline_depth_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.wal_path_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.compaction_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.compaction_retention_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.log_level_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.num_groups_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.phase1_quorum_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.phase2_quorum_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.thrifty_propose_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.thrifty_timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ServerConfig, _impl_.follower_reads_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.server_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.num_clients_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.outstanding_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.duration_s_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.warmup_s_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.read_ratio_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.num_keys_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.distribution_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.zipf_theta_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.value_size_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.skip_load_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::BenchConfig, _impl_.seed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterEvent, _impl_.at_ms_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterEvent, _impl_.replica_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterEvent, _impl_.restart_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.num_replicas_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.replica_config_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.wal_dir_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.num_clients_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.duration_s_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.read_ratio_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.num_keys_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.value_size_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.seed_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ClusterBenchConfig, _impl_.session_reads_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetRequest, _impl_.min_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetRequest, _impl_.min_version_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetResponse, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PutRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PutRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PutRequest, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::DeleteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::DeleteRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetRequest, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetRequest, _impl_.min_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetRequest, _impl_.min_version_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::KeyValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::KeyValue, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::KeyValue, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::KeyValue, _impl_.found_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiGetResponse, _impl_.pairs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiPutRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiPutRequest, _impl_.pairs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiDeleteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::MultiDeleteRequest, _impl_.keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteRequest, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteRequest, _impl_.operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteResponse, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteResponse, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteResponse, _impl_.error_message_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteResponse, _impl_.token_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteBatchRequest, _impl_.operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::CommitResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::CommitResponse, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken_SlotsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken_SlotsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken_SlotsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken_SlotsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WriteToken, _impl_.slots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ElectCoordinatorRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ElectCoordinatorRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ElectCoordinatorRequest, _impl_.coordinator_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetCoordinatorResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetCoordinatorResponse, _impl_.coordinator_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetCoordinatorResponse, _impl_.term_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetLeaderResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetLeaderResponse, _impl_.groups_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ReadIndexRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ReadIndexResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ReadIndexResponse, _impl_.slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::Operation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::Operation, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::Operation, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::Operation, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PrepareRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PrepareRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PrepareRequest, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PrepareRequest, _impl_.propose_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _impl_.propose_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _impl_.accepted_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PromiseResponse, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.propose_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::ProposeRequest, _impl_.operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _impl_.propose_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::AcceptResponse, _impl_.operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformRequest, _impl_.acceptance_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformRequest, _impl_.compactable_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::InformResponse, _impl_.applied_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.promised_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.accepted_id_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.accepted_type_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.accepted_value_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.chosen_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::PaxosLog, _impl_.accepted_operations_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPrepareRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPrepareRequest, _impl_.ballot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPrepareRequest, _impl_.from_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse_Accepted, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse_Accepted, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse_Accepted, _impl_.log_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse, _impl_.ballot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse, _impl_.accepted_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LeaderPromiseResponse, _impl_.compacted_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenRequest, _impl_.from_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenRequest, _impl_.to_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenResponse, _impl_.slots_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::GetChosenResponse, _impl_.compacted_slot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverRequest, _impl_.applied_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogs, _impl_.logs_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _impl_.kv_map_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _impl_.paxos_logs_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _impl_.applied_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _impl_.data_complete_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::RecoverChunk, _impl_.incremental_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.p99_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.p999_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::LatencySummary, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_CountersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_CountersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_CountersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_CountersEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse, _impl_.counters_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse, _impl_.latencies_us_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::StatsResponse, _impl_.text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_PaxosLogEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_PaxosLogEntry, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_PaxosLogEntry, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_PaxosLogEntry, _impl_.log_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Applied, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Applied, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Applied, _impl_.operations_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot, _impl_.kv_map_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot, _impl_.applied_slot_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot, _impl_.continued_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Snapshot, _impl_.incomplete_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Compaction, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Compaction, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord_Compaction, _impl_.round_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::keyvaluestore::WalRecord, _impl_.record_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::keyvaluestore::EmptyMessage)},
+  { 6, -1, -1, sizeof(::keyvaluestore::ServerConfig)},
+  { 31, -1, -1, sizeof(::keyvaluestore::BenchConfig)},
+  { 49, -1, -1, sizeof(::keyvaluestore::ClusterEvent)},
+  { 58, -1, -1, sizeof(::keyvaluestore::ClusterBenchConfig)},
+  { 75, 84, -1, sizeof(::keyvaluestore::GetRequest)},
+  { 87, -1, -1, sizeof(::keyvaluestore::GetResponse)},
+  { 94, -1, -1, sizeof(::keyvaluestore::PutRequest)},
+  { 102, -1, -1, sizeof(::keyvaluestore::DeleteRequest)},
+  { 109, 118, -1, sizeof(::keyvaluestore::MultiGetRequest)},
+  { 121, -1, -1, sizeof(::keyvaluestore::KeyValue)},
+  { 130, -1, -1, sizeof(::keyvaluestore::MultiGetResponse)},
+  { 137, -1, -1, sizeof(::keyvaluestore::MultiPutRequest)},
+  { 144, -1, -1, sizeof(::keyvaluestore::MultiDeleteRequest)},
+  { 151, -1, -1, sizeof(::keyvaluestore::WriteRequest)},
+  { 159, -1, -1, sizeof(::keyvaluestore::WriteResponse)},
+  { 169, -1, -1, sizeof(::keyvaluestore::WriteBatchRequest)},
+  { 176, -1, -1, sizeof(::keyvaluestore::CommitResponse)},
+  { 183, 191, -1, sizeof(::keyvaluestore::WriteToken_SlotsEntry_DoNotUse)},
+  { 193, -1, -1, sizeof(::keyvaluestore::WriteToken)},
+  { 200, -1, -1, sizeof(::keyvaluestore::ElectCoordinatorRequest)},
+  { 208, -1, -1, sizeof(::keyvaluestore::GetCoordinatorResponse)},
+  { 216, -1, -1, sizeof(::keyvaluestore::GetLeaderResponse)},
+  { 223, -1, -1, sizeof(::keyvaluestore::ReadIndexRequest)},
+  { 229, -1, -1, sizeof(::keyvaluestore::ReadIndexResponse)},
+  { 236, -1, -1, sizeof(::keyvaluestore::Operation)},
+  { 245, -1, -1, sizeof(::keyvaluestore::PrepareRequest)},
+  { 254, -1, -1, sizeof(::keyvaluestore::PromiseResponse)},
+  { 265, -1, -1, sizeof(::keyvaluestore::ProposeRequest)},
+  { 277, -1, -1, sizeof(::keyvaluestore::AcceptResponse)},
+  { 288, -1, -1, sizeof(::keyvaluestore::InformRequest)},
+  { 297, -1, -1, sizeof(::keyvaluestore::InformResponse)},
+  { 304, -1, -1, sizeof(::keyvaluestore::PaxosLog)},
+  { 316, -1, -1, sizeof(::keyvaluestore::LeaderPrepareRequest)},
+  { 324, -1, -1, sizeof(::keyvaluestore::LeaderPromiseResponse_Accepted)},
+  { 332, -1, -1, sizeof(::keyvaluestore::LeaderPromiseResponse)},
+  { 341, -1, -1, sizeof(::keyvaluestore::GetChosenRequest)},
+  { 349, -1, -1, sizeof(::keyvaluestore::GetChosenResponse)},
+  { 357, -1, -1, sizeof(::keyvaluestore::RecoverRequest)},
+  { 364, 372, -1, sizeof(::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse)},
+  { 374, -1, -1, sizeof(::keyvaluestore::RecoverChunk_PaxosLogs)},
+  { 381, 389, -1, sizeof(::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse)},
+  { 391, 399, -1, sizeof(::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse)},
+  { 401, -1, -1, sizeof(::keyvaluestore::RecoverChunk)},
+  { 412, -1, -1, sizeof(::keyvaluestore::LatencySummary)},
+  { 426, 434, -1, sizeof(::keyvaluestore::StatsResponse_CountersEntry_DoNotUse)},
+  { 436, 444, -1, sizeof(::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse)},
+  { 446, -1, -1, sizeof(::keyvaluestore::StatsResponse)},
+  { 455, -1, -1, sizeof(::keyvaluestore::WalRecord_PaxosLogEntry)},
+  { 464, -1, -1, sizeof(::keyvaluestore::WalRecord_Applied)},
+  { 472, 480, -1, sizeof(::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse)},
+  { 482, -1, -1, sizeof(::keyvaluestore::WalRecord_Snapshot)},
+  { 492, -1, -1, sizeof(::keyvaluestore::WalRecord_Compaction)},
+  { 500, -1, -1, sizeof(::keyvaluestore::WalRecord)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::keyvaluestore::_EmptyMessage_default_instance_._instance,
+  &::keyvaluestore::_ServerConfig_default_instance_._instance,
+  &::keyvaluestore::_BenchConfig_default_instance_._instance,
+  &::keyvaluestore::_ClusterEvent_default_instance_._instance,
+  &::keyvaluestore::_ClusterBenchConfig_default_instance_._instance,
+  &::keyvaluestore::_GetRequest_default_instance_._instance,
+  &::keyvaluestore::_GetResponse_default_instance_._instance,
+  &::keyvaluestore::_PutRequest_default_instance_._instance,
+  &::keyvaluestore::_DeleteRequest_default_instance_._instance,
+  &::keyvaluestore::_MultiGetRequest_default_instance_._instance,
+  &::keyvaluestore::_KeyValue_default_instance_._instance,
+  &::keyvaluestore::_MultiGetResponse_default_instance_._instance,
+  &::keyvaluestore::_MultiPutRequest_default_instance_._instance,
+  &::keyvaluestore::_MultiDeleteRequest_default_instance_._instance,
+  &::keyvaluestore::_WriteRequest_default_instance_._instance,
+  &::keyvaluestore::_WriteResponse_default_instance_._instance,
+  &::keyvaluestore::_WriteBatchRequest_default_instance_._instance,
+  &::keyvaluestore::_CommitResponse_default_instance_._instance,
+  &::keyvaluestore::_WriteToken_SlotsEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_WriteToken_default_instance_._instance,
+  &::keyvaluestore::_ElectCoordinatorRequest_default_instance_._instance,
+  &::keyvaluestore::_GetCoordinatorResponse_default_instance_._instance,
+  &::keyvaluestore::_GetLeaderResponse_default_instance_._instance,
+  &::keyvaluestore::_ReadIndexRequest_default_instance_._instance,
+  &::keyvaluestore::_ReadIndexResponse_default_instance_._instance,
+  &::keyvaluestore::_Operation_default_instance_._instance,
+  &::keyvaluestore::_PrepareRequest_default_instance_._instance,
+  &::keyvaluestore::_PromiseResponse_default_instance_._instance,
+  &::keyvaluestore::_ProposeRequest_default_instance_._instance,
+  &::keyvaluestore::_AcceptResponse_default_instance_._instance,
+  &::keyvaluestore::_InformRequest_default_instance_._instance,
+  &::keyvaluestore::_InformResponse_default_instance_._instance,
+  &::keyvaluestore::_PaxosLog_default_instance_._instance,
+  &::keyvaluestore::_LeaderPrepareRequest_default_instance_._instance,
+  &::keyvaluestore::_LeaderPromiseResponse_Accepted_default_instance_._instance,
+  &::keyvaluestore::_LeaderPromiseResponse_default_instance_._instance,
+  &::keyvaluestore::_GetChosenRequest_default_instance_._instance,
+  &::keyvaluestore::_GetChosenResponse_default_instance_._instance,
+  &::keyvaluestore::_RecoverRequest_default_instance_._instance,
+  &::keyvaluestore::_RecoverChunk_PaxosLogs_LogsEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_RecoverChunk_PaxosLogs_default_instance_._instance,
+  &::keyvaluestore::_RecoverChunk_KvMapEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_RecoverChunk_PaxosLogsEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_RecoverChunk_default_instance_._instance,
+  &::keyvaluestore::_LatencySummary_default_instance_._instance,
+  &::keyvaluestore::_StatsResponse_CountersEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_StatsResponse_LatenciesUsEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_StatsResponse_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_PaxosLogEntry_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_Applied_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_Snapshot_KvMapEntry_DoNotUse_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_Snapshot_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_Compaction_default_instance_._instance,
+  &::keyvaluestore::_WalRecord_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_keyvaluestore_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023keyvaluestore.proto\022\rkeyvaluestore\"\016\n\014"
+  "EmptyMessage\"\315\003\n\014ServerConfig\022\017\n\007my_addr"
+  "\030\001 \001(\t\022\020\n\010my_paxos\030\002 \001(\t\022\021\n\tfail_rate\030\003 "
+  "\001(\001\022\017\n\007replica\030\004 \003(\t\022\035\n\025heartbeat_interv"
+  "al_ms\030\005 \001(\005\022\034\n\024heartbeat_timeout_ms\030\006 \001("
+  "\005\022\027\n\017batch_window_us\030\007 \001(\005\022\026\n\016max_batch_"
+  "size\030\010 \001(\005\022\026\n\016pipeline_depth\030\t \001(\005\022\020\n\010wa"
+  "l_path\030\n \001(\t\022\036\n\026compaction_interval_ms\030\013"
+  " \001(\005\022\034\n\024compaction_retention\030\014 \001(\005\022\021\n\tlo"
+  "g_level\030\r \001(\t\022\022\n\nnum_groups\030\016 \001(\005\022\025\n\rpha"
+  "se1_quorum\030\017 \001(\005\022\025\n\rphase2_quorum\030\020 \001(\005\022"
+  "\027\n\017thrifty_propose\030\021 \001(\010\022\032\n\022thrifty_time"
+  "out_ms\030\022 \001(\005\022\026\n\016follower_reads\030\023 \001(\010\"\362\001\n"
+  "\013BenchConfig\022\016\n\006server\030\001 \003(\t\022\023\n\013num_clie"
+  "nts\030\002 \001(\005\022\023\n\013outstanding\030\003 \001(\005\022\022\n\ndurati"
+  "on_s\030\004 \001(\005\022\020\n\010warmup_s\030\005 \001(\005\022\022\n\nread_rat"
+  "io\030\006 \001(\001\022\020\n\010num_keys\030\007 \001(\005\022\024\n\014distributi"
+  "on\030\010 \001(\t\022\022\n\nzipf_theta\030\t \001(\001\022\022\n\nvalue_si"
+  "ze\030\n \001(\005\022\021\n\tskip_load\030\013 \001(\010\022\014\n\004seed\030\014 \001("
+  "\003\"\?\n\014ClusterEvent\022\r\n\005at_ms\030\001 \001(\005\022\017\n\007repl"
+  "ica\030\002 \001(\005\022\017\n\007restart\030\003 \001(\010\"\245\002\n\022ClusterBe"
+  "nchConfig\022\024\n\014num_replicas\030\001 \001(\005\0223\n\016repli"
+  "ca_config\030\002 \001(\0132\033.keyvaluestore.ServerCo"
+  "nfig\022\017\n\007wal_dir\030\003 \001(\t\022\023\n\013num_clients\030\004 \001"
+  "(\005\022\022\n\nduration_s\030\005 \001(\005\022\022\n\nread_ratio\030\006 \001"
+  "(\001\022\020\n\010num_keys\030\007 \001(\005\022\022\n\nvalue_size\030\010 \001(\005"
+  "\022+\n\006events\030\t \003(\0132\033.keyvaluestore.Cluster"
+  "Event\022\014\n\004seed\030\n \001(\003\022\025\n\rsession_reads\030\013 \001"
+  "(\010\"m\n\nGetRequest\022\013\n\003key\030\001 \001(\t\022\025\n\010min_slo"
+  "t\030\002 \001(\005H\000\210\001\001\022.\n\013min_version\030\003 \001(\0132\031.keyv"
+  "aluestore.WriteTokenB\013\n\t_min_slot\"\034\n\013Get"
+  "Response\022\r\n\005value\030\001 \001(\t\"(\n\nPutRequest\022\013\n"
+  "\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"\034\n\rDeleteReque"
+  "st\022\013\n\003key\030\001 \001(\t\"s\n\017MultiGetRequest\022\014\n\004ke"
+  "ys\030\001 \003(\t\022\025\n\010min_slot\030\002 \001(\005H\000\210\001\001\022.\n\013min_v"
+  "ersion\030\003 \001(\0132\031.keyvaluestore.WriteTokenB"
+  "\013\n\t_min_slot\"5\n\010KeyValue\022\013\n\003key\030\001 \001(\t\022\r\n"
+  "\005value\030\002 \001(\t\022\r\n\005found\030\003 \001(\010\":\n\020MultiGetR"
+  "esponse\022&\n\005pairs\030\001 \003(\0132\027.keyvaluestore.K"
+  "eyValue\";\n\017MultiPutRequest\022(\n\005pairs\030\001 \003("
+  "\0132\031.keyvaluestore.PutRequest\"\"\n\022MultiDel"
+  "eteRequest\022\014\n\004keys\030\001 \003(\t\"H\n\014WriteRequest"
+  "\022\n\n\002id\030\001 \001(\003\022,\n\noperations\030\002 \003(\0132\030.keyva"
+  "luestore.Operation\"j\n\rWriteResponse\022\n\n\002i"
+  "d\030\001 \001(\003\022\014\n\004code\030\002 \001(\005\022\025\n\rerror_message\030\003"
+  " \001(\t\022(\n\005token\030\004 \001(\0132\031.keyvaluestore.Writ"
+  "eToken\"A\n\021WriteBatchRequest\022,\n\noperation"
+  "s\030\001 \003(\0132\030.keyvaluestore.Operation\"\036\n\016Com"
+  "mitResponse\022\014\n\004slot\030\001 \001(\005\"o\n\nWriteToken\022"
+  "3\n\005slots\030\001 \003(\0132$.keyvaluestore.WriteToke"
+  "n.SlotsEntry\032,\n\nSlotsEntry\022\013\n\003key\030\001 \001(\005\022"
+  "\r\n\005value\030\002 \001(\005:\0028\001\";\n\027ElectCoordinatorRe"
+  "quest\022\013\n\003key\030\001 \001(\t\022\023\n\013coordinator\030\002 \001(\t\""
+  ";\n\026GetCoordinatorResponse\022\023\n\013coordinator"
+  "\030\001 \001(\t\022\014\n\004term\030\002 \001(\005\"J\n\021GetLeaderRespons"
+  "e\0225\n\006groups\030\001 \003(\0132%.keyvaluestore.GetCoo"
+  "rdinatorResponse\"\022\n\020ReadIndexRequest\"!\n\021"
+  "ReadIndexResponse\022\014\n\004slot\030\001 \001(\005\"S\n\tOpera"
+  "tion\022\013\n\003key\030\001 \001(\t\022*\n\004type\030\002 \001(\0162\034.keyval"
+  "uestore.OperationType\022\r\n\005value\030\003 \001(\t\"@\n\016"
+  "PrepareRequest\022\013\n\003key\030\001 \001(\t\022\r\n\005round\030\002 \001"
+  "(\005\022\022\n\npropose_id\030\003 \001(\005\"\204\001\n\017PromiseRespon"
+  "se\022\r\n\005round\030\001 \001(\005\022\022\n\npropose_id\030\002 \001(\005\022\023\n"
+  "\013accepted_id\030\003 \001(\005\022*\n\004type\030\004 \001(\0162\034.keyva"
+  "luestore.OperationType\022\r\n\005value\030\005 \001(\t\"\251\001"
+  "\n\016ProposeRequest\022\013\n\003key\030\001 \001(\t\022\r\n\005round\030\002"
+  " \001(\005\022\022\n\npropose_id\030\003 \001(\005\022*\n\004type\030\004 \001(\0162\034"
+  ".keyvaluestore.OperationType\022\r\n\005value\030\005 "
+  "\001(\t\022,\n\noperations\030\006 \003(\0132\030.keyvaluestore."
+  "Operation\"\234\001\n\016AcceptResponse\022\r\n\005round\030\001 "
+  "\001(\005\022\022\n\npropose_id\030\002 \001(\005\022*\n\004type\030\003 \001(\0162\034."
+  "keyvaluestore.OperationType\022\r\n\005value\030\004 \001"
+  "(\t\022,\n\noperations\030\005 \003(\0132\030.keyvaluestore.O"
+  "peration\"i\n\rInformRequest\022\013\n\003key\030\001 \001(\t\0221"
+  "\n\nacceptance\030\002 \001(\0132\035.keyvaluestore.Accep"
+  "tResponse\022\030\n\020compactable_slot\030\003 \001(\005\"&\n\016I"
+  "nformResponse\022\024\n\014applied_slot\030\001 \001(\005\"\310\001\n\010"
+  "PaxosLog\022\023\n\013promised_id\030\001 \001(\005\022\023\n\013accepte"
+  "d_id\030\002 \001(\005\0223\n\raccepted_type\030\003 \001(\0162\034.keyv"
+  "aluestore.OperationType\022\026\n\016accepted_valu"
+  "e\030\004 \001(\t\022\016\n\006chosen\030\005 \001(\010\0225\n\023accepted_oper"
+  "ations\030\006 \003(\0132\030.keyvaluestore.Operation\"9"
+  "\n\024LeaderPrepareRequest\022\016\n\006ballot\030\001 \001(\005\022\021"
+  "\n\tfrom_slot\030\002 \001(\005\"\300\001\n\025LeaderPromiseRespo"
+  "nse\022\016\n\006ballot\030\001 \001(\005\022\?\n\010accepted\030\002 \003(\0132-."
+  "keyvaluestore.LeaderPromiseResponse.Acce"
+  "pted\022\026\n\016compacted_slot\030\003 \001(\005\032>\n\010Accepted"
+  "\022\014\n\004slot\030\001 \001(\005\022$\n\003log\030\002 \001(\0132\027.keyvaluest"
+  "ore.PaxosLog\"6\n\020GetChosenRequest\022\021\n\tfrom"
+  "_slot\030\001 \001(\005\022\017\n\007to_slot\030\002 \001(\005\"Y\n\021GetChose"
+  "nResponse\022,\n\005slots\030\001 \003(\0132\035.keyvaluestore"
+  ".AcceptResponse\022\026\n\016compacted_slot\030\002 \001(\005\""
+  "&\n\016RecoverRequest\022\024\n\014applied_slot\030\001 \001(\005\""
+  "\342\003\n\014RecoverChunk\0226\n\006kv_map\030\001 \003(\0132&.keyva"
+  "luestore.RecoverChunk.KvMapEntry\022>\n\npaxo"
+  "s_logs\030\002 \003(\0132*.keyvaluestore.RecoverChun"
+  "k.PaxosLogsEntry\022\024\n\014applied_slot\030\003 \001(\005\022\025"
+  "\n\rdata_complete\030\004 \001(\010\022\023\n\013incremental\030\005 \001"
+  "(\010\032\220\001\n\tPaxosLogs\022=\n\004logs\030\001 \003(\0132/.keyvalu"
+  "estore.RecoverChunk.PaxosLogs.LogsEntry\032"
+  "D\n\tLogsEntry\022\013\n\003key\030\001 \001(\005\022&\n\005value\030\002 \001(\013"
+  "2\027.keyvaluestore.PaxosLog:\0028\001\032,\n\nKvMapEn"
+  "try\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\032W\n\016P"
+  "axosLogsEntry\022\013\n\003key\030\001 \001(\t\0224\n\005value\030\002 \001("
+  "\0132%.keyvaluestore.RecoverChunk.PaxosLogs"
+  ":\0028\001\"|\n\016LatencySummary\022\r\n\005count\030\001 \001(\004\022\014\n"
+  "\004mean\030\002 \001(\001\022\013\n\003min\030\003 \001(\004\022\013\n\003p50\030\004 \001(\004\022\013\n"
+  "\003p90\030\005 \001(\004\022\013\n\003p99\030\006 \001(\004\022\014\n\004p999\030\007 \001(\004\022\013\n"
+  "\003max\030\010 \001(\004\"\244\002\n\rStatsResponse\022<\n\010counters"
+  "\030\001 \003(\0132*.keyvaluestore.StatsResponse.Cou"
+  "ntersEntry\022C\n\014latencies_us\030\002 \003(\0132-.keyva"
+  "luestore.StatsResponse.LatenciesUsEntry\022"
+  "\014\n\004text\030\003 \001(\t\032/\n\rCountersEntry\022\013\n\003key\030\001 "
+  "\001(\t\022\r\n\005value\030\002 \001(\003:\0028\001\032Q\n\020LatenciesUsEnt"
+  "ry\022\013\n\003key\030\001 \001(\t\022,\n\005value\030\002 \001(\0132\035.keyvalu"
+  "estore.LatencySummary:\0028\001\"\216\005\n\tWalRecord\022"
+  ";\n\tpaxos_log\030\001 \001(\0132&.keyvaluestore.WalRe"
+  "cord.PaxosLogEntryH\000\022\031\n\017promised_ballot\030"
+  "\002 \001(\005H\000\0223\n\007applied\030\003 \001(\0132 .keyvaluestore"
+  ".WalRecord.AppliedH\000\0225\n\010snapshot\030\004 \001(\0132!"
+  ".keyvaluestore.WalRecord.SnapshotH\000\0229\n\nc"
+  "ompaction\030\005 \001(\0132#.keyvaluestore.WalRecor"
+  "d.CompactionH\000\032Q\n\rPaxosLogEntry\022\013\n\003key\030\001"
+  " \001(\t\022\r\n\005round\030\002 \001(\005\022$\n\003log\030\003 \001(\0132\027.keyva"
+  "luestore.PaxosLog\032E\n\007Applied\022\014\n\004slot\030\001 \001"
+  "(\005\022,\n\noperations\030\002 \003(\0132\030.keyvaluestore.O"
+  "peration\032\263\001\n\010Snapshot\022<\n\006kv_map\030\001 \003(\0132,."
+  "keyvaluestore.WalRecord.Snapshot.KvMapEn"
+  "try\022\024\n\014applied_slot\030\002 \001(\005\022\021\n\tcontinued\030\003"
+  " \001(\010\022\022\n\nincomplete\030\004 \001(\010\032,\n\nKvMapEntry\022\013"
+  "\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\032(\n\nCompac"
+  "tion\022\013\n\003key\030\001 \001(\t\022\r\n\005round\030\002 \001(\005B\010\n\006reco"
+  "rd*Q\n\rOperationType\022\013\n\007NOT_SET\020\000\022\007\n\003SET\020"
+  "\001\022\n\n\006DELETE\020\002\022\023\n\017SET_COORDINATOR\020\003\022\t\n\005BA"
+  "TCH\020\0042\345\004\n\rKeyValueStore\022C\n\010GetValue\022\031.ke"
+  "yvaluestore.GetRequest\032\032.keyvaluestore.G"
+  "etResponse\"\000\022A\n\007PutPair\022\031.keyvaluestore."
+  "PutRequest\032\031.keyvaluestore.WriteToken\"\000\022"
+  "G\n\nDeletePair\022\034.keyvaluestore.DeleteRequ"
+  "est\032\031.keyvaluestore.WriteToken\"\000\022M\n\010Mult"
+  "iGet\022\036.keyvaluestore.MultiGetRequest\032\037.k"
+  "eyvaluestore.MultiGetResponse\"\000\022G\n\010Multi"
+  "Put\022\036.keyvaluestore.MultiPutRequest\032\031.ke"
+  "yvaluestore.WriteToken\"\000\022M\n\013MultiDelete\022"
+  "!.keyvaluestore.MultiDeleteRequest\032\031.key"
+  "valuestore.WriteToken\"\000\022N\n\013WriteStream\022\033"
+  ".keyvaluestore.WriteRequest\032\034.keyvaluest"
+  "ore.WriteResponse\"\000(\0010\001\022L\n\tGetLeader\022\033.k"
+  "eyvaluestore.EmptyMessage\032 .keyvaluestor"
+  "e.GetLeaderResponse\"\0002\357\t\n\nMultiPaxos\022C\n\010"
+  "GetValue\022\031.keyvaluestore.GetRequest\032\032.ke"
+  "yvaluestore.GetResponse\"\000\022E\n\007PutPair\022\031.k"
+  "eyvaluestore.PutRequest\032\035.keyvaluestore."
+  "CommitResponse\"\000\022K\n\nDeletePair\022\034.keyvalu"
+  "estore.DeleteRequest\032\035.keyvaluestore.Com"
+  "mitResponse\"\000\022M\n\010MultiGet\022\036.keyvaluestor"
+  "e.MultiGetRequest\032\037.keyvaluestore.MultiG"
+  "etResponse\"\000\022O\n\nWriteBatch\022 .keyvaluesto"
+  "re.WriteBatchRequest\032\035.keyvaluestore.Com"
+  "mitResponse\"\000\022Y\n\020ElectCoordinator\022&.keyv"
+  "aluestore.ElectCoordinatorRequest\032\033.keyv"
+  "aluestore.EmptyMessage\"\000\022V\n\016GetCoordinat"
+  "or\022\033.keyvaluestore.EmptyMessage\032%.keyval"
+  "uestore.GetCoordinatorResponse\"\000\022P\n\tRead"
+  "Index\022\037.keyvaluestore.ReadIndexRequest\032 "
+  ".keyvaluestore.ReadIndexResponse\"\000\022J\n\007Pr"
+  "epare\022\035.keyvaluestore.PrepareRequest\032\036.k"
+  "eyvaluestore.PromiseResponse\"\000\022\\\n\rPrepar"
+  "eLeader\022#.keyvaluestore.LeaderPrepareReq"
+  "uest\032$.keyvaluestore.LeaderPromiseRespon"
+  "se\"\000\022I\n\007Propose\022\035.keyvaluestore.ProposeR"
+  "equest\032\035.keyvaluestore.AcceptResponse\"\000\022"
+  "G\n\006Inform\022\034.keyvaluestore.InformRequest\032"
+  "\035.keyvaluestore.InformResponse\"\000\022P\n\tGetC"
+  "hosen\022\037.keyvaluestore.GetChosenRequest\032 "
+  ".keyvaluestore.GetChosenResponse\"\000\022B\n\004Pi"
+  "ng\022\033.keyvaluestore.EmptyMessage\032\033.keyval"
+  "uestore.EmptyMessage\"\000\022I\n\007Recover\022\035.keyv"
+  "aluestore.RecoverRequest\032\033.keyvaluestore"
+  ".RecoverChunk\"\0000\001\022D\n\005Stats\022\033.keyvaluesto"
+  "re.EmptyMessage\032\034.keyvaluestore.StatsRes"
+  "ponse\"\000b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_keyvaluestore_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_keyvaluestore_2eproto = {
+    false, false, 7255, descriptor_table_protodef_keyvaluestore_2eproto,
+    "keyvaluestore.proto",
+    &descriptor_table_keyvaluestore_2eproto_once, nullptr, 0, 54,
+    schemas, file_default_instances, TableStruct_keyvaluestore_2eproto::offsets,
+    file_level_metadata_keyvaluestore_2eproto, file_level_enum_descriptors_keyvaluestore_2eproto,
+    file_level_service_descriptors_keyvaluestore_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_keyvaluestore_2eproto_getter() {
+  return &descriptor_table_keyvaluestore_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_keyvaluestore_2eproto(&descriptor_table_keyvaluestore_2eproto);
+namespace keyvaluestore {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OperationType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_keyvaluestore_2eproto);
+  return file_level_enum_descriptors_keyvaluestore_2eproto[0];
+}
+bool OperationType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class EmptyMessage::_Internal {
+ public:
+};
+
+EmptyMessage::EmptyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.EmptyMessage)
+}
+EmptyMessage::EmptyMessage(const EmptyMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  EmptyMessage* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.EmptyMessage)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EmptyMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EmptyMessage::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata EmptyMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerConfig::_Internal {
+ public:
+};
+
+ServerConfig::ServerConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ServerConfig)
+}
+ServerConfig::ServerConfig(const ServerConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_){from._impl_.replica_}
+    , decltype(_impl_.my_addr_){}
+    , decltype(_impl_.my_paxos_){}
+    , decltype(_impl_.wal_path_){}
+    , decltype(_impl_.log_level_){}
+    , decltype(_impl_.fail_rate_){}
+    , decltype(_impl_.heartbeat_interval_ms_){}
+    , decltype(_impl_.heartbeat_timeout_ms_){}
+    , decltype(_impl_.batch_window_us_){}
+    , decltype(_impl_.max_batch_size_){}
+    , decltype(_impl_.pipeline_depth_){}
+    , decltype(_impl_.compaction_interval_ms_){}
+    , decltype(_impl_.compaction_retention_){}
+    , decltype(_impl_.num_groups_){}
+    , decltype(_impl_.phase1_quorum_){}
+    , decltype(_impl_.phase2_quorum_){}
+    , decltype(_impl_.thrifty_timeout_ms_){}
+    , decltype(_impl_.thrifty_propose_){}
+    , decltype(_impl_.follower_reads_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.my_addr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.my_addr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_my_addr().empty()) {
+    _this->_impl_.my_addr_.Set(from._internal_my_addr(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.my_paxos_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.my_paxos_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_my_paxos().empty()) {
+    _this->_impl_.my_paxos_.Set(from._internal_my_paxos(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.wal_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wal_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_wal_path().empty()) {
+    _this->_impl_.wal_path_.Set(from._internal_wal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.log_level_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_level_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_log_level().empty()) {
+    _this->_impl_.log_level_.Set(from._internal_log_level(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.fail_rate_, &from._impl_.fail_rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.follower_reads_) -
+    reinterpret_cast<char*>(&_impl_.fail_rate_)) + sizeof(_impl_.follower_reads_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ServerConfig)
+}
+
+inline void ServerConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replica_){arena}
+    , decltype(_impl_.my_addr_){}
+    , decltype(_impl_.my_paxos_){}
+    , decltype(_impl_.wal_path_){}
+    , decltype(_impl_.log_level_){}
+    , decltype(_impl_.fail_rate_){0}
+    , decltype(_impl_.heartbeat_interval_ms_){0}
+    , decltype(_impl_.heartbeat_timeout_ms_){0}
+    , decltype(_impl_.batch_window_us_){0}
+    , decltype(_impl_.max_batch_size_){0}
+    , decltype(_impl_.pipeline_depth_){0}
+    , decltype(_impl_.compaction_interval_ms_){0}
+    , decltype(_impl_.compaction_retention_){0}
+    , decltype(_impl_.num_groups_){0}
+    , decltype(_impl_.phase1_quorum_){0}
+    , decltype(_impl_.phase2_quorum_){0}
+    , decltype(_impl_.thrifty_timeout_ms_){0}
+    , decltype(_impl_.thrifty_propose_){false}
+    , decltype(_impl_.follower_reads_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.my_addr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.my_addr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.my_paxos_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.my_paxos_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.wal_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wal_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.log_level_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.log_level_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerConfig::~ServerConfig() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ServerConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.replica_.~RepeatedPtrField();
+  _impl_.my_addr_.Destroy();
+  _impl_.my_paxos_.Destroy();
+  _impl_.wal_path_.Destroy();
+  _impl_.log_level_.Destroy();
+}
+
+void ServerConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ServerConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.replica_.Clear();
+  _impl_.my_addr_.ClearToEmpty();
+  _impl_.my_paxos_.ClearToEmpty();
+  _impl_.wal_path_.ClearToEmpty();
+  _impl_.log_level_.ClearToEmpty();
+  ::memset(&_impl_.fail_rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.follower_reads_) -
+      reinterpret_cast<char*>(&_impl_.fail_rate_)) + sizeof(_impl_.follower_reads_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string my_addr = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_my_addr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ServerConfig.my_addr"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string my_paxos = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_my_paxos();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ServerConfig.my_paxos"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double fail_rate = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.fail_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string replica = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_replica();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ServerConfig.replica"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 heartbeat_interval_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.heartbeat_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 heartbeat_timeout_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.heartbeat_timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 batch_window_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.batch_window_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_batch_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_batch_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 pipeline_depth = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.pipeline_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string wal_path = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_wal_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ServerConfig.wal_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compaction_interval_ms = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.compaction_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compaction_retention = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.compaction_retention_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string log_level = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_log_level();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ServerConfig.log_level"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_groups = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.num_groups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 phase1_quorum = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.phase1_quorum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 phase2_quorum = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.phase2_quorum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool thrifty_propose = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _impl_.thrifty_propose_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 thrifty_timeout_ms = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _impl_.thrifty_timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool follower_reads = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _impl_.follower_reads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ServerConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string my_addr = 1;
+  if (!this->_internal_my_addr().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_my_addr().data(), static_cast<int>(this->_internal_my_addr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ServerConfig.my_addr");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_my_addr(), target);
+  }
+
+  // string my_paxos = 2;
+  if (!this->_internal_my_paxos().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_my_paxos().data(), static_cast<int>(this->_internal_my_paxos().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ServerConfig.my_paxos");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_my_paxos(), target);
+  }
+
+  // double fail_rate = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_fail_rate = this->_internal_fail_rate();
+  uint64_t raw_fail_rate;
+  memcpy(&raw_fail_rate, &tmp_fail_rate, sizeof(tmp_fail_rate));
+  if (raw_fail_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_fail_rate(), target);
+  }
+
+  // repeated string replica = 4;
+  for (int i = 0, n = this->_internal_replica_size(); i < n; i++) {
+    const auto& s = this->_internal_replica(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ServerConfig.replica");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // int32 heartbeat_interval_ms = 5;
+  if (this->_internal_heartbeat_interval_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_heartbeat_interval_ms(), target);
+  }
+
+  // int32 heartbeat_timeout_ms = 6;
+  if (this->_internal_heartbeat_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_heartbeat_timeout_ms(), target);
+  }
+
+  // int32 batch_window_us = 7;
+  if (this->_internal_batch_window_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_batch_window_us(), target);
+  }
+
+  // int32 max_batch_size = 8;
+  if (this->_internal_max_batch_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_max_batch_size(), target);
+  }
+
+  // int32 pipeline_depth = 9;
+  if (this->_internal_pipeline_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_pipeline_depth(), target);
+  }
+
+  // string wal_path = 10;
+  if (!this->_internal_wal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_wal_path().data(), static_cast<int>(this->_internal_wal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ServerConfig.wal_path");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_wal_path(), target);
+  }
+
+  // int32 compaction_interval_ms = 11;
+  if (this->_internal_compaction_interval_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_compaction_interval_ms(), target);
+  }
+
+  // int32 compaction_retention = 12;
+  if (this->_internal_compaction_retention() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_compaction_retention(), target);
+  }
+
+  // string log_level = 13;
+  if (!this->_internal_log_level().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_log_level().data(), static_cast<int>(this->_internal_log_level().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ServerConfig.log_level");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_log_level(), target);
+  }
+
+  // int32 num_groups = 14;
+  if (this->_internal_num_groups() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_num_groups(), target);
+  }
+
+  // int32 phase1_quorum = 15;
+  if (this->_internal_phase1_quorum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_phase1_quorum(), target);
+  }
+
+  // int32 phase2_quorum = 16;
+  if (this->_internal_phase2_quorum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_phase2_quorum(), target);
+  }
+
+  // bool thrifty_propose = 17;
+  if (this->_internal_thrifty_propose() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_thrifty_propose(), target);
+  }
+
+  // int32 thrifty_timeout_ms = 18;
+  if (this->_internal_thrifty_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_thrifty_timeout_ms(), target);
+  }
+
+  // bool follower_reads = 19;
+  if (this->_internal_follower_reads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(19, this->_internal_follower_reads(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ServerConfig)
+  return target;
+}
+
+size_t ServerConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ServerConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string replica = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.replica_.size());
+  for (int i = 0, n = _impl_.replica_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.replica_.Get(i));
+  }
+
+  // string my_addr = 1;
+  if (!this->_internal_my_addr().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_my_addr());
+  }
+
+  // string my_paxos = 2;
+  if (!this->_internal_my_paxos().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_my_paxos());
+  }
+
+  // string wal_path = 10;
+  if (!this->_internal_wal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_wal_path());
+  }
+
+  // string log_level = 13;
+  if (!this->_internal_log_level().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_log_level());
+  }
+
+  // double fail_rate = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_fail_rate = this->_internal_fail_rate();
+  uint64_t raw_fail_rate;
+  memcpy(&raw_fail_rate, &tmp_fail_rate, sizeof(tmp_fail_rate));
+  if (raw_fail_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 heartbeat_interval_ms = 5;
+  if (this->_internal_heartbeat_interval_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_heartbeat_interval_ms());
+  }
+
+  // int32 heartbeat_timeout_ms = 6;
+  if (this->_internal_heartbeat_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_heartbeat_timeout_ms());
+  }
+
+  // int32 batch_window_us = 7;
+  if (this->_internal_batch_window_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_batch_window_us());
+  }
+
+  // int32 max_batch_size = 8;
+  if (this->_internal_max_batch_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_batch_size());
+  }
+
+  // int32 pipeline_depth = 9;
+  if (this->_internal_pipeline_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pipeline_depth());
+  }
+
+  // int32 compaction_interval_ms = 11;
+  if (this->_internal_compaction_interval_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compaction_interval_ms());
+  }
+
+  // int32 compaction_retention = 12;
+  if (this->_internal_compaction_retention() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compaction_retention());
+  }
+
+  // int32 num_groups = 14;
+  if (this->_internal_num_groups() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_groups());
+  }
+
+  // int32 phase1_quorum = 15;
+  if (this->_internal_phase1_quorum() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_phase1_quorum());
+  }
+
+  // int32 phase2_quorum = 16;
+  if (this->_internal_phase2_quorum() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_phase2_quorum());
+  }
+
+  // int32 thrifty_timeout_ms = 18;
+  if (this->_internal_thrifty_timeout_ms() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_thrifty_timeout_ms());
+  }
+
+  // bool thrifty_propose = 17;
+  if (this->_internal_thrifty_propose() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool follower_reads = 19;
+  if (this->_internal_follower_reads() != 0) {
+    total_size += 2 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerConfig::GetClassData() const { return &_class_data_; }
+
+
+void ServerConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerConfig*>(&to_msg);
+  auto& from = static_cast<const ServerConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ServerConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.replica_.MergeFrom(from._impl_.replica_);
+  if (!from._internal_my_addr().empty()) {
+    _this->_internal_set_my_addr(from._internal_my_addr());
+  }
+  if (!from._internal_my_paxos().empty()) {
+    _this->_internal_set_my_paxos(from._internal_my_paxos());
+  }
+  if (!from._internal_wal_path().empty()) {
+    _this->_internal_set_wal_path(from._internal_wal_path());
+  }
+  if (!from._internal_log_level().empty()) {
+    _this->_internal_set_log_level(from._internal_log_level());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_fail_rate = from._internal_fail_rate();
+  uint64_t raw_fail_rate;
+  memcpy(&raw_fail_rate, &tmp_fail_rate, sizeof(tmp_fail_rate));
+  if (raw_fail_rate != 0) {
+    _this->_internal_set_fail_rate(from._internal_fail_rate());
+  }
+  if (from._internal_heartbeat_interval_ms() != 0) {
+    _this->_internal_set_heartbeat_interval_ms(from._internal_heartbeat_interval_ms());
+  }
+  if (from._internal_heartbeat_timeout_ms() != 0) {
+    _this->_internal_set_heartbeat_timeout_ms(from._internal_heartbeat_timeout_ms());
+  }
+  if (from._internal_batch_window_us() != 0) {
+    _this->_internal_set_batch_window_us(from._internal_batch_window_us());
+  }
+  if (from._internal_max_batch_size() != 0) {
+    _this->_internal_set_max_batch_size(from._internal_max_batch_size());
+  }
+  if (from._internal_pipeline_depth() != 0) {
+    _this->_internal_set_pipeline_depth(from._internal_pipeline_depth());
+  }
+  if (from._internal_compaction_interval_ms() != 0) {
+    _this->_internal_set_compaction_interval_ms(from._internal_compaction_interval_ms());
+  }
+  if (from._internal_compaction_retention() != 0) {
+    _this->_internal_set_compaction_retention(from._internal_compaction_retention());
+  }
+  if (from._internal_num_groups() != 0) {
+    _this->_internal_set_num_groups(from._internal_num_groups());
+  }
+  if (from._internal_phase1_quorum() != 0) {
+    _this->_internal_set_phase1_quorum(from._internal_phase1_quorum());
+  }
+  if (from._internal_phase2_quorum() != 0) {
+    _this->_internal_set_phase2_quorum(from._internal_phase2_quorum());
+  }
+  if (from._internal_thrifty_timeout_ms() != 0) {
+    _this->_internal_set_thrifty_timeout_ms(from._internal_thrifty_timeout_ms());
+  }
+  if (from._internal_thrifty_propose() != 0) {
+    _this->_internal_set_thrifty_propose(from._internal_thrifty_propose());
+  }
+  if (from._internal_follower_reads() != 0) {
+    _this->_internal_set_follower_reads(from._internal_follower_reads());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerConfig::CopyFrom(const ServerConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ServerConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerConfig::IsInitialized() const {
+  return true;
+}
+
+void ServerConfig::InternalSwap(ServerConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.replica_.InternalSwap(&other->_impl_.replica_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.my_addr_, lhs_arena,
+      &other->_impl_.my_addr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.my_paxos_, lhs_arena,
+      &other->_impl_.my_paxos_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.wal_path_, lhs_arena,
+      &other->_impl_.wal_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.log_level_, lhs_arena,
+      &other->_impl_.log_level_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerConfig, _impl_.follower_reads_)
+      + sizeof(ServerConfig::_impl_.follower_reads_)
+      - PROTOBUF_FIELD_OFFSET(ServerConfig, _impl_.fail_rate_)>(
+          reinterpret_cast<char*>(&_impl_.fail_rate_),
+          reinterpret_cast<char*>(&other->_impl_.fail_rate_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[1]);
+}
+
+// ===================================================================
+
+class BenchConfig::_Internal {
+ public:
+};
+
+BenchConfig::BenchConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.BenchConfig)
+}
+BenchConfig::BenchConfig(const BenchConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_){from._impl_.server_}
+    , decltype(_impl_.distribution_){}
+    , decltype(_impl_.num_clients_){}
+    , decltype(_impl_.outstanding_){}
+    , decltype(_impl_.duration_s_){}
+    , decltype(_impl_.warmup_s_){}
+    , decltype(_impl_.read_ratio_){}
+    , decltype(_impl_.num_keys_){}
+    , decltype(_impl_.value_size_){}
+    , decltype(_impl_.zipf_theta_){}
+    , decltype(_impl_.seed_){}
+    , decltype(_impl_.skip_load_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.distribution_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.distribution_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_distribution().empty()) {
+    _this->_impl_.distribution_.Set(from._internal_distribution(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.num_clients_, &from._impl_.num_clients_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.skip_load_) -
+    reinterpret_cast<char*>(&_impl_.num_clients_)) + sizeof(_impl_.skip_load_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.BenchConfig)
+}
+
+inline void BenchConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.server_){arena}
+    , decltype(_impl_.distribution_){}
+    , decltype(_impl_.num_clients_){0}
+    , decltype(_impl_.outstanding_){0}
+    , decltype(_impl_.duration_s_){0}
+    , decltype(_impl_.warmup_s_){0}
+    , decltype(_impl_.read_ratio_){0}
+    , decltype(_impl_.num_keys_){0}
+    , decltype(_impl_.value_size_){0}
+    , decltype(_impl_.zipf_theta_){0}
+    , decltype(_impl_.seed_){int64_t{0}}
+    , decltype(_impl_.skip_load_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.distribution_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.distribution_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchConfig::~BenchConfig() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.BenchConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.server_.~RepeatedPtrField();
+  _impl_.distribution_.Destroy();
+}
+
+void BenchConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.BenchConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_.Clear();
+  _impl_.distribution_.ClearToEmpty();
+  ::memset(&_impl_.num_clients_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.skip_load_) -
+      reinterpret_cast<char*>(&_impl_.num_clients_)) + sizeof(_impl_.skip_load_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string server = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_server();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.BenchConfig.server"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_clients = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.num_clients_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 outstanding = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.outstanding_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 duration_s = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.duration_s_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 warmup_s = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.warmup_s_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double read_ratio = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.read_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_keys = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.num_keys_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string distribution = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_distribution();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.BenchConfig.distribution"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double zipf_theta = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.zipf_theta_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.value_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool skip_load = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.skip_load_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 seed = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.BenchConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string server = 1;
+  for (int i = 0, n = this->_internal_server_size(); i < n; i++) {
+    const auto& s = this->_internal_server(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.BenchConfig.server");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // int32 num_clients = 2;
+  if (this->_internal_num_clients() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_clients(), target);
+  }
+
+  // int32 outstanding = 3;
+  if (this->_internal_outstanding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_outstanding(), target);
+  }
+
+  // int32 duration_s = 4;
+  if (this->_internal_duration_s() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_duration_s(), target);
+  }
+
+  // int32 warmup_s = 5;
+  if (this->_internal_warmup_s() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_warmup_s(), target);
+  }
+
+  // double read_ratio = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = this->_internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_read_ratio(), target);
+  }
+
+  // int32 num_keys = 7;
+  if (this->_internal_num_keys() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_num_keys(), target);
+  }
+
+  // string distribution = 8;
+  if (!this->_internal_distribution().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_distribution().data(), static_cast<int>(this->_internal_distribution().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.BenchConfig.distribution");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_distribution(), target);
+  }
+
+  // double zipf_theta = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_zipf_theta = this->_internal_zipf_theta();
+  uint64_t raw_zipf_theta;
+  memcpy(&raw_zipf_theta, &tmp_zipf_theta, sizeof(tmp_zipf_theta));
+  if (raw_zipf_theta != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_zipf_theta(), target);
+  }
+
+  // int32 value_size = 10;
+  if (this->_internal_value_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_value_size(), target);
+  }
+
+  // bool skip_load = 11;
+  if (this->_internal_skip_load() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_skip_load(), target);
+  }
+
+  // int64 seed = 12;
+  if (this->_internal_seed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(12, this->_internal_seed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.BenchConfig)
+  return target;
+}
+
+size_t BenchConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.BenchConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string server = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.server_.size());
+  for (int i = 0, n = _impl_.server_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.server_.Get(i));
+  }
+
+  // string distribution = 8;
+  if (!this->_internal_distribution().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_distribution());
+  }
+
+  // int32 num_clients = 2;
+  if (this->_internal_num_clients() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_clients());
+  }
+
+  // int32 outstanding = 3;
+  if (this->_internal_outstanding() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_outstanding());
+  }
+
+  // int32 duration_s = 4;
+  if (this->_internal_duration_s() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration_s());
+  }
+
+  // int32 warmup_s = 5;
+  if (this->_internal_warmup_s() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_warmup_s());
+  }
+
+  // double read_ratio = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = this->_internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 num_keys = 7;
+  if (this->_internal_num_keys() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_keys());
+  }
+
+  // int32 value_size = 10;
+  if (this->_internal_value_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_size());
+  }
+
+  // double zipf_theta = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_zipf_theta = this->_internal_zipf_theta();
+  uint64_t raw_zipf_theta;
+  memcpy(&raw_zipf_theta, &tmp_zipf_theta, sizeof(tmp_zipf_theta));
+  if (raw_zipf_theta != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int64 seed = 12;
+  if (this->_internal_seed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_seed());
+  }
+
+  // bool skip_load = 11;
+  if (this->_internal_skip_load() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchConfig::GetClassData() const { return &_class_data_; }
+
+
+void BenchConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchConfig*>(&to_msg);
+  auto& from = static_cast<const BenchConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.BenchConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.server_.MergeFrom(from._impl_.server_);
+  if (!from._internal_distribution().empty()) {
+    _this->_internal_set_distribution(from._internal_distribution());
+  }
+  if (from._internal_num_clients() != 0) {
+    _this->_internal_set_num_clients(from._internal_num_clients());
+  }
+  if (from._internal_outstanding() != 0) {
+    _this->_internal_set_outstanding(from._internal_outstanding());
+  }
+  if (from._internal_duration_s() != 0) {
+    _this->_internal_set_duration_s(from._internal_duration_s());
+  }
+  if (from._internal_warmup_s() != 0) {
+    _this->_internal_set_warmup_s(from._internal_warmup_s());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = from._internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    _this->_internal_set_read_ratio(from._internal_read_ratio());
+  }
+  if (from._internal_num_keys() != 0) {
+    _this->_internal_set_num_keys(from._internal_num_keys());
+  }
+  if (from._internal_value_size() != 0) {
+    _this->_internal_set_value_size(from._internal_value_size());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_zipf_theta = from._internal_zipf_theta();
+  uint64_t raw_zipf_theta;
+  memcpy(&raw_zipf_theta, &tmp_zipf_theta, sizeof(tmp_zipf_theta));
+  if (raw_zipf_theta != 0) {
+    _this->_internal_set_zipf_theta(from._internal_zipf_theta());
+  }
+  if (from._internal_seed() != 0) {
+    _this->_internal_set_seed(from._internal_seed());
+  }
+  if (from._internal_skip_load() != 0) {
+    _this->_internal_set_skip_load(from._internal_skip_load());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchConfig::CopyFrom(const BenchConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.BenchConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchConfig::IsInitialized() const {
+  return true;
+}
+
+void BenchConfig::InternalSwap(BenchConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.server_.InternalSwap(&other->_impl_.server_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.distribution_, lhs_arena,
+      &other->_impl_.distribution_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BenchConfig, _impl_.skip_load_)
+      + sizeof(BenchConfig::_impl_.skip_load_)
+      - PROTOBUF_FIELD_OFFSET(BenchConfig, _impl_.num_clients_)>(
+          reinterpret_cast<char*>(&_impl_.num_clients_),
+          reinterpret_cast<char*>(&other->_impl_.num_clients_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[2]);
+}
+
+// ===================================================================
+
+class ClusterEvent::_Internal {
+ public:
+};
+
+ClusterEvent::ClusterEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ClusterEvent)
+}
+ClusterEvent::ClusterEvent(const ClusterEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClusterEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.at_ms_){}
+    , decltype(_impl_.replica_){}
+    , decltype(_impl_.restart_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.at_ms_, &from._impl_.at_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.restart_) -
+    reinterpret_cast<char*>(&_impl_.at_ms_)) + sizeof(_impl_.restart_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ClusterEvent)
+}
+
+inline void ClusterEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.at_ms_){0}
+    , decltype(_impl_.replica_){0}
+    , decltype(_impl_.restart_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ClusterEvent::~ClusterEvent() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ClusterEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClusterEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ClusterEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClusterEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ClusterEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.at_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.restart_) -
+      reinterpret_cast<char*>(&_impl_.at_ms_)) + sizeof(_impl_.restart_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClusterEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 at_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.at_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.replica_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool restart = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.restart_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClusterEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ClusterEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 at_ms = 1;
+  if (this->_internal_at_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_at_ms(), target);
+  }
+
+  // int32 replica = 2;
+  if (this->_internal_replica() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica(), target);
+  }
+
+  // bool restart = 3;
+  if (this->_internal_restart() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_restart(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ClusterEvent)
+  return target;
+}
+
+size_t ClusterEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ClusterEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 at_ms = 1;
+  if (this->_internal_at_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_at_ms());
+  }
+
+  // int32 replica = 2;
+  if (this->_internal_replica() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica());
+  }
+
+  // bool restart = 3;
+  if (this->_internal_restart() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClusterEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClusterEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClusterEvent::GetClassData() const { return &_class_data_; }
+
+
+void ClusterEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClusterEvent*>(&to_msg);
+  auto& from = static_cast<const ClusterEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ClusterEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_at_ms() != 0) {
+    _this->_internal_set_at_ms(from._internal_at_ms());
+  }
+  if (from._internal_replica() != 0) {
+    _this->_internal_set_replica(from._internal_replica());
+  }
+  if (from._internal_restart() != 0) {
+    _this->_internal_set_restart(from._internal_restart());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClusterEvent::CopyFrom(const ClusterEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ClusterEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClusterEvent::IsInitialized() const {
+  return true;
+}
+
+void ClusterEvent::InternalSwap(ClusterEvent* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClusterEvent, _impl_.restart_)
+      + sizeof(ClusterEvent::_impl_.restart_)
+      - PROTOBUF_FIELD_OFFSET(ClusterEvent, _impl_.at_ms_)>(
+          reinterpret_cast<char*>(&_impl_.at_ms_),
+          reinterpret_cast<char*>(&other->_impl_.at_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClusterEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[3]);
+}
+
+// ===================================================================
+
+class ClusterBenchConfig::_Internal {
+ public:
+  static const ::keyvaluestore::ServerConfig& replica_config(const ClusterBenchConfig* msg);
+};
+
+const ::keyvaluestore::ServerConfig&
+ClusterBenchConfig::_Internal::replica_config(const ClusterBenchConfig* msg) {
+  return *msg->_impl_.replica_config_;
+}
+ClusterBenchConfig::ClusterBenchConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ClusterBenchConfig)
+}
+ClusterBenchConfig::ClusterBenchConfig(const ClusterBenchConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClusterBenchConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.wal_dir_){}
+    , decltype(_impl_.replica_config_){nullptr}
+    , decltype(_impl_.num_replicas_){}
+    , decltype(_impl_.num_clients_){}
+    , decltype(_impl_.read_ratio_){}
+    , decltype(_impl_.duration_s_){}
+    , decltype(_impl_.num_keys_){}
+    , decltype(_impl_.value_size_){}
+    , decltype(_impl_.session_reads_){}
+    , decltype(_impl_.seed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.wal_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wal_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_wal_dir().empty()) {
+    _this->_impl_.wal_dir_.Set(from._internal_wal_dir(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_replica_config()) {
+    _this->_impl_.replica_config_ = new ::keyvaluestore::ServerConfig(*from._impl_.replica_config_);
+  }
+  ::memcpy(&_impl_.num_replicas_, &from._impl_.num_replicas_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.seed_) -
+    reinterpret_cast<char*>(&_impl_.num_replicas_)) + sizeof(_impl_.seed_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ClusterBenchConfig)
+}
+
+inline void ClusterBenchConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){arena}
+    , decltype(_impl_.wal_dir_){}
+    , decltype(_impl_.replica_config_){nullptr}
+    , decltype(_impl_.num_replicas_){0}
+    , decltype(_impl_.num_clients_){0}
+    , decltype(_impl_.read_ratio_){0}
+    , decltype(_impl_.duration_s_){0}
+    , decltype(_impl_.num_keys_){0}
+    , decltype(_impl_.value_size_){0}
+    , decltype(_impl_.session_reads_){false}
+    , decltype(_impl_.seed_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.wal_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wal_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ClusterBenchConfig::~ClusterBenchConfig() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ClusterBenchConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClusterBenchConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  _impl_.wal_dir_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.replica_config_;
+}
+
+void ClusterBenchConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClusterBenchConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ClusterBenchConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  _impl_.wal_dir_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.replica_config_ != nullptr) {
+    delete _impl_.replica_config_;
+  }
+  _impl_.replica_config_ = nullptr;
+  ::memset(&_impl_.num_replicas_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.seed_) -
+      reinterpret_cast<char*>(&_impl_.num_replicas_)) + sizeof(_impl_.seed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClusterBenchConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 num_replicas = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.num_replicas_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.ServerConfig replica_config = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_replica_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string wal_dir = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_wal_dir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ClusterBenchConfig.wal_dir"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_clients = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.num_clients_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 duration_s = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.duration_s_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double read_ratio = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.read_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_keys = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.num_keys_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 value_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.value_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.ClusterEvent events = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 seed = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool session_reads = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.session_reads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClusterBenchConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ClusterBenchConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 num_replicas = 1;
+  if (this->_internal_num_replicas() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_replicas(), target);
+  }
+
+  // .keyvaluestore.ServerConfig replica_config = 2;
+  if (this->_internal_has_replica_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::replica_config(this),
+        _Internal::replica_config(this).GetCachedSize(), target, stream);
+  }
+
+  // string wal_dir = 3;
+  if (!this->_internal_wal_dir().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_wal_dir().data(), static_cast<int>(this->_internal_wal_dir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ClusterBenchConfig.wal_dir");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_wal_dir(), target);
+  }
+
+  // int32 num_clients = 4;
+  if (this->_internal_num_clients() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_num_clients(), target);
+  }
+
+  // int32 duration_s = 5;
+  if (this->_internal_duration_s() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_duration_s(), target);
+  }
+
+  // double read_ratio = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = this->_internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_read_ratio(), target);
+  }
+
+  // int32 num_keys = 7;
+  if (this->_internal_num_keys() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_num_keys(), target);
+  }
+
+  // int32 value_size = 8;
+  if (this->_internal_value_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_value_size(), target);
+  }
+
+  // repeated .keyvaluestore.ClusterEvent events = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 seed = 10;
+  if (this->_internal_seed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_seed(), target);
+  }
+
+  // bool session_reads = 11;
+  if (this->_internal_session_reads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_session_reads(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ClusterBenchConfig)
+  return target;
+}
+
+size_t ClusterBenchConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ClusterBenchConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.ClusterEvent events = 9;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string wal_dir = 3;
+  if (!this->_internal_wal_dir().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_wal_dir());
+  }
+
+  // .keyvaluestore.ServerConfig replica_config = 2;
+  if (this->_internal_has_replica_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.replica_config_);
+  }
+
+  // int32 num_replicas = 1;
+  if (this->_internal_num_replicas() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_replicas());
+  }
+
+  // int32 num_clients = 4;
+  if (this->_internal_num_clients() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_clients());
+  }
+
+  // double read_ratio = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = this->_internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 duration_s = 5;
+  if (this->_internal_duration_s() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration_s());
+  }
+
+  // int32 num_keys = 7;
+  if (this->_internal_num_keys() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_keys());
+  }
+
+  // int32 value_size = 8;
+  if (this->_internal_value_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_value_size());
+  }
+
+  // bool session_reads = 11;
+  if (this->_internal_session_reads() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int64 seed = 10;
+  if (this->_internal_seed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_seed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClusterBenchConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClusterBenchConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClusterBenchConfig::GetClassData() const { return &_class_data_; }
+
+
+void ClusterBenchConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClusterBenchConfig*>(&to_msg);
+  auto& from = static_cast<const ClusterBenchConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ClusterBenchConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (!from._internal_wal_dir().empty()) {
+    _this->_internal_set_wal_dir(from._internal_wal_dir());
+  }
+  if (from._internal_has_replica_config()) {
+    _this->_internal_mutable_replica_config()->::keyvaluestore::ServerConfig::MergeFrom(
+        from._internal_replica_config());
+  }
+  if (from._internal_num_replicas() != 0) {
+    _this->_internal_set_num_replicas(from._internal_num_replicas());
+  }
+  if (from._internal_num_clients() != 0) {
+    _this->_internal_set_num_clients(from._internal_num_clients());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_read_ratio = from._internal_read_ratio();
+  uint64_t raw_read_ratio;
+  memcpy(&raw_read_ratio, &tmp_read_ratio, sizeof(tmp_read_ratio));
+  if (raw_read_ratio != 0) {
+    _this->_internal_set_read_ratio(from._internal_read_ratio());
+  }
+  if (from._internal_duration_s() != 0) {
+    _this->_internal_set_duration_s(from._internal_duration_s());
+  }
+  if (from._internal_num_keys() != 0) {
+    _this->_internal_set_num_keys(from._internal_num_keys());
+  }
+  if (from._internal_value_size() != 0) {
+    _this->_internal_set_value_size(from._internal_value_size());
+  }
+  if (from._internal_session_reads() != 0) {
+    _this->_internal_set_session_reads(from._internal_session_reads());
+  }
+  if (from._internal_seed() != 0) {
+    _this->_internal_set_seed(from._internal_seed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClusterBenchConfig::CopyFrom(const ClusterBenchConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ClusterBenchConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClusterBenchConfig::IsInitialized() const {
+  return true;
+}
+
+void ClusterBenchConfig::InternalSwap(ClusterBenchConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.wal_dir_, lhs_arena,
+      &other->_impl_.wal_dir_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClusterBenchConfig, _impl_.seed_)
+      + sizeof(ClusterBenchConfig::_impl_.seed_)
+      - PROTOBUF_FIELD_OFFSET(ClusterBenchConfig, _impl_.replica_config_)>(
+          reinterpret_cast<char*>(&_impl_.replica_config_),
+          reinterpret_cast<char*>(&other->_impl_.replica_config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClusterBenchConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[4]);
+}
+
+// ===================================================================
+
+class GetRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetRequest>()._impl_._has_bits_);
+  static void set_has_min_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::keyvaluestore::WriteToken& min_version(const GetRequest* msg);
+};
+
+const ::keyvaluestore::WriteToken&
+GetRequest::_Internal::min_version(const GetRequest* msg) {
+  return *msg->_impl_.min_version_;
+}
+GetRequest::GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetRequest)
+}
+GetRequest::GetRequest(const GetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.min_version_){nullptr}
+    , decltype(_impl_.min_slot_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_min_version()) {
+    _this->_impl_.min_version_ = new ::keyvaluestore::WriteToken(*from._impl_.min_version_);
+  }
+  _this->_impl_.min_slot_ = from._impl_.min_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetRequest)
+}
+
+inline void GetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.min_version_){nullptr}
+    , decltype(_impl_.min_slot_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetRequest::~GetRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.min_version_;
+}
+
+void GetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.min_version_ != nullptr) {
+    delete _impl_.min_version_;
+  }
+  _impl_.min_version_ = nullptr;
+  _impl_.min_slot_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.GetRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 min_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min_slot(&has_bits);
+          _impl_.min_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WriteToken min_version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min_version(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.GetRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // optional int32 min_slot = 2;
+  if (_internal_has_min_slot()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_min_slot(), target);
+  }
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  if (this->_internal_has_min_version()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::min_version(this),
+        _Internal::min_version(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetRequest)
+  return target;
+}
+
+size_t GetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  if (this->_internal_has_min_version()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_version_);
+  }
+
+  // optional int32 min_slot = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetRequest*>(&to_msg);
+  auto& from = static_cast<const GetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_has_min_version()) {
+    _this->_internal_mutable_min_version()->::keyvaluestore::WriteToken::MergeFrom(
+        from._internal_min_version());
+  }
+  if (from._internal_has_min_slot()) {
+    _this->_internal_set_min_slot(from._internal_min_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetRequest::CopyFrom(const GetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetRequest::IsInitialized() const {
+  return true;
+}
+
+void GetRequest::InternalSwap(GetRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.min_slot_)
+      + sizeof(GetRequest::_impl_.min_slot_)
+      - PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.min_version_)>(
+          reinterpret_cast<char*>(&_impl_.min_version_),
+          reinterpret_cast<char*>(&other->_impl_.min_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[5]);
+}
+
+// ===================================================================
+
+class GetResponse::_Internal {
+ public:
+};
+
+GetResponse::GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetResponse)
+}
+GetResponse::GetResponse(const GetResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetResponse)
+}
+
+inline void GetResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetResponse::~GetResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void GetResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.GetResponse.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.GetResponse.value");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetResponse)
+  return target;
+}
+
+size_t GetResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 1;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetResponse*>(&to_msg);
+  auto& from = static_cast<const GetResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetResponse::CopyFrom(const GetResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetResponse::IsInitialized() const {
+  return true;
+}
+
+void GetResponse::InternalSwap(GetResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[6]);
+}
+
+// ===================================================================
+
+class PutRequest::_Internal {
+ public:
+};
+
+PutRequest::PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.PutRequest)
+}
+PutRequest::PutRequest(const PutRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.PutRequest)
+}
+
+inline void PutRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PutRequest::~PutRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.PutRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PutRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void PutRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PutRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.PutRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.PutRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.PutRequest.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PutRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.PutRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.PutRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.PutRequest.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.PutRequest)
+  return target;
+}
+
+size_t PutRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.PutRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutRequest::GetClassData() const { return &_class_data_; }
+
+
+void PutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutRequest*>(&to_msg);
+  auto& from = static_cast<const PutRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.PutRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PutRequest::CopyFrom(const PutRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.PutRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutRequest::IsInitialized() const {
+  return true;
+}
+
+void PutRequest::InternalSwap(PutRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[7]);
+}
+
+// ===================================================================
+
+class DeleteRequest::_Internal {
+ public:
+};
+
+DeleteRequest::DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.DeleteRequest)
+}
+DeleteRequest::DeleteRequest(const DeleteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.DeleteRequest)
+}
+
+inline void DeleteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeleteRequest::~DeleteRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.DeleteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeleteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void DeleteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeleteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.DeleteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeleteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.DeleteRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeleteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.DeleteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.DeleteRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.DeleteRequest)
+  return target;
+}
+
+size_t DeleteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.DeleteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteRequest::GetClassData() const { return &_class_data_; }
+
+
+void DeleteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteRequest*>(&to_msg);
+  auto& from = static_cast<const DeleteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.DeleteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeleteRequest::CopyFrom(const DeleteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.DeleteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteRequest::IsInitialized() const {
+  return true;
+}
+
+void DeleteRequest::InternalSwap(DeleteRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[8]);
+}
+
+// ===================================================================
+
+class MultiGetRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MultiGetRequest>()._impl_._has_bits_);
+  static void set_has_min_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::keyvaluestore::WriteToken& min_version(const MultiGetRequest* msg);
+};
+
+const ::keyvaluestore::WriteToken&
+MultiGetRequest::_Internal::min_version(const MultiGetRequest* msg) {
+  return *msg->_impl_.min_version_;
+}
+MultiGetRequest::MultiGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.MultiGetRequest)
+}
+MultiGetRequest::MultiGetRequest(const MultiGetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiGetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.min_version_){nullptr}
+    , decltype(_impl_.min_slot_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_min_version()) {
+    _this->_impl_.min_version_ = new ::keyvaluestore::WriteToken(*from._impl_.min_version_);
+  }
+  _this->_impl_.min_slot_ = from._impl_.min_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.MultiGetRequest)
+}
+
+inline void MultiGetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.min_version_){nullptr}
+    , decltype(_impl_.min_slot_){0}
+  };
+}
+
+MultiGetRequest::~MultiGetRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.MultiGetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiGetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.min_version_;
+}
+
+void MultiGetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiGetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.MultiGetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.min_version_ != nullptr) {
+    delete _impl_.min_version_;
+  }
+  _impl_.min_version_ = nullptr;
+  _impl_.min_slot_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.MultiGetRequest.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 min_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min_slot(&has_bits);
+          _impl_.min_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WriteToken min_version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min_version(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiGetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.MultiGetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.MultiGetRequest.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // optional int32 min_slot = 2;
+  if (_internal_has_min_slot()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_min_slot(), target);
+  }
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  if (this->_internal_has_min_version()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::min_version(this),
+        _Internal::min_version(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.MultiGetRequest)
+  return target;
+}
+
+size_t MultiGetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.MultiGetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  if (this->_internal_has_min_version()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_version_);
+  }
+
+  // optional int32 min_slot = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiGetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiGetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiGetRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiGetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiGetRequest*>(&to_msg);
+  auto& from = static_cast<const MultiGetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.MultiGetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (from._internal_has_min_version()) {
+    _this->_internal_mutable_min_version()->::keyvaluestore::WriteToken::MergeFrom(
+        from._internal_min_version());
+  }
+  if (from._internal_has_min_slot()) {
+    _this->_internal_set_min_slot(from._internal_min_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiGetRequest::CopyFrom(const MultiGetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.MultiGetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiGetRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiGetRequest::InternalSwap(MultiGetRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MultiGetRequest, _impl_.min_slot_)
+      + sizeof(MultiGetRequest::_impl_.min_slot_)
+      - PROTOBUF_FIELD_OFFSET(MultiGetRequest, _impl_.min_version_)>(
+          reinterpret_cast<char*>(&_impl_.min_version_),
+          reinterpret_cast<char*>(&other->_impl_.min_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiGetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[9]);
+}
+
+// ===================================================================
+
+class KeyValue::_Internal {
+ public:
+};
+
+KeyValue::KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.KeyValue)
+}
+KeyValue::KeyValue(const KeyValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KeyValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.found_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.found_ = from._impl_.found_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.KeyValue)
+}
+
+inline void KeyValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.found_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+KeyValue::~KeyValue() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.KeyValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void KeyValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void KeyValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KeyValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.KeyValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.found_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KeyValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.KeyValue.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.KeyValue.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool found = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.found_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KeyValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.KeyValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.KeyValue.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.KeyValue.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  // bool found = 3;
+  if (this->_internal_found() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_found(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.KeyValue)
+  return target;
+}
+
+size_t KeyValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.KeyValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // bool found = 3;
+  if (this->_internal_found() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KeyValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KeyValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KeyValue::GetClassData() const { return &_class_data_; }
+
+
+void KeyValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KeyValue*>(&to_msg);
+  auto& from = static_cast<const KeyValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.KeyValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_found() != 0) {
+    _this->_internal_set_found(from._internal_found());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void KeyValue::CopyFrom(const KeyValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.KeyValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool KeyValue::IsInitialized() const {
+  return true;
+}
+
+void KeyValue::InternalSwap(KeyValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.found_, other->_impl_.found_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KeyValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[10]);
+}
+
+// ===================================================================
+
+class MultiGetResponse::_Internal {
+ public:
+};
+
+MultiGetResponse::MultiGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.MultiGetResponse)
+}
+MultiGetResponse::MultiGetResponse(const MultiGetResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiGetResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){from._impl_.pairs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.MultiGetResponse)
+}
+
+inline void MultiGetResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiGetResponse::~MultiGetResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.MultiGetResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiGetResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pairs_.~RepeatedPtrField();
+}
+
+void MultiGetResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiGetResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.MultiGetResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pairs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiGetResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .keyvaluestore.KeyValue pairs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pairs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiGetResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.MultiGetResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.KeyValue pairs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pairs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pairs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.MultiGetResponse)
+  return target;
+}
+
+size_t MultiGetResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.MultiGetResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.KeyValue pairs = 1;
+  total_size += 1UL * this->_internal_pairs_size();
+  for (const auto& msg : this->_impl_.pairs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiGetResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiGetResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiGetResponse::GetClassData() const { return &_class_data_; }
+
+
+void MultiGetResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiGetResponse*>(&to_msg);
+  auto& from = static_cast<const MultiGetResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.MultiGetResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pairs_.MergeFrom(from._impl_.pairs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiGetResponse::CopyFrom(const MultiGetResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.MultiGetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiGetResponse::IsInitialized() const {
+  return true;
+}
+
+void MultiGetResponse::InternalSwap(MultiGetResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pairs_.InternalSwap(&other->_impl_.pairs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiGetResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[11]);
+}
+
+// ===================================================================
+
+class MultiPutRequest::_Internal {
+ public:
+};
+
+MultiPutRequest::MultiPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.MultiPutRequest)
+}
+MultiPutRequest::MultiPutRequest(const MultiPutRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiPutRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){from._impl_.pairs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.MultiPutRequest)
+}
+
+inline void MultiPutRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiPutRequest::~MultiPutRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.MultiPutRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiPutRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pairs_.~RepeatedPtrField();
+}
+
+void MultiPutRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiPutRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.MultiPutRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pairs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiPutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .keyvaluestore.PutRequest pairs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pairs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiPutRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.MultiPutRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.PutRequest pairs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pairs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pairs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.MultiPutRequest)
+  return target;
+}
+
+size_t MultiPutRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.MultiPutRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.PutRequest pairs = 1;
+  total_size += 1UL * this->_internal_pairs_size();
+  for (const auto& msg : this->_impl_.pairs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiPutRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiPutRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiPutRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiPutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiPutRequest*>(&to_msg);
+  auto& from = static_cast<const MultiPutRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.MultiPutRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pairs_.MergeFrom(from._impl_.pairs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiPutRequest::CopyFrom(const MultiPutRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.MultiPutRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiPutRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiPutRequest::InternalSwap(MultiPutRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pairs_.InternalSwap(&other->_impl_.pairs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiPutRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[12]);
+}
+
+// ===================================================================
+
+class MultiDeleteRequest::_Internal {
+ public:
+};
+
+MultiDeleteRequest::MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.MultiDeleteRequest)
+}
+MultiDeleteRequest::MultiDeleteRequest(const MultiDeleteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiDeleteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.MultiDeleteRequest)
+}
+
+inline void MultiDeleteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiDeleteRequest::~MultiDeleteRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.MultiDeleteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiDeleteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void MultiDeleteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiDeleteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.MultiDeleteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiDeleteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.MultiDeleteRequest.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiDeleteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.MultiDeleteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.MultiDeleteRequest.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.MultiDeleteRequest)
+  return target;
+}
+
+size_t MultiDeleteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.MultiDeleteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiDeleteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiDeleteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiDeleteRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiDeleteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiDeleteRequest*>(&to_msg);
+  auto& from = static_cast<const MultiDeleteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.MultiDeleteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiDeleteRequest::CopyFrom(const MultiDeleteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.MultiDeleteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiDeleteRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiDeleteRequest::InternalSwap(MultiDeleteRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiDeleteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[13]);
+}
+
+// ===================================================================
+
+class WriteRequest::_Internal {
+ public:
+};
+
+WriteRequest::WriteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WriteRequest)
+}
+WriteRequest::WriteRequest(const WriteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WriteRequest)
+}
+
+inline void WriteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.id_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteRequest::~WriteRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WriteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+}
+
+void WriteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WriteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.id_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.Operation operations = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WriteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // repeated .keyvaluestore.Operation operations = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WriteRequest)
+  return target;
+}
+
+size_t WriteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WriteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 2;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteRequest*>(&to_msg);
+  auto& from = static_cast<const WriteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WriteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteRequest::CopyFrom(const WriteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WriteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteRequest::InternalSwap(WriteRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[14]);
+}
+
+// ===================================================================
+
+class WriteResponse::_Internal {
+ public:
+  static const ::keyvaluestore::WriteToken& token(const WriteResponse* msg);
+};
+
+const ::keyvaluestore::WriteToken&
+WriteResponse::_Internal::token(const WriteResponse* msg) {
+  return *msg->_impl_.token_;
+}
+WriteResponse::WriteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WriteResponse)
+}
+WriteResponse::WriteResponse(const WriteResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.token_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_token()) {
+    _this->_impl_.token_ = new ::keyvaluestore::WriteToken(*from._impl_.token_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.code_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.code_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WriteResponse)
+}
+
+inline void WriteResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.token_){nullptr}
+    , decltype(_impl_.id_){int64_t{0}}
+    , decltype(_impl_.code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteResponse::~WriteResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WriteResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.token_;
+}
+
+void WriteResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WriteResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_message_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.token_ != nullptr) {
+    delete _impl_.token_;
+  }
+  _impl_.token_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.code_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.code_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.WriteResponse.error_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WriteToken token = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_token(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WriteResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // int32 code = 2;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_code(), target);
+  }
+
+  // string error_message = 3;
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.WriteResponse.error_message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_message(), target);
+  }
+
+  // .keyvaluestore.WriteToken token = 4;
+  if (this->_internal_has_token()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::token(this),
+        _Internal::token(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WriteResponse)
+  return target;
+}
+
+size_t WriteResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WriteResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error_message = 3;
+  if (!this->_internal_error_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
+  }
+
+  // .keyvaluestore.WriteToken token = 4;
+  if (this->_internal_has_token()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.token_);
+  }
+
+  // int64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+
+  // int32 code = 2;
+  if (this->_internal_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteResponse::GetClassData() const { return &_class_data_; }
+
+
+void WriteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteResponse*>(&to_msg);
+  auto& from = static_cast<const WriteResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WriteResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
+  }
+  if (from._internal_has_token()) {
+    _this->_internal_mutable_token()->::keyvaluestore::WriteToken::MergeFrom(
+        from._internal_token());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteResponse::CopyFrom(const WriteResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WriteResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteResponse::IsInitialized() const {
+  return true;
+}
+
+void WriteResponse::InternalSwap(WriteResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteResponse, _impl_.code_)
+      + sizeof(WriteResponse::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(WriteResponse, _impl_.token_)>(
+          reinterpret_cast<char*>(&_impl_.token_),
+          reinterpret_cast<char*>(&other->_impl_.token_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[15]);
+}
+
+// ===================================================================
+
+class WriteBatchRequest::_Internal {
+ public:
+};
+
+WriteBatchRequest::WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WriteBatchRequest)
+}
+WriteBatchRequest::WriteBatchRequest(const WriteBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WriteBatchRequest)
+}
+
+inline void WriteBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteBatchRequest::~WriteBatchRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WriteBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+}
+
+void WriteBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WriteBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .keyvaluestore.Operation operations = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WriteBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WriteBatchRequest)
+  return target;
+}
+
+size_t WriteBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WriteBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 1;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteBatchRequest*>(&to_msg);
+  auto& from = static_cast<const WriteBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WriteBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteBatchRequest::CopyFrom(const WriteBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WriteBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteBatchRequest::InternalSwap(WriteBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[16]);
+}
+
+// ===================================================================
+
+class CommitResponse::_Internal {
+ public:
+};
+
+CommitResponse::CommitResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.CommitResponse)
+}
+CommitResponse::CommitResponse(const CommitResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slot_ = from._impl_.slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.CommitResponse)
+}
+
+inline void CommitResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommitResponse::~CommitResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.CommitResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CommitResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.CommitResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.CommitResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.CommitResponse)
+  return target;
+}
+
+size_t CommitResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.CommitResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitResponse::GetClassData() const { return &_class_data_; }
+
+
+void CommitResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitResponse*>(&to_msg);
+  auto& from = static_cast<const CommitResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.CommitResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitResponse::CopyFrom(const CommitResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.CommitResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitResponse::IsInitialized() const {
+  return true;
+}
+
+void CommitResponse::InternalSwap(CommitResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.slot_, other->_impl_.slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[17]);
+}
+
+// ===================================================================
+
+WriteToken_SlotsEntry_DoNotUse::WriteToken_SlotsEntry_DoNotUse() {}
+WriteToken_SlotsEntry_DoNotUse::WriteToken_SlotsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void WriteToken_SlotsEntry_DoNotUse::MergeFrom(const WriteToken_SlotsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata WriteToken_SlotsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[18]);
+}
+
+// ===================================================================
+
+class WriteToken::_Internal {
+ public:
+};
+
+WriteToken::WriteToken(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &WriteToken::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WriteToken)
+}
+WriteToken::WriteToken(const WriteToken& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteToken* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.slots_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WriteToken)
+}
+
+inline void WriteToken::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.slots_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteToken::~WriteToken() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WriteToken)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteToken::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.Destruct();
+  _impl_.slots_.~MapField();
+}
+
+void WriteToken::ArenaDtor(void* object) {
+  WriteToken* _this = reinterpret_cast< WriteToken* >(object);
+  _this->_impl_.slots_.Destruct();
+}
+void WriteToken::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteToken::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WriteToken)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteToken::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<int32, int32> slots = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.slots_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteToken::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WriteToken)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, int32> slots = 1;
+  if (!this->_internal_slots().empty()) {
+    using MapType = ::_pb::Map<int32_t, int32_t>;
+    using WireHelper = WriteToken_SlotsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_slots();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WriteToken)
+  return target;
+}
+
+size_t WriteToken::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WriteToken)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, int32> slots = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_slots_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >::const_iterator
+      it = this->_internal_slots().begin();
+      it != this->_internal_slots().end(); ++it) {
+    total_size += WriteToken_SlotsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteToken::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteToken::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteToken::GetClassData() const { return &_class_data_; }
+
+
+void WriteToken::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteToken*>(&to_msg);
+  auto& from = static_cast<const WriteToken&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WriteToken)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteToken::CopyFrom(const WriteToken& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WriteToken)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteToken::IsInitialized() const {
+  return true;
+}
+
+void WriteToken::InternalSwap(WriteToken* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteToken::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[19]);
+}
+
+// ===================================================================
+
+class ElectCoordinatorRequest::_Internal {
+ public:
+};
+
+ElectCoordinatorRequest::ElectCoordinatorRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ElectCoordinatorRequest)
+}
+ElectCoordinatorRequest::ElectCoordinatorRequest(const ElectCoordinatorRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ElectCoordinatorRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.coordinator_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.coordinator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_coordinator().empty()) {
+    _this->_impl_.coordinator_.Set(from._internal_coordinator(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ElectCoordinatorRequest)
+}
+
+inline void ElectCoordinatorRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.coordinator_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.coordinator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ElectCoordinatorRequest::~ElectCoordinatorRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ElectCoordinatorRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ElectCoordinatorRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.coordinator_.Destroy();
+}
+
+void ElectCoordinatorRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ElectCoordinatorRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ElectCoordinatorRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.coordinator_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ElectCoordinatorRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ElectCoordinatorRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string coordinator = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_coordinator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ElectCoordinatorRequest.coordinator"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ElectCoordinatorRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ElectCoordinatorRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ElectCoordinatorRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // string coordinator = 2;
+  if (!this->_internal_coordinator().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_coordinator().data(), static_cast<int>(this->_internal_coordinator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ElectCoordinatorRequest.coordinator");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_coordinator(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ElectCoordinatorRequest)
+  return target;
+}
+
+size_t ElectCoordinatorRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ElectCoordinatorRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string coordinator = 2;
+  if (!this->_internal_coordinator().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_coordinator());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ElectCoordinatorRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ElectCoordinatorRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ElectCoordinatorRequest::GetClassData() const { return &_class_data_; }
+
+
+void ElectCoordinatorRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ElectCoordinatorRequest*>(&to_msg);
+  auto& from = static_cast<const ElectCoordinatorRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ElectCoordinatorRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_coordinator().empty()) {
+    _this->_internal_set_coordinator(from._internal_coordinator());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ElectCoordinatorRequest::CopyFrom(const ElectCoordinatorRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ElectCoordinatorRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ElectCoordinatorRequest::IsInitialized() const {
+  return true;
+}
+
+void ElectCoordinatorRequest::InternalSwap(ElectCoordinatorRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.coordinator_, lhs_arena,
+      &other->_impl_.coordinator_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ElectCoordinatorRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[20]);
+}
+
+// ===================================================================
+
+class GetCoordinatorResponse::_Internal {
+ public:
+};
+
+GetCoordinatorResponse::GetCoordinatorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetCoordinatorResponse)
+}
+GetCoordinatorResponse::GetCoordinatorResponse(const GetCoordinatorResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetCoordinatorResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.coordinator_){}
+    , decltype(_impl_.term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.coordinator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_coordinator().empty()) {
+    _this->_impl_.coordinator_.Set(from._internal_coordinator(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.term_ = from._impl_.term_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetCoordinatorResponse)
+}
+
+inline void GetCoordinatorResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.coordinator_){}
+    , decltype(_impl_.term_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.coordinator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetCoordinatorResponse::~GetCoordinatorResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetCoordinatorResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetCoordinatorResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.coordinator_.Destroy();
+}
+
+void GetCoordinatorResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetCoordinatorResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetCoordinatorResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.coordinator_.ClearToEmpty();
+  _impl_.term_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetCoordinatorResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string coordinator = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_coordinator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.GetCoordinatorResponse.coordinator"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetCoordinatorResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetCoordinatorResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string coordinator = 1;
+  if (!this->_internal_coordinator().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_coordinator().data(), static_cast<int>(this->_internal_coordinator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.GetCoordinatorResponse.coordinator");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_coordinator(), target);
+  }
+
+  // int32 term = 2;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetCoordinatorResponse)
+  return target;
+}
+
+size_t GetCoordinatorResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetCoordinatorResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string coordinator = 1;
+  if (!this->_internal_coordinator().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_coordinator());
+  }
+
+  // int32 term = 2;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCoordinatorResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetCoordinatorResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCoordinatorResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetCoordinatorResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCoordinatorResponse*>(&to_msg);
+  auto& from = static_cast<const GetCoordinatorResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetCoordinatorResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_coordinator().empty()) {
+    _this->_internal_set_coordinator(from._internal_coordinator());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetCoordinatorResponse::CopyFrom(const GetCoordinatorResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetCoordinatorResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetCoordinatorResponse::IsInitialized() const {
+  return true;
+}
+
+void GetCoordinatorResponse::InternalSwap(GetCoordinatorResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.coordinator_, lhs_arena,
+      &other->_impl_.coordinator_, rhs_arena
+  );
+  swap(_impl_.term_, other->_impl_.term_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetCoordinatorResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[21]);
+}
+
+// ===================================================================
+
+class GetLeaderResponse::_Internal {
+ public:
+};
+
+GetLeaderResponse::GetLeaderResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetLeaderResponse)
+}
+GetLeaderResponse::GetLeaderResponse(const GetLeaderResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetLeaderResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groups_){from._impl_.groups_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetLeaderResponse)
+}
+
+inline void GetLeaderResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.groups_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetLeaderResponse::~GetLeaderResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetLeaderResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetLeaderResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.groups_.~RepeatedPtrField();
+}
+
+void GetLeaderResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetLeaderResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetLeaderResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.groups_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetLeaderResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .keyvaluestore.GetCoordinatorResponse groups = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetLeaderResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetLeaderResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.GetCoordinatorResponse groups = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetLeaderResponse)
+  return target;
+}
+
+size_t GetLeaderResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetLeaderResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.GetCoordinatorResponse groups = 1;
+  total_size += 1UL * this->_internal_groups_size();
+  for (const auto& msg : this->_impl_.groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetLeaderResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetLeaderResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetLeaderResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetLeaderResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetLeaderResponse*>(&to_msg);
+  auto& from = static_cast<const GetLeaderResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetLeaderResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.groups_.MergeFrom(from._impl_.groups_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetLeaderResponse::CopyFrom(const GetLeaderResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetLeaderResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetLeaderResponse::IsInitialized() const {
+  return true;
+}
+
+void GetLeaderResponse::InternalSwap(GetLeaderResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.groups_.InternalSwap(&other->_impl_.groups_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetLeaderResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[22]);
+}
+
+// ===================================================================
+
+class ReadIndexRequest::_Internal {
+ public:
+};
+
+ReadIndexRequest::ReadIndexRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ReadIndexRequest)
+}
+ReadIndexRequest::ReadIndexRequest(const ReadIndexRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ReadIndexRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ReadIndexRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[23]);
+}
+
+// ===================================================================
+
+class ReadIndexResponse::_Internal {
+ public:
+};
+
+ReadIndexResponse::ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ReadIndexResponse)
+}
+ReadIndexResponse::ReadIndexResponse(const ReadIndexResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadIndexResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slot_ = from._impl_.slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ReadIndexResponse)
+}
+
+inline void ReadIndexResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadIndexResponse::~ReadIndexResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ReadIndexResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadIndexResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReadIndexResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadIndexResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ReadIndexResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadIndexResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadIndexResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ReadIndexResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ReadIndexResponse)
+  return target;
+}
+
+size_t ReadIndexResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ReadIndexResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadIndexResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexResponse::GetClassData() const { return &_class_data_; }
+
+
+void ReadIndexResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadIndexResponse*>(&to_msg);
+  auto& from = static_cast<const ReadIndexResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ReadIndexResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadIndexResponse::CopyFrom(const ReadIndexResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ReadIndexResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadIndexResponse::IsInitialized() const {
+  return true;
+}
+
+void ReadIndexResponse::InternalSwap(ReadIndexResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.slot_, other->_impl_.slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[24]);
+}
+
+// ===================================================================
+
+class Operation::_Internal {
+ public:
+};
+
+Operation::Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.Operation)
+}
+Operation::Operation(const Operation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Operation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.Operation)
+}
+
+inline void Operation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Operation::~Operation() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.Operation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Operation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void Operation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Operation::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.Operation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Operation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.Operation.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.OperationType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::keyvaluestore::OperationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.Operation.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Operation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.Operation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.Operation.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // .keyvaluestore.OperationType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // string value = 3;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.Operation.value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.Operation)
+  return target;
+}
+
+size_t Operation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.Operation)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // .keyvaluestore.OperationType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Operation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Operation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Operation::GetClassData() const { return &_class_data_; }
+
+
+void Operation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Operation*>(&to_msg);
+  auto& from = static_cast<const Operation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.Operation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Operation::CopyFrom(const Operation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.Operation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Operation::IsInitialized() const {
+  return true;
+}
+
+void Operation::InternalSwap(Operation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Operation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[25]);
+}
+
+// ===================================================================
+
+class PrepareRequest::_Internal {
+ public:
+};
+
+PrepareRequest::PrepareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.PrepareRequest)
+}
+PrepareRequest::PrepareRequest(const PrepareRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrepareRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.round_){}
+    , decltype(_impl_.propose_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.round_, &from._impl_.round_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.propose_id_) -
+    reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.propose_id_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.PrepareRequest)
+}
+
+inline void PrepareRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.round_){0}
+    , decltype(_impl_.propose_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrepareRequest::~PrepareRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.PrepareRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrepareRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void PrepareRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrepareRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.PrepareRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  ::memset(&_impl_.round_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.propose_id_) -
+      reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.propose_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrepareRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.PrepareRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 round = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 propose_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.propose_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrepareRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.PrepareRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.PrepareRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_round(), target);
+  }
+
+  // int32 propose_id = 3;
+  if (this->_internal_propose_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_propose_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.PrepareRequest)
+  return target;
+}
+
+size_t PrepareRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.PrepareRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  // int32 propose_id = 3;
+  if (this->_internal_propose_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_propose_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrepareRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrepareRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrepareRequest::GetClassData() const { return &_class_data_; }
+
+
+void PrepareRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrepareRequest*>(&to_msg);
+  auto& from = static_cast<const PrepareRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.PrepareRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  if (from._internal_propose_id() != 0) {
+    _this->_internal_set_propose_id(from._internal_propose_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrepareRequest::CopyFrom(const PrepareRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.PrepareRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrepareRequest::IsInitialized() const {
+  return true;
+}
+
+void PrepareRequest::InternalSwap(PrepareRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrepareRequest, _impl_.propose_id_)
+      + sizeof(PrepareRequest::_impl_.propose_id_)
+      - PROTOBUF_FIELD_OFFSET(PrepareRequest, _impl_.round_)>(
+          reinterpret_cast<char*>(&_impl_.round_),
+          reinterpret_cast<char*>(&other->_impl_.round_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrepareRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[26]);
+}
+
+// ===================================================================
+
+class PromiseResponse::_Internal {
+ public:
+};
+
+PromiseResponse::PromiseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.PromiseResponse)
+}
+PromiseResponse::PromiseResponse(const PromiseResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PromiseResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.round_){}
+    , decltype(_impl_.propose_id_){}
+    , decltype(_impl_.accepted_id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.round_, &from._impl_.round_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.PromiseResponse)
+}
+
+inline void PromiseResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.round_){0}
+    , decltype(_impl_.propose_id_){0}
+    , decltype(_impl_.accepted_id_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PromiseResponse::~PromiseResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.PromiseResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PromiseResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void PromiseResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PromiseResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.PromiseResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.round_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PromiseResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 round = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 propose_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.propose_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 accepted_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.accepted_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.OperationType type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::keyvaluestore::OperationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.PromiseResponse.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PromiseResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.PromiseResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 round = 1;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_round(), target);
+  }
+
+  // int32 propose_id = 2;
+  if (this->_internal_propose_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_propose_id(), target);
+  }
+
+  // int32 accepted_id = 3;
+  if (this->_internal_accepted_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_accepted_id(), target);
+  }
+
+  // .keyvaluestore.OperationType type = 4;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_type(), target);
+  }
+
+  // string value = 5;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.PromiseResponse.value");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.PromiseResponse)
+  return target;
+}
+
+size_t PromiseResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.PromiseResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 5;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // int32 round = 1;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  // int32 propose_id = 2;
+  if (this->_internal_propose_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_propose_id());
+  }
+
+  // int32 accepted_id = 3;
+  if (this->_internal_accepted_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_accepted_id());
+  }
+
+  // .keyvaluestore.OperationType type = 4;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PromiseResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PromiseResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PromiseResponse::GetClassData() const { return &_class_data_; }
+
+
+void PromiseResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PromiseResponse*>(&to_msg);
+  auto& from = static_cast<const PromiseResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.PromiseResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  if (from._internal_propose_id() != 0) {
+    _this->_internal_set_propose_id(from._internal_propose_id());
+  }
+  if (from._internal_accepted_id() != 0) {
+    _this->_internal_set_accepted_id(from._internal_accepted_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PromiseResponse::CopyFrom(const PromiseResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.PromiseResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PromiseResponse::IsInitialized() const {
+  return true;
+}
+
+void PromiseResponse::InternalSwap(PromiseResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PromiseResponse, _impl_.type_)
+      + sizeof(PromiseResponse::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(PromiseResponse, _impl_.round_)>(
+          reinterpret_cast<char*>(&_impl_.round_),
+          reinterpret_cast<char*>(&other->_impl_.round_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PromiseResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[27]);
+}
+
+// ===================================================================
+
+class ProposeRequest::_Internal {
+ public:
+};
+
+ProposeRequest::ProposeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.ProposeRequest)
+}
+ProposeRequest::ProposeRequest(const ProposeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProposeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.round_){}
+    , decltype(_impl_.propose_id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.round_, &from._impl_.round_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.ProposeRequest)
+}
+
+inline void ProposeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.round_){0}
+    , decltype(_impl_.propose_id_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProposeRequest::~ProposeRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.ProposeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProposeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void ProposeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProposeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.ProposeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.round_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProposeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ProposeRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 round = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 propose_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.propose_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.OperationType type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::keyvaluestore::OperationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.ProposeRequest.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.Operation operations = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProposeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.ProposeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ProposeRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_round(), target);
+  }
+
+  // int32 propose_id = 3;
+  if (this->_internal_propose_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_propose_id(), target);
+  }
+
+  // .keyvaluestore.OperationType type = 4;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_type(), target);
+  }
+
+  // string value = 5;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.ProposeRequest.value");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_value(), target);
+  }
+
+  // repeated .keyvaluestore.Operation operations = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.ProposeRequest)
+  return target;
+}
+
+size_t ProposeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.ProposeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 6;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // string value = 5;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  // int32 propose_id = 3;
+  if (this->_internal_propose_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_propose_id());
+  }
+
+  // .keyvaluestore.OperationType type = 4;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProposeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProposeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProposeRequest::GetClassData() const { return &_class_data_; }
+
+
+void ProposeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProposeRequest*>(&to_msg);
+  auto& from = static_cast<const ProposeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.ProposeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  if (from._internal_propose_id() != 0) {
+    _this->_internal_set_propose_id(from._internal_propose_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProposeRequest::CopyFrom(const ProposeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.ProposeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProposeRequest::IsInitialized() const {
+  return true;
+}
+
+void ProposeRequest::InternalSwap(ProposeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProposeRequest, _impl_.type_)
+      + sizeof(ProposeRequest::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(ProposeRequest, _impl_.round_)>(
+          reinterpret_cast<char*>(&_impl_.round_),
+          reinterpret_cast<char*>(&other->_impl_.round_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProposeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[28]);
+}
+
+// ===================================================================
+
+class AcceptResponse::_Internal {
+ public:
+};
+
+AcceptResponse::AcceptResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.AcceptResponse)
+}
+AcceptResponse::AcceptResponse(const AcceptResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AcceptResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.round_){}
+    , decltype(_impl_.propose_id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.round_, &from._impl_.round_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.AcceptResponse)
+}
+
+inline void AcceptResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.round_){0}
+    , decltype(_impl_.propose_id_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AcceptResponse::~AcceptResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.AcceptResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AcceptResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+  _impl_.value_.Destroy();
+}
+
+void AcceptResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AcceptResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.AcceptResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.round_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.round_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AcceptResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 round = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 propose_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.propose_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.OperationType type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::keyvaluestore::OperationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.AcceptResponse.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.Operation operations = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AcceptResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.AcceptResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 round = 1;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_round(), target);
+  }
+
+  // int32 propose_id = 2;
+  if (this->_internal_propose_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_propose_id(), target);
+  }
+
+  // .keyvaluestore.OperationType type = 3;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  // string value = 4;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.AcceptResponse.value");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // repeated .keyvaluestore.Operation operations = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.AcceptResponse)
+  return target;
+}
+
+size_t AcceptResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.AcceptResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 5;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // int32 round = 1;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  // int32 propose_id = 2;
+  if (this->_internal_propose_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_propose_id());
+  }
+
+  // .keyvaluestore.OperationType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AcceptResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AcceptResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AcceptResponse::GetClassData() const { return &_class_data_; }
+
+
+void AcceptResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AcceptResponse*>(&to_msg);
+  auto& from = static_cast<const AcceptResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.AcceptResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  if (from._internal_propose_id() != 0) {
+    _this->_internal_set_propose_id(from._internal_propose_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AcceptResponse::CopyFrom(const AcceptResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.AcceptResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AcceptResponse::IsInitialized() const {
+  return true;
+}
+
+void AcceptResponse::InternalSwap(AcceptResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AcceptResponse, _impl_.type_)
+      + sizeof(AcceptResponse::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(AcceptResponse, _impl_.round_)>(
+          reinterpret_cast<char*>(&_impl_.round_),
+          reinterpret_cast<char*>(&other->_impl_.round_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AcceptResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[29]);
+}
+
+// ===================================================================
+
+class InformRequest::_Internal {
+ public:
+  static const ::keyvaluestore::AcceptResponse& acceptance(const InformRequest* msg);
+};
+
+const ::keyvaluestore::AcceptResponse&
+InformRequest::_Internal::acceptance(const InformRequest* msg) {
+  return *msg->_impl_.acceptance_;
+}
+InformRequest::InformRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.InformRequest)
+}
+InformRequest::InformRequest(const InformRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InformRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.acceptance_){nullptr}
+    , decltype(_impl_.compactable_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_acceptance()) {
+    _this->_impl_.acceptance_ = new ::keyvaluestore::AcceptResponse(*from._impl_.acceptance_);
+  }
+  _this->_impl_.compactable_slot_ = from._impl_.compactable_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.InformRequest)
+}
+
+inline void InformRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.acceptance_){nullptr}
+    , decltype(_impl_.compactable_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InformRequest::~InformRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.InformRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InformRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.acceptance_;
+}
+
+void InformRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InformRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.InformRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.acceptance_ != nullptr) {
+    delete _impl_.acceptance_;
+  }
+  _impl_.acceptance_ = nullptr;
+  _impl_.compactable_slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InformRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.InformRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.AcceptResponse acceptance = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acceptance(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compactable_slot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.compactable_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InformRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.InformRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.InformRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // .keyvaluestore.AcceptResponse acceptance = 2;
+  if (this->_internal_has_acceptance()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::acceptance(this),
+        _Internal::acceptance(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 compactable_slot = 3;
+  if (this->_internal_compactable_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_compactable_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.InformRequest)
+  return target;
+}
+
+size_t InformRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.InformRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // .keyvaluestore.AcceptResponse acceptance = 2;
+  if (this->_internal_has_acceptance()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.acceptance_);
+  }
+
+  // int32 compactable_slot = 3;
+  if (this->_internal_compactable_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compactable_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InformRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InformRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InformRequest::GetClassData() const { return &_class_data_; }
+
+
+void InformRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InformRequest*>(&to_msg);
+  auto& from = static_cast<const InformRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.InformRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_has_acceptance()) {
+    _this->_internal_mutable_acceptance()->::keyvaluestore::AcceptResponse::MergeFrom(
+        from._internal_acceptance());
+  }
+  if (from._internal_compactable_slot() != 0) {
+    _this->_internal_set_compactable_slot(from._internal_compactable_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InformRequest::CopyFrom(const InformRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.InformRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InformRequest::IsInitialized() const {
+  return true;
+}
+
+void InformRequest::InternalSwap(InformRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InformRequest, _impl_.compactable_slot_)
+      + sizeof(InformRequest::_impl_.compactable_slot_)
+      - PROTOBUF_FIELD_OFFSET(InformRequest, _impl_.acceptance_)>(
+          reinterpret_cast<char*>(&_impl_.acceptance_),
+          reinterpret_cast<char*>(&other->_impl_.acceptance_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InformRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[30]);
+}
+
+// ===================================================================
+
+class InformResponse::_Internal {
+ public:
+};
+
+InformResponse::InformResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.InformResponse)
+}
+InformResponse::InformResponse(const InformResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InformResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.applied_slot_ = from._impl_.applied_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.InformResponse)
+}
+
+inline void InformResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InformResponse::~InformResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.InformResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InformResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InformResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InformResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.InformResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applied_slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InformResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 applied_slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.applied_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InformResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.InformResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 applied_slot = 1;
+  if (this->_internal_applied_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_applied_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.InformResponse)
+  return target;
+}
+
+size_t InformResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.InformResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 applied_slot = 1;
+  if (this->_internal_applied_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InformResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InformResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InformResponse::GetClassData() const { return &_class_data_; }
+
+
+void InformResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InformResponse*>(&to_msg);
+  auto& from = static_cast<const InformResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.InformResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_applied_slot() != 0) {
+    _this->_internal_set_applied_slot(from._internal_applied_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InformResponse::CopyFrom(const InformResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.InformResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InformResponse::IsInitialized() const {
+  return true;
+}
+
+void InformResponse::InternalSwap(InformResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.applied_slot_, other->_impl_.applied_slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InformResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[31]);
+}
+
+// ===================================================================
+
+class PaxosLog::_Internal {
+ public:
+};
+
+PaxosLog::PaxosLog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.PaxosLog)
+}
+PaxosLog::PaxosLog(const PaxosLog& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PaxosLog* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accepted_operations_){from._impl_.accepted_operations_}
+    , decltype(_impl_.accepted_value_){}
+    , decltype(_impl_.promised_id_){}
+    , decltype(_impl_.accepted_id_){}
+    , decltype(_impl_.accepted_type_){}
+    , decltype(_impl_.chosen_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.accepted_value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accepted_value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_accepted_value().empty()) {
+    _this->_impl_.accepted_value_.Set(from._internal_accepted_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.promised_id_, &from._impl_.promised_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chosen_) -
+    reinterpret_cast<char*>(&_impl_.promised_id_)) + sizeof(_impl_.chosen_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.PaxosLog)
+}
+
+inline void PaxosLog::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accepted_operations_){arena}
+    , decltype(_impl_.accepted_value_){}
+    , decltype(_impl_.promised_id_){0}
+    , decltype(_impl_.accepted_id_){0}
+    , decltype(_impl_.accepted_type_){0}
+    , decltype(_impl_.chosen_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.accepted_value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.accepted_value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PaxosLog::~PaxosLog() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.PaxosLog)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PaxosLog::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.accepted_operations_.~RepeatedPtrField();
+  _impl_.accepted_value_.Destroy();
+}
+
+void PaxosLog::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PaxosLog::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.PaxosLog)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.accepted_operations_.Clear();
+  _impl_.accepted_value_.ClearToEmpty();
+  ::memset(&_impl_.promised_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.chosen_) -
+      reinterpret_cast<char*>(&_impl_.promised_id_)) + sizeof(_impl_.chosen_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PaxosLog::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 promised_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.promised_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 accepted_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.accepted_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.OperationType accepted_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_accepted_type(static_cast<::keyvaluestore::OperationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string accepted_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_accepted_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.PaxosLog.accepted_value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool chosen = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.chosen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.Operation accepted_operations = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_accepted_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PaxosLog::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.PaxosLog)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 promised_id = 1;
+  if (this->_internal_promised_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_promised_id(), target);
+  }
+
+  // int32 accepted_id = 2;
+  if (this->_internal_accepted_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_accepted_id(), target);
+  }
+
+  // .keyvaluestore.OperationType accepted_type = 3;
+  if (this->_internal_accepted_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_accepted_type(), target);
+  }
+
+  // string accepted_value = 4;
+  if (!this->_internal_accepted_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_accepted_value().data(), static_cast<int>(this->_internal_accepted_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.PaxosLog.accepted_value");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_accepted_value(), target);
+  }
+
+  // bool chosen = 5;
+  if (this->_internal_chosen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_chosen(), target);
+  }
+
+  // repeated .keyvaluestore.Operation accepted_operations = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_accepted_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_accepted_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.PaxosLog)
+  return target;
+}
+
+size_t PaxosLog::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.PaxosLog)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation accepted_operations = 6;
+  total_size += 1UL * this->_internal_accepted_operations_size();
+  for (const auto& msg : this->_impl_.accepted_operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string accepted_value = 4;
+  if (!this->_internal_accepted_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_accepted_value());
+  }
+
+  // int32 promised_id = 1;
+  if (this->_internal_promised_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_promised_id());
+  }
+
+  // int32 accepted_id = 2;
+  if (this->_internal_accepted_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_accepted_id());
+  }
+
+  // .keyvaluestore.OperationType accepted_type = 3;
+  if (this->_internal_accepted_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_accepted_type());
+  }
+
+  // bool chosen = 5;
+  if (this->_internal_chosen() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PaxosLog::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PaxosLog::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PaxosLog::GetClassData() const { return &_class_data_; }
+
+
+void PaxosLog::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PaxosLog*>(&to_msg);
+  auto& from = static_cast<const PaxosLog&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.PaxosLog)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.accepted_operations_.MergeFrom(from._impl_.accepted_operations_);
+  if (!from._internal_accepted_value().empty()) {
+    _this->_internal_set_accepted_value(from._internal_accepted_value());
+  }
+  if (from._internal_promised_id() != 0) {
+    _this->_internal_set_promised_id(from._internal_promised_id());
+  }
+  if (from._internal_accepted_id() != 0) {
+    _this->_internal_set_accepted_id(from._internal_accepted_id());
+  }
+  if (from._internal_accepted_type() != 0) {
+    _this->_internal_set_accepted_type(from._internal_accepted_type());
+  }
+  if (from._internal_chosen() != 0) {
+    _this->_internal_set_chosen(from._internal_chosen());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PaxosLog::CopyFrom(const PaxosLog& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.PaxosLog)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PaxosLog::IsInitialized() const {
+  return true;
+}
+
+void PaxosLog::InternalSwap(PaxosLog* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.accepted_operations_.InternalSwap(&other->_impl_.accepted_operations_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.accepted_value_, lhs_arena,
+      &other->_impl_.accepted_value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PaxosLog, _impl_.chosen_)
+      + sizeof(PaxosLog::_impl_.chosen_)
+      - PROTOBUF_FIELD_OFFSET(PaxosLog, _impl_.promised_id_)>(
+          reinterpret_cast<char*>(&_impl_.promised_id_),
+          reinterpret_cast<char*>(&other->_impl_.promised_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PaxosLog::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[32]);
+}
+
+// ===================================================================
+
+class LeaderPrepareRequest::_Internal {
+ public:
+};
+
+LeaderPrepareRequest::LeaderPrepareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.LeaderPrepareRequest)
+}
+LeaderPrepareRequest::LeaderPrepareRequest(const LeaderPrepareRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LeaderPrepareRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ballot_){}
+    , decltype(_impl_.from_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ballot_, &from._impl_.ballot_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.from_slot_) -
+    reinterpret_cast<char*>(&_impl_.ballot_)) + sizeof(_impl_.from_slot_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.LeaderPrepareRequest)
+}
+
+inline void LeaderPrepareRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ballot_){0}
+    , decltype(_impl_.from_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LeaderPrepareRequest::~LeaderPrepareRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.LeaderPrepareRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LeaderPrepareRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LeaderPrepareRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LeaderPrepareRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.LeaderPrepareRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ballot_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.from_slot_) -
+      reinterpret_cast<char*>(&_impl_.ballot_)) + sizeof(_impl_.from_slot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LeaderPrepareRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 ballot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ballot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 from_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.from_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LeaderPrepareRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.LeaderPrepareRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 ballot = 1;
+  if (this->_internal_ballot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ballot(), target);
+  }
+
+  // int32 from_slot = 2;
+  if (this->_internal_from_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_from_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.LeaderPrepareRequest)
+  return target;
+}
+
+size_t LeaderPrepareRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.LeaderPrepareRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 ballot = 1;
+  if (this->_internal_ballot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ballot());
+  }
+
+  // int32 from_slot = 2;
+  if (this->_internal_from_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_from_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LeaderPrepareRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LeaderPrepareRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderPrepareRequest::GetClassData() const { return &_class_data_; }
+
+
+void LeaderPrepareRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LeaderPrepareRequest*>(&to_msg);
+  auto& from = static_cast<const LeaderPrepareRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.LeaderPrepareRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ballot() != 0) {
+    _this->_internal_set_ballot(from._internal_ballot());
+  }
+  if (from._internal_from_slot() != 0) {
+    _this->_internal_set_from_slot(from._internal_from_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LeaderPrepareRequest::CopyFrom(const LeaderPrepareRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.LeaderPrepareRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LeaderPrepareRequest::IsInitialized() const {
+  return true;
+}
+
+void LeaderPrepareRequest::InternalSwap(LeaderPrepareRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LeaderPrepareRequest, _impl_.from_slot_)
+      + sizeof(LeaderPrepareRequest::_impl_.from_slot_)
+      - PROTOBUF_FIELD_OFFSET(LeaderPrepareRequest, _impl_.ballot_)>(
+          reinterpret_cast<char*>(&_impl_.ballot_),
+          reinterpret_cast<char*>(&other->_impl_.ballot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LeaderPrepareRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[33]);
+}
+
+// ===================================================================
+
+class LeaderPromiseResponse_Accepted::_Internal {
+ public:
+  static const ::keyvaluestore::PaxosLog& log(const LeaderPromiseResponse_Accepted* msg);
+};
+
+const ::keyvaluestore::PaxosLog&
+LeaderPromiseResponse_Accepted::_Internal::log(const LeaderPromiseResponse_Accepted* msg) {
+  return *msg->_impl_.log_;
+}
+LeaderPromiseResponse_Accepted::LeaderPromiseResponse_Accepted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.LeaderPromiseResponse.Accepted)
+}
+LeaderPromiseResponse_Accepted::LeaderPromiseResponse_Accepted(const LeaderPromiseResponse_Accepted& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LeaderPromiseResponse_Accepted* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_){nullptr}
+    , decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_log()) {
+    _this->_impl_.log_ = new ::keyvaluestore::PaxosLog(*from._impl_.log_);
+  }
+  _this->_impl_.slot_ = from._impl_.slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.LeaderPromiseResponse.Accepted)
+}
+
+inline void LeaderPromiseResponse_Accepted::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_){nullptr}
+    , decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LeaderPromiseResponse_Accepted::~LeaderPromiseResponse_Accepted() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.LeaderPromiseResponse.Accepted)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LeaderPromiseResponse_Accepted::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.log_;
+}
+
+void LeaderPromiseResponse_Accepted::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LeaderPromiseResponse_Accepted::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.LeaderPromiseResponse.Accepted)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.log_ != nullptr) {
+    delete _impl_.log_;
+  }
+  _impl_.log_ = nullptr;
+  _impl_.slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LeaderPromiseResponse_Accepted::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.PaxosLog log = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_log(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LeaderPromiseResponse_Accepted::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.LeaderPromiseResponse.Accepted)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_slot(), target);
+  }
+
+  // .keyvaluestore.PaxosLog log = 2;
+  if (this->_internal_has_log()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::log(this),
+        _Internal::log(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.LeaderPromiseResponse.Accepted)
+  return target;
+}
+
+size_t LeaderPromiseResponse_Accepted::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.LeaderPromiseResponse.Accepted)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .keyvaluestore.PaxosLog log = 2;
+  if (this->_internal_has_log()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.log_);
+  }
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LeaderPromiseResponse_Accepted::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LeaderPromiseResponse_Accepted::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderPromiseResponse_Accepted::GetClassData() const { return &_class_data_; }
+
+
+void LeaderPromiseResponse_Accepted::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LeaderPromiseResponse_Accepted*>(&to_msg);
+  auto& from = static_cast<const LeaderPromiseResponse_Accepted&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.LeaderPromiseResponse.Accepted)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_log()) {
+    _this->_internal_mutable_log()->::keyvaluestore::PaxosLog::MergeFrom(
+        from._internal_log());
+  }
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LeaderPromiseResponse_Accepted::CopyFrom(const LeaderPromiseResponse_Accepted& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.LeaderPromiseResponse.Accepted)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LeaderPromiseResponse_Accepted::IsInitialized() const {
+  return true;
+}
+
+void LeaderPromiseResponse_Accepted::InternalSwap(LeaderPromiseResponse_Accepted* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LeaderPromiseResponse_Accepted, _impl_.slot_)
+      + sizeof(LeaderPromiseResponse_Accepted::_impl_.slot_)
+      - PROTOBUF_FIELD_OFFSET(LeaderPromiseResponse_Accepted, _impl_.log_)>(
+          reinterpret_cast<char*>(&_impl_.log_),
+          reinterpret_cast<char*>(&other->_impl_.log_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LeaderPromiseResponse_Accepted::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[34]);
+}
+
+// ===================================================================
+
+class LeaderPromiseResponse::_Internal {
+ public:
+};
+
+LeaderPromiseResponse::LeaderPromiseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.LeaderPromiseResponse)
+}
+LeaderPromiseResponse::LeaderPromiseResponse(const LeaderPromiseResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LeaderPromiseResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accepted_){from._impl_.accepted_}
+    , decltype(_impl_.ballot_){}
+    , decltype(_impl_.compacted_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ballot_, &from._impl_.ballot_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compacted_slot_) -
+    reinterpret_cast<char*>(&_impl_.ballot_)) + sizeof(_impl_.compacted_slot_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.LeaderPromiseResponse)
+}
+
+inline void LeaderPromiseResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.accepted_){arena}
+    , decltype(_impl_.ballot_){0}
+    , decltype(_impl_.compacted_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LeaderPromiseResponse::~LeaderPromiseResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.LeaderPromiseResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LeaderPromiseResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.accepted_.~RepeatedPtrField();
+}
+
+void LeaderPromiseResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LeaderPromiseResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.LeaderPromiseResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.accepted_.Clear();
+  ::memset(&_impl_.ballot_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compacted_slot_) -
+      reinterpret_cast<char*>(&_impl_.ballot_)) + sizeof(_impl_.compacted_slot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LeaderPromiseResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 ballot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ballot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.LeaderPromiseResponse.Accepted accepted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_accepted(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compacted_slot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.compacted_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LeaderPromiseResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.LeaderPromiseResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 ballot = 1;
+  if (this->_internal_ballot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ballot(), target);
+  }
+
+  // repeated .keyvaluestore.LeaderPromiseResponse.Accepted accepted = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_accepted_size()); i < n; i++) {
+    const auto& repfield = this->_internal_accepted(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 compacted_slot = 3;
+  if (this->_internal_compacted_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_compacted_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.LeaderPromiseResponse)
+  return target;
+}
+
+size_t LeaderPromiseResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.LeaderPromiseResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.LeaderPromiseResponse.Accepted accepted = 2;
+  total_size += 1UL * this->_internal_accepted_size();
+  for (const auto& msg : this->_impl_.accepted_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 ballot = 1;
+  if (this->_internal_ballot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ballot());
+  }
+
+  // int32 compacted_slot = 3;
+  if (this->_internal_compacted_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compacted_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LeaderPromiseResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LeaderPromiseResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LeaderPromiseResponse::GetClassData() const { return &_class_data_; }
+
+
+void LeaderPromiseResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LeaderPromiseResponse*>(&to_msg);
+  auto& from = static_cast<const LeaderPromiseResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.LeaderPromiseResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.accepted_.MergeFrom(from._impl_.accepted_);
+  if (from._internal_ballot() != 0) {
+    _this->_internal_set_ballot(from._internal_ballot());
+  }
+  if (from._internal_compacted_slot() != 0) {
+    _this->_internal_set_compacted_slot(from._internal_compacted_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LeaderPromiseResponse::CopyFrom(const LeaderPromiseResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.LeaderPromiseResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LeaderPromiseResponse::IsInitialized() const {
+  return true;
+}
+
+void LeaderPromiseResponse::InternalSwap(LeaderPromiseResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.accepted_.InternalSwap(&other->_impl_.accepted_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LeaderPromiseResponse, _impl_.compacted_slot_)
+      + sizeof(LeaderPromiseResponse::_impl_.compacted_slot_)
+      - PROTOBUF_FIELD_OFFSET(LeaderPromiseResponse, _impl_.ballot_)>(
+          reinterpret_cast<char*>(&_impl_.ballot_),
+          reinterpret_cast<char*>(&other->_impl_.ballot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LeaderPromiseResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[35]);
+}
+
+// ===================================================================
+
+class GetChosenRequest::_Internal {
+ public:
+};
+
+GetChosenRequest::GetChosenRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetChosenRequest)
+}
+GetChosenRequest::GetChosenRequest(const GetChosenRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetChosenRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_slot_){}
+    , decltype(_impl_.to_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_slot_, &from._impl_.from_slot_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.to_slot_) -
+    reinterpret_cast<char*>(&_impl_.from_slot_)) + sizeof(_impl_.to_slot_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetChosenRequest)
+}
+
+inline void GetChosenRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_slot_){0}
+    , decltype(_impl_.to_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetChosenRequest::~GetChosenRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetChosenRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetChosenRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GetChosenRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetChosenRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetChosenRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_slot_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.to_slot_) -
+      reinterpret_cast<char*>(&_impl_.from_slot_)) + sizeof(_impl_.to_slot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetChosenRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 from_slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 to_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetChosenRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetChosenRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 from_slot = 1;
+  if (this->_internal_from_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_from_slot(), target);
+  }
+
+  // int32 to_slot = 2;
+  if (this->_internal_to_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_to_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetChosenRequest)
+  return target;
+}
+
+size_t GetChosenRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetChosenRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 from_slot = 1;
+  if (this->_internal_from_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_from_slot());
+  }
+
+  // int32 to_slot = 2;
+  if (this->_internal_to_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_to_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetChosenRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetChosenRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetChosenRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetChosenRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetChosenRequest*>(&to_msg);
+  auto& from = static_cast<const GetChosenRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetChosenRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from_slot() != 0) {
+    _this->_internal_set_from_slot(from._internal_from_slot());
+  }
+  if (from._internal_to_slot() != 0) {
+    _this->_internal_set_to_slot(from._internal_to_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetChosenRequest::CopyFrom(const GetChosenRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetChosenRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetChosenRequest::IsInitialized() const {
+  return true;
+}
+
+void GetChosenRequest::InternalSwap(GetChosenRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetChosenRequest, _impl_.to_slot_)
+      + sizeof(GetChosenRequest::_impl_.to_slot_)
+      - PROTOBUF_FIELD_OFFSET(GetChosenRequest, _impl_.from_slot_)>(
+          reinterpret_cast<char*>(&_impl_.from_slot_),
+          reinterpret_cast<char*>(&other->_impl_.from_slot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetChosenRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[36]);
+}
+
+// ===================================================================
+
+class GetChosenResponse::_Internal {
+ public:
+};
+
+GetChosenResponse::GetChosenResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.GetChosenResponse)
+}
+GetChosenResponse::GetChosenResponse(const GetChosenResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetChosenResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){from._impl_.slots_}
+    , decltype(_impl_.compacted_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.compacted_slot_ = from._impl_.compacted_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.GetChosenResponse)
+}
+
+inline void GetChosenResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slots_){arena}
+    , decltype(_impl_.compacted_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetChosenResponse::~GetChosenResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.GetChosenResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetChosenResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slots_.~RepeatedPtrField();
+}
+
+void GetChosenResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetChosenResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.GetChosenResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slots_.Clear();
+  _impl_.compacted_slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetChosenResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .keyvaluestore.AcceptResponse slots = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_slots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compacted_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.compacted_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetChosenResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.GetChosenResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.AcceptResponse slots = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_slots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_slots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 compacted_slot = 2;
+  if (this->_internal_compacted_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_compacted_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.GetChosenResponse)
+  return target;
+}
+
+size_t GetChosenResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.GetChosenResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.AcceptResponse slots = 1;
+  total_size += 1UL * this->_internal_slots_size();
+  for (const auto& msg : this->_impl_.slots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 compacted_slot = 2;
+  if (this->_internal_compacted_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compacted_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetChosenResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetChosenResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetChosenResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetChosenResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetChosenResponse*>(&to_msg);
+  auto& from = static_cast<const GetChosenResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.GetChosenResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slots_.MergeFrom(from._impl_.slots_);
+  if (from._internal_compacted_slot() != 0) {
+    _this->_internal_set_compacted_slot(from._internal_compacted_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetChosenResponse::CopyFrom(const GetChosenResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.GetChosenResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetChosenResponse::IsInitialized() const {
+  return true;
+}
+
+void GetChosenResponse::InternalSwap(GetChosenResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.slots_.InternalSwap(&other->_impl_.slots_);
+  swap(_impl_.compacted_slot_, other->_impl_.compacted_slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetChosenResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[37]);
+}
+
+// ===================================================================
+
+class RecoverRequest::_Internal {
+ public:
+};
+
+RecoverRequest::RecoverRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.RecoverRequest)
+}
+RecoverRequest::RecoverRequest(const RecoverRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoverRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.applied_slot_ = from._impl_.applied_slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.RecoverRequest)
+}
+
+inline void RecoverRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecoverRequest::~RecoverRequest() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.RecoverRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoverRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RecoverRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoverRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.RecoverRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applied_slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoverRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 applied_slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.applied_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoverRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.RecoverRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 applied_slot = 1;
+  if (this->_internal_applied_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_applied_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.RecoverRequest)
+  return target;
+}
+
+size_t RecoverRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.RecoverRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 applied_slot = 1;
+  if (this->_internal_applied_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoverRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoverRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoverRequest::GetClassData() const { return &_class_data_; }
+
+
+void RecoverRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoverRequest*>(&to_msg);
+  auto& from = static_cast<const RecoverRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.RecoverRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_applied_slot() != 0) {
+    _this->_internal_set_applied_slot(from._internal_applied_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoverRequest::CopyFrom(const RecoverRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.RecoverRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoverRequest::IsInitialized() const {
+  return true;
+}
+
+void RecoverRequest::InternalSwap(RecoverRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.applied_slot_, other->_impl_.applied_slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[38]);
+}
+
+// ===================================================================
+
+RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse() {}
+RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::MergeFrom(const RecoverChunk_PaxosLogs_LogsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[39]);
+}
+
+// ===================================================================
+
+class RecoverChunk_PaxosLogs::_Internal {
+ public:
+};
+
+RecoverChunk_PaxosLogs::RecoverChunk_PaxosLogs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &RecoverChunk_PaxosLogs::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.RecoverChunk.PaxosLogs)
+}
+RecoverChunk_PaxosLogs::RecoverChunk_PaxosLogs(const RecoverChunk_PaxosLogs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoverChunk_PaxosLogs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.logs_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.logs_.MergeFrom(from._impl_.logs_);
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.RecoverChunk.PaxosLogs)
+}
+
+inline void RecoverChunk_PaxosLogs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.logs_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecoverChunk_PaxosLogs::~RecoverChunk_PaxosLogs() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.RecoverChunk.PaxosLogs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoverChunk_PaxosLogs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.logs_.Destruct();
+  _impl_.logs_.~MapField();
+}
+
+void RecoverChunk_PaxosLogs::ArenaDtor(void* object) {
+  RecoverChunk_PaxosLogs* _this = reinterpret_cast< RecoverChunk_PaxosLogs* >(object);
+  _this->_impl_.logs_.Destruct();
+}
+void RecoverChunk_PaxosLogs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoverChunk_PaxosLogs::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.RecoverChunk.PaxosLogs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.logs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoverChunk_PaxosLogs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<int32, .keyvaluestore.PaxosLog> logs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.logs_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoverChunk_PaxosLogs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.RecoverChunk.PaxosLogs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .keyvaluestore.PaxosLog> logs = 1;
+  if (!this->_internal_logs().empty()) {
+    using MapType = ::_pb::Map<int32_t, ::keyvaluestore::PaxosLog>;
+    using WireHelper = RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_logs();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.RecoverChunk.PaxosLogs)
+  return target;
+}
+
+size_t RecoverChunk_PaxosLogs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.RecoverChunk.PaxosLogs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .keyvaluestore.PaxosLog> logs = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_logs_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >::const_iterator
+      it = this->_internal_logs().begin();
+      it != this->_internal_logs().end(); ++it) {
+    total_size += RecoverChunk_PaxosLogs_LogsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoverChunk_PaxosLogs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoverChunk_PaxosLogs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoverChunk_PaxosLogs::GetClassData() const { return &_class_data_; }
+
+
+void RecoverChunk_PaxosLogs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoverChunk_PaxosLogs*>(&to_msg);
+  auto& from = static_cast<const RecoverChunk_PaxosLogs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.RecoverChunk.PaxosLogs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.logs_.MergeFrom(from._impl_.logs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoverChunk_PaxosLogs::CopyFrom(const RecoverChunk_PaxosLogs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.RecoverChunk.PaxosLogs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoverChunk_PaxosLogs::IsInitialized() const {
+  return true;
+}
+
+void RecoverChunk_PaxosLogs::InternalSwap(RecoverChunk_PaxosLogs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.logs_.InternalSwap(&other->_impl_.logs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverChunk_PaxosLogs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[40]);
+}
+
+// ===================================================================
+
+RecoverChunk_KvMapEntry_DoNotUse::RecoverChunk_KvMapEntry_DoNotUse() {}
+RecoverChunk_KvMapEntry_DoNotUse::RecoverChunk_KvMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void RecoverChunk_KvMapEntry_DoNotUse::MergeFrom(const RecoverChunk_KvMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverChunk_KvMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[41]);
+}
+
+// ===================================================================
+
+RecoverChunk_PaxosLogsEntry_DoNotUse::RecoverChunk_PaxosLogsEntry_DoNotUse() {}
+RecoverChunk_PaxosLogsEntry_DoNotUse::RecoverChunk_PaxosLogsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void RecoverChunk_PaxosLogsEntry_DoNotUse::MergeFrom(const RecoverChunk_PaxosLogsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverChunk_PaxosLogsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[42]);
+}
+
+// ===================================================================
+
+class RecoverChunk::_Internal {
+ public:
+};
+
+RecoverChunk::RecoverChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &RecoverChunk::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.RecoverChunk)
+}
+RecoverChunk::RecoverChunk(const RecoverChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoverChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.kv_map_)*/{}
+    , /*decltype(_impl_.paxos_logs_)*/{}
+    , decltype(_impl_.applied_slot_){}
+    , decltype(_impl_.data_complete_){}
+    , decltype(_impl_.incremental_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.kv_map_.MergeFrom(from._impl_.kv_map_);
+  _this->_impl_.paxos_logs_.MergeFrom(from._impl_.paxos_logs_);
+  ::memcpy(&_impl_.applied_slot_, &from._impl_.applied_slot_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.incremental_) -
+    reinterpret_cast<char*>(&_impl_.applied_slot_)) + sizeof(_impl_.incremental_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.RecoverChunk)
+}
+
+inline void RecoverChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.kv_map_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.paxos_logs_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.applied_slot_){0}
+    , decltype(_impl_.data_complete_){false}
+    , decltype(_impl_.incremental_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecoverChunk::~RecoverChunk() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.RecoverChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoverChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kv_map_.Destruct();
+  _impl_.kv_map_.~MapField();
+  _impl_.paxos_logs_.Destruct();
+  _impl_.paxos_logs_.~MapField();
+}
+
+void RecoverChunk::ArenaDtor(void* object) {
+  RecoverChunk* _this = reinterpret_cast< RecoverChunk* >(object);
+  _this->_impl_.kv_map_.Destruct();
+  _this->_impl_.paxos_logs_.Destruct();
+}
+void RecoverChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoverChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.RecoverChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kv_map_.Clear();
+  _impl_.paxos_logs_.Clear();
+  ::memset(&_impl_.applied_slot_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.incremental_) -
+      reinterpret_cast<char*>(&_impl_.applied_slot_)) + sizeof(_impl_.incremental_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoverChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<string, string> kv_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.kv_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, .keyvaluestore.RecoverChunk.PaxosLogs> paxos_logs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.paxos_logs_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 applied_slot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.applied_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool data_complete = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.data_complete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool incremental = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.incremental_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoverChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.RecoverChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, string> kv_map = 1;
+  if (!this->_internal_kv_map().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = RecoverChunk_KvMapEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_kv_map();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.RecoverChunk.KvMapEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.RecoverChunk.KvMapEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // map<string, .keyvaluestore.RecoverChunk.PaxosLogs> paxos_logs = 2;
+  if (!this->_internal_paxos_logs().empty()) {
+    using MapType = ::_pb::Map<std::string, ::keyvaluestore::RecoverChunk_PaxosLogs>;
+    using WireHelper = RecoverChunk_PaxosLogsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_paxos_logs();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.RecoverChunk.PaxosLogsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // int32 applied_slot = 3;
+  if (this->_internal_applied_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_applied_slot(), target);
+  }
+
+  // bool data_complete = 4;
+  if (this->_internal_data_complete() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_data_complete(), target);
+  }
+
+  // bool incremental = 5;
+  if (this->_internal_incremental() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_incremental(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.RecoverChunk)
+  return target;
+}
+
+size_t RecoverChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.RecoverChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> kv_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_kv_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_kv_map().begin();
+      it != this->_internal_kv_map().end(); ++it) {
+    total_size += RecoverChunk_KvMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .keyvaluestore.RecoverChunk.PaxosLogs> paxos_logs = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_paxos_logs_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >::const_iterator
+      it = this->_internal_paxos_logs().begin();
+      it != this->_internal_paxos_logs().end(); ++it) {
+    total_size += RecoverChunk_PaxosLogsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // int32 applied_slot = 3;
+  if (this->_internal_applied_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied_slot());
+  }
+
+  // bool data_complete = 4;
+  if (this->_internal_data_complete() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool incremental = 5;
+  if (this->_internal_incremental() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoverChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoverChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoverChunk::GetClassData() const { return &_class_data_; }
+
+
+void RecoverChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoverChunk*>(&to_msg);
+  auto& from = static_cast<const RecoverChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.RecoverChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kv_map_.MergeFrom(from._impl_.kv_map_);
+  _this->_impl_.paxos_logs_.MergeFrom(from._impl_.paxos_logs_);
+  if (from._internal_applied_slot() != 0) {
+    _this->_internal_set_applied_slot(from._internal_applied_slot());
+  }
+  if (from._internal_data_complete() != 0) {
+    _this->_internal_set_data_complete(from._internal_data_complete());
+  }
+  if (from._internal_incremental() != 0) {
+    _this->_internal_set_incremental(from._internal_incremental());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoverChunk::CopyFrom(const RecoverChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.RecoverChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoverChunk::IsInitialized() const {
+  return true;
+}
+
+void RecoverChunk::InternalSwap(RecoverChunk* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kv_map_.InternalSwap(&other->_impl_.kv_map_);
+  _impl_.paxos_logs_.InternalSwap(&other->_impl_.paxos_logs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecoverChunk, _impl_.incremental_)
+      + sizeof(RecoverChunk::_impl_.incremental_)
+      - PROTOBUF_FIELD_OFFSET(RecoverChunk, _impl_.applied_slot_)>(
+          reinterpret_cast<char*>(&_impl_.applied_slot_),
+          reinterpret_cast<char*>(&other->_impl_.applied_slot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoverChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[43]);
+}
+
+// ===================================================================
+
+class LatencySummary::_Internal {
+ public:
+};
+
+LatencySummary::LatencySummary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.LatencySummary)
+}
+LatencySummary::LatencySummary(const LatencySummary& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencySummary* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , decltype(_impl_.p999_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.LatencySummary)
+}
+
+inline void LatencySummary::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.min_){uint64_t{0u}}
+    , decltype(_impl_.p50_){uint64_t{0u}}
+    , decltype(_impl_.p90_){uint64_t{0u}}
+    , decltype(_impl_.p99_){uint64_t{0u}}
+    , decltype(_impl_.p999_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencySummary::~LatencySummary() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.LatencySummary)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencySummary::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LatencySummary::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencySummary::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.LatencySummary)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencySummary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double mean = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 min = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p999_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencySummary::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.LatencySummary)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_count(), target);
+  }
+
+  // double mean = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_mean(), target);
+  }
+
+  // uint64 min = 3;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_min(), target);
+  }
+
+  // uint64 p50 = 4;
+  if (this->_internal_p50() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_p50(), target);
+  }
+
+  // uint64 p90 = 5;
+  if (this->_internal_p90() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p90(), target);
+  }
+
+  // uint64 p99 = 6;
+  if (this->_internal_p99() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p99(), target);
+  }
+
+  // uint64 p999 = 7;
+  if (this->_internal_p999() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p999(), target);
+  }
+
+  // uint64 max = 8;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.LatencySummary)
+  return target;
+}
+
+size_t LatencySummary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.LatencySummary)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // double mean = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 min = 3;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min());
+  }
+
+  // uint64 p50 = 4;
+  if (this->_internal_p50() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50());
+  }
+
+  // uint64 p90 = 5;
+  if (this->_internal_p90() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90());
+  }
+
+  // uint64 p99 = 6;
+  if (this->_internal_p99() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99());
+  }
+
+  // uint64 p999 = 7;
+  if (this->_internal_p999() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999());
+  }
+
+  // uint64 max = 8;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencySummary::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencySummary::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencySummary::GetClassData() const { return &_class_data_; }
+
+
+void LatencySummary::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencySummary*>(&to_msg);
+  auto& from = static_cast<const LatencySummary&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.LatencySummary)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = from._internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    _this->_internal_set_mean(from._internal_mean());
+  }
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_p50() != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  if (from._internal_p90() != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  if (from._internal_p99() != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  if (from._internal_p999() != 0) {
+    _this->_internal_set_p999(from._internal_p999());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencySummary::CopyFrom(const LatencySummary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.LatencySummary)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencySummary::IsInitialized() const {
+  return true;
+}
+
+void LatencySummary::InternalSwap(LatencySummary* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencySummary, _impl_.max_)
+      + sizeof(LatencySummary::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(LatencySummary, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencySummary::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[44]);
+}
+
+// ===================================================================
+
+StatsResponse_CountersEntry_DoNotUse::StatsResponse_CountersEntry_DoNotUse() {}
+StatsResponse_CountersEntry_DoNotUse::StatsResponse_CountersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void StatsResponse_CountersEntry_DoNotUse::MergeFrom(const StatsResponse_CountersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse_CountersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[45]);
+}
+
+// ===================================================================
+
+StatsResponse_LatenciesUsEntry_DoNotUse::StatsResponse_LatenciesUsEntry_DoNotUse() {}
+StatsResponse_LatenciesUsEntry_DoNotUse::StatsResponse_LatenciesUsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void StatsResponse_LatenciesUsEntry_DoNotUse::MergeFrom(const StatsResponse_LatenciesUsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse_LatenciesUsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[46]);
+}
+
+// ===================================================================
+
+class StatsResponse::_Internal {
+ public:
+};
+
+StatsResponse::StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &StatsResponse::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.StatsResponse)
+}
+StatsResponse::StatsResponse(const StatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.counters_)*/{}
+    , /*decltype(_impl_.latencies_us_)*/{}
+    , decltype(_impl_.text_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.counters_.MergeFrom(from._impl_.counters_);
+  _this->_impl_.latencies_us_.MergeFrom(from._impl_.latencies_us_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.StatsResponse)
+}
+
+inline void StatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.counters_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.latencies_us_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.text_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StatsResponse::~StatsResponse() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.StatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.counters_.Destruct();
+  _impl_.counters_.~MapField();
+  _impl_.latencies_us_.Destruct();
+  _impl_.latencies_us_.~MapField();
+  _impl_.text_.Destroy();
+}
+
+void StatsResponse::ArenaDtor(void* object) {
+  StatsResponse* _this = reinterpret_cast< StatsResponse* >(object);
+  _this->_impl_.counters_.Destruct();
+  _this->_impl_.latencies_us_.Destruct();
+}
+void StatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.counters_.Clear();
+  _impl_.latencies_us_.Clear();
+  _impl_.text_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<string, int64> counters = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.counters_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, .keyvaluestore.LatencySummary> latencies_us = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.latencies_us_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.StatsResponse.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, int64> counters = 1;
+  if (!this->_internal_counters().empty()) {
+    using MapType = ::_pb::Map<std::string, int64_t>;
+    using WireHelper = StatsResponse_CountersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_counters();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.StatsResponse.CountersEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // map<string, .keyvaluestore.LatencySummary> latencies_us = 2;
+  if (!this->_internal_latencies_us().empty()) {
+    using MapType = ::_pb::Map<std::string, ::keyvaluestore::LatencySummary>;
+    using WireHelper = StatsResponse_LatenciesUsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_latencies_us();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.StatsResponse.LatenciesUsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // string text = 3;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.StatsResponse.text");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.StatsResponse)
+  return target;
+}
+
+size_t StatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.StatsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, int64> counters = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_counters_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >::const_iterator
+      it = this->_internal_counters().begin();
+      it != this->_internal_counters().end(); ++it) {
+    total_size += StatsResponse_CountersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .keyvaluestore.LatencySummary> latencies_us = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_latencies_us_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >::const_iterator
+      it = this->_internal_latencies_us().begin();
+      it != this->_internal_latencies_us().end(); ++it) {
+    total_size += StatsResponse_LatenciesUsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string text = 3;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsResponse::GetClassData() const { return &_class_data_; }
+
+
+void StatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsResponse*>(&to_msg);
+  auto& from = static_cast<const StatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.StatsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.counters_.MergeFrom(from._impl_.counters_);
+  _this->_impl_.latencies_us_.MergeFrom(from._impl_.latencies_us_);
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsResponse::CopyFrom(const StatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.StatsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsResponse::IsInitialized() const {
+  return true;
+}
+
+void StatsResponse::InternalSwap(StatsResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.counters_.InternalSwap(&other->_impl_.counters_);
+  _impl_.latencies_us_.InternalSwap(&other->_impl_.latencies_us_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[47]);
+}
+
+// ===================================================================
+
+class WalRecord_PaxosLogEntry::_Internal {
+ public:
+  static const ::keyvaluestore::PaxosLog& log(const WalRecord_PaxosLogEntry* msg);
+};
+
+const ::keyvaluestore::PaxosLog&
+WalRecord_PaxosLogEntry::_Internal::log(const WalRecord_PaxosLogEntry* msg) {
+  return *msg->_impl_.log_;
+}
+WalRecord_PaxosLogEntry::WalRecord_PaxosLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WalRecord.PaxosLogEntry)
+}
+WalRecord_PaxosLogEntry::WalRecord_PaxosLogEntry(const WalRecord_PaxosLogEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalRecord_PaxosLogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.log_){nullptr}
+    , decltype(_impl_.round_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_log()) {
+    _this->_impl_.log_ = new ::keyvaluestore::PaxosLog(*from._impl_.log_);
+  }
+  _this->_impl_.round_ = from._impl_.round_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WalRecord.PaxosLogEntry)
+}
+
+inline void WalRecord_PaxosLogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.log_){nullptr}
+    , decltype(_impl_.round_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WalRecord_PaxosLogEntry::~WalRecord_PaxosLogEntry() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WalRecord.PaxosLogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalRecord_PaxosLogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.log_;
+}
+
+void WalRecord_PaxosLogEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalRecord_PaxosLogEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WalRecord.PaxosLogEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.log_ != nullptr) {
+    delete _impl_.log_;
+  }
+  _impl_.log_ = nullptr;
+  _impl_.round_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalRecord_PaxosLogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.WalRecord.PaxosLogEntry.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 round = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.PaxosLog log = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_log(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalRecord_PaxosLogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WalRecord.PaxosLogEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.WalRecord.PaxosLogEntry.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_round(), target);
+  }
+
+  // .keyvaluestore.PaxosLog log = 3;
+  if (this->_internal_has_log()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::log(this),
+        _Internal::log(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WalRecord.PaxosLogEntry)
+  return target;
+}
+
+size_t WalRecord_PaxosLogEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WalRecord.PaxosLogEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // .keyvaluestore.PaxosLog log = 3;
+  if (this->_internal_has_log()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.log_);
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalRecord_PaxosLogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalRecord_PaxosLogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalRecord_PaxosLogEntry::GetClassData() const { return &_class_data_; }
+
+
+void WalRecord_PaxosLogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalRecord_PaxosLogEntry*>(&to_msg);
+  auto& from = static_cast<const WalRecord_PaxosLogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WalRecord.PaxosLogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_has_log()) {
+    _this->_internal_mutable_log()->::keyvaluestore::PaxosLog::MergeFrom(
+        from._internal_log());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalRecord_PaxosLogEntry::CopyFrom(const WalRecord_PaxosLogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WalRecord.PaxosLogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalRecord_PaxosLogEntry::IsInitialized() const {
+  return true;
+}
+
+void WalRecord_PaxosLogEntry::InternalSwap(WalRecord_PaxosLogEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WalRecord_PaxosLogEntry, _impl_.round_)
+      + sizeof(WalRecord_PaxosLogEntry::_impl_.round_)
+      - PROTOBUF_FIELD_OFFSET(WalRecord_PaxosLogEntry, _impl_.log_)>(
+          reinterpret_cast<char*>(&_impl_.log_),
+          reinterpret_cast<char*>(&other->_impl_.log_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord_PaxosLogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[48]);
+}
+
+// ===================================================================
+
+class WalRecord_Applied::_Internal {
+ public:
+};
+
+WalRecord_Applied::WalRecord_Applied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WalRecord.Applied)
+}
+WalRecord_Applied::WalRecord_Applied(const WalRecord_Applied& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalRecord_Applied* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slot_ = from._impl_.slot_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WalRecord.Applied)
+}
+
+inline void WalRecord_Applied::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WalRecord_Applied::~WalRecord_Applied() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WalRecord.Applied)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalRecord_Applied::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+}
+
+void WalRecord_Applied::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalRecord_Applied::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WalRecord.Applied)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.slot_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalRecord_Applied::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .keyvaluestore.Operation operations = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalRecord_Applied::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WalRecord.Applied)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_slot(), target);
+  }
+
+  // repeated .keyvaluestore.Operation operations = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WalRecord.Applied)
+  return target;
+}
+
+size_t WalRecord_Applied::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WalRecord.Applied)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .keyvaluestore.Operation operations = 2;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 slot = 1;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalRecord_Applied::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalRecord_Applied::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalRecord_Applied::GetClassData() const { return &_class_data_; }
+
+
+void WalRecord_Applied::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalRecord_Applied*>(&to_msg);
+  auto& from = static_cast<const WalRecord_Applied&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WalRecord.Applied)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalRecord_Applied::CopyFrom(const WalRecord_Applied& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WalRecord.Applied)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalRecord_Applied::IsInitialized() const {
+  return true;
+}
+
+void WalRecord_Applied::InternalSwap(WalRecord_Applied* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  swap(_impl_.slot_, other->_impl_.slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord_Applied::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[49]);
+}
+
+// ===================================================================
+
+WalRecord_Snapshot_KvMapEntry_DoNotUse::WalRecord_Snapshot_KvMapEntry_DoNotUse() {}
+WalRecord_Snapshot_KvMapEntry_DoNotUse::WalRecord_Snapshot_KvMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void WalRecord_Snapshot_KvMapEntry_DoNotUse::MergeFrom(const WalRecord_Snapshot_KvMapEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord_Snapshot_KvMapEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[50]);
+}
+
+// ===================================================================
+
+class WalRecord_Snapshot::_Internal {
+ public:
+};
+
+WalRecord_Snapshot::WalRecord_Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &WalRecord_Snapshot::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WalRecord.Snapshot)
+}
+WalRecord_Snapshot::WalRecord_Snapshot(const WalRecord_Snapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalRecord_Snapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.kv_map_)*/{}
+    , decltype(_impl_.applied_slot_){}
+    , decltype(_impl_.continued_){}
+    , decltype(_impl_.incomplete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.kv_map_.MergeFrom(from._impl_.kv_map_);
+  ::memcpy(&_impl_.applied_slot_, &from._impl_.applied_slot_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.incomplete_) -
+    reinterpret_cast<char*>(&_impl_.applied_slot_)) + sizeof(_impl_.incomplete_));
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WalRecord.Snapshot)
+}
+
+inline void WalRecord_Snapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.kv_map_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.applied_slot_){0}
+    , decltype(_impl_.continued_){false}
+    , decltype(_impl_.incomplete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WalRecord_Snapshot::~WalRecord_Snapshot() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WalRecord.Snapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalRecord_Snapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kv_map_.Destruct();
+  _impl_.kv_map_.~MapField();
+}
+
+void WalRecord_Snapshot::ArenaDtor(void* object) {
+  WalRecord_Snapshot* _this = reinterpret_cast< WalRecord_Snapshot* >(object);
+  _this->_impl_.kv_map_.Destruct();
+}
+void WalRecord_Snapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalRecord_Snapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WalRecord.Snapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kv_map_.Clear();
+  ::memset(&_impl_.applied_slot_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.incomplete_) -
+      reinterpret_cast<char*>(&_impl_.applied_slot_)) + sizeof(_impl_.incomplete_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalRecord_Snapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<string, string> kv_map = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.kv_map_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 applied_slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.applied_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool continued = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.continued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool incomplete = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.incomplete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalRecord_Snapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WalRecord.Snapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, string> kv_map = 1;
+  if (!this->_internal_kv_map().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = WalRecord_Snapshot_KvMapEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_kv_map();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.WalRecord.Snapshot.KvMapEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "keyvaluestore.WalRecord.Snapshot.KvMapEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // int32 applied_slot = 2;
+  if (this->_internal_applied_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_applied_slot(), target);
+  }
+
+  // bool continued = 3;
+  if (this->_internal_continued() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_continued(), target);
+  }
+
+  // bool incomplete = 4;
+  if (this->_internal_incomplete() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_incomplete(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WalRecord.Snapshot)
+  return target;
+}
+
+size_t WalRecord_Snapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WalRecord.Snapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> kv_map = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_kv_map_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_kv_map().begin();
+      it != this->_internal_kv_map().end(); ++it) {
+    total_size += WalRecord_Snapshot_KvMapEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // int32 applied_slot = 2;
+  if (this->_internal_applied_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_applied_slot());
+  }
+
+  // bool continued = 3;
+  if (this->_internal_continued() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool incomplete = 4;
+  if (this->_internal_incomplete() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalRecord_Snapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalRecord_Snapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalRecord_Snapshot::GetClassData() const { return &_class_data_; }
+
+
+void WalRecord_Snapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalRecord_Snapshot*>(&to_msg);
+  auto& from = static_cast<const WalRecord_Snapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WalRecord.Snapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kv_map_.MergeFrom(from._impl_.kv_map_);
+  if (from._internal_applied_slot() != 0) {
+    _this->_internal_set_applied_slot(from._internal_applied_slot());
+  }
+  if (from._internal_continued() != 0) {
+    _this->_internal_set_continued(from._internal_continued());
+  }
+  if (from._internal_incomplete() != 0) {
+    _this->_internal_set_incomplete(from._internal_incomplete());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalRecord_Snapshot::CopyFrom(const WalRecord_Snapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WalRecord.Snapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalRecord_Snapshot::IsInitialized() const {
+  return true;
+}
+
+void WalRecord_Snapshot::InternalSwap(WalRecord_Snapshot* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kv_map_.InternalSwap(&other->_impl_.kv_map_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WalRecord_Snapshot, _impl_.incomplete_)
+      + sizeof(WalRecord_Snapshot::_impl_.incomplete_)
+      - PROTOBUF_FIELD_OFFSET(WalRecord_Snapshot, _impl_.applied_slot_)>(
+          reinterpret_cast<char*>(&_impl_.applied_slot_),
+          reinterpret_cast<char*>(&other->_impl_.applied_slot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord_Snapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[51]);
+}
+
+// ===================================================================
+
+class WalRecord_Compaction::_Internal {
+ public:
+};
+
+WalRecord_Compaction::WalRecord_Compaction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WalRecord.Compaction)
+}
+WalRecord_Compaction::WalRecord_Compaction(const WalRecord_Compaction& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalRecord_Compaction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.round_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.round_ = from._impl_.round_;
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WalRecord.Compaction)
+}
+
+inline void WalRecord_Compaction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.round_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WalRecord_Compaction::~WalRecord_Compaction() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WalRecord.Compaction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalRecord_Compaction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void WalRecord_Compaction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalRecord_Compaction::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WalRecord.Compaction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.round_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalRecord_Compaction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "keyvaluestore.WalRecord.Compaction.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 round = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalRecord_Compaction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WalRecord.Compaction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "keyvaluestore.WalRecord.Compaction.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_round(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WalRecord.Compaction)
+  return target;
+}
+
+size_t WalRecord_Compaction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WalRecord.Compaction)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // int32 round = 2;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_round());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalRecord_Compaction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalRecord_Compaction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalRecord_Compaction::GetClassData() const { return &_class_data_; }
+
+
+void WalRecord_Compaction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalRecord_Compaction*>(&to_msg);
+  auto& from = static_cast<const WalRecord_Compaction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WalRecord.Compaction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalRecord_Compaction::CopyFrom(const WalRecord_Compaction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WalRecord.Compaction)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalRecord_Compaction::IsInitialized() const {
+  return true;
+}
+
+void WalRecord_Compaction::InternalSwap(WalRecord_Compaction* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.round_, other->_impl_.round_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord_Compaction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[52]);
+}
+
+// ===================================================================
+
+class WalRecord::_Internal {
+ public:
+  static const ::keyvaluestore::WalRecord_PaxosLogEntry& paxos_log(const WalRecord* msg);
+  static const ::keyvaluestore::WalRecord_Applied& applied(const WalRecord* msg);
+  static const ::keyvaluestore::WalRecord_Snapshot& snapshot(const WalRecord* msg);
+  static const ::keyvaluestore::WalRecord_Compaction& compaction(const WalRecord* msg);
+};
+
+const ::keyvaluestore::WalRecord_PaxosLogEntry&
+WalRecord::_Internal::paxos_log(const WalRecord* msg) {
+  return *msg->_impl_.record_.paxos_log_;
+}
+const ::keyvaluestore::WalRecord_Applied&
+WalRecord::_Internal::applied(const WalRecord* msg) {
+  return *msg->_impl_.record_.applied_;
+}
+const ::keyvaluestore::WalRecord_Snapshot&
+WalRecord::_Internal::snapshot(const WalRecord* msg) {
+  return *msg->_impl_.record_.snapshot_;
+}
+const ::keyvaluestore::WalRecord_Compaction&
+WalRecord::_Internal::compaction(const WalRecord* msg) {
+  return *msg->_impl_.record_.compaction_;
+}
+void WalRecord::set_allocated_paxos_log(::keyvaluestore::WalRecord_PaxosLogEntry* paxos_log) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (paxos_log) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(paxos_log);
+    if (message_arena != submessage_arena) {
+      paxos_log = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, paxos_log, submessage_arena);
+    }
+    set_has_paxos_log();
+    _impl_.record_.paxos_log_ = paxos_log;
+  }
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.paxos_log)
+}
+void WalRecord::set_allocated_applied(::keyvaluestore::WalRecord_Applied* applied) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (applied) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(applied);
+    if (message_arena != submessage_arena) {
+      applied = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, applied, submessage_arena);
+    }
+    set_has_applied();
+    _impl_.record_.applied_ = applied;
+  }
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.applied)
+}
+void WalRecord::set_allocated_snapshot(::keyvaluestore::WalRecord_Snapshot* snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot);
+    if (message_arena != submessage_arena) {
+      snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, snapshot, submessage_arena);
+    }
+    set_has_snapshot();
+    _impl_.record_.snapshot_ = snapshot;
+  }
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.snapshot)
+}
+void WalRecord::set_allocated_compaction(::keyvaluestore::WalRecord_Compaction* compaction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (compaction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(compaction);
+    if (message_arena != submessage_arena) {
+      compaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, compaction, submessage_arena);
+    }
+    set_has_compaction();
+    _impl_.record_.compaction_ = compaction;
+  }
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.compaction)
+}
+WalRecord::WalRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:keyvaluestore.WalRecord)
+}
+WalRecord::WalRecord(const WalRecord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalRecord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.record_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_record();
+  switch (from.record_case()) {
+    case kPaxosLog: {
+      _this->_internal_mutable_paxos_log()->::keyvaluestore::WalRecord_PaxosLogEntry::MergeFrom(
+          from._internal_paxos_log());
+      break;
+    }
+    case kPromisedBallot: {
+      _this->_internal_set_promised_ballot(from._internal_promised_ballot());
+      break;
+    }
+    case kApplied: {
+      _this->_internal_mutable_applied()->::keyvaluestore::WalRecord_Applied::MergeFrom(
+          from._internal_applied());
+      break;
+    }
+    case kSnapshot: {
+      _this->_internal_mutable_snapshot()->::keyvaluestore::WalRecord_Snapshot::MergeFrom(
+          from._internal_snapshot());
+      break;
+    }
+    case kCompaction: {
+      _this->_internal_mutable_compaction()->::keyvaluestore::WalRecord_Compaction::MergeFrom(
+          from._internal_compaction());
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:keyvaluestore.WalRecord)
+}
+
+inline void WalRecord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.record_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_record();
+}
+
+WalRecord::~WalRecord() {
+  // @@protoc_insertion_point(destructor:keyvaluestore.WalRecord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalRecord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_record()) {
+    clear_record();
+  }
+}
+
+void WalRecord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalRecord::clear_record() {
+// @@protoc_insertion_point(one_of_clear_start:keyvaluestore.WalRecord)
+  switch (record_case()) {
+    case kPaxosLog: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.paxos_log_;
+      }
+      break;
+    }
+    case kPromisedBallot: {
+      // No need to clear
+      break;
+    }
+    case kApplied: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.applied_;
+      }
+      break;
+    }
+    case kSnapshot: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.snapshot_;
+      }
+      break;
+    }
+    case kCompaction: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.compaction_;
+      }
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = RECORD_NOT_SET;
+}
+
+
+void WalRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:keyvaluestore.WalRecord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_record();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .keyvaluestore.WalRecord.PaxosLogEntry paxos_log = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_paxos_log(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 promised_ballot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _internal_set_promised_ballot(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WalRecord.Applied applied = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_applied(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WalRecord.Snapshot snapshot = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .keyvaluestore.WalRecord.Compaction compaction = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_compaction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalRecord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:keyvaluestore.WalRecord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .keyvaluestore.WalRecord.PaxosLogEntry paxos_log = 1;
+  if (_internal_has_paxos_log()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::paxos_log(this),
+        _Internal::paxos_log(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 promised_ballot = 2;
+  if (_internal_has_promised_ballot()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_promised_ballot(), target);
+  }
+
+  // .keyvaluestore.WalRecord.Applied applied = 3;
+  if (_internal_has_applied()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::applied(this),
+        _Internal::applied(this).GetCachedSize(), target, stream);
+  }
+
+  // .keyvaluestore.WalRecord.Snapshot snapshot = 4;
+  if (_internal_has_snapshot()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::snapshot(this),
+        _Internal::snapshot(this).GetCachedSize(), target, stream);
+  }
+
+  // .keyvaluestore.WalRecord.Compaction compaction = 5;
+  if (_internal_has_compaction()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::compaction(this),
+        _Internal::compaction(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:keyvaluestore.WalRecord)
+  return target;
+}
+
+size_t WalRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:keyvaluestore.WalRecord)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (record_case()) {
+    // .keyvaluestore.WalRecord.PaxosLogEntry paxos_log = 1;
+    case kPaxosLog: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.paxos_log_);
+      break;
+    }
+    // int32 promised_ballot = 2;
+    case kPromisedBallot: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_promised_ballot());
+      break;
+    }
+    // .keyvaluestore.WalRecord.Applied applied = 3;
+    case kApplied: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.applied_);
+      break;
+    }
+    // .keyvaluestore.WalRecord.Snapshot snapshot = 4;
+    case kSnapshot: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.snapshot_);
+      break;
+    }
+    // .keyvaluestore.WalRecord.Compaction compaction = 5;
+    case kCompaction: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.compaction_);
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalRecord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalRecord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalRecord::GetClassData() const { return &_class_data_; }
+
+
+void WalRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalRecord*>(&to_msg);
+  auto& from = static_cast<const WalRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:keyvaluestore.WalRecord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.record_case()) {
+    case kPaxosLog: {
+      _this->_internal_mutable_paxos_log()->::keyvaluestore::WalRecord_PaxosLogEntry::MergeFrom(
+          from._internal_paxos_log());
+      break;
+    }
+    case kPromisedBallot: {
+      _this->_internal_set_promised_ballot(from._internal_promised_ballot());
+      break;
+    }
+    case kApplied: {
+      _this->_internal_mutable_applied()->::keyvaluestore::WalRecord_Applied::MergeFrom(
+          from._internal_applied());
+      break;
+    }
+    case kSnapshot: {
+      _this->_internal_mutable_snapshot()->::keyvaluestore::WalRecord_Snapshot::MergeFrom(
+          from._internal_snapshot());
+      break;
+    }
+    case kCompaction: {
+      _this->_internal_mutable_compaction()->::keyvaluestore::WalRecord_Compaction::MergeFrom(
+          from._internal_compaction());
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalRecord::CopyFrom(const WalRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:keyvaluestore.WalRecord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalRecord::IsInitialized() const {
+  return true;
+}
+
+void WalRecord::InternalSwap(WalRecord* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.record_, other->_impl_.record_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalRecord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_keyvaluestore_2eproto_getter, &descriptor_table_keyvaluestore_2eproto_once,
+      file_level_metadata_keyvaluestore_2eproto[53]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace keyvaluestore
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::keyvaluestore::EmptyMessage*
+Arena::CreateMaybeMessage< ::keyvaluestore::EmptyMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::EmptyMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ServerConfig*
+Arena::CreateMaybeMessage< ::keyvaluestore::ServerConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ServerConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::BenchConfig*
+Arena::CreateMaybeMessage< ::keyvaluestore::BenchConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::BenchConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ClusterEvent*
+Arena::CreateMaybeMessage< ::keyvaluestore::ClusterEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ClusterEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ClusterBenchConfig*
+Arena::CreateMaybeMessage< ::keyvaluestore::ClusterBenchConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ClusterBenchConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::PutRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::PutRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::PutRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::DeleteRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::DeleteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::DeleteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::MultiGetRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::MultiGetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::MultiGetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::KeyValue*
+Arena::CreateMaybeMessage< ::keyvaluestore::KeyValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::KeyValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::MultiGetResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::MultiGetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::MultiGetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::MultiPutRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::MultiPutRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::MultiPutRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::MultiDeleteRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::MultiDeleteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::MultiDeleteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WriteRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::WriteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WriteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WriteResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::WriteResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WriteResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WriteBatchRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::WriteBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WriteBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::CommitResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::CommitResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::CommitResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WriteToken_SlotsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::WriteToken_SlotsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WriteToken_SlotsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WriteToken*
+Arena::CreateMaybeMessage< ::keyvaluestore::WriteToken >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WriteToken >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ElectCoordinatorRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::ElectCoordinatorRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ElectCoordinatorRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetCoordinatorResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetCoordinatorResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetCoordinatorResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetLeaderResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetLeaderResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetLeaderResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ReadIndexRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::ReadIndexRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ReadIndexRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ReadIndexResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::ReadIndexResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ReadIndexResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::Operation*
+Arena::CreateMaybeMessage< ::keyvaluestore::Operation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::Operation >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::PrepareRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::PrepareRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::PrepareRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::PromiseResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::PromiseResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::PromiseResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::ProposeRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::ProposeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::ProposeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::AcceptResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::AcceptResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::AcceptResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::InformRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::InformRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::InformRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::InformResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::InformResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::InformResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::PaxosLog*
+Arena::CreateMaybeMessage< ::keyvaluestore::PaxosLog >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::PaxosLog >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::LeaderPrepareRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::LeaderPrepareRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::LeaderPrepareRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::LeaderPromiseResponse_Accepted*
+Arena::CreateMaybeMessage< ::keyvaluestore::LeaderPromiseResponse_Accepted >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::LeaderPromiseResponse_Accepted >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::LeaderPromiseResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::LeaderPromiseResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::LeaderPromiseResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetChosenRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetChosenRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetChosenRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::GetChosenResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::GetChosenResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::GetChosenResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverRequest*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverChunk_PaxosLogs*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverChunk_PaxosLogs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverChunk_PaxosLogs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::RecoverChunk*
+Arena::CreateMaybeMessage< ::keyvaluestore::RecoverChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::RecoverChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::LatencySummary*
+Arena::CreateMaybeMessage< ::keyvaluestore::LatencySummary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::LatencySummary >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::StatsResponse_CountersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::StatsResponse_CountersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::StatsResponse_CountersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::StatsResponse*
+Arena::CreateMaybeMessage< ::keyvaluestore::StatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::StatsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord_PaxosLogEntry*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord_PaxosLogEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord_PaxosLogEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord_Applied*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord_Applied >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord_Applied >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord_Snapshot*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord_Snapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord_Snapshot >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord_Compaction*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord_Compaction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord_Compaction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::keyvaluestore::WalRecord*
+Arena::CreateMaybeMessage< ::keyvaluestore::WalRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::keyvaluestore::WalRecord >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
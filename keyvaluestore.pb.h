@@ -0,0 +1,14664 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: keyvaluestore.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_keyvaluestore_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_keyvaluestore_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_keyvaluestore_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_keyvaluestore_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_keyvaluestore_2eproto;
+namespace keyvaluestore {
+class AcceptResponse;
+struct AcceptResponseDefaultTypeInternal;
+extern AcceptResponseDefaultTypeInternal _AcceptResponse_default_instance_;
+class BenchConfig;
+struct BenchConfigDefaultTypeInternal;
+extern BenchConfigDefaultTypeInternal _BenchConfig_default_instance_;
+class ClusterBenchConfig;
+struct ClusterBenchConfigDefaultTypeInternal;
+extern ClusterBenchConfigDefaultTypeInternal _ClusterBenchConfig_default_instance_;
+class ClusterEvent;
+struct ClusterEventDefaultTypeInternal;
+extern ClusterEventDefaultTypeInternal _ClusterEvent_default_instance_;
+class CommitResponse;
+struct CommitResponseDefaultTypeInternal;
+extern CommitResponseDefaultTypeInternal _CommitResponse_default_instance_;
+class DeleteRequest;
+struct DeleteRequestDefaultTypeInternal;
+extern DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
+class ElectCoordinatorRequest;
+struct ElectCoordinatorRequestDefaultTypeInternal;
+extern ElectCoordinatorRequestDefaultTypeInternal _ElectCoordinatorRequest_default_instance_;
+class EmptyMessage;
+struct EmptyMessageDefaultTypeInternal;
+extern EmptyMessageDefaultTypeInternal _EmptyMessage_default_instance_;
+class GetChosenRequest;
+struct GetChosenRequestDefaultTypeInternal;
+extern GetChosenRequestDefaultTypeInternal _GetChosenRequest_default_instance_;
+class GetChosenResponse;
+struct GetChosenResponseDefaultTypeInternal;
+extern GetChosenResponseDefaultTypeInternal _GetChosenResponse_default_instance_;
+class GetCoordinatorResponse;
+struct GetCoordinatorResponseDefaultTypeInternal;
+extern GetCoordinatorResponseDefaultTypeInternal _GetCoordinatorResponse_default_instance_;
+class GetLeaderResponse;
+struct GetLeaderResponseDefaultTypeInternal;
+extern GetLeaderResponseDefaultTypeInternal _GetLeaderResponse_default_instance_;
+class GetRequest;
+struct GetRequestDefaultTypeInternal;
+extern GetRequestDefaultTypeInternal _GetRequest_default_instance_;
+class GetResponse;
+struct GetResponseDefaultTypeInternal;
+extern GetResponseDefaultTypeInternal _GetResponse_default_instance_;
+class InformRequest;
+struct InformRequestDefaultTypeInternal;
+extern InformRequestDefaultTypeInternal _InformRequest_default_instance_;
+class InformResponse;
+struct InformResponseDefaultTypeInternal;
+extern InformResponseDefaultTypeInternal _InformResponse_default_instance_;
+class KeyValue;
+struct KeyValueDefaultTypeInternal;
+extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
+class LatencySummary;
+struct LatencySummaryDefaultTypeInternal;
+extern LatencySummaryDefaultTypeInternal _LatencySummary_default_instance_;
+class LeaderPrepareRequest;
+struct LeaderPrepareRequestDefaultTypeInternal;
+extern LeaderPrepareRequestDefaultTypeInternal _LeaderPrepareRequest_default_instance_;
+class LeaderPromiseResponse;
+struct LeaderPromiseResponseDefaultTypeInternal;
+extern LeaderPromiseResponseDefaultTypeInternal _LeaderPromiseResponse_default_instance_;
+class LeaderPromiseResponse_Accepted;
+struct LeaderPromiseResponse_AcceptedDefaultTypeInternal;
+extern LeaderPromiseResponse_AcceptedDefaultTypeInternal _LeaderPromiseResponse_Accepted_default_instance_;
+class MultiDeleteRequest;
+struct MultiDeleteRequestDefaultTypeInternal;
+extern MultiDeleteRequestDefaultTypeInternal _MultiDeleteRequest_default_instance_;
+class MultiGetRequest;
+struct MultiGetRequestDefaultTypeInternal;
+extern MultiGetRequestDefaultTypeInternal _MultiGetRequest_default_instance_;
+class MultiGetResponse;
+struct MultiGetResponseDefaultTypeInternal;
+extern MultiGetResponseDefaultTypeInternal _MultiGetResponse_default_instance_;
+class MultiPutRequest;
+struct MultiPutRequestDefaultTypeInternal;
+extern MultiPutRequestDefaultTypeInternal _MultiPutRequest_default_instance_;
+class Operation;
+struct OperationDefaultTypeInternal;
+extern OperationDefaultTypeInternal _Operation_default_instance_;
+class PaxosLog;
+struct PaxosLogDefaultTypeInternal;
+extern PaxosLogDefaultTypeInternal _PaxosLog_default_instance_;
+class PrepareRequest;
+struct PrepareRequestDefaultTypeInternal;
+extern PrepareRequestDefaultTypeInternal _PrepareRequest_default_instance_;
+class PromiseResponse;
+struct PromiseResponseDefaultTypeInternal;
+extern PromiseResponseDefaultTypeInternal _PromiseResponse_default_instance_;
+class ProposeRequest;
+struct ProposeRequestDefaultTypeInternal;
+extern ProposeRequestDefaultTypeInternal _ProposeRequest_default_instance_;
+class PutRequest;
+struct PutRequestDefaultTypeInternal;
+extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
+class ReadIndexRequest;
+struct ReadIndexRequestDefaultTypeInternal;
+extern ReadIndexRequestDefaultTypeInternal _ReadIndexRequest_default_instance_;
+class ReadIndexResponse;
+struct ReadIndexResponseDefaultTypeInternal;
+extern ReadIndexResponseDefaultTypeInternal _ReadIndexResponse_default_instance_;
+class RecoverChunk;
+struct RecoverChunkDefaultTypeInternal;
+extern RecoverChunkDefaultTypeInternal _RecoverChunk_default_instance_;
+class RecoverChunk_KvMapEntry_DoNotUse;
+struct RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal;
+extern RecoverChunk_KvMapEntry_DoNotUseDefaultTypeInternal _RecoverChunk_KvMapEntry_DoNotUse_default_instance_;
+class RecoverChunk_PaxosLogs;
+struct RecoverChunk_PaxosLogsDefaultTypeInternal;
+extern RecoverChunk_PaxosLogsDefaultTypeInternal _RecoverChunk_PaxosLogs_default_instance_;
+class RecoverChunk_PaxosLogsEntry_DoNotUse;
+struct RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal;
+extern RecoverChunk_PaxosLogsEntry_DoNotUseDefaultTypeInternal _RecoverChunk_PaxosLogsEntry_DoNotUse_default_instance_;
+class RecoverChunk_PaxosLogs_LogsEntry_DoNotUse;
+struct RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal;
+extern RecoverChunk_PaxosLogs_LogsEntry_DoNotUseDefaultTypeInternal _RecoverChunk_PaxosLogs_LogsEntry_DoNotUse_default_instance_;
+class RecoverRequest;
+struct RecoverRequestDefaultTypeInternal;
+extern RecoverRequestDefaultTypeInternal _RecoverRequest_default_instance_;
+class ServerConfig;
+struct ServerConfigDefaultTypeInternal;
+extern ServerConfigDefaultTypeInternal _ServerConfig_default_instance_;
+class StatsResponse;
+struct StatsResponseDefaultTypeInternal;
+extern StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+class StatsResponse_CountersEntry_DoNotUse;
+struct StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal;
+extern StatsResponse_CountersEntry_DoNotUseDefaultTypeInternal _StatsResponse_CountersEntry_DoNotUse_default_instance_;
+class StatsResponse_LatenciesUsEntry_DoNotUse;
+struct StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal;
+extern StatsResponse_LatenciesUsEntry_DoNotUseDefaultTypeInternal _StatsResponse_LatenciesUsEntry_DoNotUse_default_instance_;
+class WalRecord;
+struct WalRecordDefaultTypeInternal;
+extern WalRecordDefaultTypeInternal _WalRecord_default_instance_;
+class WalRecord_Applied;
+struct WalRecord_AppliedDefaultTypeInternal;
+extern WalRecord_AppliedDefaultTypeInternal _WalRecord_Applied_default_instance_;
+class WalRecord_Compaction;
+struct WalRecord_CompactionDefaultTypeInternal;
+extern WalRecord_CompactionDefaultTypeInternal _WalRecord_Compaction_default_instance_;
+class WalRecord_PaxosLogEntry;
+struct WalRecord_PaxosLogEntryDefaultTypeInternal;
+extern WalRecord_PaxosLogEntryDefaultTypeInternal _WalRecord_PaxosLogEntry_default_instance_;
+class WalRecord_Snapshot;
+struct WalRecord_SnapshotDefaultTypeInternal;
+extern WalRecord_SnapshotDefaultTypeInternal _WalRecord_Snapshot_default_instance_;
+class WalRecord_Snapshot_KvMapEntry_DoNotUse;
+struct WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal;
+extern WalRecord_Snapshot_KvMapEntry_DoNotUseDefaultTypeInternal _WalRecord_Snapshot_KvMapEntry_DoNotUse_default_instance_;
+class WriteBatchRequest;
+struct WriteBatchRequestDefaultTypeInternal;
+extern WriteBatchRequestDefaultTypeInternal _WriteBatchRequest_default_instance_;
+class WriteRequest;
+struct WriteRequestDefaultTypeInternal;
+extern WriteRequestDefaultTypeInternal _WriteRequest_default_instance_;
+class WriteResponse;
+struct WriteResponseDefaultTypeInternal;
+extern WriteResponseDefaultTypeInternal _WriteResponse_default_instance_;
+class WriteToken;
+struct WriteTokenDefaultTypeInternal;
+extern WriteTokenDefaultTypeInternal _WriteToken_default_instance_;
+class WriteToken_SlotsEntry_DoNotUse;
+struct WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal;
+extern WriteToken_SlotsEntry_DoNotUseDefaultTypeInternal _WriteToken_SlotsEntry_DoNotUse_default_instance_;
+}  // namespace keyvaluestore
+PROTOBUF_NAMESPACE_OPEN
+template<> ::keyvaluestore::AcceptResponse* Arena::CreateMaybeMessage<::keyvaluestore::AcceptResponse>(Arena*);
+template<> ::keyvaluestore::BenchConfig* Arena::CreateMaybeMessage<::keyvaluestore::BenchConfig>(Arena*);
+template<> ::keyvaluestore::ClusterBenchConfig* Arena::CreateMaybeMessage<::keyvaluestore::ClusterBenchConfig>(Arena*);
+template<> ::keyvaluestore::ClusterEvent* Arena::CreateMaybeMessage<::keyvaluestore::ClusterEvent>(Arena*);
+template<> ::keyvaluestore::CommitResponse* Arena::CreateMaybeMessage<::keyvaluestore::CommitResponse>(Arena*);
+template<> ::keyvaluestore::DeleteRequest* Arena::CreateMaybeMessage<::keyvaluestore::DeleteRequest>(Arena*);
+template<> ::keyvaluestore::ElectCoordinatorRequest* Arena::CreateMaybeMessage<::keyvaluestore::ElectCoordinatorRequest>(Arena*);
+template<> ::keyvaluestore::EmptyMessage* Arena::CreateMaybeMessage<::keyvaluestore::EmptyMessage>(Arena*);
+template<> ::keyvaluestore::GetChosenRequest* Arena::CreateMaybeMessage<::keyvaluestore::GetChosenRequest>(Arena*);
+template<> ::keyvaluestore::GetChosenResponse* Arena::CreateMaybeMessage<::keyvaluestore::GetChosenResponse>(Arena*);
+template<> ::keyvaluestore::GetCoordinatorResponse* Arena::CreateMaybeMessage<::keyvaluestore::GetCoordinatorResponse>(Arena*);
+template<> ::keyvaluestore::GetLeaderResponse* Arena::CreateMaybeMessage<::keyvaluestore::GetLeaderResponse>(Arena*);
+template<> ::keyvaluestore::GetRequest* Arena::CreateMaybeMessage<::keyvaluestore::GetRequest>(Arena*);
+template<> ::keyvaluestore::GetResponse* Arena::CreateMaybeMessage<::keyvaluestore::GetResponse>(Arena*);
+template<> ::keyvaluestore::InformRequest* Arena::CreateMaybeMessage<::keyvaluestore::InformRequest>(Arena*);
+template<> ::keyvaluestore::InformResponse* Arena::CreateMaybeMessage<::keyvaluestore::InformResponse>(Arena*);
+template<> ::keyvaluestore::KeyValue* Arena::CreateMaybeMessage<::keyvaluestore::KeyValue>(Arena*);
+template<> ::keyvaluestore::LatencySummary* Arena::CreateMaybeMessage<::keyvaluestore::LatencySummary>(Arena*);
+template<> ::keyvaluestore::LeaderPrepareRequest* Arena::CreateMaybeMessage<::keyvaluestore::LeaderPrepareRequest>(Arena*);
+template<> ::keyvaluestore::LeaderPromiseResponse* Arena::CreateMaybeMessage<::keyvaluestore::LeaderPromiseResponse>(Arena*);
+template<> ::keyvaluestore::LeaderPromiseResponse_Accepted* Arena::CreateMaybeMessage<::keyvaluestore::LeaderPromiseResponse_Accepted>(Arena*);
+template<> ::keyvaluestore::MultiDeleteRequest* Arena::CreateMaybeMessage<::keyvaluestore::MultiDeleteRequest>(Arena*);
+template<> ::keyvaluestore::MultiGetRequest* Arena::CreateMaybeMessage<::keyvaluestore::MultiGetRequest>(Arena*);
+template<> ::keyvaluestore::MultiGetResponse* Arena::CreateMaybeMessage<::keyvaluestore::MultiGetResponse>(Arena*);
+template<> ::keyvaluestore::MultiPutRequest* Arena::CreateMaybeMessage<::keyvaluestore::MultiPutRequest>(Arena*);
+template<> ::keyvaluestore::Operation* Arena::CreateMaybeMessage<::keyvaluestore::Operation>(Arena*);
+template<> ::keyvaluestore::PaxosLog* Arena::CreateMaybeMessage<::keyvaluestore::PaxosLog>(Arena*);
+template<> ::keyvaluestore::PrepareRequest* Arena::CreateMaybeMessage<::keyvaluestore::PrepareRequest>(Arena*);
+template<> ::keyvaluestore::PromiseResponse* Arena::CreateMaybeMessage<::keyvaluestore::PromiseResponse>(Arena*);
+template<> ::keyvaluestore::ProposeRequest* Arena::CreateMaybeMessage<::keyvaluestore::ProposeRequest>(Arena*);
+template<> ::keyvaluestore::PutRequest* Arena::CreateMaybeMessage<::keyvaluestore::PutRequest>(Arena*);
+template<> ::keyvaluestore::ReadIndexRequest* Arena::CreateMaybeMessage<::keyvaluestore::ReadIndexRequest>(Arena*);
+template<> ::keyvaluestore::ReadIndexResponse* Arena::CreateMaybeMessage<::keyvaluestore::ReadIndexResponse>(Arena*);
+template<> ::keyvaluestore::RecoverChunk* Arena::CreateMaybeMessage<::keyvaluestore::RecoverChunk>(Arena*);
+template<> ::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::RecoverChunk_KvMapEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::RecoverChunk_PaxosLogs* Arena::CreateMaybeMessage<::keyvaluestore::RecoverChunk_PaxosLogs>(Arena*);
+template<> ::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::RecoverChunk_PaxosLogsEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::RecoverChunk_PaxosLogs_LogsEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::RecoverRequest* Arena::CreateMaybeMessage<::keyvaluestore::RecoverRequest>(Arena*);
+template<> ::keyvaluestore::ServerConfig* Arena::CreateMaybeMessage<::keyvaluestore::ServerConfig>(Arena*);
+template<> ::keyvaluestore::StatsResponse* Arena::CreateMaybeMessage<::keyvaluestore::StatsResponse>(Arena*);
+template<> ::keyvaluestore::StatsResponse_CountersEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::StatsResponse_CountersEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::StatsResponse_LatenciesUsEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::WalRecord* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord>(Arena*);
+template<> ::keyvaluestore::WalRecord_Applied* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord_Applied>(Arena*);
+template<> ::keyvaluestore::WalRecord_Compaction* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord_Compaction>(Arena*);
+template<> ::keyvaluestore::WalRecord_PaxosLogEntry* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord_PaxosLogEntry>(Arena*);
+template<> ::keyvaluestore::WalRecord_Snapshot* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord_Snapshot>(Arena*);
+template<> ::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::WalRecord_Snapshot_KvMapEntry_DoNotUse>(Arena*);
+template<> ::keyvaluestore::WriteBatchRequest* Arena::CreateMaybeMessage<::keyvaluestore::WriteBatchRequest>(Arena*);
+template<> ::keyvaluestore::WriteRequest* Arena::CreateMaybeMessage<::keyvaluestore::WriteRequest>(Arena*);
+template<> ::keyvaluestore::WriteResponse* Arena::CreateMaybeMessage<::keyvaluestore::WriteResponse>(Arena*);
+template<> ::keyvaluestore::WriteToken* Arena::CreateMaybeMessage<::keyvaluestore::WriteToken>(Arena*);
+template<> ::keyvaluestore::WriteToken_SlotsEntry_DoNotUse* Arena::CreateMaybeMessage<::keyvaluestore::WriteToken_SlotsEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace keyvaluestore {
+
+enum OperationType : int {
+  NOT_SET = 0,
+  SET = 1,
+  DELETE = 2,
+  SET_COORDINATOR = 3,
+  BATCH = 4,
+  OperationType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  OperationType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool OperationType_IsValid(int value);
+constexpr OperationType OperationType_MIN = NOT_SET;
+constexpr OperationType OperationType_MAX = BATCH;
+constexpr int OperationType_ARRAYSIZE = OperationType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OperationType_descriptor();
+template<typename T>
+inline const std::string& OperationType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, OperationType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function OperationType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    OperationType_descriptor(), enum_t_value);
+}
+inline bool OperationType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, OperationType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OperationType>(
+    OperationType_descriptor(), name, value);
+}
+// ===================================================================
+
+class EmptyMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:keyvaluestore.EmptyMessage) */ {
+ public:
+  inline EmptyMessage() : EmptyMessage(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR EmptyMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EmptyMessage(const EmptyMessage& from);
+  EmptyMessage(EmptyMessage&& from) noexcept
+    : EmptyMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline EmptyMessage& operator=(const EmptyMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EmptyMessage& operator=(EmptyMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EmptyMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EmptyMessage* internal_default_instance() {
+    return reinterpret_cast<const EmptyMessage*>(
+               &_EmptyMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(EmptyMessage& a, EmptyMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EmptyMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EmptyMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EmptyMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EmptyMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const EmptyMessage& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const EmptyMessage& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.EmptyMessage";
+  }
+  protected:
+  explicit EmptyMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.EmptyMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ServerConfig) */ {
+ public:
+  inline ServerConfig() : ServerConfig(nullptr) {}
+  ~ServerConfig() override;
+  explicit PROTOBUF_CONSTEXPR ServerConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerConfig(const ServerConfig& from);
+  ServerConfig(ServerConfig&& from) noexcept
+    : ServerConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerConfig& operator=(const ServerConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerConfig& operator=(ServerConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerConfig* internal_default_instance() {
+    return reinterpret_cast<const ServerConfig*>(
+               &_ServerConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerConfig& a, ServerConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerConfig& from) {
+    ServerConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ServerConfig";
+  }
+  protected:
+  explicit ServerConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplicaFieldNumber = 4,
+    kMyAddrFieldNumber = 1,
+    kMyPaxosFieldNumber = 2,
+    kWalPathFieldNumber = 10,
+    kLogLevelFieldNumber = 13,
+    kFailRateFieldNumber = 3,
+    kHeartbeatIntervalMsFieldNumber = 5,
+    kHeartbeatTimeoutMsFieldNumber = 6,
+    kBatchWindowUsFieldNumber = 7,
+    kMaxBatchSizeFieldNumber = 8,
+    kPipelineDepthFieldNumber = 9,
+    kCompactionIntervalMsFieldNumber = 11,
+    kCompactionRetentionFieldNumber = 12,
+    kNumGroupsFieldNumber = 14,
+    kPhase1QuorumFieldNumber = 15,
+    kPhase2QuorumFieldNumber = 16,
+    kThriftyTimeoutMsFieldNumber = 18,
+    kThriftyProposeFieldNumber = 17,
+    kFollowerReadsFieldNumber = 19,
+  };
+  // repeated string replica = 4;
+  int replica_size() const;
+  private:
+  int _internal_replica_size() const;
+  public:
+  void clear_replica();
+  const std::string& replica(int index) const;
+  std::string* mutable_replica(int index);
+  void set_replica(int index, const std::string& value);
+  void set_replica(int index, std::string&& value);
+  void set_replica(int index, const char* value);
+  void set_replica(int index, const char* value, size_t size);
+  std::string* add_replica();
+  void add_replica(const std::string& value);
+  void add_replica(std::string&& value);
+  void add_replica(const char* value);
+  void add_replica(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& replica() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_replica();
+  private:
+  const std::string& _internal_replica(int index) const;
+  std::string* _internal_add_replica();
+  public:
+
+  // string my_addr = 1;
+  void clear_my_addr();
+  const std::string& my_addr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_my_addr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_my_addr();
+  PROTOBUF_NODISCARD std::string* release_my_addr();
+  void set_allocated_my_addr(std::string* my_addr);
+  private:
+  const std::string& _internal_my_addr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_my_addr(const std::string& value);
+  std::string* _internal_mutable_my_addr();
+  public:
+
+  // string my_paxos = 2;
+  void clear_my_paxos();
+  const std::string& my_paxos() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_my_paxos(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_my_paxos();
+  PROTOBUF_NODISCARD std::string* release_my_paxos();
+  void set_allocated_my_paxos(std::string* my_paxos);
+  private:
+  const std::string& _internal_my_paxos() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_my_paxos(const std::string& value);
+  std::string* _internal_mutable_my_paxos();
+  public:
+
+  // string wal_path = 10;
+  void clear_wal_path();
+  const std::string& wal_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_wal_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_wal_path();
+  PROTOBUF_NODISCARD std::string* release_wal_path();
+  void set_allocated_wal_path(std::string* wal_path);
+  private:
+  const std::string& _internal_wal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_wal_path(const std::string& value);
+  std::string* _internal_mutable_wal_path();
+  public:
+
+  // string log_level = 13;
+  void clear_log_level();
+  const std::string& log_level() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_log_level(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_log_level();
+  PROTOBUF_NODISCARD std::string* release_log_level();
+  void set_allocated_log_level(std::string* log_level);
+  private:
+  const std::string& _internal_log_level() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_log_level(const std::string& value);
+  std::string* _internal_mutable_log_level();
+  public:
+
+  // double fail_rate = 3;
+  void clear_fail_rate();
+  double fail_rate() const;
+  void set_fail_rate(double value);
+  private:
+  double _internal_fail_rate() const;
+  void _internal_set_fail_rate(double value);
+  public:
+
+  // int32 heartbeat_interval_ms = 5;
+  void clear_heartbeat_interval_ms();
+  int32_t heartbeat_interval_ms() const;
+  void set_heartbeat_interval_ms(int32_t value);
+  private:
+  int32_t _internal_heartbeat_interval_ms() const;
+  void _internal_set_heartbeat_interval_ms(int32_t value);
+  public:
+
+  // int32 heartbeat_timeout_ms = 6;
+  void clear_heartbeat_timeout_ms();
+  int32_t heartbeat_timeout_ms() const;
+  void set_heartbeat_timeout_ms(int32_t value);
+  private:
+  int32_t _internal_heartbeat_timeout_ms() const;
+  void _internal_set_heartbeat_timeout_ms(int32_t value);
+  public:
+
+  // int32 batch_window_us = 7;
+  void clear_batch_window_us();
+  int32_t batch_window_us() const;
+  void set_batch_window_us(int32_t value);
+  private:
+  int32_t _internal_batch_window_us() const;
+  void _internal_set_batch_window_us(int32_t value);
+  public:
+
+  // int32 max_batch_size = 8;
+  void clear_max_batch_size();
+  int32_t max_batch_size() const;
+  void set_max_batch_size(int32_t value);
+  private:
+  int32_t _internal_max_batch_size() const;
+  void _internal_set_max_batch_size(int32_t value);
+  public:
+
+  // int32 pipeline_depth = 9;
+  void clear_pipeline_depth();
+  int32_t pipeline_depth() const;
+  void set_pipeline_depth(int32_t value);
+  private:
+  int32_t _internal_pipeline_depth() const;
+  void _internal_set_pipeline_depth(int32_t value);
+  public:
+
+  // int32 compaction_interval_ms = 11;
+  void clear_compaction_interval_ms();
+  int32_t compaction_interval_ms() const;
+  void set_compaction_interval_ms(int32_t value);
+  private:
+  int32_t _internal_compaction_interval_ms() const;
+  void _internal_set_compaction_interval_ms(int32_t value);
+  public:
+
+  // int32 compaction_retention = 12;
+  void clear_compaction_retention();
+  int32_t compaction_retention() const;
+  void set_compaction_retention(int32_t value);
+  private:
+  int32_t _internal_compaction_retention() const;
+  void _internal_set_compaction_retention(int32_t value);
+  public:
+
+  // int32 num_groups = 14;
+  void clear_num_groups();
+  int32_t num_groups() const;
+  void set_num_groups(int32_t value);
+  private:
+  int32_t _internal_num_groups() const;
+  void _internal_set_num_groups(int32_t value);
+  public:
+
+  // int32 phase1_quorum = 15;
+  void clear_phase1_quorum();
+  int32_t phase1_quorum() const;
+  void set_phase1_quorum(int32_t value);
+  private:
+  int32_t _internal_phase1_quorum() const;
+  void _internal_set_phase1_quorum(int32_t value);
+  public:
+
+  // int32 phase2_quorum = 16;
+  void clear_phase2_quorum();
+  int32_t phase2_quorum() const;
+  void set_phase2_quorum(int32_t value);
+  private:
+  int32_t _internal_phase2_quorum() const;
+  void _internal_set_phase2_quorum(int32_t value);
+  public:
+
+  // int32 thrifty_timeout_ms = 18;
+  void clear_thrifty_timeout_ms();
+  int32_t thrifty_timeout_ms() const;
+  void set_thrifty_timeout_ms(int32_t value);
+  private:
+  int32_t _internal_thrifty_timeout_ms() const;
+  void _internal_set_thrifty_timeout_ms(int32_t value);
+  public:
+
+  // bool thrifty_propose = 17;
+  void clear_thrifty_propose();
+  bool thrifty_propose() const;
+  void set_thrifty_propose(bool value);
+  private:
+  bool _internal_thrifty_propose() const;
+  void _internal_set_thrifty_propose(bool value);
+  public:
+
+  // bool follower_reads = 19;
+  void clear_follower_reads();
+  bool follower_reads() const;
+  void set_follower_reads(bool value);
+  private:
+  bool _internal_follower_reads() const;
+  void _internal_set_follower_reads(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ServerConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> replica_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr my_addr_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr my_paxos_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr wal_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr log_level_;
+    double fail_rate_;
+    int32_t heartbeat_interval_ms_;
+    int32_t heartbeat_timeout_ms_;
+    int32_t batch_window_us_;
+    int32_t max_batch_size_;
+    int32_t pipeline_depth_;
+    int32_t compaction_interval_ms_;
+    int32_t compaction_retention_;
+    int32_t num_groups_;
+    int32_t phase1_quorum_;
+    int32_t phase2_quorum_;
+    int32_t thrifty_timeout_ms_;
+    bool thrifty_propose_;
+    bool follower_reads_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BenchConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.BenchConfig) */ {
+ public:
+  inline BenchConfig() : BenchConfig(nullptr) {}
+  ~BenchConfig() override;
+  explicit PROTOBUF_CONSTEXPR BenchConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchConfig(const BenchConfig& from);
+  BenchConfig(BenchConfig&& from) noexcept
+    : BenchConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchConfig& operator=(const BenchConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchConfig& operator=(BenchConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchConfig* internal_default_instance() {
+    return reinterpret_cast<const BenchConfig*>(
+               &_BenchConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(BenchConfig& a, BenchConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchConfig& from) {
+    BenchConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.BenchConfig";
+  }
+  protected:
+  explicit BenchConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerFieldNumber = 1,
+    kDistributionFieldNumber = 8,
+    kNumClientsFieldNumber = 2,
+    kOutstandingFieldNumber = 3,
+    kDurationSFieldNumber = 4,
+    kWarmupSFieldNumber = 5,
+    kReadRatioFieldNumber = 6,
+    kNumKeysFieldNumber = 7,
+    kValueSizeFieldNumber = 10,
+    kZipfThetaFieldNumber = 9,
+    kSeedFieldNumber = 12,
+    kSkipLoadFieldNumber = 11,
+  };
+  // repeated string server = 1;
+  int server_size() const;
+  private:
+  int _internal_server_size() const;
+  public:
+  void clear_server();
+  const std::string& server(int index) const;
+  std::string* mutable_server(int index);
+  void set_server(int index, const std::string& value);
+  void set_server(int index, std::string&& value);
+  void set_server(int index, const char* value);
+  void set_server(int index, const char* value, size_t size);
+  std::string* add_server();
+  void add_server(const std::string& value);
+  void add_server(std::string&& value);
+  void add_server(const char* value);
+  void add_server(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& server() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_server();
+  private:
+  const std::string& _internal_server(int index) const;
+  std::string* _internal_add_server();
+  public:
+
+  // string distribution = 8;
+  void clear_distribution();
+  const std::string& distribution() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_distribution(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_distribution();
+  PROTOBUF_NODISCARD std::string* release_distribution();
+  void set_allocated_distribution(std::string* distribution);
+  private:
+  const std::string& _internal_distribution() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_distribution(const std::string& value);
+  std::string* _internal_mutable_distribution();
+  public:
+
+  // int32 num_clients = 2;
+  void clear_num_clients();
+  int32_t num_clients() const;
+  void set_num_clients(int32_t value);
+  private:
+  int32_t _internal_num_clients() const;
+  void _internal_set_num_clients(int32_t value);
+  public:
+
+  // int32 outstanding = 3;
+  void clear_outstanding();
+  int32_t outstanding() const;
+  void set_outstanding(int32_t value);
+  private:
+  int32_t _internal_outstanding() const;
+  void _internal_set_outstanding(int32_t value);
+  public:
+
+  // int32 duration_s = 4;
+  void clear_duration_s();
+  int32_t duration_s() const;
+  void set_duration_s(int32_t value);
+  private:
+  int32_t _internal_duration_s() const;
+  void _internal_set_duration_s(int32_t value);
+  public:
+
+  // int32 warmup_s = 5;
+  void clear_warmup_s();
+  int32_t warmup_s() const;
+  void set_warmup_s(int32_t value);
+  private:
+  int32_t _internal_warmup_s() const;
+  void _internal_set_warmup_s(int32_t value);
+  public:
+
+  // double read_ratio = 6;
+  void clear_read_ratio();
+  double read_ratio() const;
+  void set_read_ratio(double value);
+  private:
+  double _internal_read_ratio() const;
+  void _internal_set_read_ratio(double value);
+  public:
+
+  // int32 num_keys = 7;
+  void clear_num_keys();
+  int32_t num_keys() const;
+  void set_num_keys(int32_t value);
+  private:
+  int32_t _internal_num_keys() const;
+  void _internal_set_num_keys(int32_t value);
+  public:
+
+  // int32 value_size = 10;
+  void clear_value_size();
+  int32_t value_size() const;
+  void set_value_size(int32_t value);
+  private:
+  int32_t _internal_value_size() const;
+  void _internal_set_value_size(int32_t value);
+  public:
+
+  // double zipf_theta = 9;
+  void clear_zipf_theta();
+  double zipf_theta() const;
+  void set_zipf_theta(double value);
+  private:
+  double _internal_zipf_theta() const;
+  void _internal_set_zipf_theta(double value);
+  public:
+
+  // int64 seed = 12;
+  void clear_seed();
+  int64_t seed() const;
+  void set_seed(int64_t value);
+  private:
+  int64_t _internal_seed() const;
+  void _internal_set_seed(int64_t value);
+  public:
+
+  // bool skip_load = 11;
+  void clear_skip_load();
+  bool skip_load() const;
+  void set_skip_load(bool value);
+  private:
+  bool _internal_skip_load() const;
+  void _internal_set_skip_load(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.BenchConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> server_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr distribution_;
+    int32_t num_clients_;
+    int32_t outstanding_;
+    int32_t duration_s_;
+    int32_t warmup_s_;
+    double read_ratio_;
+    int32_t num_keys_;
+    int32_t value_size_;
+    double zipf_theta_;
+    int64_t seed_;
+    bool skip_load_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClusterEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ClusterEvent) */ {
+ public:
+  inline ClusterEvent() : ClusterEvent(nullptr) {}
+  ~ClusterEvent() override;
+  explicit PROTOBUF_CONSTEXPR ClusterEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClusterEvent(const ClusterEvent& from);
+  ClusterEvent(ClusterEvent&& from) noexcept
+    : ClusterEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline ClusterEvent& operator=(const ClusterEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClusterEvent& operator=(ClusterEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClusterEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClusterEvent* internal_default_instance() {
+    return reinterpret_cast<const ClusterEvent*>(
+               &_ClusterEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ClusterEvent& a, ClusterEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClusterEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClusterEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClusterEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClusterEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClusterEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClusterEvent& from) {
+    ClusterEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClusterEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ClusterEvent";
+  }
+  protected:
+  explicit ClusterEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAtMsFieldNumber = 1,
+    kReplicaFieldNumber = 2,
+    kRestartFieldNumber = 3,
+  };
+  // int32 at_ms = 1;
+  void clear_at_ms();
+  int32_t at_ms() const;
+  void set_at_ms(int32_t value);
+  private:
+  int32_t _internal_at_ms() const;
+  void _internal_set_at_ms(int32_t value);
+  public:
+
+  // int32 replica = 2;
+  void clear_replica();
+  int32_t replica() const;
+  void set_replica(int32_t value);
+  private:
+  int32_t _internal_replica() const;
+  void _internal_set_replica(int32_t value);
+  public:
+
+  // bool restart = 3;
+  void clear_restart();
+  bool restart() const;
+  void set_restart(bool value);
+  private:
+  bool _internal_restart() const;
+  void _internal_set_restart(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ClusterEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t at_ms_;
+    int32_t replica_;
+    bool restart_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClusterBenchConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ClusterBenchConfig) */ {
+ public:
+  inline ClusterBenchConfig() : ClusterBenchConfig(nullptr) {}
+  ~ClusterBenchConfig() override;
+  explicit PROTOBUF_CONSTEXPR ClusterBenchConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClusterBenchConfig(const ClusterBenchConfig& from);
+  ClusterBenchConfig(ClusterBenchConfig&& from) noexcept
+    : ClusterBenchConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline ClusterBenchConfig& operator=(const ClusterBenchConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClusterBenchConfig& operator=(ClusterBenchConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClusterBenchConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClusterBenchConfig* internal_default_instance() {
+    return reinterpret_cast<const ClusterBenchConfig*>(
+               &_ClusterBenchConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ClusterBenchConfig& a, ClusterBenchConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClusterBenchConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClusterBenchConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClusterBenchConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClusterBenchConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClusterBenchConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClusterBenchConfig& from) {
+    ClusterBenchConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClusterBenchConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ClusterBenchConfig";
+  }
+  protected:
+  explicit ClusterBenchConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 9,
+    kWalDirFieldNumber = 3,
+    kReplicaConfigFieldNumber = 2,
+    kNumReplicasFieldNumber = 1,
+    kNumClientsFieldNumber = 4,
+    kReadRatioFieldNumber = 6,
+    kDurationSFieldNumber = 5,
+    kNumKeysFieldNumber = 7,
+    kValueSizeFieldNumber = 8,
+    kSessionReadsFieldNumber = 11,
+    kSeedFieldNumber = 10,
+  };
+  // repeated .keyvaluestore.ClusterEvent events = 9;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::keyvaluestore::ClusterEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::ClusterEvent >*
+      mutable_events();
+  private:
+  const ::keyvaluestore::ClusterEvent& _internal_events(int index) const;
+  ::keyvaluestore::ClusterEvent* _internal_add_events();
+  public:
+  const ::keyvaluestore::ClusterEvent& events(int index) const;
+  ::keyvaluestore::ClusterEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::ClusterEvent >&
+      events() const;
+
+  // string wal_dir = 3;
+  void clear_wal_dir();
+  const std::string& wal_dir() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_wal_dir(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_wal_dir();
+  PROTOBUF_NODISCARD std::string* release_wal_dir();
+  void set_allocated_wal_dir(std::string* wal_dir);
+  private:
+  const std::string& _internal_wal_dir() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_wal_dir(const std::string& value);
+  std::string* _internal_mutable_wal_dir();
+  public:
+
+  // .keyvaluestore.ServerConfig replica_config = 2;
+  bool has_replica_config() const;
+  private:
+  bool _internal_has_replica_config() const;
+  public:
+  void clear_replica_config();
+  const ::keyvaluestore::ServerConfig& replica_config() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::ServerConfig* release_replica_config();
+  ::keyvaluestore::ServerConfig* mutable_replica_config();
+  void set_allocated_replica_config(::keyvaluestore::ServerConfig* replica_config);
+  private:
+  const ::keyvaluestore::ServerConfig& _internal_replica_config() const;
+  ::keyvaluestore::ServerConfig* _internal_mutable_replica_config();
+  public:
+  void unsafe_arena_set_allocated_replica_config(
+      ::keyvaluestore::ServerConfig* replica_config);
+  ::keyvaluestore::ServerConfig* unsafe_arena_release_replica_config();
+
+  // int32 num_replicas = 1;
+  void clear_num_replicas();
+  int32_t num_replicas() const;
+  void set_num_replicas(int32_t value);
+  private:
+  int32_t _internal_num_replicas() const;
+  void _internal_set_num_replicas(int32_t value);
+  public:
+
+  // int32 num_clients = 4;
+  void clear_num_clients();
+  int32_t num_clients() const;
+  void set_num_clients(int32_t value);
+  private:
+  int32_t _internal_num_clients() const;
+  void _internal_set_num_clients(int32_t value);
+  public:
+
+  // double read_ratio = 6;
+  void clear_read_ratio();
+  double read_ratio() const;
+  void set_read_ratio(double value);
+  private:
+  double _internal_read_ratio() const;
+  void _internal_set_read_ratio(double value);
+  public:
+
+  // int32 duration_s = 5;
+  void clear_duration_s();
+  int32_t duration_s() const;
+  void set_duration_s(int32_t value);
+  private:
+  int32_t _internal_duration_s() const;
+  void _internal_set_duration_s(int32_t value);
+  public:
+
+  // int32 num_keys = 7;
+  void clear_num_keys();
+  int32_t num_keys() const;
+  void set_num_keys(int32_t value);
+  private:
+  int32_t _internal_num_keys() const;
+  void _internal_set_num_keys(int32_t value);
+  public:
+
+  // int32 value_size = 8;
+  void clear_value_size();
+  int32_t value_size() const;
+  void set_value_size(int32_t value);
+  private:
+  int32_t _internal_value_size() const;
+  void _internal_set_value_size(int32_t value);
+  public:
+
+  // bool session_reads = 11;
+  void clear_session_reads();
+  bool session_reads() const;
+  void set_session_reads(bool value);
+  private:
+  bool _internal_session_reads() const;
+  void _internal_set_session_reads(bool value);
+  public:
+
+  // int64 seed = 10;
+  void clear_seed();
+  int64_t seed() const;
+  void set_seed(int64_t value);
+  private:
+  int64_t _internal_seed() const;
+  void _internal_set_seed(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ClusterBenchConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::ClusterEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr wal_dir_;
+    ::keyvaluestore::ServerConfig* replica_config_;
+    int32_t num_replicas_;
+    int32_t num_clients_;
+    double read_ratio_;
+    int32_t duration_s_;
+    int32_t num_keys_;
+    int32_t value_size_;
+    bool session_reads_;
+    int64_t seed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetRequest) */ {
+ public:
+  inline GetRequest() : GetRequest(nullptr) {}
+  ~GetRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetRequest(const GetRequest& from);
+  GetRequest(GetRequest&& from) noexcept
+    : GetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetRequest& operator=(const GetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetRequest& operator=(GetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetRequest* internal_default_instance() {
+    return reinterpret_cast<const GetRequest*>(
+               &_GetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(GetRequest& a, GetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetRequest& from) {
+    GetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetRequest";
+  }
+  protected:
+  explicit GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kMinVersionFieldNumber = 3,
+    kMinSlotFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  bool has_min_version() const;
+  private:
+  bool _internal_has_min_version() const;
+  public:
+  void clear_min_version();
+  const ::keyvaluestore::WriteToken& min_version() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WriteToken* release_min_version();
+  ::keyvaluestore::WriteToken* mutable_min_version();
+  void set_allocated_min_version(::keyvaluestore::WriteToken* min_version);
+  private:
+  const ::keyvaluestore::WriteToken& _internal_min_version() const;
+  ::keyvaluestore::WriteToken* _internal_mutable_min_version();
+  public:
+  void unsafe_arena_set_allocated_min_version(
+      ::keyvaluestore::WriteToken* min_version);
+  ::keyvaluestore::WriteToken* unsafe_arena_release_min_version();
+
+  // optional int32 min_slot = 2;
+  bool has_min_slot() const;
+  private:
+  bool _internal_has_min_slot() const;
+  public:
+  void clear_min_slot();
+  int32_t min_slot() const;
+  void set_min_slot(int32_t value);
+  private:
+  int32_t _internal_min_slot() const;
+  void _internal_set_min_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::keyvaluestore::WriteToken* min_version_;
+    int32_t min_slot_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetResponse) */ {
+ public:
+  inline GetResponse() : GetResponse(nullptr) {}
+  ~GetResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetResponse(const GetResponse& from);
+  GetResponse(GetResponse&& from) noexcept
+    : GetResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetResponse& operator=(const GetResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetResponse& operator=(GetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetResponse* internal_default_instance() {
+    return reinterpret_cast<const GetResponse*>(
+               &_GetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(GetResponse& a, GetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetResponse& from) {
+    GetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetResponse";
+  }
+  protected:
+  explicit GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // string value = 1;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.PutRequest) */ {
+ public:
+  inline PutRequest() : PutRequest(nullptr) {}
+  ~PutRequest() override;
+  explicit PROTOBUF_CONSTEXPR PutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutRequest(const PutRequest& from);
+  PutRequest(PutRequest&& from) noexcept
+    : PutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PutRequest& operator=(const PutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutRequest& operator=(PutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutRequest* internal_default_instance() {
+    return reinterpret_cast<const PutRequest*>(
+               &_PutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PutRequest& a, PutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutRequest& from) {
+    PutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.PutRequest";
+  }
+  protected:
+  explicit PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.PutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.DeleteRequest) */ {
+ public:
+  inline DeleteRequest() : DeleteRequest(nullptr) {}
+  ~DeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR DeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteRequest(const DeleteRequest& from);
+  DeleteRequest(DeleteRequest&& from) noexcept
+    : DeleteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteRequest& operator=(const DeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteRequest& operator=(DeleteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteRequest* internal_default_instance() {
+    return reinterpret_cast<const DeleteRequest*>(
+               &_DeleteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(DeleteRequest& a, DeleteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteRequest& from) {
+    DeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.DeleteRequest";
+  }
+  protected:
+  explicit DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.DeleteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.MultiGetRequest) */ {
+ public:
+  inline MultiGetRequest() : MultiGetRequest(nullptr) {}
+  ~MultiGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiGetRequest(const MultiGetRequest& from);
+  MultiGetRequest(MultiGetRequest&& from) noexcept
+    : MultiGetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiGetRequest& operator=(const MultiGetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiGetRequest& operator=(MultiGetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiGetRequest*>(
+               &_MultiGetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(MultiGetRequest& a, MultiGetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetRequest& from) {
+    MultiGetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.MultiGetRequest";
+  }
+  protected:
+  explicit MultiGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+    kMinVersionFieldNumber = 3,
+    kMinSlotFieldNumber = 2,
+  };
+  // repeated string keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // .keyvaluestore.WriteToken min_version = 3;
+  bool has_min_version() const;
+  private:
+  bool _internal_has_min_version() const;
+  public:
+  void clear_min_version();
+  const ::keyvaluestore::WriteToken& min_version() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WriteToken* release_min_version();
+  ::keyvaluestore::WriteToken* mutable_min_version();
+  void set_allocated_min_version(::keyvaluestore::WriteToken* min_version);
+  private:
+  const ::keyvaluestore::WriteToken& _internal_min_version() const;
+  ::keyvaluestore::WriteToken* _internal_mutable_min_version();
+  public:
+  void unsafe_arena_set_allocated_min_version(
+      ::keyvaluestore::WriteToken* min_version);
+  ::keyvaluestore::WriteToken* unsafe_arena_release_min_version();
+
+  // optional int32 min_slot = 2;
+  bool has_min_slot() const;
+  private:
+  bool _internal_has_min_slot() const;
+  public:
+  void clear_min_slot();
+  int32_t min_slot() const;
+  void set_min_slot(int32_t value);
+  private:
+  int32_t _internal_min_slot() const;
+  void _internal_set_min_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.MultiGetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::keyvaluestore::WriteToken* min_version_;
+    int32_t min_slot_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class KeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.KeyValue) */ {
+ public:
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeyValue(const KeyValue& from);
+  KeyValue(KeyValue&& from) noexcept
+    : KeyValue() {
+    *this = ::std::move(from);
+  }
+
+  inline KeyValue& operator=(const KeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline KeyValue& operator=(KeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeyValue* internal_default_instance() {
+    return reinterpret_cast<const KeyValue*>(
+               &_KeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(KeyValue& a, KeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeyValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.KeyValue";
+  }
+  protected:
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kFoundFieldNumber = 3,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bool found = 3;
+  void clear_found();
+  bool found() const;
+  void set_found(bool value);
+  private:
+  bool _internal_found() const;
+  void _internal_set_found(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.KeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    bool found_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiGetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.MultiGetResponse) */ {
+ public:
+  inline MultiGetResponse() : MultiGetResponse(nullptr) {}
+  ~MultiGetResponse() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiGetResponse(const MultiGetResponse& from);
+  MultiGetResponse(MultiGetResponse&& from) noexcept
+    : MultiGetResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiGetResponse& operator=(const MultiGetResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiGetResponse& operator=(MultiGetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiGetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiGetResponse* internal_default_instance() {
+    return reinterpret_cast<const MultiGetResponse*>(
+               &_MultiGetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(MultiGetResponse& a, MultiGetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiGetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiGetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiGetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiGetResponse& from) {
+    MultiGetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiGetResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.MultiGetResponse";
+  }
+  protected:
+  explicit MultiGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPairsFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.KeyValue pairs = 1;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::keyvaluestore::KeyValue* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::KeyValue >*
+      mutable_pairs();
+  private:
+  const ::keyvaluestore::KeyValue& _internal_pairs(int index) const;
+  ::keyvaluestore::KeyValue* _internal_add_pairs();
+  public:
+  const ::keyvaluestore::KeyValue& pairs(int index) const;
+  ::keyvaluestore::KeyValue* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::KeyValue >&
+      pairs() const;
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.MultiGetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::KeyValue > pairs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiPutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.MultiPutRequest) */ {
+ public:
+  inline MultiPutRequest() : MultiPutRequest(nullptr) {}
+  ~MultiPutRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiPutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiPutRequest(const MultiPutRequest& from);
+  MultiPutRequest(MultiPutRequest&& from) noexcept
+    : MultiPutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiPutRequest& operator=(const MultiPutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiPutRequest& operator=(MultiPutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiPutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiPutRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiPutRequest*>(
+               &_MultiPutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(MultiPutRequest& a, MultiPutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiPutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiPutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiPutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiPutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiPutRequest& from) {
+    MultiPutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiPutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.MultiPutRequest";
+  }
+  protected:
+  explicit MultiPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPairsFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.PutRequest pairs = 1;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::keyvaluestore::PutRequest* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::PutRequest >*
+      mutable_pairs();
+  private:
+  const ::keyvaluestore::PutRequest& _internal_pairs(int index) const;
+  ::keyvaluestore::PutRequest* _internal_add_pairs();
+  public:
+  const ::keyvaluestore::PutRequest& pairs(int index) const;
+  ::keyvaluestore::PutRequest* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::PutRequest >&
+      pairs() const;
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.MultiPutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::PutRequest > pairs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiDeleteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.MultiDeleteRequest) */ {
+ public:
+  inline MultiDeleteRequest() : MultiDeleteRequest(nullptr) {}
+  ~MultiDeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiDeleteRequest(const MultiDeleteRequest& from);
+  MultiDeleteRequest(MultiDeleteRequest&& from) noexcept
+    : MultiDeleteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiDeleteRequest& operator=(const MultiDeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiDeleteRequest& operator=(MultiDeleteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiDeleteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiDeleteRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiDeleteRequest*>(
+               &_MultiDeleteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(MultiDeleteRequest& a, MultiDeleteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiDeleteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiDeleteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiDeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiDeleteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiDeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiDeleteRequest& from) {
+    MultiDeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiDeleteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.MultiDeleteRequest";
+  }
+  protected:
+  explicit MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated string keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.MultiDeleteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WriteRequest) */ {
+ public:
+  inline WriteRequest() : WriteRequest(nullptr) {}
+  ~WriteRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteRequest(const WriteRequest& from);
+  WriteRequest(WriteRequest&& from) noexcept
+    : WriteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteRequest& operator=(const WriteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteRequest& operator=(WriteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteRequest*>(
+               &_WriteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(WriteRequest& a, WriteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteRequest& from) {
+    WriteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WriteRequest";
+  }
+  protected:
+  explicit WriteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.Operation operations = 2;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::keyvaluestore::Operation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_operations();
+  public:
+  const ::keyvaluestore::Operation& operations(int index) const;
+  ::keyvaluestore::Operation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      operations() const;
+
+  // int64 id = 1;
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WriteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > operations_;
+    int64_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WriteResponse) */ {
+ public:
+  inline WriteResponse() : WriteResponse(nullptr) {}
+  ~WriteResponse() override;
+  explicit PROTOBUF_CONSTEXPR WriteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteResponse(const WriteResponse& from);
+  WriteResponse(WriteResponse&& from) noexcept
+    : WriteResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteResponse& operator=(const WriteResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteResponse& operator=(WriteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteResponse* internal_default_instance() {
+    return reinterpret_cast<const WriteResponse*>(
+               &_WriteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(WriteResponse& a, WriteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteResponse& from) {
+    WriteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WriteResponse";
+  }
+  protected:
+  explicit WriteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorMessageFieldNumber = 3,
+    kTokenFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kCodeFieldNumber = 2,
+  };
+  // string error_message = 3;
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // .keyvaluestore.WriteToken token = 4;
+  bool has_token() const;
+  private:
+  bool _internal_has_token() const;
+  public:
+  void clear_token();
+  const ::keyvaluestore::WriteToken& token() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WriteToken* release_token();
+  ::keyvaluestore::WriteToken* mutable_token();
+  void set_allocated_token(::keyvaluestore::WriteToken* token);
+  private:
+  const ::keyvaluestore::WriteToken& _internal_token() const;
+  ::keyvaluestore::WriteToken* _internal_mutable_token();
+  public:
+  void unsafe_arena_set_allocated_token(
+      ::keyvaluestore::WriteToken* token);
+  ::keyvaluestore::WriteToken* unsafe_arena_release_token();
+
+  // int64 id = 1;
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // int32 code = 2;
+  void clear_code();
+  int32_t code() const;
+  void set_code(int32_t value);
+  private:
+  int32_t _internal_code() const;
+  void _internal_set_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WriteResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::keyvaluestore::WriteToken* token_;
+    int64_t id_;
+    int32_t code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WriteBatchRequest) */ {
+ public:
+  inline WriteBatchRequest() : WriteBatchRequest(nullptr) {}
+  ~WriteBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteBatchRequest(const WriteBatchRequest& from);
+  WriteBatchRequest(WriteBatchRequest&& from) noexcept
+    : WriteBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteBatchRequest& operator=(const WriteBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteBatchRequest& operator=(WriteBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteBatchRequest*>(
+               &_WriteBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(WriteBatchRequest& a, WriteBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteBatchRequest& from) {
+    WriteBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WriteBatchRequest";
+  }
+  protected:
+  explicit WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.Operation operations = 1;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::keyvaluestore::Operation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_operations();
+  public:
+  const ::keyvaluestore::Operation& operations(int index) const;
+  ::keyvaluestore::Operation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      operations() const;
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WriteBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > operations_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.CommitResponse) */ {
+ public:
+  inline CommitResponse() : CommitResponse(nullptr) {}
+  ~CommitResponse() override;
+  explicit PROTOBUF_CONSTEXPR CommitResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitResponse(const CommitResponse& from);
+  CommitResponse(CommitResponse&& from) noexcept
+    : CommitResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitResponse& operator=(const CommitResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitResponse& operator=(CommitResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitResponse* internal_default_instance() {
+    return reinterpret_cast<const CommitResponse*>(
+               &_CommitResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CommitResponse& a, CommitResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitResponse& from) {
+    CommitResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.CommitResponse";
+  }
+  protected:
+  explicit CommitResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotFieldNumber = 1,
+  };
+  // int32 slot = 1;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.CommitResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteToken_SlotsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<WriteToken_SlotsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<WriteToken_SlotsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
+  WriteToken_SlotsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR WriteToken_SlotsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit WriteToken_SlotsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const WriteToken_SlotsEntry_DoNotUse& other);
+  static const WriteToken_SlotsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const WriteToken_SlotsEntry_DoNotUse*>(&_WriteToken_SlotsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class WriteToken final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WriteToken) */ {
+ public:
+  inline WriteToken() : WriteToken(nullptr) {}
+  ~WriteToken() override;
+  explicit PROTOBUF_CONSTEXPR WriteToken(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteToken(const WriteToken& from);
+  WriteToken(WriteToken&& from) noexcept
+    : WriteToken() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteToken& operator=(const WriteToken& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteToken& operator=(WriteToken&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteToken& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteToken* internal_default_instance() {
+    return reinterpret_cast<const WriteToken*>(
+               &_WriteToken_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(WriteToken& a, WriteToken& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteToken* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteToken* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteToken* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteToken>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteToken& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteToken& from) {
+    WriteToken::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteToken* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WriteToken";
+  }
+  protected:
+  explicit WriteToken(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 1,
+  };
+  // map<int32, int32> slots = 1;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      _internal_slots() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      _internal_mutable_slots();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      slots() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      mutable_slots();
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WriteToken)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        WriteToken_SlotsEntry_DoNotUse,
+        int32_t, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> slots_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ElectCoordinatorRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ElectCoordinatorRequest) */ {
+ public:
+  inline ElectCoordinatorRequest() : ElectCoordinatorRequest(nullptr) {}
+  ~ElectCoordinatorRequest() override;
+  explicit PROTOBUF_CONSTEXPR ElectCoordinatorRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ElectCoordinatorRequest(const ElectCoordinatorRequest& from);
+  ElectCoordinatorRequest(ElectCoordinatorRequest&& from) noexcept
+    : ElectCoordinatorRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ElectCoordinatorRequest& operator=(const ElectCoordinatorRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ElectCoordinatorRequest& operator=(ElectCoordinatorRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ElectCoordinatorRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ElectCoordinatorRequest* internal_default_instance() {
+    return reinterpret_cast<const ElectCoordinatorRequest*>(
+               &_ElectCoordinatorRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ElectCoordinatorRequest& a, ElectCoordinatorRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ElectCoordinatorRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ElectCoordinatorRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ElectCoordinatorRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ElectCoordinatorRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ElectCoordinatorRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ElectCoordinatorRequest& from) {
+    ElectCoordinatorRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ElectCoordinatorRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ElectCoordinatorRequest";
+  }
+  protected:
+  explicit ElectCoordinatorRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kCoordinatorFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string coordinator = 2;
+  void clear_coordinator();
+  const std::string& coordinator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_coordinator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_coordinator();
+  PROTOBUF_NODISCARD std::string* release_coordinator();
+  void set_allocated_coordinator(std::string* coordinator);
+  private:
+  const std::string& _internal_coordinator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_coordinator(const std::string& value);
+  std::string* _internal_mutable_coordinator();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ElectCoordinatorRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr coordinator_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetCoordinatorResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetCoordinatorResponse) */ {
+ public:
+  inline GetCoordinatorResponse() : GetCoordinatorResponse(nullptr) {}
+  ~GetCoordinatorResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetCoordinatorResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetCoordinatorResponse(const GetCoordinatorResponse& from);
+  GetCoordinatorResponse(GetCoordinatorResponse&& from) noexcept
+    : GetCoordinatorResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetCoordinatorResponse& operator=(const GetCoordinatorResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetCoordinatorResponse& operator=(GetCoordinatorResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetCoordinatorResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetCoordinatorResponse* internal_default_instance() {
+    return reinterpret_cast<const GetCoordinatorResponse*>(
+               &_GetCoordinatorResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(GetCoordinatorResponse& a, GetCoordinatorResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetCoordinatorResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetCoordinatorResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetCoordinatorResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetCoordinatorResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetCoordinatorResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetCoordinatorResponse& from) {
+    GetCoordinatorResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetCoordinatorResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetCoordinatorResponse";
+  }
+  protected:
+  explicit GetCoordinatorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCoordinatorFieldNumber = 1,
+    kTermFieldNumber = 2,
+  };
+  // string coordinator = 1;
+  void clear_coordinator();
+  const std::string& coordinator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_coordinator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_coordinator();
+  PROTOBUF_NODISCARD std::string* release_coordinator();
+  void set_allocated_coordinator(std::string* coordinator);
+  private:
+  const std::string& _internal_coordinator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_coordinator(const std::string& value);
+  std::string* _internal_mutable_coordinator();
+  public:
+
+  // int32 term = 2;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetCoordinatorResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr coordinator_;
+    int32_t term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetLeaderResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetLeaderResponse) */ {
+ public:
+  inline GetLeaderResponse() : GetLeaderResponse(nullptr) {}
+  ~GetLeaderResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetLeaderResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetLeaderResponse(const GetLeaderResponse& from);
+  GetLeaderResponse(GetLeaderResponse&& from) noexcept
+    : GetLeaderResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetLeaderResponse& operator=(const GetLeaderResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetLeaderResponse& operator=(GetLeaderResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetLeaderResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetLeaderResponse* internal_default_instance() {
+    return reinterpret_cast<const GetLeaderResponse*>(
+               &_GetLeaderResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(GetLeaderResponse& a, GetLeaderResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetLeaderResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetLeaderResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetLeaderResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetLeaderResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetLeaderResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetLeaderResponse& from) {
+    GetLeaderResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetLeaderResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetLeaderResponse";
+  }
+  protected:
+  explicit GetLeaderResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupsFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.GetCoordinatorResponse groups = 1;
+  int groups_size() const;
+  private:
+  int _internal_groups_size() const;
+  public:
+  void clear_groups();
+  ::keyvaluestore::GetCoordinatorResponse* mutable_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::GetCoordinatorResponse >*
+      mutable_groups();
+  private:
+  const ::keyvaluestore::GetCoordinatorResponse& _internal_groups(int index) const;
+  ::keyvaluestore::GetCoordinatorResponse* _internal_add_groups();
+  public:
+  const ::keyvaluestore::GetCoordinatorResponse& groups(int index) const;
+  ::keyvaluestore::GetCoordinatorResponse* add_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::GetCoordinatorResponse >&
+      groups() const;
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetLeaderResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::GetCoordinatorResponse > groups_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadIndexRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:keyvaluestore.ReadIndexRequest) */ {
+ public:
+  inline ReadIndexRequest() : ReadIndexRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ReadIndexRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadIndexRequest(const ReadIndexRequest& from);
+  ReadIndexRequest(ReadIndexRequest&& from) noexcept
+    : ReadIndexRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadIndexRequest& operator=(const ReadIndexRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexRequest& operator=(ReadIndexRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexRequest*>(
+               &_ReadIndexRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(ReadIndexRequest& a, ReadIndexRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadIndexRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ReadIndexRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ReadIndexRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ReadIndexRequest";
+  }
+  protected:
+  explicit ReadIndexRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ReadIndexRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadIndexResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ReadIndexResponse) */ {
+ public:
+  inline ReadIndexResponse() : ReadIndexResponse(nullptr) {}
+  ~ReadIndexResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadIndexResponse(const ReadIndexResponse& from);
+  ReadIndexResponse(ReadIndexResponse&& from) noexcept
+    : ReadIndexResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadIndexResponse& operator=(const ReadIndexResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexResponse& operator=(ReadIndexResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexResponse*>(
+               &_ReadIndexResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(ReadIndexResponse& a, ReadIndexResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadIndexResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadIndexResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadIndexResponse& from) {
+    ReadIndexResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadIndexResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ReadIndexResponse";
+  }
+  protected:
+  explicit ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotFieldNumber = 1,
+  };
+  // int32 slot = 1;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ReadIndexResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Operation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.Operation) */ {
+ public:
+  inline Operation() : Operation(nullptr) {}
+  ~Operation() override;
+  explicit PROTOBUF_CONSTEXPR Operation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Operation(const Operation& from);
+  Operation(Operation&& from) noexcept
+    : Operation() {
+    *this = ::std::move(from);
+  }
+
+  inline Operation& operator=(const Operation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Operation& operator=(Operation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Operation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Operation* internal_default_instance() {
+    return reinterpret_cast<const Operation*>(
+               &_Operation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(Operation& a, Operation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Operation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Operation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Operation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Operation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Operation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Operation& from) {
+    Operation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Operation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.Operation";
+  }
+  protected:
+  explicit Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 3,
+    kTypeFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .keyvaluestore.OperationType type = 2;
+  void clear_type();
+  ::keyvaluestore::OperationType type() const;
+  void set_type(::keyvaluestore::OperationType value);
+  private:
+  ::keyvaluestore::OperationType _internal_type() const;
+  void _internal_set_type(::keyvaluestore::OperationType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.Operation)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrepareRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.PrepareRequest) */ {
+ public:
+  inline PrepareRequest() : PrepareRequest(nullptr) {}
+  ~PrepareRequest() override;
+  explicit PROTOBUF_CONSTEXPR PrepareRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrepareRequest(const PrepareRequest& from);
+  PrepareRequest(PrepareRequest&& from) noexcept
+    : PrepareRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PrepareRequest& operator=(const PrepareRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrepareRequest& operator=(PrepareRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrepareRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrepareRequest* internal_default_instance() {
+    return reinterpret_cast<const PrepareRequest*>(
+               &_PrepareRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(PrepareRequest& a, PrepareRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrepareRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrepareRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrepareRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrepareRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrepareRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrepareRequest& from) {
+    PrepareRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrepareRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.PrepareRequest";
+  }
+  protected:
+  explicit PrepareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kRoundFieldNumber = 2,
+    kProposeIdFieldNumber = 3,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int32 round = 2;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // int32 propose_id = 3;
+  void clear_propose_id();
+  int32_t propose_id() const;
+  void set_propose_id(int32_t value);
+  private:
+  int32_t _internal_propose_id() const;
+  void _internal_set_propose_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.PrepareRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int32_t round_;
+    int32_t propose_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PromiseResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.PromiseResponse) */ {
+ public:
+  inline PromiseResponse() : PromiseResponse(nullptr) {}
+  ~PromiseResponse() override;
+  explicit PROTOBUF_CONSTEXPR PromiseResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PromiseResponse(const PromiseResponse& from);
+  PromiseResponse(PromiseResponse&& from) noexcept
+    : PromiseResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PromiseResponse& operator=(const PromiseResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PromiseResponse& operator=(PromiseResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PromiseResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PromiseResponse* internal_default_instance() {
+    return reinterpret_cast<const PromiseResponse*>(
+               &_PromiseResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(PromiseResponse& a, PromiseResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PromiseResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PromiseResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PromiseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PromiseResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PromiseResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PromiseResponse& from) {
+    PromiseResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PromiseResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.PromiseResponse";
+  }
+  protected:
+  explicit PromiseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 5,
+    kRoundFieldNumber = 1,
+    kProposeIdFieldNumber = 2,
+    kAcceptedIdFieldNumber = 3,
+    kTypeFieldNumber = 4,
+  };
+  // string value = 5;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 round = 1;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // int32 propose_id = 2;
+  void clear_propose_id();
+  int32_t propose_id() const;
+  void set_propose_id(int32_t value);
+  private:
+  int32_t _internal_propose_id() const;
+  void _internal_set_propose_id(int32_t value);
+  public:
+
+  // int32 accepted_id = 3;
+  void clear_accepted_id();
+  int32_t accepted_id() const;
+  void set_accepted_id(int32_t value);
+  private:
+  int32_t _internal_accepted_id() const;
+  void _internal_set_accepted_id(int32_t value);
+  public:
+
+  // .keyvaluestore.OperationType type = 4;
+  void clear_type();
+  ::keyvaluestore::OperationType type() const;
+  void set_type(::keyvaluestore::OperationType value);
+  private:
+  ::keyvaluestore::OperationType _internal_type() const;
+  void _internal_set_type(::keyvaluestore::OperationType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.PromiseResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t round_;
+    int32_t propose_id_;
+    int32_t accepted_id_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProposeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.ProposeRequest) */ {
+ public:
+  inline ProposeRequest() : ProposeRequest(nullptr) {}
+  ~ProposeRequest() override;
+  explicit PROTOBUF_CONSTEXPR ProposeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProposeRequest(const ProposeRequest& from);
+  ProposeRequest(ProposeRequest&& from) noexcept
+    : ProposeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ProposeRequest& operator=(const ProposeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProposeRequest& operator=(ProposeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProposeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProposeRequest* internal_default_instance() {
+    return reinterpret_cast<const ProposeRequest*>(
+               &_ProposeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(ProposeRequest& a, ProposeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProposeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProposeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProposeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProposeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProposeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProposeRequest& from) {
+    ProposeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProposeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.ProposeRequest";
+  }
+  protected:
+  explicit ProposeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 6,
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 5,
+    kRoundFieldNumber = 2,
+    kProposeIdFieldNumber = 3,
+    kTypeFieldNumber = 4,
+  };
+  // repeated .keyvaluestore.Operation operations = 6;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::keyvaluestore::Operation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_operations();
+  public:
+  const ::keyvaluestore::Operation& operations(int index) const;
+  ::keyvaluestore::Operation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      operations() const;
+
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 5;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 round = 2;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // int32 propose_id = 3;
+  void clear_propose_id();
+  int32_t propose_id() const;
+  void set_propose_id(int32_t value);
+  private:
+  int32_t _internal_propose_id() const;
+  void _internal_set_propose_id(int32_t value);
+  public:
+
+  // .keyvaluestore.OperationType type = 4;
+  void clear_type();
+  ::keyvaluestore::OperationType type() const;
+  void set_type(::keyvaluestore::OperationType value);
+  private:
+  ::keyvaluestore::OperationType _internal_type() const;
+  void _internal_set_type(::keyvaluestore::OperationType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.ProposeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > operations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t round_;
+    int32_t propose_id_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AcceptResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.AcceptResponse) */ {
+ public:
+  inline AcceptResponse() : AcceptResponse(nullptr) {}
+  ~AcceptResponse() override;
+  explicit PROTOBUF_CONSTEXPR AcceptResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AcceptResponse(const AcceptResponse& from);
+  AcceptResponse(AcceptResponse&& from) noexcept
+    : AcceptResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AcceptResponse& operator=(const AcceptResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AcceptResponse& operator=(AcceptResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AcceptResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AcceptResponse* internal_default_instance() {
+    return reinterpret_cast<const AcceptResponse*>(
+               &_AcceptResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(AcceptResponse& a, AcceptResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AcceptResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AcceptResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AcceptResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AcceptResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AcceptResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AcceptResponse& from) {
+    AcceptResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AcceptResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.AcceptResponse";
+  }
+  protected:
+  explicit AcceptResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 5,
+    kValueFieldNumber = 4,
+    kRoundFieldNumber = 1,
+    kProposeIdFieldNumber = 2,
+    kTypeFieldNumber = 3,
+  };
+  // repeated .keyvaluestore.Operation operations = 5;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::keyvaluestore::Operation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_operations();
+  public:
+  const ::keyvaluestore::Operation& operations(int index) const;
+  ::keyvaluestore::Operation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      operations() const;
+
+  // string value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // int32 round = 1;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // int32 propose_id = 2;
+  void clear_propose_id();
+  int32_t propose_id() const;
+  void set_propose_id(int32_t value);
+  private:
+  int32_t _internal_propose_id() const;
+  void _internal_set_propose_id(int32_t value);
+  public:
+
+  // .keyvaluestore.OperationType type = 3;
+  void clear_type();
+  ::keyvaluestore::OperationType type() const;
+  void set_type(::keyvaluestore::OperationType value);
+  private:
+  ::keyvaluestore::OperationType _internal_type() const;
+  void _internal_set_type(::keyvaluestore::OperationType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.AcceptResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > operations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t round_;
+    int32_t propose_id_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InformRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.InformRequest) */ {
+ public:
+  inline InformRequest() : InformRequest(nullptr) {}
+  ~InformRequest() override;
+  explicit PROTOBUF_CONSTEXPR InformRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InformRequest(const InformRequest& from);
+  InformRequest(InformRequest&& from) noexcept
+    : InformRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline InformRequest& operator=(const InformRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InformRequest& operator=(InformRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InformRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InformRequest* internal_default_instance() {
+    return reinterpret_cast<const InformRequest*>(
+               &_InformRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(InformRequest& a, InformRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InformRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InformRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InformRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InformRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InformRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InformRequest& from) {
+    InformRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InformRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.InformRequest";
+  }
+  protected:
+  explicit InformRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kAcceptanceFieldNumber = 2,
+    kCompactableSlotFieldNumber = 3,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // .keyvaluestore.AcceptResponse acceptance = 2;
+  bool has_acceptance() const;
+  private:
+  bool _internal_has_acceptance() const;
+  public:
+  void clear_acceptance();
+  const ::keyvaluestore::AcceptResponse& acceptance() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::AcceptResponse* release_acceptance();
+  ::keyvaluestore::AcceptResponse* mutable_acceptance();
+  void set_allocated_acceptance(::keyvaluestore::AcceptResponse* acceptance);
+  private:
+  const ::keyvaluestore::AcceptResponse& _internal_acceptance() const;
+  ::keyvaluestore::AcceptResponse* _internal_mutable_acceptance();
+  public:
+  void unsafe_arena_set_allocated_acceptance(
+      ::keyvaluestore::AcceptResponse* acceptance);
+  ::keyvaluestore::AcceptResponse* unsafe_arena_release_acceptance();
+
+  // int32 compactable_slot = 3;
+  void clear_compactable_slot();
+  int32_t compactable_slot() const;
+  void set_compactable_slot(int32_t value);
+  private:
+  int32_t _internal_compactable_slot() const;
+  void _internal_set_compactable_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.InformRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::keyvaluestore::AcceptResponse* acceptance_;
+    int32_t compactable_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InformResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.InformResponse) */ {
+ public:
+  inline InformResponse() : InformResponse(nullptr) {}
+  ~InformResponse() override;
+  explicit PROTOBUF_CONSTEXPR InformResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InformResponse(const InformResponse& from);
+  InformResponse(InformResponse&& from) noexcept
+    : InformResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InformResponse& operator=(const InformResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InformResponse& operator=(InformResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InformResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InformResponse* internal_default_instance() {
+    return reinterpret_cast<const InformResponse*>(
+               &_InformResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(InformResponse& a, InformResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InformResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InformResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InformResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InformResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InformResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InformResponse& from) {
+    InformResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InformResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.InformResponse";
+  }
+  protected:
+  explicit InformResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedSlotFieldNumber = 1,
+  };
+  // int32 applied_slot = 1;
+  void clear_applied_slot();
+  int32_t applied_slot() const;
+  void set_applied_slot(int32_t value);
+  private:
+  int32_t _internal_applied_slot() const;
+  void _internal_set_applied_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.InformResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t applied_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PaxosLog final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.PaxosLog) */ {
+ public:
+  inline PaxosLog() : PaxosLog(nullptr) {}
+  ~PaxosLog() override;
+  explicit PROTOBUF_CONSTEXPR PaxosLog(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PaxosLog(const PaxosLog& from);
+  PaxosLog(PaxosLog&& from) noexcept
+    : PaxosLog() {
+    *this = ::std::move(from);
+  }
+
+  inline PaxosLog& operator=(const PaxosLog& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PaxosLog& operator=(PaxosLog&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PaxosLog& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PaxosLog* internal_default_instance() {
+    return reinterpret_cast<const PaxosLog*>(
+               &_PaxosLog_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(PaxosLog& a, PaxosLog& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PaxosLog* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PaxosLog* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PaxosLog* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PaxosLog>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PaxosLog& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PaxosLog& from) {
+    PaxosLog::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PaxosLog* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.PaxosLog";
+  }
+  protected:
+  explicit PaxosLog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAcceptedOperationsFieldNumber = 6,
+    kAcceptedValueFieldNumber = 4,
+    kPromisedIdFieldNumber = 1,
+    kAcceptedIdFieldNumber = 2,
+    kAcceptedTypeFieldNumber = 3,
+    kChosenFieldNumber = 5,
+  };
+  // repeated .keyvaluestore.Operation accepted_operations = 6;
+  int accepted_operations_size() const;
+  private:
+  int _internal_accepted_operations_size() const;
+  public:
+  void clear_accepted_operations();
+  ::keyvaluestore::Operation* mutable_accepted_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_accepted_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_accepted_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_accepted_operations();
+  public:
+  const ::keyvaluestore::Operation& accepted_operations(int index) const;
+  ::keyvaluestore::Operation* add_accepted_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      accepted_operations() const;
+
+  // string accepted_value = 4;
+  void clear_accepted_value();
+  const std::string& accepted_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_accepted_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_accepted_value();
+  PROTOBUF_NODISCARD std::string* release_accepted_value();
+  void set_allocated_accepted_value(std::string* accepted_value);
+  private:
+  const std::string& _internal_accepted_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_accepted_value(const std::string& value);
+  std::string* _internal_mutable_accepted_value();
+  public:
+
+  // int32 promised_id = 1;
+  void clear_promised_id();
+  int32_t promised_id() const;
+  void set_promised_id(int32_t value);
+  private:
+  int32_t _internal_promised_id() const;
+  void _internal_set_promised_id(int32_t value);
+  public:
+
+  // int32 accepted_id = 2;
+  void clear_accepted_id();
+  int32_t accepted_id() const;
+  void set_accepted_id(int32_t value);
+  private:
+  int32_t _internal_accepted_id() const;
+  void _internal_set_accepted_id(int32_t value);
+  public:
+
+  // .keyvaluestore.OperationType accepted_type = 3;
+  void clear_accepted_type();
+  ::keyvaluestore::OperationType accepted_type() const;
+  void set_accepted_type(::keyvaluestore::OperationType value);
+  private:
+  ::keyvaluestore::OperationType _internal_accepted_type() const;
+  void _internal_set_accepted_type(::keyvaluestore::OperationType value);
+  public:
+
+  // bool chosen = 5;
+  void clear_chosen();
+  bool chosen() const;
+  void set_chosen(bool value);
+  private:
+  bool _internal_chosen() const;
+  void _internal_set_chosen(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.PaxosLog)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > accepted_operations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr accepted_value_;
+    int32_t promised_id_;
+    int32_t accepted_id_;
+    int accepted_type_;
+    bool chosen_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LeaderPrepareRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.LeaderPrepareRequest) */ {
+ public:
+  inline LeaderPrepareRequest() : LeaderPrepareRequest(nullptr) {}
+  ~LeaderPrepareRequest() override;
+  explicit PROTOBUF_CONSTEXPR LeaderPrepareRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LeaderPrepareRequest(const LeaderPrepareRequest& from);
+  LeaderPrepareRequest(LeaderPrepareRequest&& from) noexcept
+    : LeaderPrepareRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LeaderPrepareRequest& operator=(const LeaderPrepareRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LeaderPrepareRequest& operator=(LeaderPrepareRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LeaderPrepareRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LeaderPrepareRequest* internal_default_instance() {
+    return reinterpret_cast<const LeaderPrepareRequest*>(
+               &_LeaderPrepareRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(LeaderPrepareRequest& a, LeaderPrepareRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LeaderPrepareRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LeaderPrepareRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LeaderPrepareRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LeaderPrepareRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LeaderPrepareRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LeaderPrepareRequest& from) {
+    LeaderPrepareRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LeaderPrepareRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.LeaderPrepareRequest";
+  }
+  protected:
+  explicit LeaderPrepareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBallotFieldNumber = 1,
+    kFromSlotFieldNumber = 2,
+  };
+  // int32 ballot = 1;
+  void clear_ballot();
+  int32_t ballot() const;
+  void set_ballot(int32_t value);
+  private:
+  int32_t _internal_ballot() const;
+  void _internal_set_ballot(int32_t value);
+  public:
+
+  // int32 from_slot = 2;
+  void clear_from_slot();
+  int32_t from_slot() const;
+  void set_from_slot(int32_t value);
+  private:
+  int32_t _internal_from_slot() const;
+  void _internal_set_from_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.LeaderPrepareRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t ballot_;
+    int32_t from_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LeaderPromiseResponse_Accepted final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.LeaderPromiseResponse.Accepted) */ {
+ public:
+  inline LeaderPromiseResponse_Accepted() : LeaderPromiseResponse_Accepted(nullptr) {}
+  ~LeaderPromiseResponse_Accepted() override;
+  explicit PROTOBUF_CONSTEXPR LeaderPromiseResponse_Accepted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LeaderPromiseResponse_Accepted(const LeaderPromiseResponse_Accepted& from);
+  LeaderPromiseResponse_Accepted(LeaderPromiseResponse_Accepted&& from) noexcept
+    : LeaderPromiseResponse_Accepted() {
+    *this = ::std::move(from);
+  }
+
+  inline LeaderPromiseResponse_Accepted& operator=(const LeaderPromiseResponse_Accepted& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LeaderPromiseResponse_Accepted& operator=(LeaderPromiseResponse_Accepted&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LeaderPromiseResponse_Accepted& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LeaderPromiseResponse_Accepted* internal_default_instance() {
+    return reinterpret_cast<const LeaderPromiseResponse_Accepted*>(
+               &_LeaderPromiseResponse_Accepted_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(LeaderPromiseResponse_Accepted& a, LeaderPromiseResponse_Accepted& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LeaderPromiseResponse_Accepted* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LeaderPromiseResponse_Accepted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LeaderPromiseResponse_Accepted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LeaderPromiseResponse_Accepted>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LeaderPromiseResponse_Accepted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LeaderPromiseResponse_Accepted& from) {
+    LeaderPromiseResponse_Accepted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LeaderPromiseResponse_Accepted* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.LeaderPromiseResponse.Accepted";
+  }
+  protected:
+  explicit LeaderPromiseResponse_Accepted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogFieldNumber = 2,
+    kSlotFieldNumber = 1,
+  };
+  // .keyvaluestore.PaxosLog log = 2;
+  bool has_log() const;
+  private:
+  bool _internal_has_log() const;
+  public:
+  void clear_log();
+  const ::keyvaluestore::PaxosLog& log() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::PaxosLog* release_log();
+  ::keyvaluestore::PaxosLog* mutable_log();
+  void set_allocated_log(::keyvaluestore::PaxosLog* log);
+  private:
+  const ::keyvaluestore::PaxosLog& _internal_log() const;
+  ::keyvaluestore::PaxosLog* _internal_mutable_log();
+  public:
+  void unsafe_arena_set_allocated_log(
+      ::keyvaluestore::PaxosLog* log);
+  ::keyvaluestore::PaxosLog* unsafe_arena_release_log();
+
+  // int32 slot = 1;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.LeaderPromiseResponse.Accepted)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::keyvaluestore::PaxosLog* log_;
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LeaderPromiseResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.LeaderPromiseResponse) */ {
+ public:
+  inline LeaderPromiseResponse() : LeaderPromiseResponse(nullptr) {}
+  ~LeaderPromiseResponse() override;
+  explicit PROTOBUF_CONSTEXPR LeaderPromiseResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LeaderPromiseResponse(const LeaderPromiseResponse& from);
+  LeaderPromiseResponse(LeaderPromiseResponse&& from) noexcept
+    : LeaderPromiseResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LeaderPromiseResponse& operator=(const LeaderPromiseResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LeaderPromiseResponse& operator=(LeaderPromiseResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LeaderPromiseResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LeaderPromiseResponse* internal_default_instance() {
+    return reinterpret_cast<const LeaderPromiseResponse*>(
+               &_LeaderPromiseResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(LeaderPromiseResponse& a, LeaderPromiseResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LeaderPromiseResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LeaderPromiseResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LeaderPromiseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LeaderPromiseResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LeaderPromiseResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LeaderPromiseResponse& from) {
+    LeaderPromiseResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LeaderPromiseResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.LeaderPromiseResponse";
+  }
+  protected:
+  explicit LeaderPromiseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LeaderPromiseResponse_Accepted Accepted;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAcceptedFieldNumber = 2,
+    kBallotFieldNumber = 1,
+    kCompactedSlotFieldNumber = 3,
+  };
+  // repeated .keyvaluestore.LeaderPromiseResponse.Accepted accepted = 2;
+  int accepted_size() const;
+  private:
+  int _internal_accepted_size() const;
+  public:
+  void clear_accepted();
+  ::keyvaluestore::LeaderPromiseResponse_Accepted* mutable_accepted(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::LeaderPromiseResponse_Accepted >*
+      mutable_accepted();
+  private:
+  const ::keyvaluestore::LeaderPromiseResponse_Accepted& _internal_accepted(int index) const;
+  ::keyvaluestore::LeaderPromiseResponse_Accepted* _internal_add_accepted();
+  public:
+  const ::keyvaluestore::LeaderPromiseResponse_Accepted& accepted(int index) const;
+  ::keyvaluestore::LeaderPromiseResponse_Accepted* add_accepted();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::LeaderPromiseResponse_Accepted >&
+      accepted() const;
+
+  // int32 ballot = 1;
+  void clear_ballot();
+  int32_t ballot() const;
+  void set_ballot(int32_t value);
+  private:
+  int32_t _internal_ballot() const;
+  void _internal_set_ballot(int32_t value);
+  public:
+
+  // int32 compacted_slot = 3;
+  void clear_compacted_slot();
+  int32_t compacted_slot() const;
+  void set_compacted_slot(int32_t value);
+  private:
+  int32_t _internal_compacted_slot() const;
+  void _internal_set_compacted_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.LeaderPromiseResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::LeaderPromiseResponse_Accepted > accepted_;
+    int32_t ballot_;
+    int32_t compacted_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChosenRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetChosenRequest) */ {
+ public:
+  inline GetChosenRequest() : GetChosenRequest(nullptr) {}
+  ~GetChosenRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetChosenRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetChosenRequest(const GetChosenRequest& from);
+  GetChosenRequest(GetChosenRequest&& from) noexcept
+    : GetChosenRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetChosenRequest& operator=(const GetChosenRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChosenRequest& operator=(GetChosenRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChosenRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetChosenRequest* internal_default_instance() {
+    return reinterpret_cast<const GetChosenRequest*>(
+               &_GetChosenRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(GetChosenRequest& a, GetChosenRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetChosenRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChosenRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetChosenRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetChosenRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetChosenRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetChosenRequest& from) {
+    GetChosenRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetChosenRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetChosenRequest";
+  }
+  protected:
+  explicit GetChosenRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromSlotFieldNumber = 1,
+    kToSlotFieldNumber = 2,
+  };
+  // int32 from_slot = 1;
+  void clear_from_slot();
+  int32_t from_slot() const;
+  void set_from_slot(int32_t value);
+  private:
+  int32_t _internal_from_slot() const;
+  void _internal_set_from_slot(int32_t value);
+  public:
+
+  // int32 to_slot = 2;
+  void clear_to_slot();
+  int32_t to_slot() const;
+  void set_to_slot(int32_t value);
+  private:
+  int32_t _internal_to_slot() const;
+  void _internal_set_to_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetChosenRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t from_slot_;
+    int32_t to_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChosenResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.GetChosenResponse) */ {
+ public:
+  inline GetChosenResponse() : GetChosenResponse(nullptr) {}
+  ~GetChosenResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetChosenResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetChosenResponse(const GetChosenResponse& from);
+  GetChosenResponse(GetChosenResponse&& from) noexcept
+    : GetChosenResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetChosenResponse& operator=(const GetChosenResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChosenResponse& operator=(GetChosenResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChosenResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetChosenResponse* internal_default_instance() {
+    return reinterpret_cast<const GetChosenResponse*>(
+               &_GetChosenResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(GetChosenResponse& a, GetChosenResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetChosenResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChosenResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetChosenResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetChosenResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetChosenResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetChosenResponse& from) {
+    GetChosenResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetChosenResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.GetChosenResponse";
+  }
+  protected:
+  explicit GetChosenResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotsFieldNumber = 1,
+    kCompactedSlotFieldNumber = 2,
+  };
+  // repeated .keyvaluestore.AcceptResponse slots = 1;
+  int slots_size() const;
+  private:
+  int _internal_slots_size() const;
+  public:
+  void clear_slots();
+  ::keyvaluestore::AcceptResponse* mutable_slots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::AcceptResponse >*
+      mutable_slots();
+  private:
+  const ::keyvaluestore::AcceptResponse& _internal_slots(int index) const;
+  ::keyvaluestore::AcceptResponse* _internal_add_slots();
+  public:
+  const ::keyvaluestore::AcceptResponse& slots(int index) const;
+  ::keyvaluestore::AcceptResponse* add_slots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::AcceptResponse >&
+      slots() const;
+
+  // int32 compacted_slot = 2;
+  void clear_compacted_slot();
+  int32_t compacted_slot() const;
+  void set_compacted_slot(int32_t value);
+  private:
+  int32_t _internal_compacted_slot() const;
+  void _internal_set_compacted_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.GetChosenResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::AcceptResponse > slots_;
+    int32_t compacted_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecoverRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.RecoverRequest) */ {
+ public:
+  inline RecoverRequest() : RecoverRequest(nullptr) {}
+  ~RecoverRequest() override;
+  explicit PROTOBUF_CONSTEXPR RecoverRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoverRequest(const RecoverRequest& from);
+  RecoverRequest(RecoverRequest&& from) noexcept
+    : RecoverRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoverRequest& operator=(const RecoverRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoverRequest& operator=(RecoverRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoverRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoverRequest* internal_default_instance() {
+    return reinterpret_cast<const RecoverRequest*>(
+               &_RecoverRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(RecoverRequest& a, RecoverRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoverRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoverRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoverRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoverRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoverRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoverRequest& from) {
+    RecoverRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoverRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.RecoverRequest";
+  }
+  protected:
+  explicit RecoverRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedSlotFieldNumber = 1,
+  };
+  // int32 applied_slot = 1;
+  void clear_applied_slot();
+  int32_t applied_slot() const;
+  void set_applied_slot(int32_t value);
+  private:
+  int32_t _internal_applied_slot() const;
+  void _internal_set_applied_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.RecoverRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t applied_slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecoverChunk_PaxosLogs_LogsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, 
+    int32_t, ::keyvaluestore::PaxosLog,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_PaxosLogs_LogsEntry_DoNotUse, 
+    int32_t, ::keyvaluestore::PaxosLog,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  RecoverChunk_PaxosLogs_LogsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogs_LogsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit RecoverChunk_PaxosLogs_LogsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const RecoverChunk_PaxosLogs_LogsEntry_DoNotUse& other);
+  static const RecoverChunk_PaxosLogs_LogsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RecoverChunk_PaxosLogs_LogsEntry_DoNotUse*>(&_RecoverChunk_PaxosLogs_LogsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class RecoverChunk_PaxosLogs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.RecoverChunk.PaxosLogs) */ {
+ public:
+  inline RecoverChunk_PaxosLogs() : RecoverChunk_PaxosLogs(nullptr) {}
+  ~RecoverChunk_PaxosLogs() override;
+  explicit PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoverChunk_PaxosLogs(const RecoverChunk_PaxosLogs& from);
+  RecoverChunk_PaxosLogs(RecoverChunk_PaxosLogs&& from) noexcept
+    : RecoverChunk_PaxosLogs() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoverChunk_PaxosLogs& operator=(const RecoverChunk_PaxosLogs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoverChunk_PaxosLogs& operator=(RecoverChunk_PaxosLogs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoverChunk_PaxosLogs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoverChunk_PaxosLogs* internal_default_instance() {
+    return reinterpret_cast<const RecoverChunk_PaxosLogs*>(
+               &_RecoverChunk_PaxosLogs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(RecoverChunk_PaxosLogs& a, RecoverChunk_PaxosLogs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoverChunk_PaxosLogs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoverChunk_PaxosLogs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoverChunk_PaxosLogs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoverChunk_PaxosLogs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoverChunk_PaxosLogs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoverChunk_PaxosLogs& from) {
+    RecoverChunk_PaxosLogs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoverChunk_PaxosLogs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.RecoverChunk.PaxosLogs";
+  }
+  protected:
+  explicit RecoverChunk_PaxosLogs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogsFieldNumber = 1,
+  };
+  // map<int32, .keyvaluestore.PaxosLog> logs = 1;
+  int logs_size() const;
+  private:
+  int _internal_logs_size() const;
+  public:
+  void clear_logs();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >&
+      _internal_logs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >*
+      _internal_mutable_logs();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >&
+      logs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >*
+      mutable_logs();
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.RecoverChunk.PaxosLogs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        RecoverChunk_PaxosLogs_LogsEntry_DoNotUse,
+        int32_t, ::keyvaluestore::PaxosLog,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> logs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecoverChunk_KvMapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_KvMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_KvMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  RecoverChunk_KvMapEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR RecoverChunk_KvMapEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit RecoverChunk_KvMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const RecoverChunk_KvMapEntry_DoNotUse& other);
+  static const RecoverChunk_KvMapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RecoverChunk_KvMapEntry_DoNotUse*>(&_RecoverChunk_KvMapEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.RecoverChunk.KvMapEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.RecoverChunk.KvMapEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class RecoverChunk_PaxosLogsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_PaxosLogsEntry_DoNotUse, 
+    std::string, ::keyvaluestore::RecoverChunk_PaxosLogs,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RecoverChunk_PaxosLogsEntry_DoNotUse, 
+    std::string, ::keyvaluestore::RecoverChunk_PaxosLogs,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  RecoverChunk_PaxosLogsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR RecoverChunk_PaxosLogsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit RecoverChunk_PaxosLogsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const RecoverChunk_PaxosLogsEntry_DoNotUse& other);
+  static const RecoverChunk_PaxosLogsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RecoverChunk_PaxosLogsEntry_DoNotUse*>(&_RecoverChunk_PaxosLogsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.RecoverChunk.PaxosLogsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class RecoverChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.RecoverChunk) */ {
+ public:
+  inline RecoverChunk() : RecoverChunk(nullptr) {}
+  ~RecoverChunk() override;
+  explicit PROTOBUF_CONSTEXPR RecoverChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecoverChunk(const RecoverChunk& from);
+  RecoverChunk(RecoverChunk&& from) noexcept
+    : RecoverChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline RecoverChunk& operator=(const RecoverChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecoverChunk& operator=(RecoverChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecoverChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecoverChunk* internal_default_instance() {
+    return reinterpret_cast<const RecoverChunk*>(
+               &_RecoverChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(RecoverChunk& a, RecoverChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecoverChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecoverChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecoverChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecoverChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecoverChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecoverChunk& from) {
+    RecoverChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecoverChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.RecoverChunk";
+  }
+  protected:
+  explicit RecoverChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RecoverChunk_PaxosLogs PaxosLogs;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvMapFieldNumber = 1,
+    kPaxosLogsFieldNumber = 2,
+    kAppliedSlotFieldNumber = 3,
+    kDataCompleteFieldNumber = 4,
+    kIncrementalFieldNumber = 5,
+  };
+  // map<string, string> kv_map = 1;
+  int kv_map_size() const;
+  private:
+  int _internal_kv_map_size() const;
+  public:
+  void clear_kv_map();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_kv_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_kv_map();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      kv_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_kv_map();
+
+  // map<string, .keyvaluestore.RecoverChunk.PaxosLogs> paxos_logs = 2;
+  int paxos_logs_size() const;
+  private:
+  int _internal_paxos_logs_size() const;
+  public:
+  void clear_paxos_logs();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >&
+      _internal_paxos_logs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >*
+      _internal_mutable_paxos_logs();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >&
+      paxos_logs() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >*
+      mutable_paxos_logs();
+
+  // int32 applied_slot = 3;
+  void clear_applied_slot();
+  int32_t applied_slot() const;
+  void set_applied_slot(int32_t value);
+  private:
+  int32_t _internal_applied_slot() const;
+  void _internal_set_applied_slot(int32_t value);
+  public:
+
+  // bool data_complete = 4;
+  void clear_data_complete();
+  bool data_complete() const;
+  void set_data_complete(bool value);
+  private:
+  bool _internal_data_complete() const;
+  void _internal_set_data_complete(bool value);
+  public:
+
+  // bool incremental = 5;
+  void clear_incremental();
+  bool incremental() const;
+  void set_incremental(bool value);
+  private:
+  bool _internal_incremental() const;
+  void _internal_set_incremental(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.RecoverChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        RecoverChunk_KvMapEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> kv_map_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        RecoverChunk_PaxosLogsEntry_DoNotUse,
+        std::string, ::keyvaluestore::RecoverChunk_PaxosLogs,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> paxos_logs_;
+    int32_t applied_slot_;
+    bool data_complete_;
+    bool incremental_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencySummary final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.LatencySummary) */ {
+ public:
+  inline LatencySummary() : LatencySummary(nullptr) {}
+  ~LatencySummary() override;
+  explicit PROTOBUF_CONSTEXPR LatencySummary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencySummary(const LatencySummary& from);
+  LatencySummary(LatencySummary&& from) noexcept
+    : LatencySummary() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencySummary& operator=(const LatencySummary& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencySummary& operator=(LatencySummary&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencySummary& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencySummary* internal_default_instance() {
+    return reinterpret_cast<const LatencySummary*>(
+               &_LatencySummary_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(LatencySummary& a, LatencySummary& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencySummary* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencySummary* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencySummary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencySummary>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencySummary& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencySummary& from) {
+    LatencySummary::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencySummary* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.LatencySummary";
+  }
+  protected:
+  explicit LatencySummary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 1,
+    kMeanFieldNumber = 2,
+    kMinFieldNumber = 3,
+    kP50FieldNumber = 4,
+    kP90FieldNumber = 5,
+    kP99FieldNumber = 6,
+    kP999FieldNumber = 7,
+    kMaxFieldNumber = 8,
+  };
+  // uint64 count = 1;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // double mean = 2;
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // uint64 min = 3;
+  void clear_min();
+  uint64_t min() const;
+  void set_min(uint64_t value);
+  private:
+  uint64_t _internal_min() const;
+  void _internal_set_min(uint64_t value);
+  public:
+
+  // uint64 p50 = 4;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p90 = 5;
+  void clear_p90();
+  uint64_t p90() const;
+  void set_p90(uint64_t value);
+  private:
+  uint64_t _internal_p90() const;
+  void _internal_set_p90(uint64_t value);
+  public:
+
+  // uint64 p99 = 6;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 7;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 8;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.LatencySummary)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t count_;
+    double mean_;
+    uint64_t min_;
+    uint64_t p50_;
+    uint64_t p90_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse_CountersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_CountersEntry_DoNotUse, 
+    std::string, int64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_CountersEntry_DoNotUse, 
+    std::string, int64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> SuperType;
+  StatsResponse_CountersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR StatsResponse_CountersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit StatsResponse_CountersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const StatsResponse_CountersEntry_DoNotUse& other);
+  static const StatsResponse_CountersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const StatsResponse_CountersEntry_DoNotUse*>(&_StatsResponse_CountersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.StatsResponse.CountersEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class StatsResponse_LatenciesUsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_LatenciesUsEntry_DoNotUse, 
+    std::string, ::keyvaluestore::LatencySummary,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_LatenciesUsEntry_DoNotUse, 
+    std::string, ::keyvaluestore::LatencySummary,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  StatsResponse_LatenciesUsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR StatsResponse_LatenciesUsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit StatsResponse_LatenciesUsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const StatsResponse_LatenciesUsEntry_DoNotUse& other);
+  static const StatsResponse_LatenciesUsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const StatsResponse_LatenciesUsEntry_DoNotUse*>(&_StatsResponse_LatenciesUsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.StatsResponse.LatenciesUsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class StatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.StatsResponse) */ {
+ public:
+  inline StatsResponse() : StatsResponse(nullptr) {}
+  ~StatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsResponse(const StatsResponse& from);
+  StatsResponse(StatsResponse&& from) noexcept
+    : StatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsResponse& operator=(StatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatsResponse*>(
+               &_StatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(StatsResponse& a, StatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsResponse& from) {
+    StatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.StatsResponse";
+  }
+  protected:
+  explicit StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 1,
+    kLatenciesUsFieldNumber = 2,
+    kTextFieldNumber = 3,
+  };
+  // map<string, int64> counters = 1;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
+      _internal_counters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
+      _internal_mutable_counters();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
+      counters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
+      mutable_counters();
+
+  // map<string, .keyvaluestore.LatencySummary> latencies_us = 2;
+  int latencies_us_size() const;
+  private:
+  int _internal_latencies_us_size() const;
+  public:
+  void clear_latencies_us();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >&
+      _internal_latencies_us() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >*
+      _internal_mutable_latencies_us();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >&
+      latencies_us() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >*
+      mutable_latencies_us();
+
+  // string text = 3;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.StatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        StatsResponse_CountersEntry_DoNotUse,
+        std::string, int64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> counters_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        StatsResponse_LatenciesUsEntry_DoNotUse,
+        std::string, ::keyvaluestore::LatencySummary,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> latencies_us_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalRecord_PaxosLogEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WalRecord.PaxosLogEntry) */ {
+ public:
+  inline WalRecord_PaxosLogEntry() : WalRecord_PaxosLogEntry(nullptr) {}
+  ~WalRecord_PaxosLogEntry() override;
+  explicit PROTOBUF_CONSTEXPR WalRecord_PaxosLogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalRecord_PaxosLogEntry(const WalRecord_PaxosLogEntry& from);
+  WalRecord_PaxosLogEntry(WalRecord_PaxosLogEntry&& from) noexcept
+    : WalRecord_PaxosLogEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline WalRecord_PaxosLogEntry& operator=(const WalRecord_PaxosLogEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalRecord_PaxosLogEntry& operator=(WalRecord_PaxosLogEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalRecord_PaxosLogEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalRecord_PaxosLogEntry* internal_default_instance() {
+    return reinterpret_cast<const WalRecord_PaxosLogEntry*>(
+               &_WalRecord_PaxosLogEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(WalRecord_PaxosLogEntry& a, WalRecord_PaxosLogEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalRecord_PaxosLogEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalRecord_PaxosLogEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalRecord_PaxosLogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalRecord_PaxosLogEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalRecord_PaxosLogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalRecord_PaxosLogEntry& from) {
+    WalRecord_PaxosLogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalRecord_PaxosLogEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WalRecord.PaxosLogEntry";
+  }
+  protected:
+  explicit WalRecord_PaxosLogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kLogFieldNumber = 3,
+    kRoundFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // .keyvaluestore.PaxosLog log = 3;
+  bool has_log() const;
+  private:
+  bool _internal_has_log() const;
+  public:
+  void clear_log();
+  const ::keyvaluestore::PaxosLog& log() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::PaxosLog* release_log();
+  ::keyvaluestore::PaxosLog* mutable_log();
+  void set_allocated_log(::keyvaluestore::PaxosLog* log);
+  private:
+  const ::keyvaluestore::PaxosLog& _internal_log() const;
+  ::keyvaluestore::PaxosLog* _internal_mutable_log();
+  public:
+  void unsafe_arena_set_allocated_log(
+      ::keyvaluestore::PaxosLog* log);
+  ::keyvaluestore::PaxosLog* unsafe_arena_release_log();
+
+  // int32 round = 2;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WalRecord.PaxosLogEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::keyvaluestore::PaxosLog* log_;
+    int32_t round_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalRecord_Applied final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WalRecord.Applied) */ {
+ public:
+  inline WalRecord_Applied() : WalRecord_Applied(nullptr) {}
+  ~WalRecord_Applied() override;
+  explicit PROTOBUF_CONSTEXPR WalRecord_Applied(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalRecord_Applied(const WalRecord_Applied& from);
+  WalRecord_Applied(WalRecord_Applied&& from) noexcept
+    : WalRecord_Applied() {
+    *this = ::std::move(from);
+  }
+
+  inline WalRecord_Applied& operator=(const WalRecord_Applied& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalRecord_Applied& operator=(WalRecord_Applied&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalRecord_Applied& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalRecord_Applied* internal_default_instance() {
+    return reinterpret_cast<const WalRecord_Applied*>(
+               &_WalRecord_Applied_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(WalRecord_Applied& a, WalRecord_Applied& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalRecord_Applied* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalRecord_Applied* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalRecord_Applied* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalRecord_Applied>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalRecord_Applied& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalRecord_Applied& from) {
+    WalRecord_Applied::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalRecord_Applied* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WalRecord.Applied";
+  }
+  protected:
+  explicit WalRecord_Applied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 2,
+    kSlotFieldNumber = 1,
+  };
+  // repeated .keyvaluestore.Operation operations = 2;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::keyvaluestore::Operation* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+      mutable_operations();
+  private:
+  const ::keyvaluestore::Operation& _internal_operations(int index) const;
+  ::keyvaluestore::Operation* _internal_add_operations();
+  public:
+  const ::keyvaluestore::Operation& operations(int index) const;
+  ::keyvaluestore::Operation* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+      operations() const;
+
+  // int32 slot = 1;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WalRecord.Applied)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation > operations_;
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalRecord_Snapshot_KvMapEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<WalRecord_Snapshot_KvMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<WalRecord_Snapshot_KvMapEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  WalRecord_Snapshot_KvMapEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR WalRecord_Snapshot_KvMapEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit WalRecord_Snapshot_KvMapEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const WalRecord_Snapshot_KvMapEntry_DoNotUse& other);
+  static const WalRecord_Snapshot_KvMapEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const WalRecord_Snapshot_KvMapEntry_DoNotUse*>(&_WalRecord_Snapshot_KvMapEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.WalRecord.Snapshot.KvMapEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "keyvaluestore.WalRecord.Snapshot.KvMapEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class WalRecord_Snapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WalRecord.Snapshot) */ {
+ public:
+  inline WalRecord_Snapshot() : WalRecord_Snapshot(nullptr) {}
+  ~WalRecord_Snapshot() override;
+  explicit PROTOBUF_CONSTEXPR WalRecord_Snapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalRecord_Snapshot(const WalRecord_Snapshot& from);
+  WalRecord_Snapshot(WalRecord_Snapshot&& from) noexcept
+    : WalRecord_Snapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline WalRecord_Snapshot& operator=(const WalRecord_Snapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalRecord_Snapshot& operator=(WalRecord_Snapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalRecord_Snapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalRecord_Snapshot* internal_default_instance() {
+    return reinterpret_cast<const WalRecord_Snapshot*>(
+               &_WalRecord_Snapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(WalRecord_Snapshot& a, WalRecord_Snapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalRecord_Snapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalRecord_Snapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalRecord_Snapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalRecord_Snapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalRecord_Snapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalRecord_Snapshot& from) {
+    WalRecord_Snapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalRecord_Snapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WalRecord.Snapshot";
+  }
+  protected:
+  explicit WalRecord_Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvMapFieldNumber = 1,
+    kAppliedSlotFieldNumber = 2,
+    kContinuedFieldNumber = 3,
+    kIncompleteFieldNumber = 4,
+  };
+  // map<string, string> kv_map = 1;
+  int kv_map_size() const;
+  private:
+  int _internal_kv_map_size() const;
+  public:
+  void clear_kv_map();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_kv_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_kv_map();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      kv_map() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_kv_map();
+
+  // int32 applied_slot = 2;
+  void clear_applied_slot();
+  int32_t applied_slot() const;
+  void set_applied_slot(int32_t value);
+  private:
+  int32_t _internal_applied_slot() const;
+  void _internal_set_applied_slot(int32_t value);
+  public:
+
+  // bool continued = 3;
+  void clear_continued();
+  bool continued() const;
+  void set_continued(bool value);
+  private:
+  bool _internal_continued() const;
+  void _internal_set_continued(bool value);
+  public:
+
+  // bool incomplete = 4;
+  void clear_incomplete();
+  bool incomplete() const;
+  void set_incomplete(bool value);
+  private:
+  bool _internal_incomplete() const;
+  void _internal_set_incomplete(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WalRecord.Snapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        WalRecord_Snapshot_KvMapEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> kv_map_;
+    int32_t applied_slot_;
+    bool continued_;
+    bool incomplete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalRecord_Compaction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WalRecord.Compaction) */ {
+ public:
+  inline WalRecord_Compaction() : WalRecord_Compaction(nullptr) {}
+  ~WalRecord_Compaction() override;
+  explicit PROTOBUF_CONSTEXPR WalRecord_Compaction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalRecord_Compaction(const WalRecord_Compaction& from);
+  WalRecord_Compaction(WalRecord_Compaction&& from) noexcept
+    : WalRecord_Compaction() {
+    *this = ::std::move(from);
+  }
+
+  inline WalRecord_Compaction& operator=(const WalRecord_Compaction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalRecord_Compaction& operator=(WalRecord_Compaction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalRecord_Compaction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalRecord_Compaction* internal_default_instance() {
+    return reinterpret_cast<const WalRecord_Compaction*>(
+               &_WalRecord_Compaction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    52;
+
+  friend void swap(WalRecord_Compaction& a, WalRecord_Compaction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalRecord_Compaction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalRecord_Compaction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalRecord_Compaction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalRecord_Compaction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalRecord_Compaction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalRecord_Compaction& from) {
+    WalRecord_Compaction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalRecord_Compaction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WalRecord.Compaction";
+  }
+  protected:
+  explicit WalRecord_Compaction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kRoundFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int32 round = 2;
+  void clear_round();
+  int32_t round() const;
+  void set_round(int32_t value);
+  private:
+  int32_t _internal_round() const;
+  void _internal_set_round(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WalRecord.Compaction)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int32_t round_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:keyvaluestore.WalRecord) */ {
+ public:
+  inline WalRecord() : WalRecord(nullptr) {}
+  ~WalRecord() override;
+  explicit PROTOBUF_CONSTEXPR WalRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalRecord(const WalRecord& from);
+  WalRecord(WalRecord&& from) noexcept
+    : WalRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline WalRecord& operator=(const WalRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalRecord& operator=(WalRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  enum RecordCase {
+    kPaxosLog = 1,
+    kPromisedBallot = 2,
+    kApplied = 3,
+    kSnapshot = 4,
+    kCompaction = 5,
+    RECORD_NOT_SET = 0,
+  };
+
+  static inline const WalRecord* internal_default_instance() {
+    return reinterpret_cast<const WalRecord*>(
+               &_WalRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    53;
+
+  friend void swap(WalRecord& a, WalRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalRecord& from) {
+    WalRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "keyvaluestore.WalRecord";
+  }
+  protected:
+  explicit WalRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WalRecord_PaxosLogEntry PaxosLogEntry;
+  typedef WalRecord_Applied Applied;
+  typedef WalRecord_Snapshot Snapshot;
+  typedef WalRecord_Compaction Compaction;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPaxosLogFieldNumber = 1,
+    kPromisedBallotFieldNumber = 2,
+    kAppliedFieldNumber = 3,
+    kSnapshotFieldNumber = 4,
+    kCompactionFieldNumber = 5,
+  };
+  // .keyvaluestore.WalRecord.PaxosLogEntry paxos_log = 1;
+  bool has_paxos_log() const;
+  private:
+  bool _internal_has_paxos_log() const;
+  public:
+  void clear_paxos_log();
+  const ::keyvaluestore::WalRecord_PaxosLogEntry& paxos_log() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WalRecord_PaxosLogEntry* release_paxos_log();
+  ::keyvaluestore::WalRecord_PaxosLogEntry* mutable_paxos_log();
+  void set_allocated_paxos_log(::keyvaluestore::WalRecord_PaxosLogEntry* paxos_log);
+  private:
+  const ::keyvaluestore::WalRecord_PaxosLogEntry& _internal_paxos_log() const;
+  ::keyvaluestore::WalRecord_PaxosLogEntry* _internal_mutable_paxos_log();
+  public:
+  void unsafe_arena_set_allocated_paxos_log(
+      ::keyvaluestore::WalRecord_PaxosLogEntry* paxos_log);
+  ::keyvaluestore::WalRecord_PaxosLogEntry* unsafe_arena_release_paxos_log();
+
+  // int32 promised_ballot = 2;
+  bool has_promised_ballot() const;
+  private:
+  bool _internal_has_promised_ballot() const;
+  public:
+  void clear_promised_ballot();
+  int32_t promised_ballot() const;
+  void set_promised_ballot(int32_t value);
+  private:
+  int32_t _internal_promised_ballot() const;
+  void _internal_set_promised_ballot(int32_t value);
+  public:
+
+  // .keyvaluestore.WalRecord.Applied applied = 3;
+  bool has_applied() const;
+  private:
+  bool _internal_has_applied() const;
+  public:
+  void clear_applied();
+  const ::keyvaluestore::WalRecord_Applied& applied() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WalRecord_Applied* release_applied();
+  ::keyvaluestore::WalRecord_Applied* mutable_applied();
+  void set_allocated_applied(::keyvaluestore::WalRecord_Applied* applied);
+  private:
+  const ::keyvaluestore::WalRecord_Applied& _internal_applied() const;
+  ::keyvaluestore::WalRecord_Applied* _internal_mutable_applied();
+  public:
+  void unsafe_arena_set_allocated_applied(
+      ::keyvaluestore::WalRecord_Applied* applied);
+  ::keyvaluestore::WalRecord_Applied* unsafe_arena_release_applied();
+
+  // .keyvaluestore.WalRecord.Snapshot snapshot = 4;
+  bool has_snapshot() const;
+  private:
+  bool _internal_has_snapshot() const;
+  public:
+  void clear_snapshot();
+  const ::keyvaluestore::WalRecord_Snapshot& snapshot() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WalRecord_Snapshot* release_snapshot();
+  ::keyvaluestore::WalRecord_Snapshot* mutable_snapshot();
+  void set_allocated_snapshot(::keyvaluestore::WalRecord_Snapshot* snapshot);
+  private:
+  const ::keyvaluestore::WalRecord_Snapshot& _internal_snapshot() const;
+  ::keyvaluestore::WalRecord_Snapshot* _internal_mutable_snapshot();
+  public:
+  void unsafe_arena_set_allocated_snapshot(
+      ::keyvaluestore::WalRecord_Snapshot* snapshot);
+  ::keyvaluestore::WalRecord_Snapshot* unsafe_arena_release_snapshot();
+
+  // .keyvaluestore.WalRecord.Compaction compaction = 5;
+  bool has_compaction() const;
+  private:
+  bool _internal_has_compaction() const;
+  public:
+  void clear_compaction();
+  const ::keyvaluestore::WalRecord_Compaction& compaction() const;
+  PROTOBUF_NODISCARD ::keyvaluestore::WalRecord_Compaction* release_compaction();
+  ::keyvaluestore::WalRecord_Compaction* mutable_compaction();
+  void set_allocated_compaction(::keyvaluestore::WalRecord_Compaction* compaction);
+  private:
+  const ::keyvaluestore::WalRecord_Compaction& _internal_compaction() const;
+  ::keyvaluestore::WalRecord_Compaction* _internal_mutable_compaction();
+  public:
+  void unsafe_arena_set_allocated_compaction(
+      ::keyvaluestore::WalRecord_Compaction* compaction);
+  ::keyvaluestore::WalRecord_Compaction* unsafe_arena_release_compaction();
+
+  void clear_record();
+  RecordCase record_case() const;
+  // @@protoc_insertion_point(class_scope:keyvaluestore.WalRecord)
+ private:
+  class _Internal;
+  void set_has_paxos_log();
+  void set_has_promised_ballot();
+  void set_has_applied();
+  void set_has_snapshot();
+  void set_has_compaction();
+
+  inline bool has_record() const;
+  inline void clear_has_record();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union RecordUnion {
+      constexpr RecordUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::keyvaluestore::WalRecord_PaxosLogEntry* paxos_log_;
+      int32_t promised_ballot_;
+      ::keyvaluestore::WalRecord_Applied* applied_;
+      ::keyvaluestore::WalRecord_Snapshot* snapshot_;
+      ::keyvaluestore::WalRecord_Compaction* compaction_;
+    } record_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_keyvaluestore_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EmptyMessage
+
+// -------------------------------------------------------------------
+
+// ServerConfig
+
+// string my_addr = 1;
+inline void ServerConfig::clear_my_addr() {
+  _impl_.my_addr_.ClearToEmpty();
+}
+inline const std::string& ServerConfig::my_addr() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.my_addr)
+  return _internal_my_addr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_my_addr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.my_addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.my_addr)
+}
+inline std::string* ServerConfig::mutable_my_addr() {
+  std::string* _s = _internal_mutable_my_addr();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ServerConfig.my_addr)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_my_addr() const {
+  return _impl_.my_addr_.Get();
+}
+inline void ServerConfig::_internal_set_my_addr(const std::string& value) {
+  
+  _impl_.my_addr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_my_addr() {
+  
+  return _impl_.my_addr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_my_addr() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ServerConfig.my_addr)
+  return _impl_.my_addr_.Release();
+}
+inline void ServerConfig::set_allocated_my_addr(std::string* my_addr) {
+  if (my_addr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.my_addr_.SetAllocated(my_addr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.my_addr_.IsDefault()) {
+    _impl_.my_addr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ServerConfig.my_addr)
+}
+
+// string my_paxos = 2;
+inline void ServerConfig::clear_my_paxos() {
+  _impl_.my_paxos_.ClearToEmpty();
+}
+inline const std::string& ServerConfig::my_paxos() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.my_paxos)
+  return _internal_my_paxos();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_my_paxos(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.my_paxos_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.my_paxos)
+}
+inline std::string* ServerConfig::mutable_my_paxos() {
+  std::string* _s = _internal_mutable_my_paxos();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ServerConfig.my_paxos)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_my_paxos() const {
+  return _impl_.my_paxos_.Get();
+}
+inline void ServerConfig::_internal_set_my_paxos(const std::string& value) {
+  
+  _impl_.my_paxos_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_my_paxos() {
+  
+  return _impl_.my_paxos_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_my_paxos() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ServerConfig.my_paxos)
+  return _impl_.my_paxos_.Release();
+}
+inline void ServerConfig::set_allocated_my_paxos(std::string* my_paxos) {
+  if (my_paxos != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.my_paxos_.SetAllocated(my_paxos, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.my_paxos_.IsDefault()) {
+    _impl_.my_paxos_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ServerConfig.my_paxos)
+}
+
+// double fail_rate = 3;
+inline void ServerConfig::clear_fail_rate() {
+  _impl_.fail_rate_ = 0;
+}
+inline double ServerConfig::_internal_fail_rate() const {
+  return _impl_.fail_rate_;
+}
+inline double ServerConfig::fail_rate() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.fail_rate)
+  return _internal_fail_rate();
+}
+inline void ServerConfig::_internal_set_fail_rate(double value) {
+  
+  _impl_.fail_rate_ = value;
+}
+inline void ServerConfig::set_fail_rate(double value) {
+  _internal_set_fail_rate(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.fail_rate)
+}
+
+// repeated string replica = 4;
+inline int ServerConfig::_internal_replica_size() const {
+  return _impl_.replica_.size();
+}
+inline int ServerConfig::replica_size() const {
+  return _internal_replica_size();
+}
+inline void ServerConfig::clear_replica() {
+  _impl_.replica_.Clear();
+}
+inline std::string* ServerConfig::add_replica() {
+  std::string* _s = _internal_add_replica();
+  // @@protoc_insertion_point(field_add_mutable:keyvaluestore.ServerConfig.replica)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_replica(int index) const {
+  return _impl_.replica_.Get(index);
+}
+inline const std::string& ServerConfig::replica(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.replica)
+  return _internal_replica(index);
+}
+inline std::string* ServerConfig::mutable_replica(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ServerConfig.replica)
+  return _impl_.replica_.Mutable(index);
+}
+inline void ServerConfig::set_replica(int index, const std::string& value) {
+  _impl_.replica_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::set_replica(int index, std::string&& value) {
+  _impl_.replica_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::set_replica(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.replica_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::set_replica(int index, const char* value, size_t size) {
+  _impl_.replica_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keyvaluestore.ServerConfig.replica)
+}
+inline std::string* ServerConfig::_internal_add_replica() {
+  return _impl_.replica_.Add();
+}
+inline void ServerConfig::add_replica(const std::string& value) {
+  _impl_.replica_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::add_replica(std::string&& value) {
+  _impl_.replica_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::add_replica(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.replica_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keyvaluestore.ServerConfig.replica)
+}
+inline void ServerConfig::add_replica(const char* value, size_t size) {
+  _impl_.replica_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keyvaluestore.ServerConfig.replica)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ServerConfig::replica() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.ServerConfig.replica)
+  return _impl_.replica_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ServerConfig::mutable_replica() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.ServerConfig.replica)
+  return &_impl_.replica_;
+}
+
+// int32 heartbeat_interval_ms = 5;
+inline void ServerConfig::clear_heartbeat_interval_ms() {
+  _impl_.heartbeat_interval_ms_ = 0;
+}
+inline int32_t ServerConfig::_internal_heartbeat_interval_ms() const {
+  return _impl_.heartbeat_interval_ms_;
+}
+inline int32_t ServerConfig::heartbeat_interval_ms() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.heartbeat_interval_ms)
+  return _internal_heartbeat_interval_ms();
+}
+inline void ServerConfig::_internal_set_heartbeat_interval_ms(int32_t value) {
+  
+  _impl_.heartbeat_interval_ms_ = value;
+}
+inline void ServerConfig::set_heartbeat_interval_ms(int32_t value) {
+  _internal_set_heartbeat_interval_ms(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.heartbeat_interval_ms)
+}
+
+// int32 heartbeat_timeout_ms = 6;
+inline void ServerConfig::clear_heartbeat_timeout_ms() {
+  _impl_.heartbeat_timeout_ms_ = 0;
+}
+inline int32_t ServerConfig::_internal_heartbeat_timeout_ms() const {
+  return _impl_.heartbeat_timeout_ms_;
+}
+inline int32_t ServerConfig::heartbeat_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.heartbeat_timeout_ms)
+  return _internal_heartbeat_timeout_ms();
+}
+inline void ServerConfig::_internal_set_heartbeat_timeout_ms(int32_t value) {
+  
+  _impl_.heartbeat_timeout_ms_ = value;
+}
+inline void ServerConfig::set_heartbeat_timeout_ms(int32_t value) {
+  _internal_set_heartbeat_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.heartbeat_timeout_ms)
+}
+
+// int32 batch_window_us = 7;
+inline void ServerConfig::clear_batch_window_us() {
+  _impl_.batch_window_us_ = 0;
+}
+inline int32_t ServerConfig::_internal_batch_window_us() const {
+  return _impl_.batch_window_us_;
+}
+inline int32_t ServerConfig::batch_window_us() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.batch_window_us)
+  return _internal_batch_window_us();
+}
+inline void ServerConfig::_internal_set_batch_window_us(int32_t value) {
+  
+  _impl_.batch_window_us_ = value;
+}
+inline void ServerConfig::set_batch_window_us(int32_t value) {
+  _internal_set_batch_window_us(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.batch_window_us)
+}
+
+// int32 max_batch_size = 8;
+inline void ServerConfig::clear_max_batch_size() {
+  _impl_.max_batch_size_ = 0;
+}
+inline int32_t ServerConfig::_internal_max_batch_size() const {
+  return _impl_.max_batch_size_;
+}
+inline int32_t ServerConfig::max_batch_size() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.max_batch_size)
+  return _internal_max_batch_size();
+}
+inline void ServerConfig::_internal_set_max_batch_size(int32_t value) {
+  
+  _impl_.max_batch_size_ = value;
+}
+inline void ServerConfig::set_max_batch_size(int32_t value) {
+  _internal_set_max_batch_size(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.max_batch_size)
+}
+
+// int32 pipeline_depth = 9;
+inline void ServerConfig::clear_pipeline_depth() {
+  _impl_.pipeline_depth_ = 0;
+}
+inline int32_t ServerConfig::_internal_pipeline_depth() const {
+  return _impl_.pipeline_depth_;
+}
+inline int32_t ServerConfig::pipeline_depth() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.pipeline_depth)
+  return _internal_pipeline_depth();
+}
+inline void ServerConfig::_internal_set_pipeline_depth(int32_t value) {
+  
+  _impl_.pipeline_depth_ = value;
+}
+inline void ServerConfig::set_pipeline_depth(int32_t value) {
+  _internal_set_pipeline_depth(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.pipeline_depth)
+}
+
+// string wal_path = 10;
+inline void ServerConfig::clear_wal_path() {
+  _impl_.wal_path_.ClearToEmpty();
+}
+inline const std::string& ServerConfig::wal_path() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.wal_path)
+  return _internal_wal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_wal_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.wal_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.wal_path)
+}
+inline std::string* ServerConfig::mutable_wal_path() {
+  std::string* _s = _internal_mutable_wal_path();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ServerConfig.wal_path)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_wal_path() const {
+  return _impl_.wal_path_.Get();
+}
+inline void ServerConfig::_internal_set_wal_path(const std::string& value) {
+  
+  _impl_.wal_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_wal_path() {
+  
+  return _impl_.wal_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_wal_path() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ServerConfig.wal_path)
+  return _impl_.wal_path_.Release();
+}
+inline void ServerConfig::set_allocated_wal_path(std::string* wal_path) {
+  if (wal_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.wal_path_.SetAllocated(wal_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.wal_path_.IsDefault()) {
+    _impl_.wal_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ServerConfig.wal_path)
+}
+
+// int32 compaction_interval_ms = 11;
+inline void ServerConfig::clear_compaction_interval_ms() {
+  _impl_.compaction_interval_ms_ = 0;
+}
+inline int32_t ServerConfig::_internal_compaction_interval_ms() const {
+  return _impl_.compaction_interval_ms_;
+}
+inline int32_t ServerConfig::compaction_interval_ms() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.compaction_interval_ms)
+  return _internal_compaction_interval_ms();
+}
+inline void ServerConfig::_internal_set_compaction_interval_ms(int32_t value) {
+  
+  _impl_.compaction_interval_ms_ = value;
+}
+inline void ServerConfig::set_compaction_interval_ms(int32_t value) {
+  _internal_set_compaction_interval_ms(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.compaction_interval_ms)
+}
+
+// int32 compaction_retention = 12;
+inline void ServerConfig::clear_compaction_retention() {
+  _impl_.compaction_retention_ = 0;
+}
+inline int32_t ServerConfig::_internal_compaction_retention() const {
+  return _impl_.compaction_retention_;
+}
+inline int32_t ServerConfig::compaction_retention() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.compaction_retention)
+  return _internal_compaction_retention();
+}
+inline void ServerConfig::_internal_set_compaction_retention(int32_t value) {
+  
+  _impl_.compaction_retention_ = value;
+}
+inline void ServerConfig::set_compaction_retention(int32_t value) {
+  _internal_set_compaction_retention(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.compaction_retention)
+}
+
+// string log_level = 13;
+inline void ServerConfig::clear_log_level() {
+  _impl_.log_level_.ClearToEmpty();
+}
+inline const std::string& ServerConfig::log_level() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.log_level)
+  return _internal_log_level();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_log_level(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.log_level_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.log_level)
+}
+inline std::string* ServerConfig::mutable_log_level() {
+  std::string* _s = _internal_mutable_log_level();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ServerConfig.log_level)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_log_level() const {
+  return _impl_.log_level_.Get();
+}
+inline void ServerConfig::_internal_set_log_level(const std::string& value) {
+  
+  _impl_.log_level_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_log_level() {
+  
+  return _impl_.log_level_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_log_level() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ServerConfig.log_level)
+  return _impl_.log_level_.Release();
+}
+inline void ServerConfig::set_allocated_log_level(std::string* log_level) {
+  if (log_level != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.log_level_.SetAllocated(log_level, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.log_level_.IsDefault()) {
+    _impl_.log_level_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ServerConfig.log_level)
+}
+
+// int32 num_groups = 14;
+inline void ServerConfig::clear_num_groups() {
+  _impl_.num_groups_ = 0;
+}
+inline int32_t ServerConfig::_internal_num_groups() const {
+  return _impl_.num_groups_;
+}
+inline int32_t ServerConfig::num_groups() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.num_groups)
+  return _internal_num_groups();
+}
+inline void ServerConfig::_internal_set_num_groups(int32_t value) {
+  
+  _impl_.num_groups_ = value;
+}
+inline void ServerConfig::set_num_groups(int32_t value) {
+  _internal_set_num_groups(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.num_groups)
+}
+
+// int32 phase1_quorum = 15;
+inline void ServerConfig::clear_phase1_quorum() {
+  _impl_.phase1_quorum_ = 0;
+}
+inline int32_t ServerConfig::_internal_phase1_quorum() const {
+  return _impl_.phase1_quorum_;
+}
+inline int32_t ServerConfig::phase1_quorum() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.phase1_quorum)
+  return _internal_phase1_quorum();
+}
+inline void ServerConfig::_internal_set_phase1_quorum(int32_t value) {
+  
+  _impl_.phase1_quorum_ = value;
+}
+inline void ServerConfig::set_phase1_quorum(int32_t value) {
+  _internal_set_phase1_quorum(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.phase1_quorum)
+}
+
+// int32 phase2_quorum = 16;
+inline void ServerConfig::clear_phase2_quorum() {
+  _impl_.phase2_quorum_ = 0;
+}
+inline int32_t ServerConfig::_internal_phase2_quorum() const {
+  return _impl_.phase2_quorum_;
+}
+inline int32_t ServerConfig::phase2_quorum() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.phase2_quorum)
+  return _internal_phase2_quorum();
+}
+inline void ServerConfig::_internal_set_phase2_quorum(int32_t value) {
+  
+  _impl_.phase2_quorum_ = value;
+}
+inline void ServerConfig::set_phase2_quorum(int32_t value) {
+  _internal_set_phase2_quorum(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.phase2_quorum)
+}
+
+// bool thrifty_propose = 17;
+inline void ServerConfig::clear_thrifty_propose() {
+  _impl_.thrifty_propose_ = false;
+}
+inline bool ServerConfig::_internal_thrifty_propose() const {
+  return _impl_.thrifty_propose_;
+}
+inline bool ServerConfig::thrifty_propose() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.thrifty_propose)
+  return _internal_thrifty_propose();
+}
+inline void ServerConfig::_internal_set_thrifty_propose(bool value) {
+  
+  _impl_.thrifty_propose_ = value;
+}
+inline void ServerConfig::set_thrifty_propose(bool value) {
+  _internal_set_thrifty_propose(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.thrifty_propose)
+}
+
+// int32 thrifty_timeout_ms = 18;
+inline void ServerConfig::clear_thrifty_timeout_ms() {
+  _impl_.thrifty_timeout_ms_ = 0;
+}
+inline int32_t ServerConfig::_internal_thrifty_timeout_ms() const {
+  return _impl_.thrifty_timeout_ms_;
+}
+inline int32_t ServerConfig::thrifty_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.thrifty_timeout_ms)
+  return _internal_thrifty_timeout_ms();
+}
+inline void ServerConfig::_internal_set_thrifty_timeout_ms(int32_t value) {
+  
+  _impl_.thrifty_timeout_ms_ = value;
+}
+inline void ServerConfig::set_thrifty_timeout_ms(int32_t value) {
+  _internal_set_thrifty_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.thrifty_timeout_ms)
+}
+
+// bool follower_reads = 19;
+inline void ServerConfig::clear_follower_reads() {
+  _impl_.follower_reads_ = false;
+}
+inline bool ServerConfig::_internal_follower_reads() const {
+  return _impl_.follower_reads_;
+}
+inline bool ServerConfig::follower_reads() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ServerConfig.follower_reads)
+  return _internal_follower_reads();
+}
+inline void ServerConfig::_internal_set_follower_reads(bool value) {
+  
+  _impl_.follower_reads_ = value;
+}
+inline void ServerConfig::set_follower_reads(bool value) {
+  _internal_set_follower_reads(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ServerConfig.follower_reads)
+}
+
+// -------------------------------------------------------------------
+
+// BenchConfig
+
+// repeated string server = 1;
+inline int BenchConfig::_internal_server_size() const {
+  return _impl_.server_.size();
+}
+inline int BenchConfig::server_size() const {
+  return _internal_server_size();
+}
+inline void BenchConfig::clear_server() {
+  _impl_.server_.Clear();
+}
+inline std::string* BenchConfig::add_server() {
+  std::string* _s = _internal_add_server();
+  // @@protoc_insertion_point(field_add_mutable:keyvaluestore.BenchConfig.server)
+  return _s;
+}
+inline const std::string& BenchConfig::_internal_server(int index) const {
+  return _impl_.server_.Get(index);
+}
+inline const std::string& BenchConfig::server(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.server)
+  return _internal_server(index);
+}
+inline std::string* BenchConfig::mutable_server(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.BenchConfig.server)
+  return _impl_.server_.Mutable(index);
+}
+inline void BenchConfig::set_server(int index, const std::string& value) {
+  _impl_.server_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::set_server(int index, std::string&& value) {
+  _impl_.server_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::set_server(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.server_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::set_server(int index, const char* value, size_t size) {
+  _impl_.server_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keyvaluestore.BenchConfig.server)
+}
+inline std::string* BenchConfig::_internal_add_server() {
+  return _impl_.server_.Add();
+}
+inline void BenchConfig::add_server(const std::string& value) {
+  _impl_.server_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::add_server(std::string&& value) {
+  _impl_.server_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::add_server(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.server_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keyvaluestore.BenchConfig.server)
+}
+inline void BenchConfig::add_server(const char* value, size_t size) {
+  _impl_.server_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keyvaluestore.BenchConfig.server)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BenchConfig::server() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.BenchConfig.server)
+  return _impl_.server_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BenchConfig::mutable_server() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.BenchConfig.server)
+  return &_impl_.server_;
+}
+
+// int32 num_clients = 2;
+inline void BenchConfig::clear_num_clients() {
+  _impl_.num_clients_ = 0;
+}
+inline int32_t BenchConfig::_internal_num_clients() const {
+  return _impl_.num_clients_;
+}
+inline int32_t BenchConfig::num_clients() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.num_clients)
+  return _internal_num_clients();
+}
+inline void BenchConfig::_internal_set_num_clients(int32_t value) {
+  
+  _impl_.num_clients_ = value;
+}
+inline void BenchConfig::set_num_clients(int32_t value) {
+  _internal_set_num_clients(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.num_clients)
+}
+
+// int32 outstanding = 3;
+inline void BenchConfig::clear_outstanding() {
+  _impl_.outstanding_ = 0;
+}
+inline int32_t BenchConfig::_internal_outstanding() const {
+  return _impl_.outstanding_;
+}
+inline int32_t BenchConfig::outstanding() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.outstanding)
+  return _internal_outstanding();
+}
+inline void BenchConfig::_internal_set_outstanding(int32_t value) {
+  
+  _impl_.outstanding_ = value;
+}
+inline void BenchConfig::set_outstanding(int32_t value) {
+  _internal_set_outstanding(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.outstanding)
+}
+
+// int32 duration_s = 4;
+inline void BenchConfig::clear_duration_s() {
+  _impl_.duration_s_ = 0;
+}
+inline int32_t BenchConfig::_internal_duration_s() const {
+  return _impl_.duration_s_;
+}
+inline int32_t BenchConfig::duration_s() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.duration_s)
+  return _internal_duration_s();
+}
+inline void BenchConfig::_internal_set_duration_s(int32_t value) {
+  
+  _impl_.duration_s_ = value;
+}
+inline void BenchConfig::set_duration_s(int32_t value) {
+  _internal_set_duration_s(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.duration_s)
+}
+
+// int32 warmup_s = 5;
+inline void BenchConfig::clear_warmup_s() {
+  _impl_.warmup_s_ = 0;
+}
+inline int32_t BenchConfig::_internal_warmup_s() const {
+  return _impl_.warmup_s_;
+}
+inline int32_t BenchConfig::warmup_s() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.warmup_s)
+  return _internal_warmup_s();
+}
+inline void BenchConfig::_internal_set_warmup_s(int32_t value) {
+  
+  _impl_.warmup_s_ = value;
+}
+inline void BenchConfig::set_warmup_s(int32_t value) {
+  _internal_set_warmup_s(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.warmup_s)
+}
+
+// double read_ratio = 6;
+inline void BenchConfig::clear_read_ratio() {
+  _impl_.read_ratio_ = 0;
+}
+inline double BenchConfig::_internal_read_ratio() const {
+  return _impl_.read_ratio_;
+}
+inline double BenchConfig::read_ratio() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.read_ratio)
+  return _internal_read_ratio();
+}
+inline void BenchConfig::_internal_set_read_ratio(double value) {
+  
+  _impl_.read_ratio_ = value;
+}
+inline void BenchConfig::set_read_ratio(double value) {
+  _internal_set_read_ratio(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.read_ratio)
+}
+
+// int32 num_keys = 7;
+inline void BenchConfig::clear_num_keys() {
+  _impl_.num_keys_ = 0;
+}
+inline int32_t BenchConfig::_internal_num_keys() const {
+  return _impl_.num_keys_;
+}
+inline int32_t BenchConfig::num_keys() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.num_keys)
+  return _internal_num_keys();
+}
+inline void BenchConfig::_internal_set_num_keys(int32_t value) {
+  
+  _impl_.num_keys_ = value;
+}
+inline void BenchConfig::set_num_keys(int32_t value) {
+  _internal_set_num_keys(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.num_keys)
+}
+
+// string distribution = 8;
+inline void BenchConfig::clear_distribution() {
+  _impl_.distribution_.ClearToEmpty();
+}
+inline const std::string& BenchConfig::distribution() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.distribution)
+  return _internal_distribution();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchConfig::set_distribution(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.distribution_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.distribution)
+}
+inline std::string* BenchConfig::mutable_distribution() {
+  std::string* _s = _internal_mutable_distribution();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.BenchConfig.distribution)
+  return _s;
+}
+inline const std::string& BenchConfig::_internal_distribution() const {
+  return _impl_.distribution_.Get();
+}
+inline void BenchConfig::_internal_set_distribution(const std::string& value) {
+  
+  _impl_.distribution_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchConfig::_internal_mutable_distribution() {
+  
+  return _impl_.distribution_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchConfig::release_distribution() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.BenchConfig.distribution)
+  return _impl_.distribution_.Release();
+}
+inline void BenchConfig::set_allocated_distribution(std::string* distribution) {
+  if (distribution != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.distribution_.SetAllocated(distribution, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.distribution_.IsDefault()) {
+    _impl_.distribution_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.BenchConfig.distribution)
+}
+
+// double zipf_theta = 9;
+inline void BenchConfig::clear_zipf_theta() {
+  _impl_.zipf_theta_ = 0;
+}
+inline double BenchConfig::_internal_zipf_theta() const {
+  return _impl_.zipf_theta_;
+}
+inline double BenchConfig::zipf_theta() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.zipf_theta)
+  return _internal_zipf_theta();
+}
+inline void BenchConfig::_internal_set_zipf_theta(double value) {
+  
+  _impl_.zipf_theta_ = value;
+}
+inline void BenchConfig::set_zipf_theta(double value) {
+  _internal_set_zipf_theta(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.zipf_theta)
+}
+
+// int32 value_size = 10;
+inline void BenchConfig::clear_value_size() {
+  _impl_.value_size_ = 0;
+}
+inline int32_t BenchConfig::_internal_value_size() const {
+  return _impl_.value_size_;
+}
+inline int32_t BenchConfig::value_size() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.value_size)
+  return _internal_value_size();
+}
+inline void BenchConfig::_internal_set_value_size(int32_t value) {
+  
+  _impl_.value_size_ = value;
+}
+inline void BenchConfig::set_value_size(int32_t value) {
+  _internal_set_value_size(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.value_size)
+}
+
+// bool skip_load = 11;
+inline void BenchConfig::clear_skip_load() {
+  _impl_.skip_load_ = false;
+}
+inline bool BenchConfig::_internal_skip_load() const {
+  return _impl_.skip_load_;
+}
+inline bool BenchConfig::skip_load() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.skip_load)
+  return _internal_skip_load();
+}
+inline void BenchConfig::_internal_set_skip_load(bool value) {
+  
+  _impl_.skip_load_ = value;
+}
+inline void BenchConfig::set_skip_load(bool value) {
+  _internal_set_skip_load(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.skip_load)
+}
+
+// int64 seed = 12;
+inline void BenchConfig::clear_seed() {
+  _impl_.seed_ = int64_t{0};
+}
+inline int64_t BenchConfig::_internal_seed() const {
+  return _impl_.seed_;
+}
+inline int64_t BenchConfig::seed() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.BenchConfig.seed)
+  return _internal_seed();
+}
+inline void BenchConfig::_internal_set_seed(int64_t value) {
+  
+  _impl_.seed_ = value;
+}
+inline void BenchConfig::set_seed(int64_t value) {
+  _internal_set_seed(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.BenchConfig.seed)
+}
+
+// -------------------------------------------------------------------
+
+// ClusterEvent
+
+// int32 at_ms = 1;
+inline void ClusterEvent::clear_at_ms() {
+  _impl_.at_ms_ = 0;
+}
+inline int32_t ClusterEvent::_internal_at_ms() const {
+  return _impl_.at_ms_;
+}
+inline int32_t ClusterEvent::at_ms() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterEvent.at_ms)
+  return _internal_at_ms();
+}
+inline void ClusterEvent::_internal_set_at_ms(int32_t value) {
+  
+  _impl_.at_ms_ = value;
+}
+inline void ClusterEvent::set_at_ms(int32_t value) {
+  _internal_set_at_ms(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterEvent.at_ms)
+}
+
+// int32 replica = 2;
+inline void ClusterEvent::clear_replica() {
+  _impl_.replica_ = 0;
+}
+inline int32_t ClusterEvent::_internal_replica() const {
+  return _impl_.replica_;
+}
+inline int32_t ClusterEvent::replica() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterEvent.replica)
+  return _internal_replica();
+}
+inline void ClusterEvent::_internal_set_replica(int32_t value) {
+  
+  _impl_.replica_ = value;
+}
+inline void ClusterEvent::set_replica(int32_t value) {
+  _internal_set_replica(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterEvent.replica)
+}
+
+// bool restart = 3;
+inline void ClusterEvent::clear_restart() {
+  _impl_.restart_ = false;
+}
+inline bool ClusterEvent::_internal_restart() const {
+  return _impl_.restart_;
+}
+inline bool ClusterEvent::restart() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterEvent.restart)
+  return _internal_restart();
+}
+inline void ClusterEvent::_internal_set_restart(bool value) {
+  
+  _impl_.restart_ = value;
+}
+inline void ClusterEvent::set_restart(bool value) {
+  _internal_set_restart(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterEvent.restart)
+}
+
+// -------------------------------------------------------------------
+
+// ClusterBenchConfig
+
+// int32 num_replicas = 1;
+inline void ClusterBenchConfig::clear_num_replicas() {
+  _impl_.num_replicas_ = 0;
+}
+inline int32_t ClusterBenchConfig::_internal_num_replicas() const {
+  return _impl_.num_replicas_;
+}
+inline int32_t ClusterBenchConfig::num_replicas() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.num_replicas)
+  return _internal_num_replicas();
+}
+inline void ClusterBenchConfig::_internal_set_num_replicas(int32_t value) {
+  
+  _impl_.num_replicas_ = value;
+}
+inline void ClusterBenchConfig::set_num_replicas(int32_t value) {
+  _internal_set_num_replicas(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.num_replicas)
+}
+
+// .keyvaluestore.ServerConfig replica_config = 2;
+inline bool ClusterBenchConfig::_internal_has_replica_config() const {
+  return this != internal_default_instance() && _impl_.replica_config_ != nullptr;
+}
+inline bool ClusterBenchConfig::has_replica_config() const {
+  return _internal_has_replica_config();
+}
+inline void ClusterBenchConfig::clear_replica_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.replica_config_ != nullptr) {
+    delete _impl_.replica_config_;
+  }
+  _impl_.replica_config_ = nullptr;
+}
+inline const ::keyvaluestore::ServerConfig& ClusterBenchConfig::_internal_replica_config() const {
+  const ::keyvaluestore::ServerConfig* p = _impl_.replica_config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::ServerConfig&>(
+      ::keyvaluestore::_ServerConfig_default_instance_);
+}
+inline const ::keyvaluestore::ServerConfig& ClusterBenchConfig::replica_config() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.replica_config)
+  return _internal_replica_config();
+}
+inline void ClusterBenchConfig::unsafe_arena_set_allocated_replica_config(
+    ::keyvaluestore::ServerConfig* replica_config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.replica_config_);
+  }
+  _impl_.replica_config_ = replica_config;
+  if (replica_config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.ClusterBenchConfig.replica_config)
+}
+inline ::keyvaluestore::ServerConfig* ClusterBenchConfig::release_replica_config() {
+  
+  ::keyvaluestore::ServerConfig* temp = _impl_.replica_config_;
+  _impl_.replica_config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::ServerConfig* ClusterBenchConfig::unsafe_arena_release_replica_config() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ClusterBenchConfig.replica_config)
+  
+  ::keyvaluestore::ServerConfig* temp = _impl_.replica_config_;
+  _impl_.replica_config_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::ServerConfig* ClusterBenchConfig::_internal_mutable_replica_config() {
+  
+  if (_impl_.replica_config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::ServerConfig>(GetArenaForAllocation());
+    _impl_.replica_config_ = p;
+  }
+  return _impl_.replica_config_;
+}
+inline ::keyvaluestore::ServerConfig* ClusterBenchConfig::mutable_replica_config() {
+  ::keyvaluestore::ServerConfig* _msg = _internal_mutable_replica_config();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ClusterBenchConfig.replica_config)
+  return _msg;
+}
+inline void ClusterBenchConfig::set_allocated_replica_config(::keyvaluestore::ServerConfig* replica_config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.replica_config_;
+  }
+  if (replica_config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(replica_config);
+    if (message_arena != submessage_arena) {
+      replica_config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, replica_config, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.replica_config_ = replica_config;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ClusterBenchConfig.replica_config)
+}
+
+// string wal_dir = 3;
+inline void ClusterBenchConfig::clear_wal_dir() {
+  _impl_.wal_dir_.ClearToEmpty();
+}
+inline const std::string& ClusterBenchConfig::wal_dir() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.wal_dir)
+  return _internal_wal_dir();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClusterBenchConfig::set_wal_dir(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.wal_dir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.wal_dir)
+}
+inline std::string* ClusterBenchConfig::mutable_wal_dir() {
+  std::string* _s = _internal_mutable_wal_dir();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ClusterBenchConfig.wal_dir)
+  return _s;
+}
+inline const std::string& ClusterBenchConfig::_internal_wal_dir() const {
+  return _impl_.wal_dir_.Get();
+}
+inline void ClusterBenchConfig::_internal_set_wal_dir(const std::string& value) {
+  
+  _impl_.wal_dir_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClusterBenchConfig::_internal_mutable_wal_dir() {
+  
+  return _impl_.wal_dir_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClusterBenchConfig::release_wal_dir() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ClusterBenchConfig.wal_dir)
+  return _impl_.wal_dir_.Release();
+}
+inline void ClusterBenchConfig::set_allocated_wal_dir(std::string* wal_dir) {
+  if (wal_dir != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.wal_dir_.SetAllocated(wal_dir, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.wal_dir_.IsDefault()) {
+    _impl_.wal_dir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ClusterBenchConfig.wal_dir)
+}
+
+// int32 num_clients = 4;
+inline void ClusterBenchConfig::clear_num_clients() {
+  _impl_.num_clients_ = 0;
+}
+inline int32_t ClusterBenchConfig::_internal_num_clients() const {
+  return _impl_.num_clients_;
+}
+inline int32_t ClusterBenchConfig::num_clients() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.num_clients)
+  return _internal_num_clients();
+}
+inline void ClusterBenchConfig::_internal_set_num_clients(int32_t value) {
+  
+  _impl_.num_clients_ = value;
+}
+inline void ClusterBenchConfig::set_num_clients(int32_t value) {
+  _internal_set_num_clients(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.num_clients)
+}
+
+// int32 duration_s = 5;
+inline void ClusterBenchConfig::clear_duration_s() {
+  _impl_.duration_s_ = 0;
+}
+inline int32_t ClusterBenchConfig::_internal_duration_s() const {
+  return _impl_.duration_s_;
+}
+inline int32_t ClusterBenchConfig::duration_s() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.duration_s)
+  return _internal_duration_s();
+}
+inline void ClusterBenchConfig::_internal_set_duration_s(int32_t value) {
+  
+  _impl_.duration_s_ = value;
+}
+inline void ClusterBenchConfig::set_duration_s(int32_t value) {
+  _internal_set_duration_s(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.duration_s)
+}
+
+// double read_ratio = 6;
+inline void ClusterBenchConfig::clear_read_ratio() {
+  _impl_.read_ratio_ = 0;
+}
+inline double ClusterBenchConfig::_internal_read_ratio() const {
+  return _impl_.read_ratio_;
+}
+inline double ClusterBenchConfig::read_ratio() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.read_ratio)
+  return _internal_read_ratio();
+}
+inline void ClusterBenchConfig::_internal_set_read_ratio(double value) {
+  
+  _impl_.read_ratio_ = value;
+}
+inline void ClusterBenchConfig::set_read_ratio(double value) {
+  _internal_set_read_ratio(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.read_ratio)
+}
+
+// int32 num_keys = 7;
+inline void ClusterBenchConfig::clear_num_keys() {
+  _impl_.num_keys_ = 0;
+}
+inline int32_t ClusterBenchConfig::_internal_num_keys() const {
+  return _impl_.num_keys_;
+}
+inline int32_t ClusterBenchConfig::num_keys() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.num_keys)
+  return _internal_num_keys();
+}
+inline void ClusterBenchConfig::_internal_set_num_keys(int32_t value) {
+  
+  _impl_.num_keys_ = value;
+}
+inline void ClusterBenchConfig::set_num_keys(int32_t value) {
+  _internal_set_num_keys(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.num_keys)
+}
+
+// int32 value_size = 8;
+inline void ClusterBenchConfig::clear_value_size() {
+  _impl_.value_size_ = 0;
+}
+inline int32_t ClusterBenchConfig::_internal_value_size() const {
+  return _impl_.value_size_;
+}
+inline int32_t ClusterBenchConfig::value_size() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.value_size)
+  return _internal_value_size();
+}
+inline void ClusterBenchConfig::_internal_set_value_size(int32_t value) {
+  
+  _impl_.value_size_ = value;
+}
+inline void ClusterBenchConfig::set_value_size(int32_t value) {
+  _internal_set_value_size(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.value_size)
+}
+
+// repeated .keyvaluestore.ClusterEvent events = 9;
+inline int ClusterBenchConfig::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int ClusterBenchConfig::events_size() const {
+  return _internal_events_size();
+}
+inline void ClusterBenchConfig::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::keyvaluestore::ClusterEvent* ClusterBenchConfig::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ClusterBenchConfig.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::ClusterEvent >*
+ClusterBenchConfig::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.ClusterBenchConfig.events)
+  return &_impl_.events_;
+}
+inline const ::keyvaluestore::ClusterEvent& ClusterBenchConfig::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::keyvaluestore::ClusterEvent& ClusterBenchConfig::events(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.events)
+  return _internal_events(index);
+}
+inline ::keyvaluestore::ClusterEvent* ClusterBenchConfig::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::keyvaluestore::ClusterEvent* ClusterBenchConfig::add_events() {
+  ::keyvaluestore::ClusterEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:keyvaluestore.ClusterBenchConfig.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::ClusterEvent >&
+ClusterBenchConfig::events() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.ClusterBenchConfig.events)
+  return _impl_.events_;
+}
+
+// int64 seed = 10;
+inline void ClusterBenchConfig::clear_seed() {
+  _impl_.seed_ = int64_t{0};
+}
+inline int64_t ClusterBenchConfig::_internal_seed() const {
+  return _impl_.seed_;
+}
+inline int64_t ClusterBenchConfig::seed() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.seed)
+  return _internal_seed();
+}
+inline void ClusterBenchConfig::_internal_set_seed(int64_t value) {
+  
+  _impl_.seed_ = value;
+}
+inline void ClusterBenchConfig::set_seed(int64_t value) {
+  _internal_set_seed(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.seed)
+}
+
+// bool session_reads = 11;
+inline void ClusterBenchConfig::clear_session_reads() {
+  _impl_.session_reads_ = false;
+}
+inline bool ClusterBenchConfig::_internal_session_reads() const {
+  return _impl_.session_reads_;
+}
+inline bool ClusterBenchConfig::session_reads() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ClusterBenchConfig.session_reads)
+  return _internal_session_reads();
+}
+inline void ClusterBenchConfig::_internal_set_session_reads(bool value) {
+  
+  _impl_.session_reads_ = value;
+}
+inline void ClusterBenchConfig::set_session_reads(bool value) {
+  _internal_set_session_reads(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ClusterBenchConfig.session_reads)
+}
+
+// -------------------------------------------------------------------
+
+// GetRequest
+
+// string key = 1;
+inline void GetRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetRequest.key)
+}
+inline std::string* GetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetRequest.key)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.GetRequest.key)
+  return _impl_.key_.Release();
+}
+inline void GetRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.GetRequest.key)
+}
+
+// optional int32 min_slot = 2;
+inline bool GetRequest::_internal_has_min_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetRequest::has_min_slot() const {
+  return _internal_has_min_slot();
+}
+inline void GetRequest::clear_min_slot() {
+  _impl_.min_slot_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t GetRequest::_internal_min_slot() const {
+  return _impl_.min_slot_;
+}
+inline int32_t GetRequest::min_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetRequest.min_slot)
+  return _internal_min_slot();
+}
+inline void GetRequest::_internal_set_min_slot(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_slot_ = value;
+}
+inline void GetRequest::set_min_slot(int32_t value) {
+  _internal_set_min_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetRequest.min_slot)
+}
+
+// .keyvaluestore.WriteToken min_version = 3;
+inline bool GetRequest::_internal_has_min_version() const {
+  return this != internal_default_instance() && _impl_.min_version_ != nullptr;
+}
+inline bool GetRequest::has_min_version() const {
+  return _internal_has_min_version();
+}
+inline void GetRequest::clear_min_version() {
+  if (GetArenaForAllocation() == nullptr && _impl_.min_version_ != nullptr) {
+    delete _impl_.min_version_;
+  }
+  _impl_.min_version_ = nullptr;
+}
+inline const ::keyvaluestore::WriteToken& GetRequest::_internal_min_version() const {
+  const ::keyvaluestore::WriteToken* p = _impl_.min_version_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::WriteToken&>(
+      ::keyvaluestore::_WriteToken_default_instance_);
+}
+inline const ::keyvaluestore::WriteToken& GetRequest::min_version() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetRequest.min_version)
+  return _internal_min_version();
+}
+inline void GetRequest::unsafe_arena_set_allocated_min_version(
+    ::keyvaluestore::WriteToken* min_version) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_version_);
+  }
+  _impl_.min_version_ = min_version;
+  if (min_version) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.GetRequest.min_version)
+}
+inline ::keyvaluestore::WriteToken* GetRequest::release_min_version() {
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.min_version_;
+  _impl_.min_version_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* GetRequest::unsafe_arena_release_min_version() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.GetRequest.min_version)
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.min_version_;
+  _impl_.min_version_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* GetRequest::_internal_mutable_min_version() {
+  
+  if (_impl_.min_version_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::WriteToken>(GetArenaForAllocation());
+    _impl_.min_version_ = p;
+  }
+  return _impl_.min_version_;
+}
+inline ::keyvaluestore::WriteToken* GetRequest::mutable_min_version() {
+  ::keyvaluestore::WriteToken* _msg = _internal_mutable_min_version();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetRequest.min_version)
+  return _msg;
+}
+inline void GetRequest::set_allocated_min_version(::keyvaluestore::WriteToken* min_version) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.min_version_;
+  }
+  if (min_version) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(min_version);
+    if (message_arena != submessage_arena) {
+      min_version = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_version, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.min_version_ = min_version;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.GetRequest.min_version)
+}
+
+// -------------------------------------------------------------------
+
+// GetResponse
+
+// string value = 1;
+inline void GetResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetResponse::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetResponse.value)
+}
+inline std::string* GetResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetResponse.value)
+  return _s;
+}
+inline const std::string& GetResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetResponse::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.GetResponse.value)
+  return _impl_.value_.Release();
+}
+inline void GetResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.GetResponse.value)
+}
+
+// -------------------------------------------------------------------
+
+// PutRequest
+
+// string key = 1;
+inline void PutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PutRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.PutRequest.key)
+}
+inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PutRequest.key)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.PutRequest.key)
+  return _impl_.key_.Release();
+}
+inline void PutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.PutRequest.key)
+}
+
+// string value = 2;
+inline void PutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutRequest::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PutRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.PutRequest.value)
+}
+inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PutRequest.value)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.PutRequest.value)
+  return _impl_.value_.Release();
+}
+inline void PutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.PutRequest.value)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteRequest
+
+// string key = 1;
+inline void DeleteRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.DeleteRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.DeleteRequest.key)
+}
+inline std::string* DeleteRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.DeleteRequest.key)
+  return _s;
+}
+inline const std::string& DeleteRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DeleteRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.DeleteRequest.key)
+  return _impl_.key_.Release();
+}
+inline void DeleteRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.DeleteRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetRequest
+
+// repeated string keys = 1;
+inline int MultiGetRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiGetRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiGetRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiGetRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:keyvaluestore.MultiGetRequest.keys)
+  return _s;
+}
+inline const std::string& MultiGetRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiGetRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiGetRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiGetRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.MultiGetRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiGetRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keyvaluestore.MultiGetRequest.keys)
+}
+inline std::string* MultiGetRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiGetRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keyvaluestore.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keyvaluestore.MultiGetRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiGetRequest::keys() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.MultiGetRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiGetRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.MultiGetRequest.keys)
+  return &_impl_.keys_;
+}
+
+// optional int32 min_slot = 2;
+inline bool MultiGetRequest::_internal_has_min_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MultiGetRequest::has_min_slot() const {
+  return _internal_has_min_slot();
+}
+inline void MultiGetRequest::clear_min_slot() {
+  _impl_.min_slot_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t MultiGetRequest::_internal_min_slot() const {
+  return _impl_.min_slot_;
+}
+inline int32_t MultiGetRequest::min_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiGetRequest.min_slot)
+  return _internal_min_slot();
+}
+inline void MultiGetRequest::_internal_set_min_slot(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_slot_ = value;
+}
+inline void MultiGetRequest::set_min_slot(int32_t value) {
+  _internal_set_min_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.MultiGetRequest.min_slot)
+}
+
+// .keyvaluestore.WriteToken min_version = 3;
+inline bool MultiGetRequest::_internal_has_min_version() const {
+  return this != internal_default_instance() && _impl_.min_version_ != nullptr;
+}
+inline bool MultiGetRequest::has_min_version() const {
+  return _internal_has_min_version();
+}
+inline void MultiGetRequest::clear_min_version() {
+  if (GetArenaForAllocation() == nullptr && _impl_.min_version_ != nullptr) {
+    delete _impl_.min_version_;
+  }
+  _impl_.min_version_ = nullptr;
+}
+inline const ::keyvaluestore::WriteToken& MultiGetRequest::_internal_min_version() const {
+  const ::keyvaluestore::WriteToken* p = _impl_.min_version_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::WriteToken&>(
+      ::keyvaluestore::_WriteToken_default_instance_);
+}
+inline const ::keyvaluestore::WriteToken& MultiGetRequest::min_version() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiGetRequest.min_version)
+  return _internal_min_version();
+}
+inline void MultiGetRequest::unsafe_arena_set_allocated_min_version(
+    ::keyvaluestore::WriteToken* min_version) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_version_);
+  }
+  _impl_.min_version_ = min_version;
+  if (min_version) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.MultiGetRequest.min_version)
+}
+inline ::keyvaluestore::WriteToken* MultiGetRequest::release_min_version() {
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.min_version_;
+  _impl_.min_version_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* MultiGetRequest::unsafe_arena_release_min_version() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.MultiGetRequest.min_version)
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.min_version_;
+  _impl_.min_version_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* MultiGetRequest::_internal_mutable_min_version() {
+  
+  if (_impl_.min_version_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::WriteToken>(GetArenaForAllocation());
+    _impl_.min_version_ = p;
+  }
+  return _impl_.min_version_;
+}
+inline ::keyvaluestore::WriteToken* MultiGetRequest::mutable_min_version() {
+  ::keyvaluestore::WriteToken* _msg = _internal_mutable_min_version();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.MultiGetRequest.min_version)
+  return _msg;
+}
+inline void MultiGetRequest::set_allocated_min_version(::keyvaluestore::WriteToken* min_version) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.min_version_;
+  }
+  if (min_version) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(min_version);
+    if (message_arena != submessage_arena) {
+      min_version = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_version, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.min_version_ = min_version;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.MultiGetRequest.min_version)
+}
+
+// -------------------------------------------------------------------
+
+// KeyValue
+
+// string key = 1;
+inline void KeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.KeyValue.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.KeyValue.key)
+}
+inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.KeyValue.key)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void KeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.KeyValue.key)
+  return _impl_.key_.Release();
+}
+inline void KeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.KeyValue.key)
+}
+
+// string value = 2;
+inline void KeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.KeyValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.KeyValue.value)
+}
+inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.KeyValue.value)
+  return _s;
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeyValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.KeyValue.value)
+  return _impl_.value_.Release();
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.KeyValue.value)
+}
+
+// bool found = 3;
+inline void KeyValue::clear_found() {
+  _impl_.found_ = false;
+}
+inline bool KeyValue::_internal_found() const {
+  return _impl_.found_;
+}
+inline bool KeyValue::found() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.KeyValue.found)
+  return _internal_found();
+}
+inline void KeyValue::_internal_set_found(bool value) {
+  
+  _impl_.found_ = value;
+}
+inline void KeyValue::set_found(bool value) {
+  _internal_set_found(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.KeyValue.found)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetResponse
+
+// repeated .keyvaluestore.KeyValue pairs = 1;
+inline int MultiGetResponse::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
+}
+inline int MultiGetResponse::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void MultiGetResponse::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::keyvaluestore::KeyValue* MultiGetResponse::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.MultiGetResponse.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::KeyValue >*
+MultiGetResponse::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.MultiGetResponse.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::keyvaluestore::KeyValue& MultiGetResponse::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::keyvaluestore::KeyValue& MultiGetResponse::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiGetResponse.pairs)
+  return _internal_pairs(index);
+}
+inline ::keyvaluestore::KeyValue* MultiGetResponse::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::keyvaluestore::KeyValue* MultiGetResponse::add_pairs() {
+  ::keyvaluestore::KeyValue* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiGetResponse.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::KeyValue >&
+MultiGetResponse::pairs() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.MultiGetResponse.pairs)
+  return _impl_.pairs_;
+}
+
+// -------------------------------------------------------------------
+
+// MultiPutRequest
+
+// repeated .keyvaluestore.PutRequest pairs = 1;
+inline int MultiPutRequest::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
+}
+inline int MultiPutRequest::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void MultiPutRequest::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::keyvaluestore::PutRequest* MultiPutRequest::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.MultiPutRequest.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::PutRequest >*
+MultiPutRequest::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.MultiPutRequest.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::keyvaluestore::PutRequest& MultiPutRequest::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::keyvaluestore::PutRequest& MultiPutRequest::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiPutRequest.pairs)
+  return _internal_pairs(index);
+}
+inline ::keyvaluestore::PutRequest* MultiPutRequest::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::keyvaluestore::PutRequest* MultiPutRequest::add_pairs() {
+  ::keyvaluestore::PutRequest* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiPutRequest.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::PutRequest >&
+MultiPutRequest::pairs() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.MultiPutRequest.pairs)
+  return _impl_.pairs_;
+}
+
+// -------------------------------------------------------------------
+
+// MultiDeleteRequest
+
+// repeated string keys = 1;
+inline int MultiDeleteRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiDeleteRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiDeleteRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiDeleteRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:keyvaluestore.MultiDeleteRequest.keys)
+  return _s;
+}
+inline const std::string& MultiDeleteRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiDeleteRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.MultiDeleteRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiDeleteRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.MultiDeleteRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiDeleteRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline std::string* MultiDeleteRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiDeleteRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:keyvaluestore.MultiDeleteRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiDeleteRequest::keys() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.MultiDeleteRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiDeleteRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.MultiDeleteRequest.keys)
+  return &_impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteRequest
+
+// int64 id = 1;
+inline void WriteRequest::clear_id() {
+  _impl_.id_ = int64_t{0};
+}
+inline int64_t WriteRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline int64_t WriteRequest::id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteRequest.id)
+  return _internal_id();
+}
+inline void WriteRequest::_internal_set_id(int64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void WriteRequest::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WriteRequest.id)
+}
+
+// repeated .keyvaluestore.Operation operations = 2;
+inline int WriteRequest::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int WriteRequest::operations_size() const {
+  return _internal_operations_size();
+}
+inline void WriteRequest::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::keyvaluestore::Operation* WriteRequest::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WriteRequest.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+WriteRequest::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.WriteRequest.operations)
+  return &_impl_.operations_;
+}
+inline const ::keyvaluestore::Operation& WriteRequest::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& WriteRequest::operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteRequest.operations)
+  return _internal_operations(index);
+}
+inline ::keyvaluestore::Operation* WriteRequest::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::keyvaluestore::Operation* WriteRequest::add_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.WriteRequest.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+WriteRequest::operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.WriteRequest.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteResponse
+
+// int64 id = 1;
+inline void WriteResponse::clear_id() {
+  _impl_.id_ = int64_t{0};
+}
+inline int64_t WriteResponse::_internal_id() const {
+  return _impl_.id_;
+}
+inline int64_t WriteResponse::id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteResponse.id)
+  return _internal_id();
+}
+inline void WriteResponse::_internal_set_id(int64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void WriteResponse::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WriteResponse.id)
+}
+
+// int32 code = 2;
+inline void WriteResponse::clear_code() {
+  _impl_.code_ = 0;
+}
+inline int32_t WriteResponse::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t WriteResponse::code() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteResponse.code)
+  return _internal_code();
+}
+inline void WriteResponse::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void WriteResponse::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WriteResponse.code)
+}
+
+// string error_message = 3;
+inline void WriteResponse::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& WriteResponse::error_message() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteResponse.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.WriteResponse.error_message)
+}
+inline std::string* WriteResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WriteResponse.error_message)
+  return _s;
+}
+inline const std::string& WriteResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void WriteResponse::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteResponse::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteResponse::release_error_message() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WriteResponse.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void WriteResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WriteResponse.error_message)
+}
+
+// .keyvaluestore.WriteToken token = 4;
+inline bool WriteResponse::_internal_has_token() const {
+  return this != internal_default_instance() && _impl_.token_ != nullptr;
+}
+inline bool WriteResponse::has_token() const {
+  return _internal_has_token();
+}
+inline void WriteResponse::clear_token() {
+  if (GetArenaForAllocation() == nullptr && _impl_.token_ != nullptr) {
+    delete _impl_.token_;
+  }
+  _impl_.token_ = nullptr;
+}
+inline const ::keyvaluestore::WriteToken& WriteResponse::_internal_token() const {
+  const ::keyvaluestore::WriteToken* p = _impl_.token_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::WriteToken&>(
+      ::keyvaluestore::_WriteToken_default_instance_);
+}
+inline const ::keyvaluestore::WriteToken& WriteResponse::token() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteResponse.token)
+  return _internal_token();
+}
+inline void WriteResponse::unsafe_arena_set_allocated_token(
+    ::keyvaluestore::WriteToken* token) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.token_);
+  }
+  _impl_.token_ = token;
+  if (token) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WriteResponse.token)
+}
+inline ::keyvaluestore::WriteToken* WriteResponse::release_token() {
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.token_;
+  _impl_.token_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* WriteResponse::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WriteResponse.token)
+  
+  ::keyvaluestore::WriteToken* temp = _impl_.token_;
+  _impl_.token_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::WriteToken* WriteResponse::_internal_mutable_token() {
+  
+  if (_impl_.token_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::WriteToken>(GetArenaForAllocation());
+    _impl_.token_ = p;
+  }
+  return _impl_.token_;
+}
+inline ::keyvaluestore::WriteToken* WriteResponse::mutable_token() {
+  ::keyvaluestore::WriteToken* _msg = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WriteResponse.token)
+  return _msg;
+}
+inline void WriteResponse::set_allocated_token(::keyvaluestore::WriteToken* token) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.token_;
+  }
+  if (token) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(token);
+    if (message_arena != submessage_arena) {
+      token = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, token, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.token_ = token;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WriteResponse.token)
+}
+
+// -------------------------------------------------------------------
+
+// WriteBatchRequest
+
+// repeated .keyvaluestore.Operation operations = 1;
+inline int WriteBatchRequest::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int WriteBatchRequest::operations_size() const {
+  return _internal_operations_size();
+}
+inline void WriteBatchRequest::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::keyvaluestore::Operation* WriteBatchRequest::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WriteBatchRequest.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+WriteBatchRequest::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.WriteBatchRequest.operations)
+  return &_impl_.operations_;
+}
+inline const ::keyvaluestore::Operation& WriteBatchRequest::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& WriteBatchRequest::operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WriteBatchRequest.operations)
+  return _internal_operations(index);
+}
+inline ::keyvaluestore::Operation* WriteBatchRequest::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::keyvaluestore::Operation* WriteBatchRequest::add_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.WriteBatchRequest.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+WriteBatchRequest::operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.WriteBatchRequest.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// CommitResponse
+
+// int32 slot = 1;
+inline void CommitResponse::clear_slot() {
+  _impl_.slot_ = 0;
+}
+inline int32_t CommitResponse::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t CommitResponse::slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.CommitResponse.slot)
+  return _internal_slot();
+}
+inline void CommitResponse::_internal_set_slot(int32_t value) {
+  
+  _impl_.slot_ = value;
+}
+inline void CommitResponse::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.CommitResponse.slot)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// WriteToken
+
+// map<int32, int32> slots = 1;
+inline int WriteToken::_internal_slots_size() const {
+  return _impl_.slots_.size();
+}
+inline int WriteToken::slots_size() const {
+  return _internal_slots_size();
+}
+inline void WriteToken::clear_slots() {
+  _impl_.slots_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+WriteToken::_internal_slots() const {
+  return _impl_.slots_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+WriteToken::slots() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.WriteToken.slots)
+  return _internal_slots();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+WriteToken::_internal_mutable_slots() {
+  return _impl_.slots_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+WriteToken::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.WriteToken.slots)
+  return _internal_mutable_slots();
+}
+
+// -------------------------------------------------------------------
+
+// ElectCoordinatorRequest
+
+// string key = 1;
+inline void ElectCoordinatorRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ElectCoordinatorRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ElectCoordinatorRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ElectCoordinatorRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ElectCoordinatorRequest.key)
+}
+inline std::string* ElectCoordinatorRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ElectCoordinatorRequest.key)
+  return _s;
+}
+inline const std::string& ElectCoordinatorRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ElectCoordinatorRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ElectCoordinatorRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ElectCoordinatorRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ElectCoordinatorRequest.key)
+  return _impl_.key_.Release();
+}
+inline void ElectCoordinatorRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ElectCoordinatorRequest.key)
+}
+
+// string coordinator = 2;
+inline void ElectCoordinatorRequest::clear_coordinator() {
+  _impl_.coordinator_.ClearToEmpty();
+}
+inline const std::string& ElectCoordinatorRequest::coordinator() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ElectCoordinatorRequest.coordinator)
+  return _internal_coordinator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ElectCoordinatorRequest::set_coordinator(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.coordinator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ElectCoordinatorRequest.coordinator)
+}
+inline std::string* ElectCoordinatorRequest::mutable_coordinator() {
+  std::string* _s = _internal_mutable_coordinator();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ElectCoordinatorRequest.coordinator)
+  return _s;
+}
+inline const std::string& ElectCoordinatorRequest::_internal_coordinator() const {
+  return _impl_.coordinator_.Get();
+}
+inline void ElectCoordinatorRequest::_internal_set_coordinator(const std::string& value) {
+  
+  _impl_.coordinator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ElectCoordinatorRequest::_internal_mutable_coordinator() {
+  
+  return _impl_.coordinator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ElectCoordinatorRequest::release_coordinator() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ElectCoordinatorRequest.coordinator)
+  return _impl_.coordinator_.Release();
+}
+inline void ElectCoordinatorRequest::set_allocated_coordinator(std::string* coordinator) {
+  if (coordinator != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.coordinator_.SetAllocated(coordinator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coordinator_.IsDefault()) {
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ElectCoordinatorRequest.coordinator)
+}
+
+// -------------------------------------------------------------------
+
+// GetCoordinatorResponse
+
+// string coordinator = 1;
+inline void GetCoordinatorResponse::clear_coordinator() {
+  _impl_.coordinator_.ClearToEmpty();
+}
+inline const std::string& GetCoordinatorResponse::coordinator() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetCoordinatorResponse.coordinator)
+  return _internal_coordinator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCoordinatorResponse::set_coordinator(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.coordinator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetCoordinatorResponse.coordinator)
+}
+inline std::string* GetCoordinatorResponse::mutable_coordinator() {
+  std::string* _s = _internal_mutable_coordinator();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetCoordinatorResponse.coordinator)
+  return _s;
+}
+inline const std::string& GetCoordinatorResponse::_internal_coordinator() const {
+  return _impl_.coordinator_.Get();
+}
+inline void GetCoordinatorResponse::_internal_set_coordinator(const std::string& value) {
+  
+  _impl_.coordinator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCoordinatorResponse::_internal_mutable_coordinator() {
+  
+  return _impl_.coordinator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCoordinatorResponse::release_coordinator() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.GetCoordinatorResponse.coordinator)
+  return _impl_.coordinator_.Release();
+}
+inline void GetCoordinatorResponse::set_allocated_coordinator(std::string* coordinator) {
+  if (coordinator != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.coordinator_.SetAllocated(coordinator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coordinator_.IsDefault()) {
+    _impl_.coordinator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.GetCoordinatorResponse.coordinator)
+}
+
+// int32 term = 2;
+inline void GetCoordinatorResponse::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t GetCoordinatorResponse::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t GetCoordinatorResponse::term() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetCoordinatorResponse.term)
+  return _internal_term();
+}
+inline void GetCoordinatorResponse::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void GetCoordinatorResponse::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetCoordinatorResponse.term)
+}
+
+// -------------------------------------------------------------------
+
+// GetLeaderResponse
+
+// repeated .keyvaluestore.GetCoordinatorResponse groups = 1;
+inline int GetLeaderResponse::_internal_groups_size() const {
+  return _impl_.groups_.size();
+}
+inline int GetLeaderResponse::groups_size() const {
+  return _internal_groups_size();
+}
+inline void GetLeaderResponse::clear_groups() {
+  _impl_.groups_.Clear();
+}
+inline ::keyvaluestore::GetCoordinatorResponse* GetLeaderResponse::mutable_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetLeaderResponse.groups)
+  return _impl_.groups_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::GetCoordinatorResponse >*
+GetLeaderResponse::mutable_groups() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.GetLeaderResponse.groups)
+  return &_impl_.groups_;
+}
+inline const ::keyvaluestore::GetCoordinatorResponse& GetLeaderResponse::_internal_groups(int index) const {
+  return _impl_.groups_.Get(index);
+}
+inline const ::keyvaluestore::GetCoordinatorResponse& GetLeaderResponse::groups(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetLeaderResponse.groups)
+  return _internal_groups(index);
+}
+inline ::keyvaluestore::GetCoordinatorResponse* GetLeaderResponse::_internal_add_groups() {
+  return _impl_.groups_.Add();
+}
+inline ::keyvaluestore::GetCoordinatorResponse* GetLeaderResponse::add_groups() {
+  ::keyvaluestore::GetCoordinatorResponse* _add = _internal_add_groups();
+  // @@protoc_insertion_point(field_add:keyvaluestore.GetLeaderResponse.groups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::GetCoordinatorResponse >&
+GetLeaderResponse::groups() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.GetLeaderResponse.groups)
+  return _impl_.groups_;
+}
+
+// -------------------------------------------------------------------
+
+// ReadIndexRequest
+
+// -------------------------------------------------------------------
+
+// ReadIndexResponse
+
+// int32 slot = 1;
+inline void ReadIndexResponse::clear_slot() {
+  _impl_.slot_ = 0;
+}
+inline int32_t ReadIndexResponse::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t ReadIndexResponse::slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ReadIndexResponse.slot)
+  return _internal_slot();
+}
+inline void ReadIndexResponse::_internal_set_slot(int32_t value) {
+  
+  _impl_.slot_ = value;
+}
+inline void ReadIndexResponse::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ReadIndexResponse.slot)
+}
+
+// -------------------------------------------------------------------
+
+// Operation
+
+// string key = 1;
+inline void Operation::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& Operation::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.Operation.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Operation::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.Operation.key)
+}
+inline std::string* Operation::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.Operation.key)
+  return _s;
+}
+inline const std::string& Operation::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Operation::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Operation::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Operation::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.Operation.key)
+  return _impl_.key_.Release();
+}
+inline void Operation::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.Operation.key)
+}
+
+// .keyvaluestore.OperationType type = 2;
+inline void Operation::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::keyvaluestore::OperationType Operation::_internal_type() const {
+  return static_cast< ::keyvaluestore::OperationType >(_impl_.type_);
+}
+inline ::keyvaluestore::OperationType Operation::type() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.Operation.type)
+  return _internal_type();
+}
+inline void Operation::_internal_set_type(::keyvaluestore::OperationType value) {
+  
+  _impl_.type_ = value;
+}
+inline void Operation::set_type(::keyvaluestore::OperationType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.Operation.type)
+}
+
+// string value = 3;
+inline void Operation::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& Operation::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.Operation.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Operation::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.Operation.value)
+}
+inline std::string* Operation::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.Operation.value)
+  return _s;
+}
+inline const std::string& Operation::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Operation::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Operation::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Operation::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.Operation.value)
+  return _impl_.value_.Release();
+}
+inline void Operation::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.Operation.value)
+}
+
+// -------------------------------------------------------------------
+
+// PrepareRequest
+
+// string key = 1;
+inline void PrepareRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PrepareRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PrepareRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrepareRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.PrepareRequest.key)
+}
+inline std::string* PrepareRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PrepareRequest.key)
+  return _s;
+}
+inline const std::string& PrepareRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PrepareRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrepareRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrepareRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.PrepareRequest.key)
+  return _impl_.key_.Release();
+}
+inline void PrepareRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.PrepareRequest.key)
+}
+
+// int32 round = 2;
+inline void PrepareRequest::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t PrepareRequest::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t PrepareRequest::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PrepareRequest.round)
+  return _internal_round();
+}
+inline void PrepareRequest::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void PrepareRequest::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PrepareRequest.round)
+}
+
+// int32 propose_id = 3;
+inline void PrepareRequest::clear_propose_id() {
+  _impl_.propose_id_ = 0;
+}
+inline int32_t PrepareRequest::_internal_propose_id() const {
+  return _impl_.propose_id_;
+}
+inline int32_t PrepareRequest::propose_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PrepareRequest.propose_id)
+  return _internal_propose_id();
+}
+inline void PrepareRequest::_internal_set_propose_id(int32_t value) {
+  
+  _impl_.propose_id_ = value;
+}
+inline void PrepareRequest::set_propose_id(int32_t value) {
+  _internal_set_propose_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PrepareRequest.propose_id)
+}
+
+// -------------------------------------------------------------------
+
+// PromiseResponse
+
+// int32 round = 1;
+inline void PromiseResponse::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t PromiseResponse::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t PromiseResponse::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PromiseResponse.round)
+  return _internal_round();
+}
+inline void PromiseResponse::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void PromiseResponse::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PromiseResponse.round)
+}
+
+// int32 propose_id = 2;
+inline void PromiseResponse::clear_propose_id() {
+  _impl_.propose_id_ = 0;
+}
+inline int32_t PromiseResponse::_internal_propose_id() const {
+  return _impl_.propose_id_;
+}
+inline int32_t PromiseResponse::propose_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PromiseResponse.propose_id)
+  return _internal_propose_id();
+}
+inline void PromiseResponse::_internal_set_propose_id(int32_t value) {
+  
+  _impl_.propose_id_ = value;
+}
+inline void PromiseResponse::set_propose_id(int32_t value) {
+  _internal_set_propose_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PromiseResponse.propose_id)
+}
+
+// int32 accepted_id = 3;
+inline void PromiseResponse::clear_accepted_id() {
+  _impl_.accepted_id_ = 0;
+}
+inline int32_t PromiseResponse::_internal_accepted_id() const {
+  return _impl_.accepted_id_;
+}
+inline int32_t PromiseResponse::accepted_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PromiseResponse.accepted_id)
+  return _internal_accepted_id();
+}
+inline void PromiseResponse::_internal_set_accepted_id(int32_t value) {
+  
+  _impl_.accepted_id_ = value;
+}
+inline void PromiseResponse::set_accepted_id(int32_t value) {
+  _internal_set_accepted_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PromiseResponse.accepted_id)
+}
+
+// .keyvaluestore.OperationType type = 4;
+inline void PromiseResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::keyvaluestore::OperationType PromiseResponse::_internal_type() const {
+  return static_cast< ::keyvaluestore::OperationType >(_impl_.type_);
+}
+inline ::keyvaluestore::OperationType PromiseResponse::type() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PromiseResponse.type)
+  return _internal_type();
+}
+inline void PromiseResponse::_internal_set_type(::keyvaluestore::OperationType value) {
+  
+  _impl_.type_ = value;
+}
+inline void PromiseResponse::set_type(::keyvaluestore::OperationType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PromiseResponse.type)
+}
+
+// string value = 5;
+inline void PromiseResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PromiseResponse::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PromiseResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PromiseResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.PromiseResponse.value)
+}
+inline std::string* PromiseResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PromiseResponse.value)
+  return _s;
+}
+inline const std::string& PromiseResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PromiseResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PromiseResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PromiseResponse::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.PromiseResponse.value)
+  return _impl_.value_.Release();
+}
+inline void PromiseResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.PromiseResponse.value)
+}
+
+// -------------------------------------------------------------------
+
+// ProposeRequest
+
+// string key = 1;
+inline void ProposeRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ProposeRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProposeRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ProposeRequest.key)
+}
+inline std::string* ProposeRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ProposeRequest.key)
+  return _s;
+}
+inline const std::string& ProposeRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ProposeRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProposeRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProposeRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ProposeRequest.key)
+  return _impl_.key_.Release();
+}
+inline void ProposeRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ProposeRequest.key)
+}
+
+// int32 round = 2;
+inline void ProposeRequest::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t ProposeRequest::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t ProposeRequest::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.round)
+  return _internal_round();
+}
+inline void ProposeRequest::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void ProposeRequest::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ProposeRequest.round)
+}
+
+// int32 propose_id = 3;
+inline void ProposeRequest::clear_propose_id() {
+  _impl_.propose_id_ = 0;
+}
+inline int32_t ProposeRequest::_internal_propose_id() const {
+  return _impl_.propose_id_;
+}
+inline int32_t ProposeRequest::propose_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.propose_id)
+  return _internal_propose_id();
+}
+inline void ProposeRequest::_internal_set_propose_id(int32_t value) {
+  
+  _impl_.propose_id_ = value;
+}
+inline void ProposeRequest::set_propose_id(int32_t value) {
+  _internal_set_propose_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ProposeRequest.propose_id)
+}
+
+// .keyvaluestore.OperationType type = 4;
+inline void ProposeRequest::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::keyvaluestore::OperationType ProposeRequest::_internal_type() const {
+  return static_cast< ::keyvaluestore::OperationType >(_impl_.type_);
+}
+inline ::keyvaluestore::OperationType ProposeRequest::type() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.type)
+  return _internal_type();
+}
+inline void ProposeRequest::_internal_set_type(::keyvaluestore::OperationType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ProposeRequest::set_type(::keyvaluestore::OperationType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.ProposeRequest.type)
+}
+
+// string value = 5;
+inline void ProposeRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& ProposeRequest::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProposeRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.ProposeRequest.value)
+}
+inline std::string* ProposeRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ProposeRequest.value)
+  return _s;
+}
+inline const std::string& ProposeRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void ProposeRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProposeRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProposeRequest::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.ProposeRequest.value)
+  return _impl_.value_.Release();
+}
+inline void ProposeRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.ProposeRequest.value)
+}
+
+// repeated .keyvaluestore.Operation operations = 6;
+inline int ProposeRequest::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int ProposeRequest::operations_size() const {
+  return _internal_operations_size();
+}
+inline void ProposeRequest::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::keyvaluestore::Operation* ProposeRequest::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.ProposeRequest.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+ProposeRequest::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.ProposeRequest.operations)
+  return &_impl_.operations_;
+}
+inline const ::keyvaluestore::Operation& ProposeRequest::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& ProposeRequest::operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.ProposeRequest.operations)
+  return _internal_operations(index);
+}
+inline ::keyvaluestore::Operation* ProposeRequest::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::keyvaluestore::Operation* ProposeRequest::add_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.ProposeRequest.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+ProposeRequest::operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.ProposeRequest.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// AcceptResponse
+
+// int32 round = 1;
+inline void AcceptResponse::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t AcceptResponse::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t AcceptResponse::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.AcceptResponse.round)
+  return _internal_round();
+}
+inline void AcceptResponse::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void AcceptResponse::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.AcceptResponse.round)
+}
+
+// int32 propose_id = 2;
+inline void AcceptResponse::clear_propose_id() {
+  _impl_.propose_id_ = 0;
+}
+inline int32_t AcceptResponse::_internal_propose_id() const {
+  return _impl_.propose_id_;
+}
+inline int32_t AcceptResponse::propose_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.AcceptResponse.propose_id)
+  return _internal_propose_id();
+}
+inline void AcceptResponse::_internal_set_propose_id(int32_t value) {
+  
+  _impl_.propose_id_ = value;
+}
+inline void AcceptResponse::set_propose_id(int32_t value) {
+  _internal_set_propose_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.AcceptResponse.propose_id)
+}
+
+// .keyvaluestore.OperationType type = 3;
+inline void AcceptResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::keyvaluestore::OperationType AcceptResponse::_internal_type() const {
+  return static_cast< ::keyvaluestore::OperationType >(_impl_.type_);
+}
+inline ::keyvaluestore::OperationType AcceptResponse::type() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.AcceptResponse.type)
+  return _internal_type();
+}
+inline void AcceptResponse::_internal_set_type(::keyvaluestore::OperationType value) {
+  
+  _impl_.type_ = value;
+}
+inline void AcceptResponse::set_type(::keyvaluestore::OperationType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.AcceptResponse.type)
+}
+
+// string value = 4;
+inline void AcceptResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& AcceptResponse::value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.AcceptResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AcceptResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.AcceptResponse.value)
+}
+inline std::string* AcceptResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.AcceptResponse.value)
+  return _s;
+}
+inline const std::string& AcceptResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void AcceptResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AcceptResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AcceptResponse::release_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.AcceptResponse.value)
+  return _impl_.value_.Release();
+}
+inline void AcceptResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.AcceptResponse.value)
+}
+
+// repeated .keyvaluestore.Operation operations = 5;
+inline int AcceptResponse::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int AcceptResponse::operations_size() const {
+  return _internal_operations_size();
+}
+inline void AcceptResponse::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::keyvaluestore::Operation* AcceptResponse::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.AcceptResponse.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+AcceptResponse::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.AcceptResponse.operations)
+  return &_impl_.operations_;
+}
+inline const ::keyvaluestore::Operation& AcceptResponse::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& AcceptResponse::operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.AcceptResponse.operations)
+  return _internal_operations(index);
+}
+inline ::keyvaluestore::Operation* AcceptResponse::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::keyvaluestore::Operation* AcceptResponse::add_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.AcceptResponse.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+AcceptResponse::operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.AcceptResponse.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// InformRequest
+
+// string key = 1;
+inline void InformRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& InformRequest::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.InformRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InformRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.InformRequest.key)
+}
+inline std::string* InformRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.InformRequest.key)
+  return _s;
+}
+inline const std::string& InformRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void InformRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InformRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InformRequest::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.InformRequest.key)
+  return _impl_.key_.Release();
+}
+inline void InformRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.InformRequest.key)
+}
+
+// .keyvaluestore.AcceptResponse acceptance = 2;
+inline bool InformRequest::_internal_has_acceptance() const {
+  return this != internal_default_instance() && _impl_.acceptance_ != nullptr;
+}
+inline bool InformRequest::has_acceptance() const {
+  return _internal_has_acceptance();
+}
+inline void InformRequest::clear_acceptance() {
+  if (GetArenaForAllocation() == nullptr && _impl_.acceptance_ != nullptr) {
+    delete _impl_.acceptance_;
+  }
+  _impl_.acceptance_ = nullptr;
+}
+inline const ::keyvaluestore::AcceptResponse& InformRequest::_internal_acceptance() const {
+  const ::keyvaluestore::AcceptResponse* p = _impl_.acceptance_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::AcceptResponse&>(
+      ::keyvaluestore::_AcceptResponse_default_instance_);
+}
+inline const ::keyvaluestore::AcceptResponse& InformRequest::acceptance() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.InformRequest.acceptance)
+  return _internal_acceptance();
+}
+inline void InformRequest::unsafe_arena_set_allocated_acceptance(
+    ::keyvaluestore::AcceptResponse* acceptance) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acceptance_);
+  }
+  _impl_.acceptance_ = acceptance;
+  if (acceptance) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.InformRequest.acceptance)
+}
+inline ::keyvaluestore::AcceptResponse* InformRequest::release_acceptance() {
+  
+  ::keyvaluestore::AcceptResponse* temp = _impl_.acceptance_;
+  _impl_.acceptance_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::AcceptResponse* InformRequest::unsafe_arena_release_acceptance() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.InformRequest.acceptance)
+  
+  ::keyvaluestore::AcceptResponse* temp = _impl_.acceptance_;
+  _impl_.acceptance_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::AcceptResponse* InformRequest::_internal_mutable_acceptance() {
+  
+  if (_impl_.acceptance_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::AcceptResponse>(GetArenaForAllocation());
+    _impl_.acceptance_ = p;
+  }
+  return _impl_.acceptance_;
+}
+inline ::keyvaluestore::AcceptResponse* InformRequest::mutable_acceptance() {
+  ::keyvaluestore::AcceptResponse* _msg = _internal_mutable_acceptance();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.InformRequest.acceptance)
+  return _msg;
+}
+inline void InformRequest::set_allocated_acceptance(::keyvaluestore::AcceptResponse* acceptance) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acceptance_;
+  }
+  if (acceptance) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acceptance);
+    if (message_arena != submessage_arena) {
+      acceptance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acceptance, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.acceptance_ = acceptance;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.InformRequest.acceptance)
+}
+
+// int32 compactable_slot = 3;
+inline void InformRequest::clear_compactable_slot() {
+  _impl_.compactable_slot_ = 0;
+}
+inline int32_t InformRequest::_internal_compactable_slot() const {
+  return _impl_.compactable_slot_;
+}
+inline int32_t InformRequest::compactable_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.InformRequest.compactable_slot)
+  return _internal_compactable_slot();
+}
+inline void InformRequest::_internal_set_compactable_slot(int32_t value) {
+  
+  _impl_.compactable_slot_ = value;
+}
+inline void InformRequest::set_compactable_slot(int32_t value) {
+  _internal_set_compactable_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.InformRequest.compactable_slot)
+}
+
+// -------------------------------------------------------------------
+
+// InformResponse
+
+// int32 applied_slot = 1;
+inline void InformResponse::clear_applied_slot() {
+  _impl_.applied_slot_ = 0;
+}
+inline int32_t InformResponse::_internal_applied_slot() const {
+  return _impl_.applied_slot_;
+}
+inline int32_t InformResponse::applied_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.InformResponse.applied_slot)
+  return _internal_applied_slot();
+}
+inline void InformResponse::_internal_set_applied_slot(int32_t value) {
+  
+  _impl_.applied_slot_ = value;
+}
+inline void InformResponse::set_applied_slot(int32_t value) {
+  _internal_set_applied_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.InformResponse.applied_slot)
+}
+
+// -------------------------------------------------------------------
+
+// PaxosLog
+
+// int32 promised_id = 1;
+inline void PaxosLog::clear_promised_id() {
+  _impl_.promised_id_ = 0;
+}
+inline int32_t PaxosLog::_internal_promised_id() const {
+  return _impl_.promised_id_;
+}
+inline int32_t PaxosLog::promised_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.promised_id)
+  return _internal_promised_id();
+}
+inline void PaxosLog::_internal_set_promised_id(int32_t value) {
+  
+  _impl_.promised_id_ = value;
+}
+inline void PaxosLog::set_promised_id(int32_t value) {
+  _internal_set_promised_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PaxosLog.promised_id)
+}
+
+// int32 accepted_id = 2;
+inline void PaxosLog::clear_accepted_id() {
+  _impl_.accepted_id_ = 0;
+}
+inline int32_t PaxosLog::_internal_accepted_id() const {
+  return _impl_.accepted_id_;
+}
+inline int32_t PaxosLog::accepted_id() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.accepted_id)
+  return _internal_accepted_id();
+}
+inline void PaxosLog::_internal_set_accepted_id(int32_t value) {
+  
+  _impl_.accepted_id_ = value;
+}
+inline void PaxosLog::set_accepted_id(int32_t value) {
+  _internal_set_accepted_id(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PaxosLog.accepted_id)
+}
+
+// .keyvaluestore.OperationType accepted_type = 3;
+inline void PaxosLog::clear_accepted_type() {
+  _impl_.accepted_type_ = 0;
+}
+inline ::keyvaluestore::OperationType PaxosLog::_internal_accepted_type() const {
+  return static_cast< ::keyvaluestore::OperationType >(_impl_.accepted_type_);
+}
+inline ::keyvaluestore::OperationType PaxosLog::accepted_type() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.accepted_type)
+  return _internal_accepted_type();
+}
+inline void PaxosLog::_internal_set_accepted_type(::keyvaluestore::OperationType value) {
+  
+  _impl_.accepted_type_ = value;
+}
+inline void PaxosLog::set_accepted_type(::keyvaluestore::OperationType value) {
+  _internal_set_accepted_type(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PaxosLog.accepted_type)
+}
+
+// string accepted_value = 4;
+inline void PaxosLog::clear_accepted_value() {
+  _impl_.accepted_value_.ClearToEmpty();
+}
+inline const std::string& PaxosLog::accepted_value() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.accepted_value)
+  return _internal_accepted_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PaxosLog::set_accepted_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.accepted_value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.PaxosLog.accepted_value)
+}
+inline std::string* PaxosLog::mutable_accepted_value() {
+  std::string* _s = _internal_mutable_accepted_value();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PaxosLog.accepted_value)
+  return _s;
+}
+inline const std::string& PaxosLog::_internal_accepted_value() const {
+  return _impl_.accepted_value_.Get();
+}
+inline void PaxosLog::_internal_set_accepted_value(const std::string& value) {
+  
+  _impl_.accepted_value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PaxosLog::_internal_mutable_accepted_value() {
+  
+  return _impl_.accepted_value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PaxosLog::release_accepted_value() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.PaxosLog.accepted_value)
+  return _impl_.accepted_value_.Release();
+}
+inline void PaxosLog::set_allocated_accepted_value(std::string* accepted_value) {
+  if (accepted_value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.accepted_value_.SetAllocated(accepted_value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.accepted_value_.IsDefault()) {
+    _impl_.accepted_value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.PaxosLog.accepted_value)
+}
+
+// bool chosen = 5;
+inline void PaxosLog::clear_chosen() {
+  _impl_.chosen_ = false;
+}
+inline bool PaxosLog::_internal_chosen() const {
+  return _impl_.chosen_;
+}
+inline bool PaxosLog::chosen() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.chosen)
+  return _internal_chosen();
+}
+inline void PaxosLog::_internal_set_chosen(bool value) {
+  
+  _impl_.chosen_ = value;
+}
+inline void PaxosLog::set_chosen(bool value) {
+  _internal_set_chosen(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.PaxosLog.chosen)
+}
+
+// repeated .keyvaluestore.Operation accepted_operations = 6;
+inline int PaxosLog::_internal_accepted_operations_size() const {
+  return _impl_.accepted_operations_.size();
+}
+inline int PaxosLog::accepted_operations_size() const {
+  return _internal_accepted_operations_size();
+}
+inline void PaxosLog::clear_accepted_operations() {
+  _impl_.accepted_operations_.Clear();
+}
+inline ::keyvaluestore::Operation* PaxosLog::mutable_accepted_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.PaxosLog.accepted_operations)
+  return _impl_.accepted_operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+PaxosLog::mutable_accepted_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.PaxosLog.accepted_operations)
+  return &_impl_.accepted_operations_;
+}
+inline const ::keyvaluestore::Operation& PaxosLog::_internal_accepted_operations(int index) const {
+  return _impl_.accepted_operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& PaxosLog::accepted_operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.PaxosLog.accepted_operations)
+  return _internal_accepted_operations(index);
+}
+inline ::keyvaluestore::Operation* PaxosLog::_internal_add_accepted_operations() {
+  return _impl_.accepted_operations_.Add();
+}
+inline ::keyvaluestore::Operation* PaxosLog::add_accepted_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_accepted_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.PaxosLog.accepted_operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+PaxosLog::accepted_operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.PaxosLog.accepted_operations)
+  return _impl_.accepted_operations_;
+}
+
+// -------------------------------------------------------------------
+
+// LeaderPrepareRequest
+
+// int32 ballot = 1;
+inline void LeaderPrepareRequest::clear_ballot() {
+  _impl_.ballot_ = 0;
+}
+inline int32_t LeaderPrepareRequest::_internal_ballot() const {
+  return _impl_.ballot_;
+}
+inline int32_t LeaderPrepareRequest::ballot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPrepareRequest.ballot)
+  return _internal_ballot();
+}
+inline void LeaderPrepareRequest::_internal_set_ballot(int32_t value) {
+  
+  _impl_.ballot_ = value;
+}
+inline void LeaderPrepareRequest::set_ballot(int32_t value) {
+  _internal_set_ballot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LeaderPrepareRequest.ballot)
+}
+
+// int32 from_slot = 2;
+inline void LeaderPrepareRequest::clear_from_slot() {
+  _impl_.from_slot_ = 0;
+}
+inline int32_t LeaderPrepareRequest::_internal_from_slot() const {
+  return _impl_.from_slot_;
+}
+inline int32_t LeaderPrepareRequest::from_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPrepareRequest.from_slot)
+  return _internal_from_slot();
+}
+inline void LeaderPrepareRequest::_internal_set_from_slot(int32_t value) {
+  
+  _impl_.from_slot_ = value;
+}
+inline void LeaderPrepareRequest::set_from_slot(int32_t value) {
+  _internal_set_from_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LeaderPrepareRequest.from_slot)
+}
+
+// -------------------------------------------------------------------
+
+// LeaderPromiseResponse_Accepted
+
+// int32 slot = 1;
+inline void LeaderPromiseResponse_Accepted::clear_slot() {
+  _impl_.slot_ = 0;
+}
+inline int32_t LeaderPromiseResponse_Accepted::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t LeaderPromiseResponse_Accepted::slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPromiseResponse.Accepted.slot)
+  return _internal_slot();
+}
+inline void LeaderPromiseResponse_Accepted::_internal_set_slot(int32_t value) {
+  
+  _impl_.slot_ = value;
+}
+inline void LeaderPromiseResponse_Accepted::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LeaderPromiseResponse.Accepted.slot)
+}
+
+// .keyvaluestore.PaxosLog log = 2;
+inline bool LeaderPromiseResponse_Accepted::_internal_has_log() const {
+  return this != internal_default_instance() && _impl_.log_ != nullptr;
+}
+inline bool LeaderPromiseResponse_Accepted::has_log() const {
+  return _internal_has_log();
+}
+inline void LeaderPromiseResponse_Accepted::clear_log() {
+  if (GetArenaForAllocation() == nullptr && _impl_.log_ != nullptr) {
+    delete _impl_.log_;
+  }
+  _impl_.log_ = nullptr;
+}
+inline const ::keyvaluestore::PaxosLog& LeaderPromiseResponse_Accepted::_internal_log() const {
+  const ::keyvaluestore::PaxosLog* p = _impl_.log_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::PaxosLog&>(
+      ::keyvaluestore::_PaxosLog_default_instance_);
+}
+inline const ::keyvaluestore::PaxosLog& LeaderPromiseResponse_Accepted::log() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPromiseResponse.Accepted.log)
+  return _internal_log();
+}
+inline void LeaderPromiseResponse_Accepted::unsafe_arena_set_allocated_log(
+    ::keyvaluestore::PaxosLog* log) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.log_);
+  }
+  _impl_.log_ = log;
+  if (log) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.LeaderPromiseResponse.Accepted.log)
+}
+inline ::keyvaluestore::PaxosLog* LeaderPromiseResponse_Accepted::release_log() {
+  
+  ::keyvaluestore::PaxosLog* temp = _impl_.log_;
+  _impl_.log_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::PaxosLog* LeaderPromiseResponse_Accepted::unsafe_arena_release_log() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.LeaderPromiseResponse.Accepted.log)
+  
+  ::keyvaluestore::PaxosLog* temp = _impl_.log_;
+  _impl_.log_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::PaxosLog* LeaderPromiseResponse_Accepted::_internal_mutable_log() {
+  
+  if (_impl_.log_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::PaxosLog>(GetArenaForAllocation());
+    _impl_.log_ = p;
+  }
+  return _impl_.log_;
+}
+inline ::keyvaluestore::PaxosLog* LeaderPromiseResponse_Accepted::mutable_log() {
+  ::keyvaluestore::PaxosLog* _msg = _internal_mutable_log();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.LeaderPromiseResponse.Accepted.log)
+  return _msg;
+}
+inline void LeaderPromiseResponse_Accepted::set_allocated_log(::keyvaluestore::PaxosLog* log) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.log_;
+  }
+  if (log) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(log);
+    if (message_arena != submessage_arena) {
+      log = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, log, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.log_ = log;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.LeaderPromiseResponse.Accepted.log)
+}
+
+// -------------------------------------------------------------------
+
+// LeaderPromiseResponse
+
+// int32 ballot = 1;
+inline void LeaderPromiseResponse::clear_ballot() {
+  _impl_.ballot_ = 0;
+}
+inline int32_t LeaderPromiseResponse::_internal_ballot() const {
+  return _impl_.ballot_;
+}
+inline int32_t LeaderPromiseResponse::ballot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPromiseResponse.ballot)
+  return _internal_ballot();
+}
+inline void LeaderPromiseResponse::_internal_set_ballot(int32_t value) {
+  
+  _impl_.ballot_ = value;
+}
+inline void LeaderPromiseResponse::set_ballot(int32_t value) {
+  _internal_set_ballot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LeaderPromiseResponse.ballot)
+}
+
+// repeated .keyvaluestore.LeaderPromiseResponse.Accepted accepted = 2;
+inline int LeaderPromiseResponse::_internal_accepted_size() const {
+  return _impl_.accepted_.size();
+}
+inline int LeaderPromiseResponse::accepted_size() const {
+  return _internal_accepted_size();
+}
+inline void LeaderPromiseResponse::clear_accepted() {
+  _impl_.accepted_.Clear();
+}
+inline ::keyvaluestore::LeaderPromiseResponse_Accepted* LeaderPromiseResponse::mutable_accepted(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.LeaderPromiseResponse.accepted)
+  return _impl_.accepted_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::LeaderPromiseResponse_Accepted >*
+LeaderPromiseResponse::mutable_accepted() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.LeaderPromiseResponse.accepted)
+  return &_impl_.accepted_;
+}
+inline const ::keyvaluestore::LeaderPromiseResponse_Accepted& LeaderPromiseResponse::_internal_accepted(int index) const {
+  return _impl_.accepted_.Get(index);
+}
+inline const ::keyvaluestore::LeaderPromiseResponse_Accepted& LeaderPromiseResponse::accepted(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPromiseResponse.accepted)
+  return _internal_accepted(index);
+}
+inline ::keyvaluestore::LeaderPromiseResponse_Accepted* LeaderPromiseResponse::_internal_add_accepted() {
+  return _impl_.accepted_.Add();
+}
+inline ::keyvaluestore::LeaderPromiseResponse_Accepted* LeaderPromiseResponse::add_accepted() {
+  ::keyvaluestore::LeaderPromiseResponse_Accepted* _add = _internal_add_accepted();
+  // @@protoc_insertion_point(field_add:keyvaluestore.LeaderPromiseResponse.accepted)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::LeaderPromiseResponse_Accepted >&
+LeaderPromiseResponse::accepted() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.LeaderPromiseResponse.accepted)
+  return _impl_.accepted_;
+}
+
+// int32 compacted_slot = 3;
+inline void LeaderPromiseResponse::clear_compacted_slot() {
+  _impl_.compacted_slot_ = 0;
+}
+inline int32_t LeaderPromiseResponse::_internal_compacted_slot() const {
+  return _impl_.compacted_slot_;
+}
+inline int32_t LeaderPromiseResponse::compacted_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LeaderPromiseResponse.compacted_slot)
+  return _internal_compacted_slot();
+}
+inline void LeaderPromiseResponse::_internal_set_compacted_slot(int32_t value) {
+  
+  _impl_.compacted_slot_ = value;
+}
+inline void LeaderPromiseResponse::set_compacted_slot(int32_t value) {
+  _internal_set_compacted_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LeaderPromiseResponse.compacted_slot)
+}
+
+// -------------------------------------------------------------------
+
+// GetChosenRequest
+
+// int32 from_slot = 1;
+inline void GetChosenRequest::clear_from_slot() {
+  _impl_.from_slot_ = 0;
+}
+inline int32_t GetChosenRequest::_internal_from_slot() const {
+  return _impl_.from_slot_;
+}
+inline int32_t GetChosenRequest::from_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetChosenRequest.from_slot)
+  return _internal_from_slot();
+}
+inline void GetChosenRequest::_internal_set_from_slot(int32_t value) {
+  
+  _impl_.from_slot_ = value;
+}
+inline void GetChosenRequest::set_from_slot(int32_t value) {
+  _internal_set_from_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetChosenRequest.from_slot)
+}
+
+// int32 to_slot = 2;
+inline void GetChosenRequest::clear_to_slot() {
+  _impl_.to_slot_ = 0;
+}
+inline int32_t GetChosenRequest::_internal_to_slot() const {
+  return _impl_.to_slot_;
+}
+inline int32_t GetChosenRequest::to_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetChosenRequest.to_slot)
+  return _internal_to_slot();
+}
+inline void GetChosenRequest::_internal_set_to_slot(int32_t value) {
+  
+  _impl_.to_slot_ = value;
+}
+inline void GetChosenRequest::set_to_slot(int32_t value) {
+  _internal_set_to_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetChosenRequest.to_slot)
+}
+
+// -------------------------------------------------------------------
+
+// GetChosenResponse
+
+// repeated .keyvaluestore.AcceptResponse slots = 1;
+inline int GetChosenResponse::_internal_slots_size() const {
+  return _impl_.slots_.size();
+}
+inline int GetChosenResponse::slots_size() const {
+  return _internal_slots_size();
+}
+inline void GetChosenResponse::clear_slots() {
+  _impl_.slots_.Clear();
+}
+inline ::keyvaluestore::AcceptResponse* GetChosenResponse::mutable_slots(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.GetChosenResponse.slots)
+  return _impl_.slots_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::AcceptResponse >*
+GetChosenResponse::mutable_slots() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.GetChosenResponse.slots)
+  return &_impl_.slots_;
+}
+inline const ::keyvaluestore::AcceptResponse& GetChosenResponse::_internal_slots(int index) const {
+  return _impl_.slots_.Get(index);
+}
+inline const ::keyvaluestore::AcceptResponse& GetChosenResponse::slots(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetChosenResponse.slots)
+  return _internal_slots(index);
+}
+inline ::keyvaluestore::AcceptResponse* GetChosenResponse::_internal_add_slots() {
+  return _impl_.slots_.Add();
+}
+inline ::keyvaluestore::AcceptResponse* GetChosenResponse::add_slots() {
+  ::keyvaluestore::AcceptResponse* _add = _internal_add_slots();
+  // @@protoc_insertion_point(field_add:keyvaluestore.GetChosenResponse.slots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::AcceptResponse >&
+GetChosenResponse::slots() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.GetChosenResponse.slots)
+  return _impl_.slots_;
+}
+
+// int32 compacted_slot = 2;
+inline void GetChosenResponse::clear_compacted_slot() {
+  _impl_.compacted_slot_ = 0;
+}
+inline int32_t GetChosenResponse::_internal_compacted_slot() const {
+  return _impl_.compacted_slot_;
+}
+inline int32_t GetChosenResponse::compacted_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.GetChosenResponse.compacted_slot)
+  return _internal_compacted_slot();
+}
+inline void GetChosenResponse::_internal_set_compacted_slot(int32_t value) {
+  
+  _impl_.compacted_slot_ = value;
+}
+inline void GetChosenResponse::set_compacted_slot(int32_t value) {
+  _internal_set_compacted_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.GetChosenResponse.compacted_slot)
+}
+
+// -------------------------------------------------------------------
+
+// RecoverRequest
+
+// int32 applied_slot = 1;
+inline void RecoverRequest::clear_applied_slot() {
+  _impl_.applied_slot_ = 0;
+}
+inline int32_t RecoverRequest::_internal_applied_slot() const {
+  return _impl_.applied_slot_;
+}
+inline int32_t RecoverRequest::applied_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.RecoverRequest.applied_slot)
+  return _internal_applied_slot();
+}
+inline void RecoverRequest::_internal_set_applied_slot(int32_t value) {
+  
+  _impl_.applied_slot_ = value;
+}
+inline void RecoverRequest::set_applied_slot(int32_t value) {
+  _internal_set_applied_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.RecoverRequest.applied_slot)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// RecoverChunk_PaxosLogs
+
+// map<int32, .keyvaluestore.PaxosLog> logs = 1;
+inline int RecoverChunk_PaxosLogs::_internal_logs_size() const {
+  return _impl_.logs_.size();
+}
+inline int RecoverChunk_PaxosLogs::logs_size() const {
+  return _internal_logs_size();
+}
+inline void RecoverChunk_PaxosLogs::clear_logs() {
+  _impl_.logs_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >&
+RecoverChunk_PaxosLogs::_internal_logs() const {
+  return _impl_.logs_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >&
+RecoverChunk_PaxosLogs::logs() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.RecoverChunk.PaxosLogs.logs)
+  return _internal_logs();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >*
+RecoverChunk_PaxosLogs::_internal_mutable_logs() {
+  return _impl_.logs_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::keyvaluestore::PaxosLog >*
+RecoverChunk_PaxosLogs::mutable_logs() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.RecoverChunk.PaxosLogs.logs)
+  return _internal_mutable_logs();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// RecoverChunk
+
+// map<string, string> kv_map = 1;
+inline int RecoverChunk::_internal_kv_map_size() const {
+  return _impl_.kv_map_.size();
+}
+inline int RecoverChunk::kv_map_size() const {
+  return _internal_kv_map_size();
+}
+inline void RecoverChunk::clear_kv_map() {
+  _impl_.kv_map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+RecoverChunk::_internal_kv_map() const {
+  return _impl_.kv_map_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+RecoverChunk::kv_map() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.RecoverChunk.kv_map)
+  return _internal_kv_map();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+RecoverChunk::_internal_mutable_kv_map() {
+  return _impl_.kv_map_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+RecoverChunk::mutable_kv_map() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.RecoverChunk.kv_map)
+  return _internal_mutable_kv_map();
+}
+
+// map<string, .keyvaluestore.RecoverChunk.PaxosLogs> paxos_logs = 2;
+inline int RecoverChunk::_internal_paxos_logs_size() const {
+  return _impl_.paxos_logs_.size();
+}
+inline int RecoverChunk::paxos_logs_size() const {
+  return _internal_paxos_logs_size();
+}
+inline void RecoverChunk::clear_paxos_logs() {
+  _impl_.paxos_logs_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >&
+RecoverChunk::_internal_paxos_logs() const {
+  return _impl_.paxos_logs_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >&
+RecoverChunk::paxos_logs() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.RecoverChunk.paxos_logs)
+  return _internal_paxos_logs();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >*
+RecoverChunk::_internal_mutable_paxos_logs() {
+  return _impl_.paxos_logs_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::RecoverChunk_PaxosLogs >*
+RecoverChunk::mutable_paxos_logs() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.RecoverChunk.paxos_logs)
+  return _internal_mutable_paxos_logs();
+}
+
+// int32 applied_slot = 3;
+inline void RecoverChunk::clear_applied_slot() {
+  _impl_.applied_slot_ = 0;
+}
+inline int32_t RecoverChunk::_internal_applied_slot() const {
+  return _impl_.applied_slot_;
+}
+inline int32_t RecoverChunk::applied_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.RecoverChunk.applied_slot)
+  return _internal_applied_slot();
+}
+inline void RecoverChunk::_internal_set_applied_slot(int32_t value) {
+  
+  _impl_.applied_slot_ = value;
+}
+inline void RecoverChunk::set_applied_slot(int32_t value) {
+  _internal_set_applied_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.RecoverChunk.applied_slot)
+}
+
+// bool data_complete = 4;
+inline void RecoverChunk::clear_data_complete() {
+  _impl_.data_complete_ = false;
+}
+inline bool RecoverChunk::_internal_data_complete() const {
+  return _impl_.data_complete_;
+}
+inline bool RecoverChunk::data_complete() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.RecoverChunk.data_complete)
+  return _internal_data_complete();
+}
+inline void RecoverChunk::_internal_set_data_complete(bool value) {
+  
+  _impl_.data_complete_ = value;
+}
+inline void RecoverChunk::set_data_complete(bool value) {
+  _internal_set_data_complete(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.RecoverChunk.data_complete)
+}
+
+// bool incremental = 5;
+inline void RecoverChunk::clear_incremental() {
+  _impl_.incremental_ = false;
+}
+inline bool RecoverChunk::_internal_incremental() const {
+  return _impl_.incremental_;
+}
+inline bool RecoverChunk::incremental() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.RecoverChunk.incremental)
+  return _internal_incremental();
+}
+inline void RecoverChunk::_internal_set_incremental(bool value) {
+  
+  _impl_.incremental_ = value;
+}
+inline void RecoverChunk::set_incremental(bool value) {
+  _internal_set_incremental(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.RecoverChunk.incremental)
+}
+
+// -------------------------------------------------------------------
+
+// LatencySummary
+
+// uint64 count = 1;
+inline void LatencySummary::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencySummary::count() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.count)
+  return _internal_count();
+}
+inline void LatencySummary::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencySummary::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.count)
+}
+
+// double mean = 2;
+inline void LatencySummary::clear_mean() {
+  _impl_.mean_ = 0;
+}
+inline double LatencySummary::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double LatencySummary::mean() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.mean)
+  return _internal_mean();
+}
+inline void LatencySummary::_internal_set_mean(double value) {
+  
+  _impl_.mean_ = value;
+}
+inline void LatencySummary::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.mean)
+}
+
+// uint64 min = 3;
+inline void LatencySummary::clear_min() {
+  _impl_.min_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_min() const {
+  return _impl_.min_;
+}
+inline uint64_t LatencySummary::min() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.min)
+  return _internal_min();
+}
+inline void LatencySummary::_internal_set_min(uint64_t value) {
+  
+  _impl_.min_ = value;
+}
+inline void LatencySummary::set_min(uint64_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.min)
+}
+
+// uint64 p50 = 4;
+inline void LatencySummary::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t LatencySummary::p50() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.p50)
+  return _internal_p50();
+}
+inline void LatencySummary::_internal_set_p50(uint64_t value) {
+  
+  _impl_.p50_ = value;
+}
+inline void LatencySummary::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.p50)
+}
+
+// uint64 p90 = 5;
+inline void LatencySummary::clear_p90() {
+  _impl_.p90_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline uint64_t LatencySummary::p90() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.p90)
+  return _internal_p90();
+}
+inline void LatencySummary::_internal_set_p90(uint64_t value) {
+  
+  _impl_.p90_ = value;
+}
+inline void LatencySummary::set_p90(uint64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.p90)
+}
+
+// uint64 p99 = 6;
+inline void LatencySummary::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t LatencySummary::p99() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.p99)
+  return _internal_p99();
+}
+inline void LatencySummary::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void LatencySummary::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.p99)
+}
+
+// uint64 p999 = 7;
+inline void LatencySummary::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t LatencySummary::p999() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.p999)
+  return _internal_p999();
+}
+inline void LatencySummary::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void LatencySummary::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.p999)
+}
+
+// uint64 max = 8;
+inline void LatencySummary::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t LatencySummary::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t LatencySummary::max() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.LatencySummary.max)
+  return _internal_max();
+}
+inline void LatencySummary::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void LatencySummary::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.LatencySummary.max)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// StatsResponse
+
+// map<string, int64> counters = 1;
+inline int StatsResponse::_internal_counters_size() const {
+  return _impl_.counters_.size();
+}
+inline int StatsResponse::counters_size() const {
+  return _internal_counters_size();
+}
+inline void StatsResponse::clear_counters() {
+  _impl_.counters_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
+StatsResponse::_internal_counters() const {
+  return _impl_.counters_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
+StatsResponse::counters() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.StatsResponse.counters)
+  return _internal_counters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
+StatsResponse::_internal_mutable_counters() {
+  return _impl_.counters_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
+StatsResponse::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.StatsResponse.counters)
+  return _internal_mutable_counters();
+}
+
+// map<string, .keyvaluestore.LatencySummary> latencies_us = 2;
+inline int StatsResponse::_internal_latencies_us_size() const {
+  return _impl_.latencies_us_.size();
+}
+inline int StatsResponse::latencies_us_size() const {
+  return _internal_latencies_us_size();
+}
+inline void StatsResponse::clear_latencies_us() {
+  _impl_.latencies_us_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >&
+StatsResponse::_internal_latencies_us() const {
+  return _impl_.latencies_us_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >&
+StatsResponse::latencies_us() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.StatsResponse.latencies_us)
+  return _internal_latencies_us();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >*
+StatsResponse::_internal_mutable_latencies_us() {
+  return _impl_.latencies_us_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::keyvaluestore::LatencySummary >*
+StatsResponse::mutable_latencies_us() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.StatsResponse.latencies_us)
+  return _internal_mutable_latencies_us();
+}
+
+// string text = 3;
+inline void StatsResponse::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& StatsResponse::text() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.StatsResponse.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatsResponse::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.StatsResponse.text)
+}
+inline std::string* StatsResponse::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.StatsResponse.text)
+  return _s;
+}
+inline const std::string& StatsResponse::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void StatsResponse::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatsResponse::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatsResponse::release_text() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.StatsResponse.text)
+  return _impl_.text_.Release();
+}
+inline void StatsResponse::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.StatsResponse.text)
+}
+
+// -------------------------------------------------------------------
+
+// WalRecord_PaxosLogEntry
+
+// string key = 1;
+inline void WalRecord_PaxosLogEntry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WalRecord_PaxosLogEntry::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.PaxosLogEntry.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalRecord_PaxosLogEntry::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.PaxosLogEntry.key)
+}
+inline std::string* WalRecord_PaxosLogEntry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.PaxosLogEntry.key)
+  return _s;
+}
+inline const std::string& WalRecord_PaxosLogEntry::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WalRecord_PaxosLogEntry::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalRecord_PaxosLogEntry::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalRecord_PaxosLogEntry::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.PaxosLogEntry.key)
+  return _impl_.key_.Release();
+}
+inline void WalRecord_PaxosLogEntry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.PaxosLogEntry.key)
+}
+
+// int32 round = 2;
+inline void WalRecord_PaxosLogEntry::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t WalRecord_PaxosLogEntry::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t WalRecord_PaxosLogEntry::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.PaxosLogEntry.round)
+  return _internal_round();
+}
+inline void WalRecord_PaxosLogEntry::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void WalRecord_PaxosLogEntry::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.PaxosLogEntry.round)
+}
+
+// .keyvaluestore.PaxosLog log = 3;
+inline bool WalRecord_PaxosLogEntry::_internal_has_log() const {
+  return this != internal_default_instance() && _impl_.log_ != nullptr;
+}
+inline bool WalRecord_PaxosLogEntry::has_log() const {
+  return _internal_has_log();
+}
+inline void WalRecord_PaxosLogEntry::clear_log() {
+  if (GetArenaForAllocation() == nullptr && _impl_.log_ != nullptr) {
+    delete _impl_.log_;
+  }
+  _impl_.log_ = nullptr;
+}
+inline const ::keyvaluestore::PaxosLog& WalRecord_PaxosLogEntry::_internal_log() const {
+  const ::keyvaluestore::PaxosLog* p = _impl_.log_;
+  return p != nullptr ? *p : reinterpret_cast<const ::keyvaluestore::PaxosLog&>(
+      ::keyvaluestore::_PaxosLog_default_instance_);
+}
+inline const ::keyvaluestore::PaxosLog& WalRecord_PaxosLogEntry::log() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.PaxosLogEntry.log)
+  return _internal_log();
+}
+inline void WalRecord_PaxosLogEntry::unsafe_arena_set_allocated_log(
+    ::keyvaluestore::PaxosLog* log) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.log_);
+  }
+  _impl_.log_ = log;
+  if (log) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WalRecord.PaxosLogEntry.log)
+}
+inline ::keyvaluestore::PaxosLog* WalRecord_PaxosLogEntry::release_log() {
+  
+  ::keyvaluestore::PaxosLog* temp = _impl_.log_;
+  _impl_.log_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::keyvaluestore::PaxosLog* WalRecord_PaxosLogEntry::unsafe_arena_release_log() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.PaxosLogEntry.log)
+  
+  ::keyvaluestore::PaxosLog* temp = _impl_.log_;
+  _impl_.log_ = nullptr;
+  return temp;
+}
+inline ::keyvaluestore::PaxosLog* WalRecord_PaxosLogEntry::_internal_mutable_log() {
+  
+  if (_impl_.log_ == nullptr) {
+    auto* p = CreateMaybeMessage<::keyvaluestore::PaxosLog>(GetArenaForAllocation());
+    _impl_.log_ = p;
+  }
+  return _impl_.log_;
+}
+inline ::keyvaluestore::PaxosLog* WalRecord_PaxosLogEntry::mutable_log() {
+  ::keyvaluestore::PaxosLog* _msg = _internal_mutable_log();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.PaxosLogEntry.log)
+  return _msg;
+}
+inline void WalRecord_PaxosLogEntry::set_allocated_log(::keyvaluestore::PaxosLog* log) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.log_;
+  }
+  if (log) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(log);
+    if (message_arena != submessage_arena) {
+      log = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, log, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.log_ = log;
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.PaxosLogEntry.log)
+}
+
+// -------------------------------------------------------------------
+
+// WalRecord_Applied
+
+// int32 slot = 1;
+inline void WalRecord_Applied::clear_slot() {
+  _impl_.slot_ = 0;
+}
+inline int32_t WalRecord_Applied::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t WalRecord_Applied::slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Applied.slot)
+  return _internal_slot();
+}
+inline void WalRecord_Applied::_internal_set_slot(int32_t value) {
+  
+  _impl_.slot_ = value;
+}
+inline void WalRecord_Applied::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Applied.slot)
+}
+
+// repeated .keyvaluestore.Operation operations = 2;
+inline int WalRecord_Applied::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int WalRecord_Applied::operations_size() const {
+  return _internal_operations_size();
+}
+inline void WalRecord_Applied::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::keyvaluestore::Operation* WalRecord_Applied::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.Applied.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >*
+WalRecord_Applied::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:keyvaluestore.WalRecord.Applied.operations)
+  return &_impl_.operations_;
+}
+inline const ::keyvaluestore::Operation& WalRecord_Applied::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::keyvaluestore::Operation& WalRecord_Applied::operations(int index) const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Applied.operations)
+  return _internal_operations(index);
+}
+inline ::keyvaluestore::Operation* WalRecord_Applied::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::keyvaluestore::Operation* WalRecord_Applied::add_operations() {
+  ::keyvaluestore::Operation* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:keyvaluestore.WalRecord.Applied.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::keyvaluestore::Operation >&
+WalRecord_Applied::operations() const {
+  // @@protoc_insertion_point(field_list:keyvaluestore.WalRecord.Applied.operations)
+  return _impl_.operations_;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// WalRecord_Snapshot
+
+// map<string, string> kv_map = 1;
+inline int WalRecord_Snapshot::_internal_kv_map_size() const {
+  return _impl_.kv_map_.size();
+}
+inline int WalRecord_Snapshot::kv_map_size() const {
+  return _internal_kv_map_size();
+}
+inline void WalRecord_Snapshot::clear_kv_map() {
+  _impl_.kv_map_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+WalRecord_Snapshot::_internal_kv_map() const {
+  return _impl_.kv_map_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+WalRecord_Snapshot::kv_map() const {
+  // @@protoc_insertion_point(field_map:keyvaluestore.WalRecord.Snapshot.kv_map)
+  return _internal_kv_map();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+WalRecord_Snapshot::_internal_mutable_kv_map() {
+  return _impl_.kv_map_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+WalRecord_Snapshot::mutable_kv_map() {
+  // @@protoc_insertion_point(field_mutable_map:keyvaluestore.WalRecord.Snapshot.kv_map)
+  return _internal_mutable_kv_map();
+}
+
+// int32 applied_slot = 2;
+inline void WalRecord_Snapshot::clear_applied_slot() {
+  _impl_.applied_slot_ = 0;
+}
+inline int32_t WalRecord_Snapshot::_internal_applied_slot() const {
+  return _impl_.applied_slot_;
+}
+inline int32_t WalRecord_Snapshot::applied_slot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Snapshot.applied_slot)
+  return _internal_applied_slot();
+}
+inline void WalRecord_Snapshot::_internal_set_applied_slot(int32_t value) {
+  
+  _impl_.applied_slot_ = value;
+}
+inline void WalRecord_Snapshot::set_applied_slot(int32_t value) {
+  _internal_set_applied_slot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Snapshot.applied_slot)
+}
+
+// bool continued = 3;
+inline void WalRecord_Snapshot::clear_continued() {
+  _impl_.continued_ = false;
+}
+inline bool WalRecord_Snapshot::_internal_continued() const {
+  return _impl_.continued_;
+}
+inline bool WalRecord_Snapshot::continued() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Snapshot.continued)
+  return _internal_continued();
+}
+inline void WalRecord_Snapshot::_internal_set_continued(bool value) {
+  
+  _impl_.continued_ = value;
+}
+inline void WalRecord_Snapshot::set_continued(bool value) {
+  _internal_set_continued(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Snapshot.continued)
+}
+
+// bool incomplete = 4;
+inline void WalRecord_Snapshot::clear_incomplete() {
+  _impl_.incomplete_ = false;
+}
+inline bool WalRecord_Snapshot::_internal_incomplete() const {
+  return _impl_.incomplete_;
+}
+inline bool WalRecord_Snapshot::incomplete() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Snapshot.incomplete)
+  return _internal_incomplete();
+}
+inline void WalRecord_Snapshot::_internal_set_incomplete(bool value) {
+  
+  _impl_.incomplete_ = value;
+}
+inline void WalRecord_Snapshot::set_incomplete(bool value) {
+  _internal_set_incomplete(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Snapshot.incomplete)
+}
+
+// -------------------------------------------------------------------
+
+// WalRecord_Compaction
+
+// string key = 1;
+inline void WalRecord_Compaction::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WalRecord_Compaction::key() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Compaction.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalRecord_Compaction::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Compaction.key)
+}
+inline std::string* WalRecord_Compaction::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.Compaction.key)
+  return _s;
+}
+inline const std::string& WalRecord_Compaction::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WalRecord_Compaction::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalRecord_Compaction::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalRecord_Compaction::release_key() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.Compaction.key)
+  return _impl_.key_.Release();
+}
+inline void WalRecord_Compaction::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:keyvaluestore.WalRecord.Compaction.key)
+}
+
+// int32 round = 2;
+inline void WalRecord_Compaction::clear_round() {
+  _impl_.round_ = 0;
+}
+inline int32_t WalRecord_Compaction::_internal_round() const {
+  return _impl_.round_;
+}
+inline int32_t WalRecord_Compaction::round() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.Compaction.round)
+  return _internal_round();
+}
+inline void WalRecord_Compaction::_internal_set_round(int32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void WalRecord_Compaction::set_round(int32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.Compaction.round)
+}
+
+// -------------------------------------------------------------------
+
+// WalRecord
+
+// .keyvaluestore.WalRecord.PaxosLogEntry paxos_log = 1;
+inline bool WalRecord::_internal_has_paxos_log() const {
+  return record_case() == kPaxosLog;
+}
+inline bool WalRecord::has_paxos_log() const {
+  return _internal_has_paxos_log();
+}
+inline void WalRecord::set_has_paxos_log() {
+  _impl_._oneof_case_[0] = kPaxosLog;
+}
+inline void WalRecord::clear_paxos_log() {
+  if (_internal_has_paxos_log()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.paxos_log_;
+    }
+    clear_has_record();
+  }
+}
+inline ::keyvaluestore::WalRecord_PaxosLogEntry* WalRecord::release_paxos_log() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.paxos_log)
+  if (_internal_has_paxos_log()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_PaxosLogEntry* temp = _impl_.record_.paxos_log_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.paxos_log_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::keyvaluestore::WalRecord_PaxosLogEntry& WalRecord::_internal_paxos_log() const {
+  return _internal_has_paxos_log()
+      ? *_impl_.record_.paxos_log_
+      : reinterpret_cast< ::keyvaluestore::WalRecord_PaxosLogEntry&>(::keyvaluestore::_WalRecord_PaxosLogEntry_default_instance_);
+}
+inline const ::keyvaluestore::WalRecord_PaxosLogEntry& WalRecord::paxos_log() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.paxos_log)
+  return _internal_paxos_log();
+}
+inline ::keyvaluestore::WalRecord_PaxosLogEntry* WalRecord::unsafe_arena_release_paxos_log() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:keyvaluestore.WalRecord.paxos_log)
+  if (_internal_has_paxos_log()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_PaxosLogEntry* temp = _impl_.record_.paxos_log_;
+    _impl_.record_.paxos_log_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalRecord::unsafe_arena_set_allocated_paxos_log(::keyvaluestore::WalRecord_PaxosLogEntry* paxos_log) {
+  clear_record();
+  if (paxos_log) {
+    set_has_paxos_log();
+    _impl_.record_.paxos_log_ = paxos_log;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WalRecord.paxos_log)
+}
+inline ::keyvaluestore::WalRecord_PaxosLogEntry* WalRecord::_internal_mutable_paxos_log() {
+  if (!_internal_has_paxos_log()) {
+    clear_record();
+    set_has_paxos_log();
+    _impl_.record_.paxos_log_ = CreateMaybeMessage< ::keyvaluestore::WalRecord_PaxosLogEntry >(GetArenaForAllocation());
+  }
+  return _impl_.record_.paxos_log_;
+}
+inline ::keyvaluestore::WalRecord_PaxosLogEntry* WalRecord::mutable_paxos_log() {
+  ::keyvaluestore::WalRecord_PaxosLogEntry* _msg = _internal_mutable_paxos_log();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.paxos_log)
+  return _msg;
+}
+
+// int32 promised_ballot = 2;
+inline bool WalRecord::_internal_has_promised_ballot() const {
+  return record_case() == kPromisedBallot;
+}
+inline bool WalRecord::has_promised_ballot() const {
+  return _internal_has_promised_ballot();
+}
+inline void WalRecord::set_has_promised_ballot() {
+  _impl_._oneof_case_[0] = kPromisedBallot;
+}
+inline void WalRecord::clear_promised_ballot() {
+  if (_internal_has_promised_ballot()) {
+    _impl_.record_.promised_ballot_ = 0;
+    clear_has_record();
+  }
+}
+inline int32_t WalRecord::_internal_promised_ballot() const {
+  if (_internal_has_promised_ballot()) {
+    return _impl_.record_.promised_ballot_;
+  }
+  return 0;
+}
+inline void WalRecord::_internal_set_promised_ballot(int32_t value) {
+  if (!_internal_has_promised_ballot()) {
+    clear_record();
+    set_has_promised_ballot();
+  }
+  _impl_.record_.promised_ballot_ = value;
+}
+inline int32_t WalRecord::promised_ballot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.promised_ballot)
+  return _internal_promised_ballot();
+}
+inline void WalRecord::set_promised_ballot(int32_t value) {
+  _internal_set_promised_ballot(value);
+  // @@protoc_insertion_point(field_set:keyvaluestore.WalRecord.promised_ballot)
+}
+
+// .keyvaluestore.WalRecord.Applied applied = 3;
+inline bool WalRecord::_internal_has_applied() const {
+  return record_case() == kApplied;
+}
+inline bool WalRecord::has_applied() const {
+  return _internal_has_applied();
+}
+inline void WalRecord::set_has_applied() {
+  _impl_._oneof_case_[0] = kApplied;
+}
+inline void WalRecord::clear_applied() {
+  if (_internal_has_applied()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.applied_;
+    }
+    clear_has_record();
+  }
+}
+inline ::keyvaluestore::WalRecord_Applied* WalRecord::release_applied() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.applied)
+  if (_internal_has_applied()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Applied* temp = _impl_.record_.applied_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.applied_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::keyvaluestore::WalRecord_Applied& WalRecord::_internal_applied() const {
+  return _internal_has_applied()
+      ? *_impl_.record_.applied_
+      : reinterpret_cast< ::keyvaluestore::WalRecord_Applied&>(::keyvaluestore::_WalRecord_Applied_default_instance_);
+}
+inline const ::keyvaluestore::WalRecord_Applied& WalRecord::applied() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.applied)
+  return _internal_applied();
+}
+inline ::keyvaluestore::WalRecord_Applied* WalRecord::unsafe_arena_release_applied() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:keyvaluestore.WalRecord.applied)
+  if (_internal_has_applied()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Applied* temp = _impl_.record_.applied_;
+    _impl_.record_.applied_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalRecord::unsafe_arena_set_allocated_applied(::keyvaluestore::WalRecord_Applied* applied) {
+  clear_record();
+  if (applied) {
+    set_has_applied();
+    _impl_.record_.applied_ = applied;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WalRecord.applied)
+}
+inline ::keyvaluestore::WalRecord_Applied* WalRecord::_internal_mutable_applied() {
+  if (!_internal_has_applied()) {
+    clear_record();
+    set_has_applied();
+    _impl_.record_.applied_ = CreateMaybeMessage< ::keyvaluestore::WalRecord_Applied >(GetArenaForAllocation());
+  }
+  return _impl_.record_.applied_;
+}
+inline ::keyvaluestore::WalRecord_Applied* WalRecord::mutable_applied() {
+  ::keyvaluestore::WalRecord_Applied* _msg = _internal_mutable_applied();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.applied)
+  return _msg;
+}
+
+// .keyvaluestore.WalRecord.Snapshot snapshot = 4;
+inline bool WalRecord::_internal_has_snapshot() const {
+  return record_case() == kSnapshot;
+}
+inline bool WalRecord::has_snapshot() const {
+  return _internal_has_snapshot();
+}
+inline void WalRecord::set_has_snapshot() {
+  _impl_._oneof_case_[0] = kSnapshot;
+}
+inline void WalRecord::clear_snapshot() {
+  if (_internal_has_snapshot()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.snapshot_;
+    }
+    clear_has_record();
+  }
+}
+inline ::keyvaluestore::WalRecord_Snapshot* WalRecord::release_snapshot() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.snapshot)
+  if (_internal_has_snapshot()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Snapshot* temp = _impl_.record_.snapshot_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::keyvaluestore::WalRecord_Snapshot& WalRecord::_internal_snapshot() const {
+  return _internal_has_snapshot()
+      ? *_impl_.record_.snapshot_
+      : reinterpret_cast< ::keyvaluestore::WalRecord_Snapshot&>(::keyvaluestore::_WalRecord_Snapshot_default_instance_);
+}
+inline const ::keyvaluestore::WalRecord_Snapshot& WalRecord::snapshot() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.snapshot)
+  return _internal_snapshot();
+}
+inline ::keyvaluestore::WalRecord_Snapshot* WalRecord::unsafe_arena_release_snapshot() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:keyvaluestore.WalRecord.snapshot)
+  if (_internal_has_snapshot()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Snapshot* temp = _impl_.record_.snapshot_;
+    _impl_.record_.snapshot_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalRecord::unsafe_arena_set_allocated_snapshot(::keyvaluestore::WalRecord_Snapshot* snapshot) {
+  clear_record();
+  if (snapshot) {
+    set_has_snapshot();
+    _impl_.record_.snapshot_ = snapshot;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WalRecord.snapshot)
+}
+inline ::keyvaluestore::WalRecord_Snapshot* WalRecord::_internal_mutable_snapshot() {
+  if (!_internal_has_snapshot()) {
+    clear_record();
+    set_has_snapshot();
+    _impl_.record_.snapshot_ = CreateMaybeMessage< ::keyvaluestore::WalRecord_Snapshot >(GetArenaForAllocation());
+  }
+  return _impl_.record_.snapshot_;
+}
+inline ::keyvaluestore::WalRecord_Snapshot* WalRecord::mutable_snapshot() {
+  ::keyvaluestore::WalRecord_Snapshot* _msg = _internal_mutable_snapshot();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.snapshot)
+  return _msg;
+}
+
+// .keyvaluestore.WalRecord.Compaction compaction = 5;
+inline bool WalRecord::_internal_has_compaction() const {
+  return record_case() == kCompaction;
+}
+inline bool WalRecord::has_compaction() const {
+  return _internal_has_compaction();
+}
+inline void WalRecord::set_has_compaction() {
+  _impl_._oneof_case_[0] = kCompaction;
+}
+inline void WalRecord::clear_compaction() {
+  if (_internal_has_compaction()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.compaction_;
+    }
+    clear_has_record();
+  }
+}
+inline ::keyvaluestore::WalRecord_Compaction* WalRecord::release_compaction() {
+  // @@protoc_insertion_point(field_release:keyvaluestore.WalRecord.compaction)
+  if (_internal_has_compaction()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Compaction* temp = _impl_.record_.compaction_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.compaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::keyvaluestore::WalRecord_Compaction& WalRecord::_internal_compaction() const {
+  return _internal_has_compaction()
+      ? *_impl_.record_.compaction_
+      : reinterpret_cast< ::keyvaluestore::WalRecord_Compaction&>(::keyvaluestore::_WalRecord_Compaction_default_instance_);
+}
+inline const ::keyvaluestore::WalRecord_Compaction& WalRecord::compaction() const {
+  // @@protoc_insertion_point(field_get:keyvaluestore.WalRecord.compaction)
+  return _internal_compaction();
+}
+inline ::keyvaluestore::WalRecord_Compaction* WalRecord::unsafe_arena_release_compaction() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:keyvaluestore.WalRecord.compaction)
+  if (_internal_has_compaction()) {
+    clear_has_record();
+    ::keyvaluestore::WalRecord_Compaction* temp = _impl_.record_.compaction_;
+    _impl_.record_.compaction_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalRecord::unsafe_arena_set_allocated_compaction(::keyvaluestore::WalRecord_Compaction* compaction) {
+  clear_record();
+  if (compaction) {
+    set_has_compaction();
+    _impl_.record_.compaction_ = compaction;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:keyvaluestore.WalRecord.compaction)
+}
+inline ::keyvaluestore::WalRecord_Compaction* WalRecord::_internal_mutable_compaction() {
+  if (!_internal_has_compaction()) {
+    clear_record();
+    set_has_compaction();
+    _impl_.record_.compaction_ = CreateMaybeMessage< ::keyvaluestore::WalRecord_Compaction >(GetArenaForAllocation());
+  }
+  return _impl_.record_.compaction_;
+}
+inline ::keyvaluestore::WalRecord_Compaction* WalRecord::mutable_compaction() {
+  ::keyvaluestore::WalRecord_Compaction* _msg = _internal_mutable_compaction();
+  // @@protoc_insertion_point(field_mutable:keyvaluestore.WalRecord.compaction)
+  return _msg;
+}
+
+inline bool WalRecord::has_record() const {
+  return record_case() != RECORD_NOT_SET;
+}
+inline void WalRecord::clear_has_record() {
+  _impl_._oneof_case_[0] = RECORD_NOT_SET;
+}
+inline WalRecord::RecordCase WalRecord::record_case() const {
+  return WalRecord::RecordCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace keyvaluestore
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::keyvaluestore::OperationType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::keyvaluestore::OperationType>() {
+  return ::keyvaluestore::OperationType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_keyvaluestore_2eproto
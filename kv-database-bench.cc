@@ -0,0 +1,316 @@
+// Microbenchmarks of KeyValueDataBase, without gRPC in the loop.
+//
+// Every benchmark runs a fixed number of operations split over 1, 2, 4 and
+// 8 threads, for several key and value sizes, and prints one line per run:
+//
+//   benchmark threads key_size value_size ops ops_per_sec ns_per_op
+//
+// Usage: `./kv-database-bench [--ops=<int>] [--threads=1,2,4,8]
+//         [--filter=<substring>] [--wal_path=<file>]`
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "kv-database.h"
+#include "time_log.h"
+#include "wal.h"
+
+using keyvaluestore::KeyValueDataBase;
+using keyvaluestore::Operation;
+using keyvaluestore::OperationType;
+using keyvaluestore::WriteAheadLog;
+
+using Clock = std::chrono::steady_clock;
+
+// Operations in the batch of each batch-accept.
+constexpr int kOperationsPerBatch = 16;
+// Keys in the store copied by GetDataMap.
+constexpr int kSnapshotKeys = 10000;
+// Rounds of the key whose latest round GetLatestRound looks up.
+constexpr int kRoundsOfLatestRound = 1000;
+
+struct Options {
+  int num_of_ops = 100000;
+  std::vector<int> thread_counts = {1, 2, 4, 8};
+  std::string filter;
+  std::string wal_path;
+};
+
+struct Sizes {
+  size_t key_size;
+  size_t value_size;
+};
+
+// Returns the key numbered index, padded to key_size.
+static std::string Key(int index, size_t key_size) {
+  std::string digits = std::to_string(index);
+  if (digits.size() >= key_size) return digits;
+  return std::string(key_size - digits.size(), 'k') + digits;
+}
+
+// A database, optionally backed by a fresh write-ahead log.
+class Store {
+ public:
+  explicit Store(const std::string& wal_path) {
+    if (!wal_path.empty()) {
+      unlink(wal_path.c_str());
+      wal_ = std::make_unique<WriteAheadLog>(wal_path);
+    }
+    kv_db_ = std::make_unique<KeyValueDataBase>(wal_.get());
+    grpc::Status status = kv_db_->ReplayWal();
+    if (!status.ok()) {
+      std::cerr << status.error_message() << std::endl;
+      std::exit(1);
+    }
+  }
+  KeyValueDataBase* operator->() { return kv_db_.get(); }
+
+ private:
+  std::unique_ptr<WriteAheadLog> wal_;
+  std::unique_ptr<KeyValueDataBase> kv_db_;
+};
+
+// Runs op(thread, i) for i in [0, num_of_ops / num_of_threads) on each of
+// num_of_threads threads, started together, and returns the wall time.
+static Clock::duration RunThreads(int num_of_threads, int num_of_ops,
+                                  const std::function<void(int, int)>& op) {
+  std::mutex mtx;
+  std::condition_variable cv;
+  int num_of_ready = 0;
+  bool started = false;
+  std::vector<std::thread> threads;
+  int ops_per_thread = num_of_ops / num_of_threads;
+  for (int t = 0; t < num_of_threads; ++t) {
+    threads.emplace_back([&, t] {
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        ++num_of_ready;
+        cv.notify_all();
+        cv.wait(lock, [&] { return started; });
+      }
+      for (int i = 0; i < ops_per_thread; ++i) op(t, i);
+    });
+  }
+  Clock::time_point start;
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&] { return num_of_ready == num_of_threads; });
+    started = true;
+    start = Clock::now();
+  }
+  cv.notify_all();
+  for (auto& thread : threads) thread.join();
+  return Clock::now() - start;
+}
+
+static void Report(const std::string& name, int num_of_threads,
+                   const Sizes& sizes, int num_of_ops,
+                   Clock::duration elapsed) {
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  printf("%-24s %2d %5zu %6zu %8d %12.0f %10.1f\n", name.c_str(),
+         num_of_threads, sizes.key_size, sizes.value_size, num_of_ops,
+         num_of_ops / seconds, seconds * 1e9 / num_of_ops);
+  fflush(stdout);
+}
+
+// State of one run of a benchmark.
+struct Fixture {
+  explicit Fixture(const std::string& wal_path) : store(wal_path) {}
+
+  Store store;
+  std::vector<std::string> keys;
+  std::string value;
+  std::atomic<int> next_round{0};
+  int ops_per_thread = 0;
+
+  // Thread t works on keys [t * n, (t + 1) * n), so no key is shared.
+  const std::string& OwnKey(int thread, int i) const {
+    return keys[thread * ops_per_thread + i];
+  }
+};
+
+// One benchmark. setup prepares the fixture; op(thread, i) is then timed
+// over all threads.
+struct Benchmark {
+  std::string name;
+  std::function<void(Fixture*)> setup;
+  std::function<void(Fixture*, int thread, int i)> op;
+  // Runs num_of_ops / ops_divisor ops, for benchmarks whose ops do many
+  // times the work, or keep many times the memory, of the others.
+  int ops_divisor = 1;
+  // Keys of the fixture; one per op if 0.
+  int num_of_keys = 0;
+};
+
+static void LoadKeys(Fixture* fixture) {
+  for (const std::string& key : fixture->keys) {
+    fixture->store->SetValue(key, fixture->value);
+  }
+}
+
+static std::vector<Benchmark> Benchmarks() {
+  auto no_setup = [](Fixture*) {};
+  std::vector<Benchmark> benchmarks;
+  benchmarks.push_back({"GetValue", LoadKeys, [](Fixture* fixture, int t,
+                                                 int i) {
+                          std::string value;
+                          fixture->store->GetValue(fixture->OwnKey(t, i),
+                                                   &value);
+                        }});
+  benchmarks.push_back({"SetValue/insert", no_setup,
+                        [](Fixture* fixture, int t, int i) {
+                          fixture->store->SetValue(fixture->OwnKey(t, i),
+                                                   fixture->value);
+                        }});
+  benchmarks.push_back({"SetValue/overwrite", LoadKeys,
+                        [](Fixture* fixture, int t, int i) {
+                          fixture->store->SetValue(fixture->OwnKey(t, i),
+                                                   fixture->value);
+                        }});
+  benchmarks.push_back({"DeleteEntry", LoadKeys,
+                        [](Fixture* fixture, int t, int i) {
+                          fixture->store->DeleteEntry(fixture->OwnKey(t, i));
+                        }});
+  // The acceptor benchmarks walk the rounds of a single key shared by all
+  // threads, like the write log.
+  benchmarks.push_back({"AddPaxosLog/propose", no_setup,
+                        [](Fixture* fixture, int, int) {
+                          fixture->store->AddPaxosLog(fixture->keys[0],
+                                                      ++fixture->next_round);
+                        }});
+  benchmarks.push_back({"AddPaxosLog/promise", no_setup,
+                        [](Fixture* fixture, int, int) {
+                          fixture->store->AddPaxosLog(fixture->keys[0],
+                                                      ++fixture->next_round,
+                                                      /*promised_id=*/1);
+                        }});
+  benchmarks.push_back({"AddPaxosLog/accept", no_setup,
+                        [](Fixture* fixture, int, int) {
+                          fixture->store->AddPaxosLog(
+                              fixture->keys[0], ++fixture->next_round,
+                              /*accepted_id=*/1, OperationType::SET,
+                              fixture->value);
+                        }});
+  benchmarks.push_back(
+      {"AddPaxosLog/accept_batch", no_setup, [](Fixture* fixture, int, int i) {
+         google::protobuf::RepeatedPtrField<Operation> operations;
+         for (int j = 0; j < kOperationsPerBatch; ++j) {
+           Operation* operation = operations.Add();
+           operation->set_key(
+               fixture->keys[(i * kOperationsPerBatch + j) %
+                             fixture->keys.size()]);
+           operation->set_type(OperationType::SET);
+           operation->set_value(fixture->value);
+         }
+         fixture->store->AddPaxosLog(fixture->keys[0], ++fixture->next_round,
+                                     /*accepted_id=*/1, operations);
+       },
+       /*ops_divisor=*/kOperationsPerBatch});
+  benchmarks.push_back({"GetLatestRound",
+                        [](Fixture* fixture) {
+                          for (int round = 1; round <= kRoundsOfLatestRound;
+                               ++round) {
+                            fixture->store->AddPaxosLog(fixture->keys[0],
+                                                        round,
+                                                        /*promised_id=*/1);
+                          }
+                        },
+                        [](Fixture* fixture, int, int) {
+                          fixture->store->GetLatestRound(fixture->keys[0]);
+                        }});
+  benchmarks.push_back({"GetDataMap/10k_keys", LoadKeys,
+                        [](Fixture* fixture, int, int) {
+                          fixture->store->GetDataMap();
+                        },
+                        /*ops_divisor=*/1000, kSnapshotKeys});
+  return benchmarks;
+}
+
+static bool ParseOptions(int argc, char** argv, Options* options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto value_of = [&arg](const std::string& flag) -> const char* {
+      return arg.rfind(flag, 0) == 0 ? arg.c_str() + flag.size() : nullptr;
+    };
+    if (const char* ops = value_of("--ops=")) {
+      options->num_of_ops = std::atoi(ops);
+    } else if (const char* threads = value_of("--threads=")) {
+      options->thread_counts.clear();
+      std::stringstream list(threads);
+      std::string count;
+      while (std::getline(list, count, ',')) {
+        options->thread_counts.push_back(std::atoi(count.c_str()));
+      }
+    } else if (const char* filter = value_of("--filter=")) {
+      options->filter = filter;
+    } else if (const char* wal_path = value_of("--wal_path=")) {
+      options->wal_path = wal_path;
+    } else {
+      return false;
+    }
+  }
+  if (options->num_of_ops <= 0 || options->thread_counts.empty()) {
+    return false;
+  }
+  for (int count : options->thread_counts) {
+    if (count <= 0) return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, &options)) {
+    std::cerr << "Usage: `./kv-database-bench [--ops=<int>] "
+                 "[--threads=1,2,4,8] [--filter=<substring>] "
+                 "[--wal_path=<file>]`"
+              << std::endl;
+    return -1;
+  }
+  // Keeps the WAL's replay lines out of the results.
+  time_log::SetLevel(time_log::Level::kWarning);
+  const std::vector<Sizes> all_sizes = {{16, 16}, {16, 256}, {64, 4096}};
+  printf("%-24s %2s %5s %6s %8s %12s %10s\n", "benchmark", "th", "key",
+         "value", "ops", "ops_per_sec", "ns_per_op");
+  for (const Benchmark& benchmark : Benchmarks()) {
+    if (benchmark.name.find(options.filter) == std::string::npos) continue;
+    for (const Sizes& sizes : all_sizes) {
+      for (int num_of_threads : options.thread_counts) {
+        int num_of_ops = options.num_of_ops / benchmark.ops_divisor;
+        // Every thread runs the same number of ops.
+        num_of_ops -= num_of_ops % num_of_threads;
+        if (num_of_ops == 0) continue;
+        Fixture fixture(options.wal_path);
+        int num_of_keys = benchmark.num_of_keys > 0 ? benchmark.num_of_keys
+                                                    : num_of_ops;
+        for (int i = 0; i < num_of_keys; ++i) {
+          fixture.keys.push_back(Key(i, sizes.key_size));
+        }
+        fixture.value = std::string(sizes.value_size, 'v');
+        fixture.ops_per_thread = num_of_ops / num_of_threads;
+        benchmark.setup(&fixture);
+        Clock::duration elapsed =
+            RunThreads(num_of_threads, num_of_ops, [&](int thread, int i) {
+              benchmark.op(&fixture, thread, i);
+            });
+        Report(benchmark.name, num_of_threads, sizes, num_of_ops, elapsed);
+      }
+    }
+  }
+  if (!options.wal_path.empty()) unlink(options.wal_path.c_str());
+  return 0;
+}
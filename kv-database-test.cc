@@ -0,0 +1,172 @@
+// Tests of KeyValueDataBase, without gRPC in the loop.
+//
+// Prints one line per failed check and exits non-zero if any failed.
+//
+// Usage: `./kv-database-test`
+
+#include <unistd.h>
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "kv-database.h"
+#include "time_log.h"
+#include "wal.h"
+
+using keyvaluestore::KeyValueDataBase;
+using keyvaluestore::Operation;
+using keyvaluestore::OperationType;
+using keyvaluestore::WriteAheadLog;
+
+namespace {
+
+// The write log key of MultiPaxosServiceImpl.
+constexpr char kLogKey[] = "#log";
+
+int failures = 0;
+
+#define CHECK(condition)                                                   \
+  do {                                                                     \
+    if (!(condition)) {                                                    \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "       \
+                << #condition << std::endl;                                \
+      ++failures;                                                          \
+    }                                                                      \
+  } while (false)
+
+void TestAcceptRecordsProposal() {
+  KeyValueDataBase db;
+  CHECK(db.AcceptIfNotSuperseded(kLogKey, 1, 3, OperationType::SET, "v").ok());
+  auto state = db.GetAcceptorState(kLogKey, 1);
+  CHECK(state.accepted_id == 3);
+  CHECK(state.accepted_type == OperationType::SET);
+  CHECK(state.accepted != nullptr && state.accepted->value == "v");
+
+  google::protobuf::RepeatedPtrField<Operation> operations;
+  operations.Add()->set_key("k");
+  CHECK(db.AcceptIfNotSuperseded(kLogKey, 2, 3, operations).ok());
+  state = db.GetAcceptorState(kLogKey, 2);
+  CHECK(state.accepted_type == OperationType::BATCH);
+  CHECK(state.accepted != nullptr && state.accepted->operations.size() == 1);
+}
+
+void TestAcceptRefusesLowerThanPromisedId() {
+  KeyValueDataBase db;
+  db.AddPaxosLog("coordinator", 1, 5);
+  grpc::Status status = db.AcceptIfNotSuperseded(
+      "coordinator", 1, 4, OperationType::SET, "v");
+  CHECK(status.error_code() == grpc::StatusCode::ABORTED);
+  CHECK(db.GetAcceptorState("coordinator", 1).accepted_id == 0);
+  CHECK(db.AcceptIfNotSuperseded("coordinator", 1, 5, OperationType::SET, "v")
+            .ok());
+}
+
+void TestAcceptRefusesOutdatedTerm() {
+  KeyValueDataBase db;
+  CHECK(db.PromiseBallot(2));
+  grpc::Status status =
+      db.AcceptIfNotSuperseded(kLogKey, 1, 1, OperationType::SET, "v");
+  CHECK(status.error_code() == grpc::StatusCode::FAILED_PRECONDITION);
+  CHECK(db.GetAcceptorState(kLogKey, 1).accepted_id == 0);
+  // Elections are not bound by the Coordinator's term.
+  CHECK(db.AcceptIfNotSuperseded("coordinator", 1, 1, OperationType::SET, "v")
+            .ok());
+  CHECK(db.AcceptIfNotSuperseded(kLogKey, 1, 2, OperationType::SET, "v").ok());
+}
+
+int CountAccepted(KeyValueDataBase& db) {
+  int accepted = 0;
+  for (const auto& log : db.GetPaxosLogs(kLogKey)) {
+    if (log.second.accepted_id() > 0) ++accepted;
+  }
+  return accepted;
+}
+
+// A new Coordinator promised a ballot must find, in the logs it reads after
+// the promise, every proposal of an older term that was accepted: none may
+// be accepted once the promise is made.
+void TestNoAcceptAfterPromise() {
+  constexpr int kIterations = 200;
+  constexpr int kRounds = 64;
+  for (int i = 0; i < kIterations; ++i) {
+    KeyValueDataBase db;
+    std::atomic<bool> started{false};
+    std::thread proposer([&db, &started] {
+      for (int round = 1; round <= kRounds; ++round) {
+        db.AcceptIfNotSuperseded(kLogKey, round, 1, OperationType::SET, "v");
+        started = true;
+      }
+    });
+    while (!started) std::this_thread::yield();
+    CHECK(db.PromiseBallot(2));
+    int seen = CountAccepted(db);
+    proposer.join();
+    CHECK(CountAccepted(db) == seen);
+    if (CountAccepted(db) != seen) return;
+  }
+}
+
+// A checkpoint taken while writes and compactions go on must replay to the
+// same state as the database it was taken from.
+void TestCheckpointWhileWriting() {
+  const std::string wal_path =
+      "/tmp/kv-database-test-" + std::to_string(getpid()) + ".wal";
+  unlink(wal_path.c_str());
+  auto wal = std::make_unique<WriteAheadLog>(wal_path);
+  auto db = std::make_unique<KeyValueDataBase>(wal.get());
+  CHECK(db->ReplayWal().ok());
+  constexpr int kRounds = 2000;
+  std::atomic<bool> written{false};
+  std::thread writer([&db, &written] {
+    for (int round = 1; round <= kRounds; ++round) {
+      db->SetValue("k" + std::to_string(round), std::to_string(round));
+      db->AcceptIfNotSuperseded(kLogKey, round, 1, OperationType::SET, "v");
+      db->SetChosen(kLogKey, round);
+      if (round % 100 == 0) {
+        int num_of_rounds = 0;
+        db->CompactPaxosLogs(kLogKey, round - 50, &num_of_rounds);
+      }
+    }
+    written = true;
+  });
+  while (!written) CHECK(db->CheckpointWal().ok());
+  writer.join();
+  auto data_map = db->GetDataMap();
+  auto paxos_logs = db->GetPaxosLogsMap();
+  db.reset();
+  wal.reset();
+
+  wal = std::make_unique<WriteAheadLog>(wal_path);
+  db = std::make_unique<KeyValueDataBase>(wal.get());
+  CHECK(db->ReplayWal().ok());
+  CHECK(db->GetDataMap() == data_map);
+  auto replayed_logs = db->GetPaxosLogsMap();
+  CHECK(replayed_logs.size() == paxos_logs.size());
+  for (const auto& logs : paxos_logs) {
+    CHECK(replayed_logs[logs.first].size() == logs.second.size());
+  }
+  CHECK(db->GetCompactedRound(kLogKey) == kRounds - 50);
+  db.reset();
+  wal.reset();
+  unlink(wal_path.c_str());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  time_log::SetLevel(time_log::Level::kWarning);
+  TestAcceptRecordsProposal();
+  TestAcceptRefusesLowerThanPromisedId();
+  TestAcceptRefusesOutdatedTerm();
+  TestNoAcceptAfterPromise();
+  TestCheckpointWhileWriting();
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed." << std::endl;
+    return 1;
+  }
+  std::cout << "All tests passed." << std::endl;
+  return 0;
+}
@@ -1,15 +1,180 @@
 #include "kv-database.h"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 namespace keyvaluestore {
 
 using grpc::Status;
 using keyvaluestore::PaxosLog;
+using keyvaluestore::WalRecord;
+
+using ReaderLock = std::shared_lock<std::shared_mutex>;
+using WriterLock = std::unique_lock<std::shared_mutex>;
+
+// Returns a WAL record of operations executed in slot.
+template <typename Operations>
+static WalRecord AppliedRecord(const Operations& operations, int slot) {
+  WalRecord record;
+  record.mutable_applied()->set_slot(slot);
+  for (const Operation& operation : operations) {
+    *record.mutable_applied()->add_operations() = operation;
+  }
+  return record;
+}
+
+// Converts an acceptor state to a PaxosLog, for RPCs and the write-ahead
+// log.
+static PaxosLog ToPaxosLog(const AcceptorState& state) {
+  PaxosLog paxos_log;
+  paxos_log.set_promised_id(state.promised_id);
+  paxos_log.set_accepted_id(state.accepted_id);
+  paxos_log.set_accepted_type(state.accepted_type);
+  paxos_log.set_chosen(state.chosen);
+  if (state.accepted != nullptr) {
+    paxos_log.set_accepted_value(state.accepted->value);
+    for (const Operation& operation : state.accepted->operations) {
+      *paxos_log.add_accepted_operations() = operation;
+    }
+  }
+  return paxos_log;
+}
+
+static AcceptorState FromPaxosLog(const PaxosLog& paxos_log) {
+  AcceptorState state;
+  state.promised_id = paxos_log.promised_id();
+  state.accepted_id = paxos_log.accepted_id();
+  state.accepted_type = paxos_log.accepted_type();
+  state.chosen = paxos_log.chosen();
+  if (paxos_log.accepted_id() > 0) {
+    state.accepted = std::make_shared<const AcceptedValue>(AcceptedValue{
+        paxos_log.accepted_value(),
+        {paxos_log.accepted_operations().begin(),
+         paxos_log.accepted_operations().end()}});
+  }
+  return state;
+}
+
+AcceptorState* KeyValueDataBase::RoundLog::Find(int round) {
+  int index = round / static_cast<int>(kNumOfShards) - first_index;
+  if (index < 0 || index >= static_cast<int>(states.size()) ||
+      !states[index].has_value()) {
+    return nullptr;
+  }
+  return &*states[index];
+}
+
+AcceptorState& KeyValueDataBase::RoundLog::FindOrAdd(int round) {
+  int index = round / static_cast<int>(kNumOfShards);
+  if (states.empty()) {
+    first_index = index;
+    round_offset = round % kNumOfShards;
+  }
+  for (; index < first_index; --first_index) states.emplace_front();
+  while (index >= first_index + static_cast<int>(states.size())) {
+    states.emplace_back();
+  }
+  auto& state = states[index - first_index];
+  if (!state.has_value()) state.emplace();
+  return *state;
+}
+
+size_t KeyValueDataBase::RoundLog::DropUpTo(int round, int* num_of_rounds) {
+  size_t freed_bytes = 0;
+  while (!states.empty() &&
+         first_index * static_cast<int>(kNumOfShards) + round_offset <=
+             round) {
+    const auto& state = states.front();
+    if (state.has_value()) {
+      ++*num_of_rounds;
+      freed_bytes += sizeof(*state);
+      // The value may still be shared with a reader.
+      if (state->accepted != nullptr && state->accepted.use_count() == 1) {
+        freed_bytes += sizeof(AcceptedValue) + state->accepted->value.size();
+        for (const Operation& operation : state->accepted->operations) {
+          freed_bytes += operation.SpaceUsedLong();
+        }
+      }
+    }
+    states.pop_front();
+    ++first_index;
+  }
+  return freed_bytes;
+}
+
+template <typename Fn>
+void KeyValueDataBase::RoundLog::ForEach(int from, int to,
+                                         const Fn& fn) const {
+  for (size_t i = 0; i < states.size(); ++i) {
+    int round = (first_index + static_cast<int>(i)) *
+                    static_cast<int>(kNumOfShards) +
+                round_offset;
+    if (round > to) break;
+    if (round >= from && states[i].has_value()) fn(round, *states[i]);
+  }
+}
+
+int KeyValueDataBase::RoundLog::LastRound() const {
+  for (size_t i = states.size(); i > 0; --i) {
+    if (states[i - 1].has_value()) {
+      return (first_index + static_cast<int>(i) - 1) *
+                 static_cast<int>(kNumOfShards) +
+             round_offset;
+    }
+  }
+  return 0;
+}
+
+KeyValueDataBase::KeyValueDataBase(WriteAheadLog* wal) : wal_(wal) {}
+
+Status KeyValueDataBase::ReplayWal() {
+  if (wal_ == nullptr) return Status::OK;
+  Status status =
+      wal_->Open([this](const WalRecord& record) { Redo(record); });
+  // Drop a snapshot whose last chunk never made it to disk.
+  replayed_snapshot_.clear();
+  return status;
+}
+
+KeyValueDataBase::DataShard& KeyValueDataBase::DataShardOf(
+    const std::string& key) {
+  return data_shards_[std::hash<std::string>()(key) % kNumOfShards];
+}
+
+KeyValueDataBase::PaxosShard& KeyValueDataBase::PaxosShardOf(
+    const std::string& key, int round) {
+  return paxos_shards_[(std::hash<std::string>()(key) + round) % kNumOfShards];
+}
+
+// Locking shards in a fixed order keeps multi-shard lockers from
+// deadlocking.
+template <typename Lock>
+std::vector<Lock> KeyValueDataBase::LockDataShards(
+    std::vector<size_t> indexes) {
+  if (indexes.empty()) {
+    for (size_t i = 0; i < kNumOfShards; ++i) indexes.push_back(i);
+  }
+  std::sort(indexes.begin(), indexes.end());
+  indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+  std::vector<Lock> locks;
+  for (size_t i : indexes) locks.emplace_back(data_shards_[i].mtx);
+  return locks;
+}
+
+void KeyValueDataBase::RaiseAppliedSlot(int slot) {
+  int applied_slot = applied_slot_.load();
+  while (slot > applied_slot &&
+         !applied_slot_.compare_exchange_weak(applied_slot, slot)) {
+  }
+}
 
 // Return whether the value is found.
 bool KeyValueDataBase::GetValue(const std::string& key, std::string* value) {
-  std::shared_lock<std::shared_mutex> reader_lock(data_mtx_);
-  auto iter = data_map_.find(key);
-  if (iter == data_map_.end()) return false;
+  DataShard& shard = DataShardOf(key);
+  ReaderLock reader_lock(shard.mtx);
+  auto iter = shard.data_map.find(key);
+  if (iter == shard.data_map.end()) return false;
   *value = iter->second;
   return true;
 }
@@ -18,98 +183,583 @@ bool KeyValueDataBase::GetValue(const std::string& key, std::string* value) {
 // pair is newly added.
 bool KeyValueDataBase::SetValue(const std::string& key,
                                 const std::string& val) {
-  std::unique_lock<std::shared_mutex> writer_lock(data_mtx_);
-  bool found = data_map_.find(key) != data_map_.end();
-  data_map_[key] = val;
+  Operation operation;
+  operation.set_key(key);
+  operation.set_type(OperationType::SET);
+  operation.set_value(val);
+  DataShard& shard = DataShardOf(key);
+  bool found;
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    found = shard.data_map.find(key) != shard.data_map.end();
+    shard.data_map[key] = val;
+    if (wal_ != nullptr) {
+      lsn = Log(AppliedRecord(std::vector<Operation>{operation}, 0));
+    }
+  }
+  Sync(lsn);
   return found;
 }
 
 // Returns true if the deletion actually happens, false if the key
 // didn't exist.
 bool KeyValueDataBase::DeleteEntry(const std::string& key) {
-  std::unique_lock<std::shared_mutex> writer_lock(data_mtx_);
-  bool found = data_map_.find(key) != data_map_.end();
-  data_map_.erase(key);
+  Operation operation;
+  operation.set_key(key);
+  operation.set_type(OperationType::DELETE);
+  DataShard& shard = DataShardOf(key);
+  bool found;
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    found = shard.data_map.erase(key) > 0;
+    if (wal_ != nullptr) {
+      lsn = Log(AppliedRecord(std::vector<Operation>{operation}, 0));
+    }
+  }
+  Sync(lsn);
   return found;
 }
 
-// Returns a copy of data_map_.
+// Executes SET and DELETE operations of a slot under the locks of the shards
+// they touch.
+void KeyValueDataBase::ApplyOperations(const std::vector<Operation>& operations,
+                                       int slot) {
+  std::vector<size_t> indexes;
+  for (const Operation& operation : operations) {
+    indexes.push_back(std::hash<std::string>()(operation.key()) %
+                      kNumOfShards);
+  }
+  // A slot without operations still appends to wal_, which must happen
+  // under some shard lock.
+  if (indexes.empty()) indexes.push_back(0);
+  uint64_t lsn = 0;
+  {
+    auto writer_locks = LockDataShards<WriterLock>(std::move(indexes));
+    for (const Operation& operation : operations) Execute(operation);
+    // Raised after the operations are visible, so that a GetDataMap() copy
+    // fully reflects the slot it reports.
+    RaiseAppliedSlot(slot);
+    if (wal_ != nullptr) lsn = Log(AppliedRecord(operations, slot));
+  }
+  Sync(lsn);
+}
+
+void KeyValueDataBase::Execute(const Operation& operation) {
+  auto& data_map = DataShardOf(operation.key()).data_map;
+  switch (operation.type()) {
+    case OperationType::SET:
+      data_map[operation.key()] = operation.value();
+      break;
+    case OperationType::DELETE:
+      data_map.erase(operation.key());
+      break;
+    default:
+      break;
+  }
+}
+
+int KeyValueDataBase::GetAppliedSlot() { return applied_slot_.load(); }
+
+// Replaces the data with a recovery snapshot.
+void KeyValueDataBase::ResetData(
+    std::unordered_map<std::string, std::string> data_map, int applied_slot) {
+  uint64_t lsn = 0;
+  {
+    auto writer_locks = LockDataShards<WriterLock>();
+    for (auto& shard : data_shards_) shard.data_map.clear();
+    for (auto& kv : data_map) {
+      DataShardOf(kv.first).data_map.insert(std::move(kv));
+    }
+    applied_slot_ = applied_slot;
+    loading_snapshot_ = false;
+    if (wal_ != nullptr) {
+      WalRecord record;
+      record.mutable_snapshot()->set_applied_slot(applied_slot);
+      for (const auto& shard : data_shards_) {
+        record.mutable_snapshot()->mutable_kv_map()->insert(
+            shard.data_map.begin(), shard.data_map.end());
+      }
+      lsn = Log(record);
+    }
+  }
+  Sync(lsn);
+}
+
+// Loads one chunk of a recovery snapshot.
+void KeyValueDataBase::LoadSnapshotChunk(
+    const google::protobuf::Map<std::string, std::string>& chunk,
+    int applied_slot, bool first, bool last) {
+  uint64_t lsn = 0;
+  {
+    auto writer_locks = LockDataShards<WriterLock>();
+    if (first) {
+      for (auto& shard : data_shards_) shard.data_map.clear();
+    }
+    for (const auto& kv : chunk) {
+      DataShardOf(kv.first).data_map[kv.first] = kv.second;
+    }
+    applied_slot_ = applied_slot;
+    loading_snapshot_ = !last;
+    if (wal_ != nullptr) {
+      WalRecord record;
+      record.mutable_snapshot()->set_applied_slot(applied_slot);
+      *record.mutable_snapshot()->mutable_kv_map() = chunk;
+      record.mutable_snapshot()->set_continued(!first);
+      record.mutable_snapshot()->set_incomplete(!last);
+      lsn = Log(record);
+    }
+  }
+  Sync(lsn);
+}
+
+// Returns a copy of the data.
 std::unordered_map<std::string, std::string> KeyValueDataBase::GetDataMap() {
-  std::shared_lock<std::shared_mutex> reader_lock(data_mtx_);
-  return data_map_;
+  int applied_slot;
+  return GetDataMap(&applied_slot);
+}
+
+// Returns a copy of the data and a slot it fully reflects. Reading the slot
+// first makes it a lower bound for what the shards reflect.
+std::unordered_map<std::string, std::string> KeyValueDataBase::GetDataMap(
+    int* applied_slot) {
+  *applied_slot = applied_slot_.load();
+  std::unordered_map<std::string, std::string> data_map;
+  for (auto& shard : data_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    data_map.insert(shard.data_map.begin(), shard.data_map.end());
+  }
+  return data_map;
+}
+
+std::unordered_map<std::string, std::string> KeyValueDataBase::GetDataShard(
+    size_t index) {
+  DataShard& shard = data_shards_[index];
+  ReaderLock reader_lock(shard.mtx);
+  return shard.data_map;
 }
 
-// Returns a set of keys in paxos_logs_map_.
+// Returns a set of keys that have Paxos logs.
 std::unordered_set<std::string> KeyValueDataBase::GetPaxosLogKeys() {
-  std::shared_lock<std::shared_mutex> reader_lock(paxos_logs_mtx_);
   std::unordered_set<std::string> keys;
-  for (const auto& log : paxos_logs_map_) {
-    keys.insert(log.first);
+  for (auto& shard : paxos_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    for (const auto& logs : shard.round_logs) {
+      if (!logs.second.states.empty()) keys.insert(logs.first);
+    }
   }
   return keys;
 }
+
 // Returns a copy of PaxosLogsMap of a key.
 std::map<int, keyvaluestore::PaxosLog> KeyValueDataBase::GetPaxosLogs(
     const std::string& key) {
-  std::shared_lock<std::shared_mutex> reader_lock(paxos_logs_mtx_);
-  return paxos_logs_map_[key];
+  return GetPaxosLogs(key, std::numeric_limits<int>::min(),
+                      std::numeric_limits<int>::max());
+}
+
+// Returns a copy of the Paxos logs of a key in rounds [from_round, to_round],
+// merged from all shards.
+std::map<int, keyvaluestore::PaxosLog> KeyValueDataBase::GetPaxosLogs(
+    const std::string& key, int from_round, int to_round) {
+  std::map<int, PaxosLog> paxos_logs;
+  for (auto& shard : paxos_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    auto logs = shard.round_logs.find(key);
+    if (logs == shard.round_logs.end()) continue;
+    logs->second.ForEach(from_round, to_round,
+                         [&](int round, const AcceptorState& state) {
+                           paxos_logs.emplace(round, ToPaxosLog(state));
+                         });
+  }
+  return paxos_logs;
 }
 
-// Returns the mapped Paxos log for given key & round.
-// A new element will be constructed using its default constructor and inserted
-// if key or round is not found.
-PaxosLog KeyValueDataBase::GetPaxosLog(const std::string& key, int round) {
-  std::shared_lock<std::shared_mutex> reader_lock(paxos_logs_mtx_);
-  return paxos_logs_map_[key][round];
+// Returns the acceptor state of key & round.
+// Returns an empty state if key or round is not found.
+AcceptorState KeyValueDataBase::GetAcceptorState(const std::string& key,
+                                                 int round) {
+  PaxosShard& shard = PaxosShardOf(key, round);
+  ReaderLock reader_lock(shard.mtx);
+  auto logs = shard.round_logs.find(key);
+  if (logs == shard.round_logs.end()) return AcceptorState();
+  AcceptorState* state = logs->second.Find(round);
+  if (state == nullptr) return AcceptorState();
+  return *state;
 }
 
-// Returns a copy of paxos_logs_map_.
+// Returns a copy of all Paxos logs.
 std::unordered_map<std::string, std::map<int, keyvaluestore::PaxosLog>>
 KeyValueDataBase::GetPaxosLogsMap() {
-  return paxos_logs_map_;
+  std::unordered_map<std::string, std::map<int, PaxosLog>> paxos_logs_map;
+  for (auto& shard : paxos_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    for (const auto& logs : shard.round_logs) {
+      auto& paxos_logs = paxos_logs_map[logs.first];
+      logs.second.ForEach(std::numeric_limits<int>::min(),
+                          std::numeric_limits<int>::max(),
+                          [&](int round, const AcceptorState& state) {
+                            paxos_logs.emplace(round, ToPaxosLog(state));
+                          });
+    }
+  }
+  return paxos_logs_map;
 }
 
 // Returns the latest Paxos round number for the given key.
-// A new element will be constructed using its default constructor and
-// inserted if key is not found.
 // Returns 0 if round is not found for given key.
 int KeyValueDataBase::GetLatestRound(const std::string& key) {
-  std::shared_lock<std::shared_mutex> reader_lock(paxos_logs_mtx_);
-  if (paxos_logs_map_[key].empty()) return 0;
-  return paxos_logs_map_[key].rbegin()->first;
+  int latest_round = GetCompactedRound(key);
+  for (auto& shard : paxos_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    auto logs = shard.round_logs.find(key);
+    if (logs == shard.round_logs.end()) continue;
+    latest_round = std::max(latest_round, logs->second.LastRound());
+  }
+  return latest_round;
+}
+
+int KeyValueDataBase::GetPromisedBallot() {
+  ReaderLock reader_lock(ballot_mtx_);
+  return promised_ballot_;
+}
+
+bool KeyValueDataBase::PromiseBallot(int ballot) {
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(ballot_mtx_);
+    if (ballot < promised_ballot_) return false;
+    if (ballot == promised_ballot_) return true;
+    promised_ballot_ = ballot;
+    WalRecord record;
+    record.set_promised_ballot(ballot);
+    lsn = Log(record);
+  }
+  Sync(lsn);
+  return true;
 }
+
 // Add PaxosLog when Acceptor receives a proposal.
 void KeyValueDataBase::AddPaxosLog(const std::string& key, int round) {
-  std::unique_lock<std::shared_mutex> writer_lock(paxos_logs_mtx_);
-  (paxos_logs_map_[key])[round];
+  PaxosShard& shard = PaxosShardOf(key, round);
+  WriterLock writer_lock(shard.mtx);
+  shard.round_logs[key].FindOrAdd(round);
 }
-// Update the promised_id in paxos_logs_map_ for the given key and round.
+// Update the promised_id in the Paxos logs for the given key and round.
 void KeyValueDataBase::AddPaxosLog(const std::string& key, int round,
                                    int promised_id) {
-  std::unique_lock<std::shared_mutex> writer_lock(paxos_logs_mtx_);
-  (paxos_logs_map_[key])[round].set_promised_id(promised_id);
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    shard.round_logs[key].FindOrAdd(round).promised_id = promised_id;
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
 }
 
-// Update the acceptance info in paxos_logs_map_ for the given key and round.
+// Update the acceptance info in the Paxos logs for the given key and round.
 void KeyValueDataBase::AddPaxosLog(const std::string& key, int round,
                                    int accepted_id, OperationType accepted_type,
                                    std::string accepted_value) {
-  std::unique_lock<std::shared_mutex> writer_lock(paxos_logs_mtx_);
-  (paxos_logs_map_[key])[round].set_accepted_id(accepted_id);
-  (paxos_logs_map_[key])[round].set_accepted_type(accepted_type);
-  (paxos_logs_map_[key])[round].set_accepted_value(accepted_value);
+  auto accepted = std::make_shared<const AcceptedValue>(
+      AcceptedValue{std::move(accepted_value), {}});
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    AcceptorState& state = shard.round_logs[key].FindOrAdd(round);
+    state.accepted_id = accepted_id;
+    state.accepted_type = accepted_type;
+    state.accepted = std::move(accepted);
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
+}
+
+// Update the acceptance info of a batch of operations in the Paxos logs for
+// the given key and round.
+void KeyValueDataBase::AddPaxosLog(
+    const std::string& key, int round, int accepted_id,
+    const google::protobuf::RepeatedPtrField<Operation>& operations) {
+  auto accepted = std::make_shared<const AcceptedValue>(
+      AcceptedValue{"", {operations.begin(), operations.end()}});
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    AcceptorState& state = shard.round_logs[key].FindOrAdd(round);
+    state.accepted_id = accepted_id;
+    state.accepted_type = OperationType::BATCH;
+    state.accepted = std::move(accepted);
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
 }
 
 // Add PaxosLog from recovery snapshot.
 void KeyValueDataBase::AddPaxosLog(const std::string& key, int round,
-                                   int promised_id, int accepted_id,
-                                   OperationType accepted_type,
-                                   std::string accepted_value) {
-  std::unique_lock<std::shared_mutex> writer_lock(paxos_logs_mtx_);
-  (paxos_logs_map_[key])[round].set_promised_id(promised_id);
-  (paxos_logs_map_[key])[round].set_accepted_id(accepted_id);
-  (paxos_logs_map_[key])[round].set_accepted_type(accepted_type);
-  (paxos_logs_map_[key])[round].set_accepted_value(accepted_value);
+                                   const PaxosLog& paxos_log) {
+  AcceptorState new_state = FromPaxosLog(paxos_log);
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    shard.round_logs[key].FindOrAdd(round) = std::move(new_state);
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
+}
+
+Status KeyValueDataBase::AcceptIfNotSuperseded(const std::string& key,
+                                               int round, int accepted_id,
+                                               OperationType accepted_type,
+                                               std::string accepted_value) {
+  return AcceptIfNotSuperseded(
+      key, round, accepted_id, accepted_type,
+      std::make_shared<const AcceptedValue>(
+          AcceptedValue{std::move(accepted_value), {}}));
+}
+
+Status KeyValueDataBase::AcceptIfNotSuperseded(
+    const std::string& key, int round, int accepted_id,
+    const google::protobuf::RepeatedPtrField<Operation>& operations) {
+  return AcceptIfNotSuperseded(
+      key, round, accepted_id, OperationType::BATCH,
+      std::make_shared<const AcceptedValue>(
+          AcceptedValue{"", {operations.begin(), operations.end()}}));
+}
+
+// Holding ballot_mtx_ keeps PromiseBallot() out until the acceptance is
+// logged, so a new Coordinator either sees it in PrepareLeader or it is
+// refused.
+Status KeyValueDataBase::AcceptIfNotSuperseded(
+    const std::string& key, int round, int accepted_id,
+    OperationType accepted_type,
+    std::shared_ptr<const AcceptedValue> accepted) {
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    ReaderLock ballot_lock(ballot_mtx_);
+    AcceptorState& state = shard.round_logs[key].FindOrAdd(round);
+    if (state.promised_id > accepted_id) {
+      return Status(grpc::StatusCode::ABORTED,
+                    "Aborted. Proposal ID is too low.");
+    }
+    if (key != "coordinator" && promised_ballot_ > accepted_id) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    "Aborted. Coordinator term is outdated.");
+    }
+    state.accepted_id = accepted_id;
+    state.accepted_type = accepted_type;
+    state.accepted = std::move(accepted);
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
+  return Status::OK;
+}
+
+// Mark the accepted proposal of key & round as chosen.
+void KeyValueDataBase::SetChosen(const std::string& key, int round) {
+  PaxosShard& shard = PaxosShardOf(key, round);
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(shard.mtx);
+    AcceptorState& state = shard.round_logs[key].FindOrAdd(round);
+    if (state.chosen) return;
+    state.chosen = true;
+    lsn = LogPaxosLog(key, round);
+  }
+  Sync(lsn);
+}
+
+// Drop the Paxos logs of key up to round. The compaction is logged first;
+// the rounds are then dropped one shard at a time.
+size_t KeyValueDataBase::CompactPaxosLogs(const std::string& key, int round,
+                                          int* num_of_rounds) {
+  *num_of_rounds = 0;
+  uint64_t lsn = 0;
+  {
+    WriterLock writer_lock(compaction_mtx_);
+    int& compacted_round = compacted_rounds_[key];
+    if (round <= compacted_round) return 0;
+    compacted_round = round;
+    if (wal_ != nullptr) {
+      WalRecord record;
+      record.mutable_compaction()->set_key(key);
+      record.mutable_compaction()->set_round(round);
+      lsn = Log(record);
+    }
+  }
+  size_t freed_bytes = 0;
+  for (auto& shard : paxos_shards_) {
+    WriterLock writer_lock(shard.mtx);
+    auto logs = shard.round_logs.find(key);
+    if (logs == shard.round_logs.end()) continue;
+    freed_bytes += logs->second.DropUpTo(round, num_of_rounds);
+  }
+  Sync(lsn);
+  return freed_bytes;
+}
+
+int KeyValueDataBase::GetCompactedRound(const std::string& key) {
+  ReaderLock reader_lock(compaction_mtx_);
+  auto compacted = compacted_rounds_.find(key);
+  if (compacted == compacted_rounds_.end()) return 0;
+  return compacted->second;
+}
+
+bool KeyValueDataBase::WalNeedsCheckpoint() {
+  return wal_ != nullptr && wal_->NeedsCheckpoint();
+}
+
+// Rewrite the write-ahead log from the current state. Every append happens
+// under the lock of the state it changes, so the state copied after
+// BeginCheckpoint() reflects every record appended before. The shards are
+// then copied one at a time, and the records appended meanwhile, replayed
+// after the copy, bring each shard to the same state in the end.
+Status KeyValueDataBase::CheckpointWal() {
+  if (wal_ == nullptr) return Status::OK;
+  int applied_slot;
+  {
+    // Loading a snapshot takes every data shard lock.
+    ReaderLock data_lock(data_shards_[0].mtx);
+    if (loading_snapshot_) {
+      return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                    "A recovery snapshot is being loaded.");
+    }
+    wal_->BeginCheckpoint();
+    applied_slot = applied_slot_;
+  }
+  std::vector<WalRecord> records;
+  // The data goes in one snapshot chunk per shard.
+  for (size_t i = 0; i < kNumOfShards; ++i) {
+    WalRecord snapshot;
+    snapshot.mutable_snapshot()->set_applied_slot(applied_slot);
+    snapshot.mutable_snapshot()->set_continued(i > 0);
+    snapshot.mutable_snapshot()->set_incomplete(i + 1 < kNumOfShards);
+    ReaderLock reader_lock(data_shards_[i].mtx);
+    snapshot.mutable_snapshot()->mutable_kv_map()->insert(
+        data_shards_[i].data_map.begin(), data_shards_[i].data_map.end());
+    records.push_back(std::move(snapshot));
+  }
+  std::vector<WalRecord> paxos_logs;
+  for (auto& shard : paxos_shards_) {
+    ReaderLock reader_lock(shard.mtx);
+    for (const auto& logs : shard.round_logs) {
+      logs.second.ForEach(std::numeric_limits<int>::min(),
+                          std::numeric_limits<int>::max(),
+                          [&](int round, const AcceptorState& state) {
+                            WalRecord record;
+                            record.mutable_paxos_log()->set_key(logs.first);
+                            record.mutable_paxos_log()->set_round(round);
+                            *record.mutable_paxos_log()->mutable_log() =
+                                ToPaxosLog(state);
+                            paxos_logs.push_back(std::move(record));
+                          });
+    }
+  }
+  {
+    ReaderLock ballot_lock(ballot_mtx_);
+    WalRecord promise;
+    promise.set_promised_ballot(promised_ballot_);
+    records.push_back(std::move(promise));
+  }
+  {
+    // Copied after the Paxos logs, and replayed before them, so that the
+    // rounds dropped meanwhile are skipped.
+    ReaderLock compaction_lock(compaction_mtx_);
+    for (const auto& compacted : compacted_rounds_) {
+      WalRecord record;
+      record.mutable_compaction()->set_key(compacted.first);
+      record.mutable_compaction()->set_round(compacted.second);
+      records.push_back(std::move(record));
+    }
+  }
+  records.insert(records.end(), std::make_move_iterator(paxos_logs.begin()),
+                 std::make_move_iterator(paxos_logs.end()));
+  return wal_->Rewrite(records);
+}
+
+// Replays without locks: nothing else runs before ReplayWal() returns.
+void KeyValueDataBase::Redo(const WalRecord& record) {
+  switch (record.record_case()) {
+    case WalRecord::kPaxosLog: {
+      const auto& entry = record.paxos_log();
+      // Skip rounds dropped while a checkpoint was being taken.
+      auto compacted = compacted_rounds_.find(entry.key());
+      if (compacted != compacted_rounds_.end() &&
+          entry.round() <= compacted->second) {
+        break;
+      }
+      PaxosShardOf(entry.key(), entry.round())
+          .round_logs[entry.key()]
+          .FindOrAdd(entry.round()) = FromPaxosLog(entry.log());
+      break;
+    }
+    case WalRecord::kPromisedBallot:
+      promised_ballot_ = std::max(promised_ballot_, record.promised_ballot());
+      break;
+    case WalRecord::kApplied:
+      for (const Operation& operation : record.applied().operations()) {
+        Execute(operation);
+      }
+      RaiseAppliedSlot(record.applied().slot());
+      break;
+    case WalRecord::kSnapshot: {
+      // Stage chunks so that a snapshot cut off by a crash is ignored.
+      const auto& snapshot = record.snapshot();
+      if (!snapshot.continued()) replayed_snapshot_.clear();
+      for (const auto& kv : snapshot.kv_map()) {
+        replayed_snapshot_[kv.first] = kv.second;
+      }
+      if (snapshot.incomplete()) break;
+      for (auto& shard : data_shards_) shard.data_map.clear();
+      for (auto& kv : replayed_snapshot_) {
+        DataShardOf(kv.first).data_map.insert(std::move(kv));
+      }
+      replayed_snapshot_.clear();
+      applied_slot_ = snapshot.applied_slot();
+      break;
+    }
+    case WalRecord::kCompaction: {
+      const auto& compaction = record.compaction();
+      int& compacted_round = compacted_rounds_[compaction.key()];
+      compacted_round = std::max(compacted_round, compaction.round());
+      int num_of_rounds = 0;
+      for (auto& shard : paxos_shards_) {
+        auto logs = shard.round_logs.find(compaction.key());
+        if (logs == shard.round_logs.end()) continue;
+        logs->second.DropUpTo(compacted_round, &num_of_rounds);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+uint64_t KeyValueDataBase::LogPaxosLog(const std::string& key, int round) {
+  if (wal_ == nullptr) return 0;
+  WalRecord record;
+  record.mutable_paxos_log()->set_key(key);
+  record.mutable_paxos_log()->set_round(round);
+  AcceptorState* state = PaxosShardOf(key, round).round_logs[key].Find(round);
+  if (state != nullptr) {
+    *record.mutable_paxos_log()->mutable_log() = ToPaxosLog(*state);
+  }
+  return wal_->Append(record);
+}
+
+uint64_t KeyValueDataBase::Log(const WalRecord& record) {
+  if (wal_ == nullptr) return 0;
+  return wal_->Append(record);
+}
+
+void KeyValueDataBase::Sync(uint64_t lsn) {
+  if (wal_ != nullptr && lsn > 0) wal_->Sync(lsn);
 }
 
 }  // namespace keyvaluestore
@@ -2,31 +2,64 @@
 #define KV_DATABASE_H
 
 #include <grpcpp/grpcpp.h>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include "keyvaluestore.grpc.pb.h"
+#include "wal.h"
 
 namespace keyvaluestore {
 
-// struct PaxosLog {
-//   PaxosLog() : promised_id(0), accepted_id(0) {}
-//   int promised_id;
-//   int accepted_id;
-//   OperationType accepted_type;
-//   std::string accepted_value;
-// };
+// The value accepted in a Paxos round: a single value, or the operations of
+// a batch. Immutable once accepted.
+struct AcceptedValue {
+  std::string value;
+  std::vector<Operation> operations;
+};
+
+// In-memory acceptor state of one Paxos round. The accepted value is held by
+// reference, so copying the state never copies the value.
+struct AcceptorState {
+  int promised_id = 0;
+  int accepted_id = 0;
+  OperationType accepted_type = OperationType::NOT_SET;
+  bool chosen = false;
+  // Null until a value is accepted.
+  std::shared_ptr<const AcceptedValue> accepted;
+};
 
 // An in-memory implementation of a key-value database.
 //
+// Data and Paxos logs are each split into kNumOfShards hash-partitioned
+// shards with their own locks, so that operations on different keys (or
+// Paxos rounds) do not contend. Whole-store reads visit one shard at a time.
+//
+// Paxos logs are kept as AcceptorStates in contiguous per-key arrays; the
+// PaxosLog protobuf is only built for RPCs and the write-ahead log.
+//
+// If a write-ahead log is given, the database is rebuilt from it on
+// construction, and every state change is on disk before the method making
+// it returns.
 // Thread-safe.
 class KeyValueDataBase {
  public:
+  static constexpr size_t kNumOfShards = 16;
+
+  explicit KeyValueDataBase(WriteAheadLog* wal = nullptr);
+  // Rebuilds the database from the write-ahead log, if any. Must be called
+  // before any other method.
+  grpc::Status ReplayWal();
+
   // Returns whether the value is found.
   bool GetValue(const std::string& key, std::string* value);
   // Returns true if the value is overwritten, false if the key-val
@@ -36,28 +69,67 @@ class KeyValueDataBase {
   // didn't exist.
   bool DeleteEntry(const std::string& key);
 
-  // Returns a copy of data_map_.
+  // Executes the SET and DELETE operations of a write log slot while holding
+  // the locks of all shards they touch, so readers see either none or all of
+  // them, and records the slot as applied. Slots must be applied one at a
+  // time.
+  void ApplyOperations(const std::vector<Operation>& operations, int slot);
+  // Returns the last write log slot executed.
+  int GetAppliedSlot();
+  // Replaces the data with a snapshot that reflects slots up to
+  // applied_slot.
+  void ResetData(std::unordered_map<std::string, std::string> data_map,
+                 int applied_slot);
+  // Loads a snapshot that reflects slots up to applied_slot one chunk at a
+  // time, so it never has to be held in memory whole. The first chunk
+  // replaces the data and later ones add to it. Until the last chunk is
+  // loaded, the data is incomplete and the write-ahead log still replays to
+  // the state before the snapshot.
+  void LoadSnapshotChunk(
+      const google::protobuf::Map<std::string, std::string>& chunk,
+      int applied_slot, bool first, bool last);
+
+  // Returns a copy of the data, taken one shard at a time.
   std::unordered_map<std::string, std::string> GetDataMap();
+  // Returns a copy of the data, taken one shard at a time, and a slot it
+  // fully reflects. Slots executed meanwhile may be reflected in part; the
+  // copy is consistent again once the slots after applied_slot are
+  // re-executed on it.
+  std::unordered_map<std::string, std::string> GetDataMap(int* applied_slot);
+
+  // Returns a copy of the data of one shard, index < kNumOfShards. Copies
+  // of every shard, taken after GetAppliedSlot(), reflect that slot as a
+  // GetDataMap() copy does.
+  std::unordered_map<std::string, std::string> GetDataShard(size_t index);
 
-  // Returns a set of keys in paxos_logs_map_.
+  // Returns a set of keys that have Paxos logs.
   std::unordered_set<std::string> GetPaxosLogKeys();
 
   // Returns a copy of PaxosLogsMap of a key.
   std::map<int, keyvaluestore::PaxosLog> GetPaxosLogs(const std::string& key);
+  // Returns a copy of the Paxos logs of a key in rounds [from_round,
+  // to_round].
+  std::map<int, keyvaluestore::PaxosLog> GetPaxosLogs(const std::string& key,
+                                                      int from_round,
+                                                      int to_round);
 
-  // Returns a copy of paxos_logs_map_.
+  // Returns a copy of all Paxos logs, taken one shard at a time.
   std::unordered_map<std::string, std::map<int, keyvaluestore::PaxosLog>>
   GetPaxosLogsMap();
-  // Returns the mapped Paxos log for given key & round.
-  // A new element will be constructed using its default constructor and
-  // inserted if key or round is not found.
-  keyvaluestore::PaxosLog GetPaxosLog(const std::string& key, int round);
-
-  // Returns the latest Paxos round number for the given key.
-  // A new element will be constructed using its default constructor and
-  // inserted if key or round is not found.
+  // Returns the acceptor state of key & round, sharing its accepted value.
+  // Returns an empty state if key or round is not found.
+  AcceptorState GetAcceptorState(const std::string& key, int round);
+
+  // Returns the latest Paxos round number for the given key, including
+  // compacted rounds. Returns 0 if no round is found for the given key.
   int GetLatestRound(const std::string& key);
 
+  // Returns the highest ballot promised to a stable Coordinator.
+  int GetPromisedBallot();
+  // Promises ballot to a stable Coordinator. Returns false if a higher
+  // ballot has already been promised.
+  bool PromiseBallot(int ballot);
+
   // Add PaxosLog when Acceptor receives a proposal.
   void AddPaxosLog(const std::string& key, int round);
   // Add PaxosLog when Acceptor promises a proposal.
@@ -65,17 +137,121 @@ class KeyValueDataBase {
   // Add PaxosLog when Acceptor accepts a proposal.
   void AddPaxosLog(const std::string& key, int round, int accepted_id,
                    OperationType accepted_type, std::string accepted_value);
+  // Add PaxosLog when Acceptor accepts a batch of operations.
+  void AddPaxosLog(
+      const std::string& key, int round, int accepted_id,
+      const google::protobuf::RepeatedPtrField<Operation>& operations);
   // Add PaxosLog from recovery snapshot.
-  void AddPaxosLog(const std::string& key, int round, int promised_id,
-                   int accepted_id, OperationType accepted_type,
-                   std::string accepted_value);
+  void AddPaxosLog(const std::string& key, int round,
+                   const keyvaluestore::PaxosLog& paxos_log);
+  // Accepts a proposal of key & round unless it is superseded, checking and
+  // accepting in one step so that no promise can come in between. Returns
+  // ABORTED if a higher proposal ID is promised for the round, and, for any
+  // key but "coordinator", FAILED_PRECONDITION if a higher ballot is promised
+  // to a stable Coordinator.
+  grpc::Status AcceptIfNotSuperseded(const std::string& key, int round,
+                                     int accepted_id,
+                                     OperationType accepted_type,
+                                     std::string accepted_value);
+  // Same as above, for a batch of operations.
+  grpc::Status AcceptIfNotSuperseded(
+      const std::string& key, int round, int accepted_id,
+      const google::protobuf::RepeatedPtrField<Operation>& operations);
+  // Mark the accepted proposal of key & round as chosen when Learner is
+  // informed.
+  void SetChosen(const std::string& key, int round);
+
+  // Drops the Paxos logs of key up to round, which must be chosen and
+  // executed. Returns the approximate number of bytes freed, and sets
+  // *num_of_rounds to the number of rounds dropped.
+  size_t CompactPaxosLogs(const std::string& key, int round,
+                          int* num_of_rounds);
+  // Returns the last round of key dropped by compaction, 0 if none.
+  int GetCompactedRound(const std::string& key);
+  // Returns whether the write-ahead log has grown enough since its last
+  // checkpoint to take another. False without a write-ahead log.
+  bool WalNeedsCheckpoint();
+  // Rewrites the write-ahead log as a checkpoint of the current state, so
+  // that it no longer holds dropped rounds. No-op without a write-ahead log.
+  // Fails while a snapshot is partially loaded. Writers are only held off
+  // one shard at a time while it is copied.
+  grpc::Status CheckpointWal();
 
  private:
-  std::unordered_map<std::string, std::string> data_map_;
-  std::shared_mutex data_mtx_;
-  std::unordered_map<std::string, std::map<int, keyvaluestore::PaxosLog>>
-      paxos_logs_map_;
-  std::shared_mutex paxos_logs_mtx_;
+  struct DataShard {
+    std::unordered_map<std::string, std::string> data_map;
+    std::shared_mutex mtx;
+  };
+  // The rounds of one key in a Paxos shard. They are all congruent modulo
+  // kNumOfShards, so round / kNumOfShards indexes them contiguously.
+  struct RoundLog {
+    // Returns the state of round, nullptr if absent.
+    AcceptorState* Find(int round);
+    // Returns the state of round, adding an empty one if absent.
+    AcceptorState& FindOrAdd(int round);
+    // Drops the rounds up to round. Returns the approximate number of bytes
+    // freed, and adds the number of rounds dropped to *num_of_rounds.
+    size_t DropUpTo(int round, int* num_of_rounds);
+    // Calls fn(round, state) on every present round in [from, to], in order.
+    template <typename Fn>
+    void ForEach(int from, int to, const Fn& fn) const;
+    // Returns the last present round, 0 if none.
+    int LastRound() const;
+
+    int first_index = 0;
+    int round_offset = 0;
+    // Rounds never touched in between are left empty.
+    std::deque<std::optional<AcceptorState>> states;
+  };
+  // Paxos logs are sharded by key and round, so that the rounds of one busy
+  // key, e.g. the write log, spread over all shards.
+  struct PaxosShard {
+    std::unordered_map<std::string, RoundLog> round_logs;
+    std::shared_mutex mtx;
+  };
+
+  DataShard& DataShardOf(const std::string& key);
+  PaxosShard& PaxosShardOf(const std::string& key, int round);
+  // Locks the data shards of the given indexes in ascending order, or all of
+  // them if indexes is empty.
+  template <typename Lock>
+  std::vector<Lock> LockDataShards(std::vector<size_t> indexes = {});
+  // Implements AcceptIfNotSuperseded().
+  grpc::Status AcceptIfNotSuperseded(
+      const std::string& key, int round, int accepted_id,
+      OperationType accepted_type,
+      std::shared_ptr<const AcceptedValue> accepted);
+  // Raises applied_slot_ to slot, if it is lower.
+  void RaiseAppliedSlot(int slot);
+
+  // Executes a SET or DELETE operation. Requires the lock of the key's data
+  // shard.
+  void Execute(const Operation& operation);
+  // Re-executes a state change read back from wal_.
+  void Redo(const WalRecord& record);
+  // Appends the current Paxos log of key & round to wal_. Requires the lock
+  // of its Paxos shard. Returns the sequence number of the record, 0 if
+  // there is no wal_.
+  uint64_t LogPaxosLog(const std::string& key, int round);
+  // Appends a record to wal_. Every append happens under the lock of the
+  // state it changes, which CheckpointWal() relies on.
+  uint64_t Log(const WalRecord& record);
+  // Waits until the record numbered lsn is durable.
+  void Sync(uint64_t lsn);
+
+  WriteAheadLog* wal_;
+  std::array<DataShard, kNumOfShards> data_shards_;
+  std::atomic<int> applied_slot_{0};
+  // Whether the data holds only part of a snapshot. Guarded by all data
+  // shard locks together.
+  bool loading_snapshot_ = false;
+  // Chunks of a snapshot read back from wal_ but not complete yet.
+  std::unordered_map<std::string, std::string> replayed_snapshot_;
+  std::array<PaxosShard, kNumOfShards> paxos_shards_;
+  std::unordered_map<std::string, int> compacted_rounds_;
+  std::shared_mutex compaction_mtx_;
+  int promised_ballot_ = 0;
+  std::shared_mutex ballot_mtx_;
 };
 
 }  // namespace keyvaluestore
@@ -0,0 +1,376 @@
+#include "kv-store-client.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "paxos-group.h"
+
+namespace keyvaluestore {
+
+using grpc::ClientContext;
+using grpc::Status;
+
+// Deadline of each request, as of a request a replica forwards.
+constexpr std::chrono::milliseconds kRequestTimeout(5000);
+// How many redirects a request follows before it falls back to a replica.
+constexpr int kMaxRedirects = 3;
+
+namespace {
+
+void SetDeadline(ClientContext* context) {
+  context->set_deadline(std::chrono::system_clock::now() + kRequestTimeout);
+}
+
+Status NoReplicaStatus() {
+  return Status(grpc::StatusCode::UNAVAILABLE, "No replica to ask.");
+}
+
+bool IsUnreachable(const Status& status) {
+  return status.error_code() == grpc::StatusCode::UNAVAILABLE ||
+         status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED;
+}
+
+}  // namespace
+
+KeyValueStoreClient::KeyValueStoreClient(
+    const std::vector<std::string>& server_addresses, bool session_reads)
+    : session_reads_(session_reads) {
+  for (const std::string& address : server_addresses) {
+    server_stubs_.push_back(KeyValueStore::NewStub(
+        grpc::CreateChannel(address, grpc::InsecureChannelCredentials())));
+  }
+}
+
+Status KeyValueStoreClient::GetValue(const std::string& key,
+                                     std::string* value) {
+  GetRequest request;
+  request.set_key(key);
+  GetResponse response;
+  Status status;
+  if (session_reads_) {
+    status = SessionRead(&KeyValueStore::Stub::GetValue, request, &response);
+  }
+  if (!session_reads_ || IsUnreachable(status)) {
+    status = Call(
+        GroupOf(key, NumOfGroups()), &MultiPaxos::Stub::GetValue, request,
+        &response, [&](KeyValueStore::Stub* stub, ClientContext* context) {
+          return stub->GetValue(context, request, &response);
+        });
+  }
+  if (status.ok()) *value = response.value();
+  return status;
+}
+
+Status KeyValueStoreClient::PutPair(const std::string& key,
+                                    const std::string& value) {
+  PutRequest request;
+  request.set_key(key);
+  request.set_value(value);
+  int group = GroupOf(key, NumOfGroups());
+  CommitResponse response;
+  WriteToken token;
+  Status status = Call(group, &MultiPaxos::Stub::PutPair, request, &response,
+                       [&](KeyValueStore::Stub* stub, ClientContext* context) {
+                         return stub->PutPair(context, request, &token);
+                       });
+  if (status.ok()) UpdateSession(group, response, token);
+  return status;
+}
+
+Status KeyValueStoreClient::DeletePair(const std::string& key) {
+  DeleteRequest request;
+  request.set_key(key);
+  int group = GroupOf(key, NumOfGroups());
+  CommitResponse response;
+  WriteToken token;
+  Status status = Call(group, &MultiPaxos::Stub::DeletePair, request,
+                       &response,
+                       [&](KeyValueStore::Stub* stub, ClientContext* context) {
+                         return stub->DeletePair(context, request, &token);
+                       });
+  if (status.ok()) UpdateSession(group, response, token);
+  return status;
+}
+
+Status KeyValueStoreClient::MultiGet(const std::vector<std::string>& keys,
+                                     std::vector<KeyValue>* pairs) {
+  if (session_reads_) {
+    MultiGetRequest request;
+    for (const std::string& key : keys) request.add_keys(key);
+    MultiGetResponse response;
+    Status status =
+        SessionRead(&KeyValueStore::Stub::MultiGet, request, &response);
+    if (!IsUnreachable(status)) {
+      if (status.ok()) {
+        pairs->assign(response.pairs().begin(), response.pairs().end());
+      }
+      return status;
+    }
+  }
+  int num_of_groups = NumOfGroups();
+  std::map<int, MultiGetRequest> parts;
+  for (const std::string& key : keys) {
+    parts[GroupOf(key, num_of_groups)].add_keys(key);
+  }
+  std::map<int, MultiGetResponse> responses;
+  for (const auto& part : parts) {
+    MultiGetResponse* response = &responses[part.first];
+    Status status = Call(
+        part.first, &MultiPaxos::Stub::MultiGet, part.second, response,
+        [&](KeyValueStore::Stub* stub, ClientContext* context) {
+          return stub->MultiGet(context, part.second, response);
+        });
+    if (!status.ok()) return status;
+  }
+  // Each group answers its keys in request order.
+  std::map<int, int> next_of_group;
+  pairs->clear();
+  for (const std::string& key : keys) {
+    int group = GroupOf(key, num_of_groups);
+    int index = next_of_group[group]++;
+    if (index >= responses[group].pairs_size()) {
+      pairs->clear();
+      return Status(grpc::StatusCode::INTERNAL,
+                    "Coordinator left out some keys.");
+    }
+    pairs->push_back(responses[group].pairs(index));
+  }
+  return Status::OK;
+}
+
+Status KeyValueStoreClient::MultiPut(
+    const std::vector<std::pair<std::string, std::string>>& pairs) {
+  int num_of_groups = NumOfGroups();
+  std::map<int, WriteBatchRequest> parts;
+  for (const auto& pair : pairs) {
+    Operation* operation =
+        parts[GroupOf(pair.first, num_of_groups)].add_operations();
+    operation->set_key(pair.first);
+    operation->set_type(OperationType::SET);
+    operation->set_value(pair.second);
+  }
+  for (const auto& part : parts) {
+    CommitResponse response;
+    WriteToken token;
+    Status status = Call(
+        part.first, &MultiPaxos::Stub::WriteBatch, part.second, &response,
+        [&](KeyValueStore::Stub* stub, ClientContext* context) {
+          MultiPutRequest request;
+          for (const Operation& operation : part.second.operations()) {
+            PutRequest* put = request.add_pairs();
+            put->set_key(operation.key());
+            put->set_value(operation.value());
+          }
+          return stub->MultiPut(context, request, &token);
+        });
+    if (!status.ok()) return status;
+    UpdateSession(part.first, response, token);
+  }
+  return Status::OK;
+}
+
+Status KeyValueStoreClient::MultiDelete(const std::vector<std::string>& keys) {
+  int num_of_groups = NumOfGroups();
+  std::map<int, WriteBatchRequest> parts;
+  for (const std::string& key : keys) {
+    Operation* operation = parts[GroupOf(key, num_of_groups)].add_operations();
+    operation->set_key(key);
+    operation->set_type(OperationType::DELETE);
+  }
+  for (const auto& part : parts) {
+    CommitResponse response;
+    WriteToken token;
+    Status status = Call(
+        part.first, &MultiPaxos::Stub::WriteBatch, part.second, &response,
+        [&](KeyValueStore::Stub* stub, ClientContext* context) {
+          MultiDeleteRequest request;
+          for (const Operation& operation : part.second.operations()) {
+            request.add_keys(operation.key());
+          }
+          return stub->MultiDelete(context, request, &token);
+        });
+    if (!status.ok()) return status;
+    UpdateSession(part.first, response, token);
+  }
+  return Status::OK;
+}
+
+Status KeyValueStoreClient::StreamPut(
+    const std::vector<std::pair<std::string, std::string>>& pairs,
+    std::vector<WriteResponse>* responses) {
+  KeyValueStore::Stub* stub = GetServerStub();
+  if (stub == nullptr) return NoReplicaStatus();
+  ClientContext context;
+  auto stream = stub->WriteStream(&context);
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    WriteRequest request;
+    request.set_id(i);
+    Operation* operation = request.add_operations();
+    operation->set_key(pairs[i].first);
+    operation->set_type(OperationType::SET);
+    operation->set_value(pairs[i].second);
+    if (!stream->Write(request)) break;
+  }
+  stream->WritesDone();
+  responses->clear();
+  WriteResponse response;
+  while (stream->Read(&response)) {
+    UpdateSession(response.token());
+    responses->push_back(response);
+  }
+  return stream->Finish();
+}
+
+Status KeyValueStoreClient::RefreshLeaders() {
+  size_t first;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    first = server_;
+  }
+  Status status = NoReplicaStatus();
+  for (size_t i = 0; i < server_stubs_.size(); ++i) {
+    size_t server = (first + i) % server_stubs_.size();
+    ClientContext context;
+    SetDeadline(&context);
+    GetLeaderResponse response;
+    status = server_stubs_[server]->GetLeader(&context, EmptyMessage(),
+                                              &response);
+    if (!status.ok()) continue;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      server_ = server;
+      if (static_cast<int>(leaders_.size()) != response.groups_size()) {
+        leaders_.assign(response.groups_size(), GetCoordinatorResponse());
+      }
+    }
+    for (int group = 0; group < response.groups_size(); ++group) {
+      UpdateLeader(group, response.groups(group));
+    }
+    return Status::OK;
+  }
+  return status;
+}
+
+WriteToken KeyValueStoreClient::GetSession() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return session_;
+}
+
+template <typename Request, typename Response>
+Status KeyValueStoreClient::Call(int group,
+                                 PaxosMethod<Request, Response> method,
+                                 const Request& request, Response* response,
+                                 const FallbackFn& fallback) {
+  for (int redirect = 0; redirect <= kMaxRedirects; ++redirect) {
+    GetCoordinatorResponse leader = GetLeader(group);
+    if (leader.coordinator().empty()) break;
+    ClientContext context;
+    SetDeadline(&context);
+    Status status = (GetPaxosStub(leader.coordinator(), group)->*method)(
+        &context, request, response);
+    if (status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) {
+      // The replica no longer leads. Follow its hint if it knows a later
+      // Coordinator, or else ask a replica who leads.
+      GetCoordinatorResponse hint;
+      if (hint.ParseFromString(status.error_details()) &&
+          hint.coordinator() != leader.coordinator() &&
+          UpdateLeader(group, hint)) {
+        continue;
+      }
+    } else if (!IsUnreachable(status)) {
+      return status;
+    }
+    // A replica may have elected a new Coordinator already. If not, fall
+    // back to one, which elects.
+    if (!RefreshLeaders().ok() ||
+        GetLeader(group).coordinator() == leader.coordinator()) {
+      break;
+    }
+  }
+  response->Clear();
+  KeyValueStore::Stub* stub = GetServerStub();
+  if (stub == nullptr) return NoReplicaStatus();
+  ClientContext context;
+  SetDeadline(&context);
+  Status status = fallback(stub, &context);
+  // The replica may have elected a new Coordinator for the request.
+  if (status.ok()) RefreshLeaders();
+  return status;
+}
+
+template <typename Request, typename Response>
+Status KeyValueStoreClient::SessionRead(ServerMethod<Request, Response> method,
+                                        Request request, Response* response) {
+  *request.mutable_min_version() = GetSession();
+  KeyValueStore::Stub* stub = GetServerStub();
+  if (stub == nullptr) return NoReplicaStatus();
+  ClientContext context;
+  SetDeadline(&context);
+  return (stub->*method)(&context, request, response);
+}
+
+void KeyValueStoreClient::UpdateSession(int group,
+                                        const CommitResponse& committed,
+                                        const WriteToken& token) {
+  WriteToken merged = token;
+  if (committed.slot() > 0) (*merged.mutable_slots())[group] = committed.slot();
+  UpdateSession(merged);
+}
+
+void KeyValueStoreClient::UpdateSession(const WriteToken& token) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto* slots = session_.mutable_slots();
+  for (const auto& slot : token.slots()) {
+    (*slots)[slot.first] = std::max((*slots)[slot.first], slot.second);
+  }
+}
+
+int KeyValueStoreClient::NumOfGroups() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!leaders_.empty()) return leaders_.size();
+  }
+  RefreshLeaders();
+  std::lock_guard<std::mutex> lock(mtx_);
+  return leaders_.size();
+}
+
+GetCoordinatorResponse KeyValueStoreClient::GetLeader(int group) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (group >= static_cast<int>(leaders_.size())) {
+    return GetCoordinatorResponse();
+  }
+  return leaders_[group];
+}
+
+bool KeyValueStoreClient::UpdateLeader(int group,
+                                       const GetCoordinatorResponse& leader) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (group >= static_cast<int>(leaders_.size()) ||
+      leader.coordinator().empty()) {
+    return false;
+  }
+  GetCoordinatorResponse& cached = leaders_[group];
+  if (leader.term() < cached.term()) return false;
+  bool changed = leader.coordinator() != cached.coordinator();
+  cached = leader;
+  return changed;
+}
+
+MultiPaxos::Stub* KeyValueStoreClient::GetPaxosStub(const std::string& address,
+                                                    int group) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto& stub = paxos_stubs_[{address, group}];
+  if (stub == nullptr) {
+    stub = MultiPaxos::NewStub(CreateGroupChannel(address, group));
+  }
+  return stub.get();
+}
+
+KeyValueStore::Stub* KeyValueStoreClient::GetServerStub() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (server_stubs_.empty()) return nullptr;
+  return server_stubs_[server_].get();
+}
+
+}  // namespace keyvaluestore
@@ -0,0 +1,121 @@
+#ifndef KV_STORE_CLIENT_H
+#define KV_STORE_CLIENT_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// Client library of the key-value store.
+//
+// Requests skip the replica that would forward them: the client caches the
+// Coordinator of every Paxos group, learned from a replica's GetLeader, and
+// sends each request straight to the MultiPaxos service of its group's
+// Coordinator. A replica that is no longer Coordinator redirects to the one
+// it knows, which updates the cache. If no Coordinator can be reached, the
+// request goes through a replica's KeyValueStore service, which elects a new
+// one, and the cache is refreshed afterwards.
+//
+// Multi-key requests are split by group, and each part is sent on its own,
+// one group at a time. Writes are thus atomic within a group only.
+//
+// The client is a session: it keeps the WriteToken of every write it made.
+// With session_reads, reads carry that token to the replica that answered
+// last, which serves them from its own store once it has executed the
+// session's writes. Reads then see the session's own writes, though not
+// necessarily the latest writes of other clients.
+//
+// Thread-safe.
+class KeyValueStoreClient {
+ public:
+  // server_addresses are the KeyValueStore addresses of replicas. Leaders
+  // are fetched from, and requests fall back to, the first that answers.
+  explicit KeyValueStoreClient(
+      const std::vector<std::string>& server_addresses,
+      bool session_reads = false);
+
+  // Sets *value to the value of key. NOT_FOUND if key is not in the store.
+  grpc::Status GetValue(const std::string& key, std::string* value);
+  grpc::Status PutPair(const std::string& key, const std::string& value);
+  grpc::Status DeletePair(const std::string& key);
+  // Sets *pairs to every key with its value, in the order of keys.
+  grpc::Status MultiGet(const std::vector<std::string>& keys,
+                        std::vector<KeyValue>* pairs);
+  grpc::Status MultiPut(
+      const std::vector<std::pair<std::string, std::string>>& pairs);
+  grpc::Status MultiDelete(const std::vector<std::string>& keys);
+  // Streams pairs through a replica, one write each, without waiting for a
+  // write to commit before sending the next. Sets *responses to the answer
+  // of every write that was answered.
+  grpc::Status StreamPut(
+      const std::vector<std::pair<std::string, std::string>>& pairs,
+      std::vector<WriteResponse>* responses);
+
+  // Fetches the Coordinator of every group from a replica.
+  grpc::Status RefreshLeaders();
+  // Returns the WriteToken of the writes of this client so far.
+  WriteToken GetSession();
+
+ private:
+  template <typename Request, typename Response>
+  using PaxosMethod = grpc::Status (MultiPaxos::Stub::*)(
+      grpc::ClientContext*, const Request&, Response*);
+  template <typename Request, typename Response>
+  using ServerMethod = grpc::Status (KeyValueStore::Stub::*)(
+      grpc::ClientContext*, const Request&, Response*);
+  // Sends a request through the KeyValueStore service of a replica.
+  using FallbackFn =
+      std::function<grpc::Status(KeyValueStore::Stub*, grpc::ClientContext*)>;
+
+  // Sends request to the Coordinator of group with method, following its
+  // redirects. Calls fallback instead if no Coordinator can be reached.
+  template <typename Request, typename Response>
+  grpc::Status Call(int group, PaxosMethod<Request, Response> method,
+                    const Request& request, Response* response,
+                    const FallbackFn& fallback);
+  // Sends request with method, carrying the session's WriteToken, to the
+  // replica that answered last.
+  template <typename Request, typename Response>
+  grpc::Status SessionRead(ServerMethod<Request, Response> method,
+                           Request request, Response* response);
+  // Adds the slots of a write of group to the session: committed if it went
+  // to the Coordinator, token if it fell back to a replica.
+  void UpdateSession(int group, const CommitResponse& committed,
+                     const WriteToken& token);
+  void UpdateSession(const WriteToken& token);
+  // Returns the number of groups, fetching the leaders if they are unknown.
+  // 0 if no replica answers.
+  int NumOfGroups();
+  // Returns the cached Coordinator of group, empty if unknown.
+  GetCoordinatorResponse GetLeader(int group);
+  // Caches leader as the Coordinator of group, unless a later term is
+  // cached. Returns whether the cached Coordinator changed.
+  bool UpdateLeader(int group, const GetCoordinatorResponse& leader);
+  MultiPaxos::Stub* GetPaxosStub(const std::string& address, int group);
+  // Returns the replica that answered last, or nullptr if there is none.
+  KeyValueStore::Stub* GetServerStub();
+
+  std::vector<std::unique_ptr<KeyValueStore::Stub>> server_stubs_;
+  std::mutex mtx_;
+  // leaders_[i] is the Coordinator of group i.
+  std::vector<GetCoordinatorResponse> leaders_;
+  // Keyed by the Paxos address and group the stub's calls are sent to.
+  std::map<std::pair<std::string, int>, std::unique_ptr<MultiPaxos::Stub>>
+      paxos_stubs_;
+  size_t server_ = 0;
+  const bool session_reads_;
+  WriteToken session_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
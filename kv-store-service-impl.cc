@@ -2,168 +2,681 @@
 #include "kv-store-service-impl.h"
 
 #include <chrono>
+#include <deque>
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <set>
-#include <shared_mutex>
-#include <thread>
+#include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 
 #include "keyvaluestore.grpc.pb.h"
+#include "paxos-group.h"
 #include "time_log.h"
 
 namespace keyvaluestore {
 
+using grpc::CallbackServerContext;
 using grpc::ClientContext;
-using grpc::ServerContext;
 using grpc::Status;
+using keyvaluestore::CommitResponse;
 using keyvaluestore::DeleteRequest;
 using keyvaluestore::EmptyMessage;
+using keyvaluestore::GetCoordinatorResponse;
+using keyvaluestore::GetLeaderResponse;
 using keyvaluestore::GetRequest;
 using keyvaluestore::GetResponse;
 using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiDeleteRequest;
+using keyvaluestore::KeyValue;
+using keyvaluestore::MultiGetRequest;
+using keyvaluestore::MultiGetResponse;
+using keyvaluestore::MultiPutRequest;
+using keyvaluestore::Operation;
+using keyvaluestore::OperationType;
 using keyvaluestore::PutRequest;
+using keyvaluestore::ReadIndexRequest;
+using keyvaluestore::ReadIndexResponse;
+using keyvaluestore::WriteBatchRequest;
+using keyvaluestore::WriteRequest;
+using keyvaluestore::WriteResponse;
+using keyvaluestore::WriteToken;
 
-Status KeyValueStoreServiceImpl::GetValue(ServerContext* context,
-                                          const GetRequest* request,
-                                          GetResponse* response) {
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Received Request: Get [key: " << request->key() << "]."
-             << std::endl;
+// Deadline of each request forwarded to Coordinator, and of an election.
+constexpr std::chrono::milliseconds kForwardTimeout(5000);
+// How many times a forwarded request follows a new Coordinator elected
+// while it was in flight.
+constexpr int kMaxFailoversFollowed = 3;
+// How many messages of one write stream are forwarded at once. Reading the
+// stream pauses until one of them is answered.
+constexpr int kMaxStreamWritesInFlight = 64;
+
+template <typename Request, typename Response>
+class KeyValueStoreServiceImpl::ForwardCall {
+ public:
+  using DoneFn = std::function<void(const Status& status, Response* response)>;
+
+  // Forwards request to the Coordinator of group. done is called exactly
+  // once, with Coordinator's response, before the call deletes itself.
+  static void Start(KeyValueStoreServiceImpl* service, int group,
+                    Request request, DoneFn done) {
+    auto* call = new ForwardCall(service, service->paxos_stubs_maps_[group],
+                                 std::move(request), std::move(done));
+    call->Forward(/*elected=*/false);
   }
-  Status get_status = RequestFlow(*request, response);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
+
+ private:
+  ForwardCall(KeyValueStoreServiceImpl* service,
+              PaxosStubsMap* paxos_stubs_map, Request request, DoneFn done)
+      : service_(service),
+        paxos_stubs_map_(paxos_stubs_map),
+        request_(std::move(request)),
+        done_(std::move(done)),
+        start_(std::chrono::steady_clock::now()) {}
+
+  void Forward(bool elected) {
+    // A ClientContext serves one call only.
+    contexts_.push_back(std::make_unique<ClientContext>());
+    ClientContext* cc = contexts_.back().get();
+    int term = 0;
+    auto* coordinator_stub = paxos_stubs_map_->StartCoordinatorCall(cc, &term);
+    if (coordinator_stub == nullptr) {
+      paxos_stubs_map_->EndCoordinatorCall(cc);
+      Reply(Status(grpc::StatusCode::ABORTED, "Coordinator is not set."));
+      return;
+    }
+    cc->set_deadline(std::chrono::system_clock::now() + kForwardTimeout);
+    ForwardToCoordinator(
+        cc, coordinator_stub, &request_, &response_,
+        [this, cc, term, elected](Status forward_status) {
+          paxos_stubs_map_->EndCoordinatorCall(cc);
+          bool unreachable =
+              forward_status.error_code() == grpc::StatusCode::UNAVAILABLE ||
+              forward_status.error_code() ==
+                  grpc::StatusCode::DEADLINE_EXCEEDED ||
+              forward_status.error_code() == grpc::StatusCode::CANCELLED;
+          if (unreachable && paxos_stubs_map_->GetCoordinatorTerm() > term &&
+              num_of_failovers_followed_++ < kMaxFailoversFollowed) {
+            // Another Coordinator was elected while the call was in flight,
+            // which cancels it. Retry there.
+            Forward(elected);
+          } else if (!elected && unreachable) {
+            // Elect a new Coordinator if the current one is unavailable.
+            ElectNewCoordinator();
+          } else if (!elected && forward_status.error_code() ==
+                                     grpc::StatusCode::FAILED_PRECONDITION) {
+            // The lead moved on, e.g. back to the group's preferred
+            // replica. Follow it once.
+            Forward(/*elected=*/true);
+          } else if (elected && !forward_status.ok()) {
+            Reply(Status(forward_status.error_code(),
+                         "Failed to communicate with Coordinator. " +
+                             forward_status.error_message()));
+          } else {
+            Reply(forward_status);
+          }
+        });
+  }
+
+  void ElectNewCoordinator() {
+    service_->stats_->Increment(Counter::kForwardElections);
+    TIME_LOG << "[" << service_->keyvaluestore_address_ << "] "
+             << "Sending Request to elect Coordinator via Paxos.";
+    auto* my_paxos_stub =
+        paxos_stubs_map_->GetStub(service_->my_paxos_address_);
+    elect_context_.set_deadline(std::chrono::system_clock::now() +
+                                kForwardTimeout);
+    elect_req_.set_key("coordinator");
+    elect_req_.set_coordinator(service_->my_paxos_address_);
+    my_paxos_stub->async()->ElectCoordinator(
+        &elect_context_, &elect_req_, &elect_resp_,
+        [this](Status election_status) {
+          if (!election_status.ok() ||
+              paxos_stubs_map_->GetCoordinatorStub() == nullptr) {
+            Reply(Status(
+                election_status.error_code(),
+                "Can't reach Coordinator. Failed to elect a new Coordinator. " +
+                    election_status.error_message()));
+            return;
+          }
+          // Forward request to new Coordinator.
+          Forward(/*elected=*/true);
+        });
+  }
+
+  void Reply(const Status& status) {
+    service_->stats_->Record(Phase::kForward,
+                             std::chrono::steady_clock::now() - start_);
+    done_(status, &response_);
+    delete this;
+  }
+
+  KeyValueStoreServiceImpl* service_;
+  PaxosStubsMap* paxos_stubs_map_;
+  const Request request_;
+  Response response_;
+  DoneFn done_;
+  const std::chrono::steady_clock::time_point start_;
+  // One per forwarding attempt, kept until the call deletes itself.
+  std::vector<std::unique_ptr<ClientContext>> contexts_;
+  int num_of_failovers_followed_ = 0;
+  ClientContext elect_context_;
+  ElectCoordinatorRequest elect_req_;
+  EmptyMessage elect_resp_;
+};
+
+// A read is served here once this replica has executed every write its
+// group's Coordinator had executed when the read arrived, or every write of
+// the session it carries the WriteToken of. If Coordinator cannot tell, or
+// this replica is too far behind, the read is forwarded to Coordinator
+// instead.
+template <typename Request, typename Response>
+class KeyValueStoreServiceImpl::FollowerRead {
+ public:
+  // Reads at the read index of the group's Coordinator.
+  static void Start(KeyValueStoreServiceImpl* service, int group,
+                    Request request, ForwardDoneFn<Response> done) {
+    auto* read =
+        new FollowerRead(service, group, std::move(request), std::move(done));
+    service->RequestReadIndex(group, [read](const Status& status, int slot) {
+      read->ReadHere(status, slot);
+    });
+  }
+
+  // Reads once slot of the group is executed here.
+  static void StartAt(KeyValueStoreServiceImpl* service, int group,
+                      Request request, int slot,
+                      ForwardDoneFn<Response> done) {
+    auto* read =
+        new FollowerRead(service, group, std::move(request), std::move(done));
+    read->ReadHere(Status::OK, slot);
+  }
+
+ private:
+  FollowerRead(KeyValueStoreServiceImpl* service, int group, Request request,
+               ForwardDoneFn<Response> done)
+      : service_(service),
+        group_(group),
+        request_(std::move(request)),
+        done_(std::move(done)) {}
+
+  void ReadHere(const Status& read_index_status, int read_index) {
+    if (!read_index_status.ok()) {
+      FallBack();
+      return;
+    }
+    request_.set_min_slot(read_index);
+    auto* my_paxos_stub = service_->paxos_stubs_maps_[group_]->GetStub(
+        service_->my_paxos_address_);
+    context_.set_deadline(std::chrono::system_clock::now() + kForwardTimeout);
+    ForwardToCoordinator(
+        &context_, my_paxos_stub, &request_, &response_,
+        [this](Status read_status) {
+          if (read_status.error_code() ==
+              grpc::StatusCode::DEADLINE_EXCEEDED) {
+            FallBack();
+            return;
+          }
+          done_(read_status, &response_);
+          delete this;
+        });
+  }
+
+  // Forwards the read to Coordinator, like without follower reads.
+  void FallBack() {
+    request_.clear_min_slot();
+    ForwardCall<Request, Response>::Start(service_, group_,
+                                          std::move(request_),
+                                          std::move(done_));
+    delete this;
+  }
+
+  KeyValueStoreServiceImpl* service_;
+  const int group_;
+  Request request_;
+  Response response_;
+  ForwardDoneFn<Response> done_;
+  ClientContext context_;
+};
+
+// Forwards the messages of a write stream concurrently, and writes their
+// responses back in the order they complete.
+class KeyValueStoreServiceImpl::WriteStreamReactor
+    : public grpc::ServerBidiReactor<WriteRequest, WriteResponse> {
+ public:
+  explicit WriteStreamReactor(KeyValueStoreServiceImpl* service)
+      : service_(service) {
+    StartRead(&request_);
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) {
+      // The client is done writing, or gone. Finish once every forwarded
+      // message is answered.
+      std::unique_lock<std::mutex> lock(mtx_);
+      reads_done_ = true;
+      MaybeFinish(&lock);
+      return;
+    }
+    TIME_LOG << "[" << service_->keyvaluestore_address_ << "] "
+             << "Received Request: WriteStream [id: " << request_.id()
+             << ", operations: " << request_.operations_size() << "].";
+    int64_t id = request_.id();
+    WriteBatchRequest batch;
+    batch.mutable_operations()->Swap(request_.mutable_operations());
+    bool read_next;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      read_next = ++num_of_in_flight_ < kMaxStreamWritesInFlight;
+      read_paused_ = !read_next;
+    }
+    // Outside of mtx_: the call may fail, and call back, right away.
+    service_->Forward(std::move(batch),
+                      [this, id](const Status& status, WriteToken* token) {
+                        OnForwarded(id, status, token);
+                      });
+    if (read_next) StartRead(&request_);
+  }
+
+  void OnWriteDone(bool ok) override {
+    std::unique_lock<std::mutex> lock(mtx_);
+    responses_.pop_front();
+    if (!ok) {
+      // The stream is broken; drop the remaining responses.
+      write_failed_ = true;
+      responses_.clear();
+    }
+    if (!responses_.empty()) {
+      StartWrite(&responses_.front());
+    } else {
+      writing_ = false;
+      MaybeFinish(&lock);
+    }
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  void OnForwarded(int64_t id, const Status& status, WriteToken* token) {
+    TIME_LOG << "[" << service_->keyvaluestore_address_ << "] "
+             << "Returning Response to Request: WriteStream [id: " << id
+             << "].";
+    std::unique_lock<std::mutex> lock(mtx_);
+    --num_of_in_flight_;
+    if (read_paused_) {
+      read_paused_ = false;
+      StartRead(&request_);
+    }
+    if (!write_failed_) {
+      WriteResponse response;
+      response.set_id(id);
+      response.set_code(status.error_code());
+      response.set_error_message(status.error_message());
+      response.mutable_token()->Swap(token);
+      responses_.push_back(std::move(response));
+      if (!writing_) {
+        writing_ = true;
+        StartWrite(&responses_.front());
+      }
+    }
+    MaybeFinish(&lock);
+  }
+
+  // Finishes the stream once nothing is left to read, forward or write.
+  // Unlocks mtx_ first, as the reactor may be deleted right after Finish.
+  void MaybeFinish(std::unique_lock<std::mutex>* lock) {
+    bool finish =
+        reads_done_ && num_of_in_flight_ == 0 && !writing_ && !finished_;
+    finished_ = finished_ || finish;
+    lock->unlock();
+    if (finish) Finish(Status::OK);
+  }
+
+  KeyValueStoreServiceImpl* service_;
+  WriteRequest request_;
+  std::mutex mtx_;
+  int num_of_in_flight_ = 0;
+  bool read_paused_ = false;
+  bool reads_done_ = false;
+  // Responses waiting to be written. The front one is being written while
+  // writing_ is true; a deque keeps it in place as more are appended.
+  std::deque<WriteResponse> responses_;
+  bool writing_ = false;
+  bool write_failed_ = false;
+  bool finished_ = false;
+};
+
+template <typename Request, typename ForwardRequest, typename Response>
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::RequestFlow(
+    CallbackServerContext* context, const Request& request,
+    ForwardRequest forward_request, Response* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  TIME_LOG << "[" << keyvaluestore_address_ << "] "
+           << "Received Request: " << Describe(request) << ".";
+  // request and response stay valid until the reactor is finished.
+  ForwardDoneFn<Response> done = [this, reactor, &request, response](
+                                     const Status& status,
+                                     Response* forwarded) {
+    response->Swap(forwarded);
     TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Returning Response to Request: Get [key: " << request->key()
-             << "]." << std::endl;
+             << "Returning Response to Request: " << Describe(request) << ".";
+    reactor->Finish(status);
+  };
+  Forward(std::move(forward_request), std::move(done));
+  return reactor;
+}
+
+template <typename Request, typename Response>
+void KeyValueStoreServiceImpl::Forward(Request request,
+                                       ForwardDoneFn<Response> done) {
+  int group = GroupOf(request.key(), paxos_stubs_maps_.size());
+  if constexpr (std::is_same_v<Response, WriteToken>) {
+    Dispatch<Request, CommitResponse>(group, std::move(request),
+                                      WithToken(group, std::move(done)));
+  } else {
+    Dispatch<Request, Response>(group, std::move(request), std::move(done));
   }
-  return get_status;
 }
 
-Status KeyValueStoreServiceImpl::PutPair(grpc::ServerContext* context,
-                                         const PutRequest* request,
-                                         EmptyMessage* response) {
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Received Request: Put [key: " << request->key()
-             << ", value: " << request->value() << "]." << std::endl;
+void KeyValueStoreServiceImpl::Forward(MultiGetRequest request,
+                                       ForwardDoneFn<MultiGetResponse> done) {
+  const int num_of_groups = paxos_stubs_maps_.size();
+  std::map<int, MultiGetRequest> parts;
+  for (const std::string& key : request.keys()) {
+    parts[GroupOf(key, num_of_groups)].add_keys(key);
   }
-  Status put_status = RequestFlow(*request, response);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Returning Response to Request: Put [key: " << request->key()
-             << ", value: " << request->value() << "]." << std::endl;
+  if (request.has_min_version()) {
+    for (auto& part : parts) {
+      *part.second.mutable_min_version() = request.min_version();
+    }
+  }
+  if (parts.size() <= 1) {
+    int group = parts.empty() ? 0 : parts.begin()->first;
+    Dispatch<MultiGetRequest, MultiGetResponse>(group, std::move(request),
+                                                std::move(done));
+    return;
   }
-  return put_status;
+  ForwardParts<MultiGetRequest, MultiGetResponse>(
+      std::move(parts),
+      [request, done, num_of_groups](
+          const Status& status, std::map<int, MultiGetResponse>* responses) {
+        MultiGetResponse response;
+        Status merge_status = status;
+        // Each group answers its keys in request order.
+        std::map<int, int> next_pairs;
+        for (const std::string& key : request.keys()) {
+          if (!merge_status.ok()) break;
+          int group = GroupOf(key, num_of_groups);
+          auto* pairs = (*responses)[group].mutable_pairs();
+          int index = next_pairs[group]++;
+          if (index >= pairs->size()) {
+            merge_status = Status(grpc::StatusCode::INTERNAL,
+                                  "Coordinator left out some keys.");
+            break;
+          }
+          response.add_pairs()->Swap(pairs->Mutable(index));
+        }
+        if (!merge_status.ok()) response.Clear();
+        done(merge_status, &response);
+      });
 }
 
-Status KeyValueStoreServiceImpl::DeletePair(grpc::ServerContext* context,
-                                            const DeleteRequest* request,
-                                            EmptyMessage* response) {
+void KeyValueStoreServiceImpl::Forward(WriteBatchRequest request,
+                                       ForwardDoneFn<WriteToken> done) {
+  const int num_of_groups = paxos_stubs_maps_.size();
+  std::map<int, WriteBatchRequest> parts;
+  for (const Operation& operation : request.operations()) {
+    *parts[GroupOf(operation.key(), num_of_groups)].add_operations() =
+        operation;
+  }
+  if (parts.size() <= 1) {
+    int group = parts.empty() ? 0 : parts.begin()->first;
+    Dispatch<WriteBatchRequest, CommitResponse>(
+        group, std::move(request), WithToken(group, std::move(done)));
+    return;
+  }
+  ForwardParts<WriteBatchRequest, CommitResponse>(
+      std::move(parts),
+      [done](const Status& status, std::map<int, CommitResponse>* responses) {
+        // Also the slots of the groups that committed if another failed.
+        WriteToken token;
+        for (const auto& response : *responses) {
+          if (response.second.slot() > 0) {
+            (*token.mutable_slots())[response.first] = response.second.slot();
+          }
+        }
+        done(status, &token);
+      });
+}
+
+template <typename Request, typename Response>
+void KeyValueStoreServiceImpl::ForwardParts(std::map<int, Request> parts,
+                                            PartsDoneFn<Response> done) {
+  struct State {
+    std::mutex mtx;
+    size_t num_of_pending;
+    Status status;
+    std::map<int, Response> responses;
+    PartsDoneFn<Response> done;
+  };
+  auto state = std::make_shared<State>();
+  state->num_of_pending = parts.size();
+  state->done = std::move(done);
+  for (auto& part : parts) {
+    int group = part.first;
+    Dispatch<Request, Response>(
+        group, std::move(part.second),
+        [state, group](const Status& status, Response* response) {
+          std::unique_lock<std::mutex> lock(state->mtx);
+          if (!status.ok() && state->status.ok()) state->status = status;
+          state->responses[group].Swap(response);
+          if (--state->num_of_pending > 0) return;
+          lock.unlock();
+          state->done(state->status, &state->responses);
+        });
+  }
+}
+
+template <typename Request, typename Response>
+void KeyValueStoreServiceImpl::Dispatch(int group, Request request,
+                                        ForwardDoneFn<Response> done) {
+  if constexpr (std::is_same_v<Request, GetRequest> ||
+                std::is_same_v<Request, MultiGetRequest>) {
+    if (request.has_min_version()) {
+      // Groups the session has not written are read as they are here.
+      const auto& slots = request.min_version().slots();
+      auto slot = slots.find(group);
+      int min_slot = slot == slots.end() ? 0 : slot->second;
+      FollowerRead<Request, Response>::StartAt(
+          this, group, std::move(request), min_slot, std::move(done));
+      return;
+    }
+    if (follower_reads_ &&
+        paxos_stubs_maps_[group]->GetCoordinator() != my_paxos_address_) {
+      FollowerRead<Request, Response>::Start(this, group, std::move(request),
+                                             std::move(done));
+      return;
+    }
+  }
+  ForwardCall<Request, Response>::Start(this, group, std::move(request),
+                                        std::move(done));
+}
+
+void KeyValueStoreServiceImpl::RequestReadIndex(int group,
+                                                ReadIndexDoneFn done) {
+  ReadIndexQueue& queue = read_index_queues_[group];
   {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Received Request: Delete [key: " << request->key() << "]."
-             << std::endl;
+    std::lock_guard<std::mutex> lock(queue.mtx);
+    queue.waiting.push_back(std::move(done));
+    if (queue.in_flight) return;
+    queue.in_flight = true;
   }
-  Status delete_status = RequestFlow(*request, response);
+  SendReadIndex(group);
+}
+
+void KeyValueStoreServiceImpl::SendReadIndex(int group) {
+  ReadIndexQueue& queue = read_index_queues_[group];
+  std::vector<ReadIndexDoneFn> batch;
   {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Returning Response to Request: Delete [key: " << request->key()
-             << "]." << std::endl;
+    std::lock_guard<std::mutex> lock(queue.mtx);
+    batch.swap(queue.waiting);
+  }
+  ForwardCall<ReadIndexRequest, ReadIndexResponse>::Start(
+      this, group, ReadIndexRequest(),
+      [this, group, batch](const Status& status, ReadIndexResponse* response) {
+        for (const ReadIndexDoneFn& read : batch) {
+          read(status, response->slot());
+        }
+        // The reads that arrived meanwhile need a read index of their own.
+        ReadIndexQueue& queue = read_index_queues_[group];
+        {
+          std::lock_guard<std::mutex> lock(queue.mtx);
+          if (queue.waiting.empty()) {
+            queue.in_flight = false;
+            return;
+          }
+        }
+        SendReadIndex(group);
+      });
+}
+
+KeyValueStoreServiceImpl::ForwardDoneFn<CommitResponse>
+KeyValueStoreServiceImpl::WithToken(int group,
+                                    ForwardDoneFn<WriteToken> done) {
+  return [group, done](const Status& status, CommitResponse* committed) {
+    WriteToken token;
+    if (committed->slot() > 0) {
+      (*token.mutable_slots())[group] = committed->slot();
+    }
+    done(status, &token);
+  };
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::GetValue(
+    CallbackServerContext* context, const GetRequest* request,
+    GetResponse* response) {
+  return RequestFlow(context, *request, *request, response);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::PutPair(
+    CallbackServerContext* context, const PutRequest* request,
+    WriteToken* response) {
+  return RequestFlow(context, *request, *request, response);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::DeletePair(
+    CallbackServerContext* context, const DeleteRequest* request,
+    WriteToken* response) {
+  return RequestFlow(context, *request, *request, response);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::MultiGet(
+    CallbackServerContext* context, const MultiGetRequest* request,
+    MultiGetResponse* response) {
+  return RequestFlow(context, *request, *request, response);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::MultiPut(
+    CallbackServerContext* context, const MultiPutRequest* request,
+    WriteToken* response) {
+  WriteBatchRequest batch;
+  for (const PutRequest& pair : request->pairs()) {
+    Operation* operation = batch.add_operations();
+    operation->set_key(pair.key());
+    operation->set_type(OperationType::SET);
+    operation->set_value(pair.value());
+  }
+  return RequestFlow(context, *request, std::move(batch), response);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::MultiDelete(
+    CallbackServerContext* context, const MultiDeleteRequest* request,
+    WriteToken* response) {
+  WriteBatchRequest batch;
+  for (const std::string& key : request->keys()) {
+    Operation* operation = batch.add_operations();
+    operation->set_key(key);
+    operation->set_type(OperationType::DELETE);
   }
-  return delete_status;
+  return RequestFlow(context, *request, std::move(batch), response);
+}
+
+grpc::ServerBidiReactor<WriteRequest, WriteResponse>*
+KeyValueStoreServiceImpl::WriteStream(CallbackServerContext* context) {
+  return new WriteStreamReactor(this);
+}
+
+grpc::ServerUnaryReactor* KeyValueStoreServiceImpl::GetLeader(
+    CallbackServerContext* context, const EmptyMessage* request,
+    GetLeaderResponse* response) {
+  for (PaxosStubsMap* paxos_stubs_map : paxos_stubs_maps_) {
+    GetCoordinatorResponse* group = response->add_groups();
+    group->set_coordinator(paxos_stubs_map->GetCoordinator());
+    group->set_term(paxos_stubs_map->GetCoordinatorTerm());
+  }
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  reactor->Finish(Status::OK);
+  return reactor;
 }
 
 // Forward GetRequest to Coordinator.
-Status KeyValueStoreServiceImpl::ForwardToCoordinator(ClientContext* cc,
-                                                      MultiPaxos::Stub* stub,
-                                                      const GetRequest& request,
-                                                      GetResponse* response) {
-  return stub->GetValue(cc, request, response);
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const GetRequest* request,
+    GetResponse* response, std::function<void(Status)> done) {
+  stub->async()->GetValue(cc, request, response, std::move(done));
 }
 // Forward PutRequest to Coordinator.
-Status KeyValueStoreServiceImpl::ForwardToCoordinator(ClientContext* cc,
-                                                      MultiPaxos::Stub* stub,
-                                                      const PutRequest& request,
-                                                      EmptyMessage* response) {
-  return stub->PutPair(cc, request, response);
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const PutRequest* request,
+    CommitResponse* response, std::function<void(Status)> done) {
+  stub->async()->PutPair(cc, request, response, std::move(done));
 }
 // Forward DeleteRequest to Coordinator.
-Status KeyValueStoreServiceImpl::ForwardToCoordinator(
-    ClientContext* cc, MultiPaxos::Stub* stub, const DeleteRequest& request,
-    EmptyMessage* response) {
-  return stub->DeletePair(cc, request, response);
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const DeleteRequest* request,
+    CommitResponse* response, std::function<void(Status)> done) {
+  stub->async()->DeletePair(cc, request, response, std::move(done));
 }
-
-template <typename Request, typename Response>
-Status KeyValueStoreServiceImpl::RequestFlow(const Request& request,
-                                             Response* response) {
-  assert(paxos_stubs_map_ != nullptr);
-  auto* coordinator_stub = paxos_stubs_map_->GetCoordinatorStub();
-
-  if (coordinator_stub == nullptr) {
-    return Status(grpc::StatusCode::ABORTED, "Coordinator is not set.");
-  }
-  ClientContext cc;
-  auto deadline =
-      std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-  cc.set_deadline(deadline);
-  // Forward request to Coordinator.
-  Status forward_status =
-      ForwardToCoordinator(&cc, coordinator_stub, request, response);
-
-  // Elect a new Coordinator if the current one is unavailable.
-  if (forward_status.error_code() == grpc::StatusCode::UNAVAILABLE ||
-      forward_status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
-    Status election_status = ElectNewCoordinator();
-    coordinator_stub = paxos_stubs_map_->GetCoordinatorStub();
-    if (!election_status.ok() || coordinator_stub == nullptr) {
-      return Status(
-          election_status.error_code(),
-          "Can't reach Coordinator. Failed to elect a new Coordinator. " +
-              election_status.error_message());
-    }
-    // Forward request to new Coordinator.
-    ClientContext new_cc;
-    forward_status =
-        ForwardToCoordinator(&new_cc, coordinator_stub, request, response);
-    if (!forward_status.ok()) {
-      return Status(forward_status.error_code(),
-                    "Failed to communicate with Coordinator. " +
-                        forward_status.error_message());
-    }
-  }
-  return forward_status;
+// Forward MultiGetRequest to Coordinator.
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const MultiGetRequest* request,
+    MultiGetResponse* response, std::function<void(Status)> done) {
+  stub->async()->MultiGet(cc, request, response, std::move(done));
+}
+// Forward a batch of writes to Coordinator.
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const WriteBatchRequest* request,
+    CommitResponse* response, std::function<void(Status)> done) {
+  stub->async()->WriteBatch(cc, request, response, std::move(done));
+}
+// Ask Coordinator for the read index of a follower read.
+void KeyValueStoreServiceImpl::ForwardToCoordinator(
+    ClientContext* cc, MultiPaxos::Stub* stub, const ReadIndexRequest* request,
+    ReadIndexResponse* response, std::function<void(Status)> done) {
+  stub->async()->ReadIndex(cc, request, response, std::move(done));
 }
 
-Status KeyValueStoreServiceImpl::ElectNewCoordinator() {
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << keyvaluestore_address_ << "] "
-             << "Sending Request to elect Coordinator via Paxos." << std::endl;
-  }
-  assert(paxos_stubs_map_ != nullptr);
-  auto* my_paxos_stub = paxos_stubs_map_->GetStub(my_paxos_address_);
-  ClientContext context;
-  auto deadline =
-      std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-  context.set_deadline(deadline);
-  ElectCoordinatorRequest set_cdnt_req;
-  set_cdnt_req.set_key("coordinator");
-  set_cdnt_req.set_coordinator(my_paxos_address_);
-  EmptyMessage set_cdnt_resp;
-  return my_paxos_stub->ElectCoordinator(&context, set_cdnt_req,
-                                         &set_cdnt_resp);
+std::string KeyValueStoreServiceImpl::Describe(const GetRequest& request) {
+  return "Get [key: " + request.key() + "]";
+}
+std::string KeyValueStoreServiceImpl::Describe(const PutRequest& request) {
+  return "Put [key: " + request.key() + ", value: " + request.value() + "]";
+}
+std::string KeyValueStoreServiceImpl::Describe(const DeleteRequest& request) {
+  return "Delete [key: " + request.key() + "]";
+}
+std::string KeyValueStoreServiceImpl::Describe(const MultiGetRequest& request) {
+  return "MultiGet [keys: " + std::to_string(request.keys_size()) + "]";
+}
+std::string KeyValueStoreServiceImpl::Describe(const MultiPutRequest& request) {
+  return "MultiPut [pairs: " + std::to_string(request.pairs_size()) + "]";
+}
+std::string KeyValueStoreServiceImpl::Describe(
+    const MultiDeleteRequest& request) {
+  return "MultiDelete [keys: " + std::to_string(request.keys_size()) + "]";
 }
 
 }  // namespace keyvaluestore
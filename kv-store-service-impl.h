@@ -2,65 +2,204 @@
 #define KV_STORE_SERVICE_IMPL_H
 
 #include <chrono>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
-#include <mutex>
-#include <shared_mutex>
-#include <thread>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 
 #include "keyvaluestore.grpc.pb.h"
 #include "paxos-stubs-map.h"
+#include "server-stats.h"
 #include "time_log.h"
 
 namespace keyvaluestore {
 
 // Logic and data behind the server's behavior.
-class KeyValueStoreServiceImpl final : public KeyValueStore::Service {
+//
+// Built on the gRPC callback API: a request in flight is a ForwardCall
+// waiting on Coordinator's reply, not a thread blocked on it.
+//
+// Each key is served by the Coordinator of its Paxos group. Multi-key
+// requests and the messages of a write stream are split by group, and each
+// part is forwarded as one request; its Coordinator commits it in one slot
+// of the group's write log. Writes are thus atomic within a group only.
+//
+// With follower_reads, reads are served by this replica instead: the group's
+// Coordinator only confirms it still leads and returns a read index, and the
+// read waits until this replica has executed the write log up to it.
+//
+// Writes answer with the WriteToken of the slots they were committed in. A
+// read carrying one as its min_version is served by this replica, whatever
+// follower_reads is, once it has executed those slots; no Coordinator is
+// asked.
+class KeyValueStoreServiceImpl final : public KeyValueStore::CallbackService {
  public:
-  KeyValueStoreServiceImpl(PaxosStubsMap* paxos_stubs_map,
+  // paxos_stubs_maps[i] holds the stubs and Coordinator of group i.
+  KeyValueStoreServiceImpl(std::vector<PaxosStubsMap*> paxos_stubs_maps,
+                           ServerStats* stats,
                            const std::string& keyvaluestore_address,
-                           const std::string& my_paxos_address)
-      : paxos_stubs_map_(paxos_stubs_map),
+                           const std::string& my_paxos_address,
+                           bool follower_reads)
+      : paxos_stubs_maps_(std::move(paxos_stubs_maps)),
+        stats_(stats),
         keyvaluestore_address_(keyvaluestore_address),
-        my_paxos_address_(my_paxos_address) {}
+        my_paxos_address_(my_paxos_address),
+        follower_reads_(follower_reads),
+        read_index_queues_(paxos_stubs_maps_.size()) {}
 
   // Get the corresponding value for a given key
-  grpc::Status GetValue(grpc::ServerContext* context, const GetRequest* request,
-                        GetResponse* response) override;
+  grpc::ServerUnaryReactor* GetValue(grpc::CallbackServerContext* context,
+                                     const GetRequest* request,
+                                     GetResponse* response) override;
 
   // Put a (key, value) pair into the store
-  grpc::Status PutPair(grpc::ServerContext* context, const PutRequest* request,
-                       EmptyMessage* response) override;
+  grpc::ServerUnaryReactor* PutPair(grpc::CallbackServerContext* context,
+                                    const PutRequest* request,
+                                    WriteToken* response) override;
 
   // Delete the corresponding pair from the store for a given key
-  grpc::Status DeletePair(grpc::ServerContext* context,
-                          const DeleteRequest* request,
-                          EmptyMessage* response) override;
+  grpc::ServerUnaryReactor* DeletePair(grpc::CallbackServerContext* context,
+                                       const DeleteRequest* request,
+                                       WriteToken* response) override;
+
+  // Get the values of several keys at once
+  grpc::ServerUnaryReactor* MultiGet(grpc::CallbackServerContext* context,
+                                     const MultiGetRequest* request,
+                                     MultiGetResponse* response) override;
+
+  // Put several (key, value) pairs into the store, atomically per group
+  grpc::ServerUnaryReactor* MultiPut(grpc::CallbackServerContext* context,
+                                     const MultiPutRequest* request,
+                                     WriteToken* response) override;
+
+  // Delete several keys from the store, atomically per group
+  grpc::ServerUnaryReactor* MultiDelete(grpc::CallbackServerContext* context,
+                                        const MultiDeleteRequest* request,
+                                        WriteToken* response) override;
+
+  // Stream writes, each message committed as one batch
+  grpc::ServerBidiReactor<WriteRequest, WriteResponse>* WriteStream(
+      grpc::CallbackServerContext* context) override;
+
+  // Get the Coordinator of every Paxos group
+  grpc::ServerUnaryReactor* GetLeader(grpc::CallbackServerContext* context,
+                                      const EmptyMessage* request,
+                                      GetLeaderResponse* response) override;
 
  private:
-  grpc::Status ForwardToCoordinator(grpc::ClientContext* cc,
-                                    MultiPaxos::Stub* stub,
-                                    const GetRequest& request,
-                                    GetResponse* response);
-  grpc::Status ForwardToCoordinator(grpc::ClientContext* cc,
-                                    MultiPaxos::Stub* stub,
-                                    const PutRequest& request,
-                                    EmptyMessage* response);
-  grpc::Status ForwardToCoordinator(grpc::ClientContext* cc,
-                                    MultiPaxos::Stub* stub,
-                                    const DeleteRequest& request,
-                                    EmptyMessage* response);
+  // Forwards one request to the Coordinator of a group, electing a new
+  // Coordinator and forwarding once more if the current one is unreachable.
+  template <typename Request, typename Response>
+  class ForwardCall;
+  // Serves a read here at the read index of its group's Coordinator, or at
+  // the slot of its min_version.
+  template <typename Request, typename Response>
+  class FollowerRead;
+  class WriteStreamReactor;
+
+  template <typename Response>
+  using ForwardDoneFn =
+      std::function<void(const grpc::Status& status, Response* response)>;
+  template <typename Response>
+  using PartsDoneFn = std::function<void(
+      const grpc::Status& status, std::map<int, Response>* responses)>;
+  using ReadIndexDoneFn =
+      std::function<void(const grpc::Status& status, int read_index)>;
+
+  // The follower reads of a group waiting for a read index. Those that
+  // arrive while a ReadIndex request is in flight share the next one.
+  struct ReadIndexQueue {
+    std::mutex mtx;
+    bool in_flight = false;
+    std::vector<ReadIndexDoneFn> waiting;
+  };
+
+  // Forwards a single-key request to the Coordinator of the key's group. A
+  // write answers with a WriteToken.
+  template <typename Request, typename Response>
+  void Forward(Request request, ForwardDoneFn<Response> done);
+  // Forwards the keys of each group to its Coordinator, and merges the
+  // values back in request order.
+  void Forward(MultiGetRequest request, ForwardDoneFn<MultiGetResponse> done);
+  // Forwards the operations of each group to its Coordinator, and merges
+  // the slots they were committed in into one WriteToken.
+  void Forward(WriteBatchRequest request, ForwardDoneFn<WriteToken> done);
+  // Forwards the parts of a request, keyed by group, concurrently. done is
+  // called once all are answered, with the first error if any.
   template <typename Request, typename Response>
-  grpc::Status RequestFlow(const Request& request, Response* response);
-  grpc::Status ElectNewCoordinator();
+  void ForwardParts(std::map<int, Request> parts, PartsDoneFn<Response> done);
+  // Starts the request of one group: a FollowerRead for a read with a
+  // min_version, or if follower_reads_ is set and this replica does not lead
+  // the group; otherwise a ForwardCall.
+  template <typename Request, typename Response>
+  void Dispatch(int group, Request request, ForwardDoneFn<Response> done);
+  // Asks the Coordinator of group for a read index, along with the other
+  // reads of the group waiting for one.
+  void RequestReadIndex(int group, ReadIndexDoneFn done);
+  // Sends one ReadIndex request for the reads of group waiting for one.
+  void SendReadIndex(int group);
+  // Wraps done to be called with the WriteToken of a write committed in
+  // group.
+  static ForwardDoneFn<CommitResponse> WithToken(
+      int group, ForwardDoneFn<WriteToken> done);
+
+  // Forwards forward_request, derived from request, and answers the client
+  // with Coordinator's response.
+  template <typename Request, typename ForwardRequest, typename Response>
+  grpc::ServerUnaryReactor* RequestFlow(grpc::CallbackServerContext* context,
+                                        const Request& request,
+                                        ForwardRequest forward_request,
+                                        Response* response);
+
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const GetRequest* request,
+                                   GetResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const PutRequest* request,
+                                   CommitResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const DeleteRequest* request,
+                                   CommitResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const MultiGetRequest* request,
+                                   MultiGetResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const WriteBatchRequest* request,
+                                   CommitResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  static void ForwardToCoordinator(grpc::ClientContext* cc,
+                                   MultiPaxos::Stub* stub,
+                                   const ReadIndexRequest* request,
+                                   ReadIndexResponse* response,
+                                   std::function<void(grpc::Status)> done);
+  // Describes a request for the log, e.g. "Get [key: apple]".
+  static std::string Describe(const GetRequest& request);
+  static std::string Describe(const PutRequest& request);
+  static std::string Describe(const DeleteRequest& request);
+  static std::string Describe(const MultiGetRequest& request);
+  static std::string Describe(const MultiPutRequest& request);
+  static std::string Describe(const MultiDeleteRequest& request);
 
+  const std::vector<PaxosStubsMap*> paxos_stubs_maps_;
+  ServerStats* stats_;
   const std::string keyvaluestore_address_;
   const std::string my_paxos_address_;
-  PaxosStubsMap* paxos_stubs_map_;
-  std::shared_mutex log_mtx_;
+  const bool follower_reads_;
+  std::vector<ReadIndexQueue> read_index_queues_;
 };
 
 }  // namespace keyvaluestore
@@ -0,0 +1,153 @@
+#include "liveness-tracker.h"
+
+#include <memory>
+#include <vector>
+
+namespace keyvaluestore {
+
+using grpc::ClientAsyncResponseReader;
+using grpc::ClientContext;
+using grpc::CompletionQueue;
+using grpc::Status;
+
+// Weight of the newest sample in the smoothed RTT.
+constexpr double kRttAlpha = 0.2;
+
+LivenessTracker::LivenessTracker(PaxosStubsMap* paxos_stubs_map,
+                                 ServerStats* stats,
+                                 std::chrono::milliseconds interval,
+                                 std::chrono::milliseconds timeout,
+                                 int suspicion_threshold)
+    : paxos_stubs_map_(paxos_stubs_map),
+      stats_(stats),
+      interval_(interval),
+      timeout_(timeout),
+      suspicion_threshold_(suspicion_threshold) {
+  // Every replica starts as down until it answers a heartbeat.
+  for (const auto& stub : paxos_stubs_map_->GetPaxosStubs()) {
+    health_[stub.first].suspicion = suspicion_threshold_;
+  }
+}
+
+LivenessTracker::~LivenessTracker() { Stop(); }
+
+void LivenessTracker::Start() {
+  Sweep();
+  heartbeat_thread_ = std::thread(&LivenessTracker::HeartbeatLoop, this);
+}
+
+void LivenessTracker::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(stop_mtx_);
+    stopped_ = true;
+  }
+  stop_cv_.notify_all();
+  if (heartbeat_thread_.joinable()) heartbeat_thread_.join();
+}
+
+std::set<std::string> LivenessTracker::GetLiveReplicas() {
+  std::shared_lock<std::shared_mutex> reader_lock(health_mtx_);
+  std::set<std::string> live;
+  for (const auto& replica : health_) {
+    if (replica.second.suspicion < suspicion_threshold_) {
+      live.insert(replica.first);
+    }
+  }
+  return live;
+}
+
+std::map<std::string, ReplicaHealth> LivenessTracker::GetHealth() {
+  std::shared_lock<std::shared_mutex> reader_lock(health_mtx_);
+  return health_;
+}
+
+bool LivenessTracker::IsLive(const std::string& address) {
+  std::shared_lock<std::shared_mutex> reader_lock(health_mtx_);
+  auto iter = health_.find(address);
+  return iter != health_.end() && iter->second.suspicion < suspicion_threshold_;
+}
+
+bool LivenessTracker::Probe(const std::string& address) {
+  MultiPaxos::Stub* stub = paxos_stubs_map_->GetStub(address);
+  if (stub == nullptr) return false;
+  ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + timeout_);
+  EmptyMessage ping_req;
+  EmptyMessage ping_resp;
+  Status ping_status = stub->Ping(&context, ping_req, &ping_resp);
+  std::unique_lock<std::shared_mutex> writer_lock(health_mtx_);
+  ReplicaHealth& health = health_[address];
+  if (ping_status.ok()) {
+    health.suspicion = 0;
+    health.last_heard = std::chrono::steady_clock::now();
+  } else {
+    health.suspicion = suspicion_threshold_;
+  }
+  return ping_status.ok();
+}
+
+void LivenessTracker::Sweep() {
+  struct Heartbeat {
+    std::string address;
+    ClientContext context;
+    EmptyMessage response;
+    Status status;
+    std::chrono::steady_clock::time_point sent;
+    std::unique_ptr<ClientAsyncResponseReader<EmptyMessage>> reader;
+  };
+  ServerStats::Timer timer(stats_, Phase::kPingSweep);
+  CompletionQueue cq;
+  std::vector<std::unique_ptr<Heartbeat>> heartbeats;
+  EmptyMessage ping_req;
+  auto deadline = std::chrono::system_clock::now() + timeout_;
+  for (const auto& stub : paxos_stubs_map_->GetPaxosStubs()) {
+    auto heartbeat = std::make_unique<Heartbeat>();
+    heartbeat->address = stub.first;
+    heartbeat->context.set_deadline(deadline);
+    heartbeat->sent = std::chrono::steady_clock::now();
+    heartbeat->reader =
+        stub.second->PrepareAsyncPing(&heartbeat->context, ping_req, &cq);
+    heartbeat->reader->StartCall();
+    heartbeat->reader->Finish(&heartbeat->response, &heartbeat->status,
+                              heartbeat.get());
+    heartbeats.push_back(std::move(heartbeat));
+  }
+  // Every call carries a deadline, so all of them complete.
+  for (size_t i = 0; i < heartbeats.size(); ++i) {
+    void* tag;
+    bool ok;
+    if (!cq.Next(&tag, &ok)) break;
+    auto* heartbeat = static_cast<Heartbeat*>(tag);
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::shared_mutex> writer_lock(health_mtx_);
+    ReplicaHealth& health = health_[heartbeat->address];
+    if (ok && heartbeat->status.ok()) {
+      double rtt_ms =
+          std::chrono::duration<double, std::milli>(now - heartbeat->sent)
+              .count();
+      health.rtt_ms = health.rtt_ms == 0
+                          ? rtt_ms
+                          : (1 - kRttAlpha) * health.rtt_ms + kRttAlpha * rtt_ms;
+      health.suspicion = 0;
+      health.last_heard = now;
+    } else if (health.suspicion < suspicion_threshold_) {
+      ++health.suspicion;
+    }
+  }
+  cq.Shutdown();
+  void* tag;
+  bool ok;
+  while (cq.Next(&tag, &ok)) {
+  }
+}
+
+void LivenessTracker::HeartbeatLoop() {
+  std::unique_lock<std::mutex> lock(stop_mtx_);
+  while (!stop_cv_.wait_for(lock, interval_, [this] { return stopped_; })) {
+    lock.unlock();
+    Sweep();
+    lock.lock();
+  }
+}
+
+}  // namespace keyvaluestore
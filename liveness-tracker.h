@@ -0,0 +1,81 @@
+#ifndef LIVENESS_TRACKER_H
+#define LIVENESS_TRACKER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+#include "paxos-stubs-map.h"
+#include "server-stats.h"
+
+namespace keyvaluestore {
+
+// Health of one replica as observed by the heartbeat loop.
+struct ReplicaHealth {
+  // Smoothed Ping round-trip time in milliseconds.
+  double rtt_ms = 0;
+  // Number of consecutive missed heartbeats. 0 means healthy.
+  int suspicion = 0;
+  std::chrono::steady_clock::time_point last_heard;
+};
+
+// Keeps a continuously updated view of which replicas are alive by pinging
+// every stub in PaxosStubsMap on a background thread, so that the write path
+// can read a cached membership view instead of pinging on every request.
+// Thread-safe.
+class LivenessTracker {
+ public:
+  // A replica is considered down after `suspicion_threshold` consecutive
+  // heartbeats are missed.
+  LivenessTracker(PaxosStubsMap* paxos_stubs_map, ServerStats* stats,
+                  std::chrono::milliseconds interval,
+                  std::chrono::milliseconds timeout, int suspicion_threshold);
+  ~LivenessTracker();
+
+  // Runs one heartbeat sweep synchronously, then keeps sweeping in the
+  // background every `interval`.
+  void Start();
+  void Stop();
+
+  // Returns the addresses of replicas currently considered alive.
+  std::set<std::string> GetLiveReplicas();
+  // Returns a copy of the health of every replica.
+  std::map<std::string, ReplicaHealth> GetHealth();
+  // Returns whether the replica at address is currently considered alive.
+  bool IsLive(const std::string& address);
+  // Pings the replica at address right away, e.g. after a call to it
+  // failed, and returns whether it answered. One that did not is considered
+  // down at once.
+  bool Probe(const std::string& address);
+
+ private:
+  // Pings all replicas concurrently and updates health_.
+  void Sweep();
+  void HeartbeatLoop();
+
+  PaxosStubsMap* paxos_stubs_map_;
+  ServerStats* stats_;
+  const std::chrono::milliseconds interval_;
+  const std::chrono::milliseconds timeout_;
+  const int suspicion_threshold_;
+
+  std::map<std::string, ReplicaHealth> health_;
+  std::shared_mutex health_mtx_;
+
+  std::thread heartbeat_thread_;
+  bool stopped_ = false;
+  std::mutex stop_mtx_;
+  std::condition_variable stop_cv_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
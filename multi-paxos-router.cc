@@ -0,0 +1,177 @@
+#include "multi-paxos-router.h"
+
+#include "paxos-group.h"
+
+namespace keyvaluestore {
+
+using grpc::CallbackServerContext;
+using grpc::ServerContext;
+using grpc::ServerWriter;
+using grpc::Status;
+
+MultiPaxosServiceImpl* MultiPaxosRouter::GroupOf(
+    const grpc::ServerContextBase& context) {
+  int group = GetGroup(context);
+  if (group < 0 || group >= static_cast<int>(groups_.size())) return nullptr;
+  return groups_[group];
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::Reject(
+    CallbackServerContext* context) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  reactor->Finish(
+      Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group."));
+  return reactor;
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::GetValue(
+    CallbackServerContext* context, const GetRequest* request,
+    GetResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) return Reject(context);
+  return group->GetValue(context, request, response);
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::PutPair(
+    CallbackServerContext* context, const PutRequest* request,
+    CommitResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) return Reject(context);
+  return group->PutPair(context, request, response);
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::DeletePair(
+    CallbackServerContext* context, const DeleteRequest* request,
+    CommitResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) return Reject(context);
+  return group->DeletePair(context, request, response);
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::MultiGet(
+    CallbackServerContext* context, const MultiGetRequest* request,
+    MultiGetResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) return Reject(context);
+  return group->MultiGet(context, request, response);
+}
+
+grpc::ServerUnaryReactor* MultiPaxosRouter::WriteBatch(
+    CallbackServerContext* context, const WriteBatchRequest* request,
+    CommitResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) return Reject(context);
+  return group->WriteBatch(context, request, response);
+}
+
+Status MultiPaxosRouter::ElectCoordinator(
+    ServerContext* context, const ElectCoordinatorRequest* request,
+    EmptyMessage* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->ElectCoordinator(context, request, response);
+}
+
+Status MultiPaxosRouter::GetCoordinator(ServerContext* context,
+                                        const EmptyMessage* request,
+                                        GetCoordinatorResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->GetCoordinator(context, request, response);
+}
+
+Status MultiPaxosRouter::ReadIndex(ServerContext* context,
+                                   const ReadIndexRequest* request,
+                                   ReadIndexResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->ReadIndex(context, request, response);
+}
+
+Status MultiPaxosRouter::Prepare(ServerContext* context,
+                                 const PrepareRequest* request,
+                                 PromiseResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Prepare(context, request, response);
+}
+
+Status MultiPaxosRouter::PrepareLeader(ServerContext* context,
+                                       const LeaderPrepareRequest* request,
+                                       LeaderPromiseResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->PrepareLeader(context, request, response);
+}
+
+Status MultiPaxosRouter::Propose(ServerContext* context,
+                                 const ProposeRequest* request,
+                                 AcceptResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Propose(context, request, response);
+}
+
+Status MultiPaxosRouter::Inform(ServerContext* context,
+                                const InformRequest* request,
+                                InformResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Inform(context, request, response);
+}
+
+Status MultiPaxosRouter::GetChosen(ServerContext* context,
+                                   const GetChosenRequest* request,
+                                   GetChosenResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->GetChosen(context, request, response);
+}
+
+Status MultiPaxosRouter::Ping(ServerContext* context,
+                              const EmptyMessage* request,
+                              EmptyMessage* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Ping(context, request, response);
+}
+
+Status MultiPaxosRouter::Stats(ServerContext* context,
+                               const EmptyMessage* request,
+                               StatsResponse* response) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Stats(context, request, response);
+}
+
+Status MultiPaxosRouter::Recover(ServerContext* context,
+                                 const RecoverRequest* request,
+                                 ServerWriter<RecoverChunk>* writer) {
+  MultiPaxosServiceImpl* group = GroupOf(*context);
+  if (group == nullptr) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, "Unknown Paxos group.");
+  }
+  return group->Recover(context, request, writer);
+}
+
+}  // namespace keyvaluestore
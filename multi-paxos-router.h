@@ -0,0 +1,87 @@
+#ifndef MULTI_PAXOS_ROUTER_H
+#define MULTI_PAXOS_ROUTER_H
+
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+#include "multi-paxos-service-impl.h"
+
+namespace keyvaluestore {
+
+// Serves the MultiPaxos service of every Paxos group of a replica on one
+// port. Each call is handed to the group named in its metadata; see
+// paxos-group.h.
+class MultiPaxosRouter final
+    : public MultiPaxos::WithCallbackMethod_GetValue<
+          MultiPaxos::WithCallbackMethod_PutPair<
+              MultiPaxos::WithCallbackMethod_DeletePair<
+                  MultiPaxos::WithCallbackMethod_MultiGet<
+                      MultiPaxos::WithCallbackMethod_WriteBatch<
+                          MultiPaxos::Service>>>>> {
+ public:
+  // groups[i] serves group i.
+  explicit MultiPaxosRouter(std::vector<MultiPaxosServiceImpl*> groups)
+      : groups_(std::move(groups)) {}
+
+  grpc::ServerUnaryReactor* GetValue(grpc::CallbackServerContext* context,
+                                     const GetRequest* request,
+                                     GetResponse* response) override;
+  grpc::ServerUnaryReactor* PutPair(grpc::CallbackServerContext* context,
+                                    const PutRequest* request,
+                                    CommitResponse* response) override;
+  grpc::ServerUnaryReactor* DeletePair(grpc::CallbackServerContext* context,
+                                       const DeleteRequest* request,
+                                       CommitResponse* response) override;
+  grpc::ServerUnaryReactor* MultiGet(grpc::CallbackServerContext* context,
+                                     const MultiGetRequest* request,
+                                     MultiGetResponse* response) override;
+  grpc::ServerUnaryReactor* WriteBatch(grpc::CallbackServerContext* context,
+                                       const WriteBatchRequest* request,
+                                       CommitResponse* response) override;
+  grpc::Status ElectCoordinator(grpc::ServerContext* context,
+                                const ElectCoordinatorRequest* request,
+                                EmptyMessage* response) override;
+  grpc::Status GetCoordinator(grpc::ServerContext* context,
+                              const EmptyMessage* request,
+                              GetCoordinatorResponse* response) override;
+  grpc::Status ReadIndex(grpc::ServerContext* context,
+                         const ReadIndexRequest* request,
+                         ReadIndexResponse* response) override;
+  grpc::Status Prepare(grpc::ServerContext* context,
+                       const PrepareRequest* request,
+                       PromiseResponse* response) override;
+  grpc::Status PrepareLeader(grpc::ServerContext* context,
+                             const LeaderPrepareRequest* request,
+                             LeaderPromiseResponse* response) override;
+  grpc::Status Propose(grpc::ServerContext* context,
+                       const ProposeRequest* request,
+                       AcceptResponse* response) override;
+  grpc::Status Inform(grpc::ServerContext* context,
+                      const InformRequest* request,
+                      InformResponse* response) override;
+  grpc::Status GetChosen(grpc::ServerContext* context,
+                         const GetChosenRequest* request,
+                         GetChosenResponse* response) override;
+  grpc::Status Ping(grpc::ServerContext* context, const EmptyMessage* request,
+                    EmptyMessage* response) override;
+  grpc::Status Recover(grpc::ServerContext* context,
+                       const RecoverRequest* request,
+                       grpc::ServerWriter<RecoverChunk>* writer) override;
+  grpc::Status Stats(grpc::ServerContext* context, const EmptyMessage* request,
+                     StatsResponse* response) override;
+
+ private:
+  // Returns the group a call is addressed to, nullptr if there is none.
+  MultiPaxosServiceImpl* GroupOf(const grpc::ServerContextBase& context);
+  // Fails a callback call addressed to no group.
+  static grpc::ServerUnaryReactor* Reject(
+      grpc::CallbackServerContext* context);
+
+  const std::vector<MultiPaxosServiceImpl*> groups_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
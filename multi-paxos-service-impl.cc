@@ -1,41 +1,155 @@
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
+#include <sstream>
 
 #include "multi-paxos-service-impl.h"
+#include "quorum-call.h"
 
 namespace keyvaluestore {
 
+using grpc::CallbackServerContext;
 using grpc::ClientContext;
 using grpc::ServerContext;
+using grpc::ServerWriter;
 using grpc::Status;
 using keyvaluestore::AcceptResponse;
+using keyvaluestore::CommitResponse;
 using keyvaluestore::DeleteRequest;
 using keyvaluestore::EmptyMessage;
+using keyvaluestore::GetChosenRequest;
+using keyvaluestore::GetChosenResponse;
 using keyvaluestore::GetRequest;
 using keyvaluestore::GetResponse;
 using keyvaluestore::InformRequest;
+using keyvaluestore::InformResponse;
+using keyvaluestore::LeaderPrepareRequest;
+using keyvaluestore::LeaderPromiseResponse;
+using keyvaluestore::KeyValue;
+using keyvaluestore::MultiGetRequest;
+using keyvaluestore::MultiGetResponse;
 using keyvaluestore::MultiPaxos;
+using keyvaluestore::Operation;
 using keyvaluestore::OperationType;
 using keyvaluestore::PaxosLog;
 using keyvaluestore::PrepareRequest;
 using keyvaluestore::PromiseResponse;
 using keyvaluestore::ProposeRequest;
 using keyvaluestore::PutRequest;
-using keyvaluestore::RecoverResponse;
+using keyvaluestore::RecoverChunk;
+using keyvaluestore::RecoverRequest;
+using keyvaluestore::StatsResponse;
+using keyvaluestore::WriteBatchRequest;
+
+// Deadline of each Prepare/Propose/Inform call sent to a replica.
+constexpr std::chrono::milliseconds kPaxosRpcTimeout(5000);
+// How many times Coordinator proposes a slot before giving up its Phase 1.
+constexpr int kMaxProposeAttempts = 5;
+// How long a Learner waits on a missing slot before fetching it.
+constexpr std::chrono::milliseconds kCatchUpInterval(200);
+// How long a read at a minimum slot waits for the slot to be executed. A
+// Learner that missed the slot fetches it within two kCatchUpIntervals.
+constexpr std::chrono::milliseconds kLocalReadTimeout(1000);
+// How often a replica checks whether Coordinator is suspected, and how long
+// each rank of replicas waits before taking over from it.
+constexpr std::chrono::milliseconds kFailoverCheckInterval(50);
+constexpr std::chrono::milliseconds kFailoverBackoff(300);
+// Recover streams state in chunks of about this size, far below the gRPC
+// message size limit.
+constexpr size_t kRecoverChunkBytes = 1 << 20;
+// Recover copies the Paxos logs of a key this many rounds at a time.
+constexpr int kRecoverRoundsPerCopy = 256;
+// Deadline of a whole Recover stream.
+constexpr std::chrono::milliseconds kRecoverTimeout(60000);
+// How long a starting replica waits for a quorum of replicas to be live.
+constexpr std::chrono::milliseconds kStartupQuorumTimeout(60000);
+
+// Converts an accepted Paxos log of a write log slot to an acceptance.
+static AcceptResponse ToAcceptance(int slot, const PaxosLog& paxos_log) {
+  AcceptResponse acceptance;
+  acceptance.set_round(slot);
+  acceptance.set_propose_id(paxos_log.accepted_id());
+  acceptance.set_type(paxos_log.accepted_type());
+  acceptance.set_value(paxos_log.accepted_value());
+  *acceptance.mutable_operations() = paxos_log.accepted_operations();
+  return acceptance;
+}
 
 // Construction method.
 MultiPaxosServiceImpl::MultiPaxosServiceImpl(
-    PaxosStubsMap* paxos_stubs_map, KeyValueDataBase* kv_db,
-    const std::string& my_paxos_address, double fail_rate)
+    PaxosStubsMap* paxos_stubs_map, LivenessTracker* liveness_tracker,
+    KeyValueDataBase* kv_db, ServerStats* stats,
+    const std::string& my_paxos_address,
+    double fail_rate, std::chrono::microseconds batch_window,
+    int max_batch_size, int pipeline_depth,
+    std::chrono::milliseconds compaction_interval, int compaction_retention,
+    int phase1_quorum, int phase2_quorum, bool thrifty_propose,
+    std::chrono::milliseconds thrifty_timeout)
     : paxos_stubs_map_(paxos_stubs_map),
+      liveness_tracker_(liveness_tracker),
       kv_db_(kv_db),
+      stats_(stats),
       my_paxos_address_(my_paxos_address),
-      fail_rate_(fail_rate) {}
+      fail_rate_(fail_rate),
+      phase1_quorum_(phase1_quorum),
+      phase2_quorum_(phase2_quorum),
+      thrifty_propose_(thrifty_propose),
+      thrifty_timeout_(thrifty_timeout),
+      compaction_interval_(compaction_interval),
+      compaction_retention_(compaction_retention),
+      batcher_(std::make_unique<WriteBatcher>(
+          [this](const std::vector<Operation>& operations, int* slot) {
+            return ProposeBatch(operations, slot);
+          },
+          stats, batch_window, max_batch_size, pipeline_depth)) {
+  catch_up_thread_ = std::thread(&MultiPaxosServiceImpl::CatchUpLoop, this);
+  failover_thread_ = std::thread(&MultiPaxosServiceImpl::FailoverLoop, this);
+  compaction_thread_ =
+      std::thread(&MultiPaxosServiceImpl::CompactionLoop, this);
+}
+
+MultiPaxosServiceImpl::~MultiPaxosServiceImpl() {
+  {
+    std::lock_guard<std::mutex> apply_lock(apply_mtx_);
+    stopped_ = true;
+  }
+  applied_cv_.notify_all();
+  {
+    std::lock_guard<std::mutex> failover_lock(failover_mtx_);
+    failover_stopped_ = true;
+  }
+  failover_cv_.notify_all();
+  if (catch_up_thread_.joinable()) catch_up_thread_.join();
+  if (failover_thread_.joinable()) failover_thread_.join();
+  if (compaction_thread_.joinable()) compaction_thread_.join();
+}
 
 // Find Coordinator and recover data from Coordinator on construction.
-Status MultiPaxosServiceImpl::Initialize() {
+Status MultiPaxosServiceImpl::Initialize(bool lead) {
+  // A replica started ahead of the others waits until both quorums can be
+  // reached.
+  auto deadline = std::chrono::steady_clock::now() + kStartupQuorumTimeout;
+  while (true) {
+    std::map<std::string, MultiPaxos::Stub*> acceptor_stubs;
+    int phase1_quorum = 0;
+    int phase2_quorum = 0;
+    Status live_status =
+        GetLiveAcceptorStubs(&acceptor_stubs, &phase1_quorum, &phase2_quorum);
+    if (live_status.error_code() == grpc::StatusCode::INVALID_ARGUMENT) {
+      return live_status;
+    }
+    if (live_status.ok() &&
+        static_cast<int>(acceptor_stubs.size()) >= phase1_quorum) {
+      break;
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return Status(grpc::StatusCode::UNAVAILABLE,
+                    "Too few replicas became live for a quorum.");
+    }
+    std::this_thread::sleep_for(kFailoverCheckInterval);
+  }
   // Try to get Coordinator address from other replicas.
   Status get_status = GetCoordinator();
-  auto* coordinator_stub = paxos_stubs_map_->GetCoordinatorStub();
   // If not successful, start an election for Coordinators.
   if (!get_status.ok()) {
     Status elect_status = ElectNewCoordinator();
@@ -45,102 +159,203 @@ Status MultiPaxosServiceImpl::Initialize() {
           "ElectNewCoordinator Failed: " + elect_status.error_message());
     }
   }
-  Status recover_status = GetRecovery();
+  Status recover_status = GetRecovery(paxos_stubs_map_->GetCoordinatorStub());
   if (!recover_status.ok()) {
     return Status(grpc::StatusCode::ABORTED,
                   "GetRecovery Failed: " + recover_status.error_message());
   }
+  // Take the lead back from whichever replica stood in meanwhile. Another
+  // replica keeps leading if this fails.
+  if (lead && paxos_stubs_map_->GetCoordinator() != my_paxos_address_) {
+    Status elect_status = ElectNewCoordinator();
+    if (!elect_status.ok()) {
+      TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                       << "Failed to take the lead: "
+                       << elect_status.error_message();
+    }
+  }
   return Status::OK;
 }
 
 // Get the corresponding value for a given key
-Status MultiPaxosServiceImpl::GetValue(ServerContext* context,
-                                       const GetRequest* request,
-                                       GetResponse* response) {
+grpc::ServerUnaryReactor* MultiPaxosServiceImpl::GetValue(
+    CallbackServerContext* context, const GetRequest* request,
+    GetResponse* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
   if (context->IsCancelled()) {
-    return Status(grpc::StatusCode::CANCELLED,
-                  "Deadline exceeded or Client cancelled, abandoning.");
+    reactor->Finish(
+        Status(grpc::StatusCode::CANCELLED,
+               "Deadline exceeded or Client cancelled, abandoning."));
+    return reactor;
   }
-  std::string key = request->key();
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received Forwarded Request: Get [key: " << key << "]."
-             << std::endl;
-  }
-  if (key == "coordinator") {
-    return Status(grpc::StatusCode::ABORTED, "Illegal keyword");
+  const std::string& key = request->key();
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received Forwarded Request: Get [key: " << key << "].";
+  if (key == "coordinator" || key == kLogKey) {
+    reactor->Finish(Status(grpc::StatusCode::ABORTED, "Illegal keyword"));
+    return reactor;
   }
   assert(kv_db_ != nullptr);
-  std::string value;
-  bool get_success = kv_db_->GetValue(key, &value);
-  if (!get_success) {
-    return Status(grpc::StatusCode::NOT_FOUND, "Key not found.");
-  }
-  response->set_value(value);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Returning GetResponse: [key: " << key
-             << ", value: " << response->value() << "]." << std::endl;
-  }
-  return Status::OK;
+  // The request and response stay valid until the reactor is finished.
+  WhenReadable(
+      request->has_min_slot(), request->min_slot(),
+      [this, reactor, request, response](const Status& status) {
+        if (!status.ok()) {
+          reactor->Finish(status);
+          return;
+        }
+        if (!kv_db_->GetValue(request->key(), response->mutable_value())) {
+          reactor->Finish(
+              Status(grpc::StatusCode::NOT_FOUND, "Key not found."));
+          return;
+        }
+        TIME_LOG << "[" << my_paxos_address_ << "] "
+                 << "Returning GetResponse: [key: " << request->key()
+                 << ", value: " << response->value() << "].";
+        reactor->Finish(Status::OK);
+      });
+  return reactor;
 }
 
-Status MultiPaxosServiceImpl::PutPair(grpc::ServerContext* context,
-                                      const PutRequest* request,
-                                      EmptyMessage* response) {
+grpc::ServerUnaryReactor* MultiPaxosServiceImpl::PutPair(
+    CallbackServerContext* context, const PutRequest* request,
+    CommitResponse* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
   if (context->IsCancelled()) {
-    return Status(grpc::StatusCode::CANCELLED,
-                  "Deadline exceeded or Client cancelled, abandoning.");
+    reactor->Finish(
+        Status(grpc::StatusCode::CANCELLED,
+               "Deadline exceeded or Client cancelled, abandoning."));
+    return reactor;
   }
-  std::string key = request->key();
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
+  const std::string& key = request->key();
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received Forwarded Request: Put [key: " << key
+           << ", value: " << request->value() << "].";
+  if (key == "coordinator" || key == kLogKey) {
+    reactor->Finish(Status(grpc::StatusCode::ABORTED, "Illegal keyword"));
+    return reactor;
+  }
+  // The request and response stay valid until the reactor is finished.
+  SubmitWrite(*request, [this, reactor, request, response](
+                            const Status& put_status, int slot) {
     TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received Forwarded Request: Put [key: " << key
-             << ", value: " << request->value() << "]." << std::endl;
+             << "Returning Response to Request: Put [key: " << request->key()
+             << ", value: " << request->value() << "].";
+    response->set_slot(slot);
+    reactor->Finish(put_status);
+  });
+  return reactor;
+}
+
+grpc::ServerUnaryReactor* MultiPaxosServiceImpl::DeletePair(
+    CallbackServerContext* context, const DeleteRequest* request,
+    CommitResponse* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  if (context->IsCancelled()) {
+    reactor->Finish(
+        Status(grpc::StatusCode::CANCELLED,
+               "Deadline exceeded or Client cancelled, abandoning."));
+    return reactor;
   }
-  if (key == "coordinator") {
-    return Status(grpc::StatusCode::ABORTED, "Illegal keyword");
+  const std::string& key = request->key();
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received Forwarded Request: Delete [key: " << key << "].";
+  if (key == "coordinator" || key == kLogKey) {
+    reactor->Finish(Status(grpc::StatusCode::ABORTED, "Illegal keyword"));
+    return reactor;
   }
-  // Run a Paxos instance to reach consensus on the operation.
-  Status put_status = RunPaxos(*request);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
+  SubmitWrite(*request, [this, reactor, request, response](
+                            const Status& delete_status, int slot) {
     TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Returning Response to Request: Put [key: " << key
-             << ", value: " << request->value() << "]." << std::endl;
-  }
-  return put_status;
+             << "Returning Response to Request: Delete [key: "
+             << request->key() << "].";
+    response->set_slot(slot);
+    reactor->Finish(delete_status);
+  });
+  return reactor;
 }
 
-Status MultiPaxosServiceImpl::DeletePair(grpc::ServerContext* context,
-                                         const DeleteRequest* request,
-                                         EmptyMessage* response) {
+grpc::ServerUnaryReactor* MultiPaxosServiceImpl::MultiGet(
+    CallbackServerContext* context, const MultiGetRequest* request,
+    MultiGetResponse* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
   if (context->IsCancelled()) {
-    return Status(grpc::StatusCode::CANCELLED,
-                  "Deadline exceeded or Client cancelled, abandoning.");
+    reactor->Finish(
+        Status(grpc::StatusCode::CANCELLED,
+               "Deadline exceeded or Client cancelled, abandoning."));
+    return reactor;
   }
-  std::string key = request->key();
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received Forwarded Request: Delete [key: " << key << "]."
-             << std::endl;
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received Forwarded Request: MultiGet [keys: "
+           << request->keys_size() << "].";
+  for (const std::string& key : request->keys()) {
+    if (key == "coordinator" || key == kLogKey) {
+      reactor->Finish(Status(grpc::StatusCode::ABORTED, "Illegal keyword"));
+      return reactor;
+    }
+  }
+  assert(kv_db_ != nullptr);
+  WhenReadable(
+      request->has_min_slot(), request->min_slot(),
+      [this, reactor, request, response](const Status& status) {
+        if (!status.ok()) {
+          reactor->Finish(status);
+          return;
+        }
+        for (const std::string& key : request->keys()) {
+          KeyValue* pair = response->add_pairs();
+          pair->set_key(key);
+          pair->set_found(kv_db_->GetValue(key, pair->mutable_value()));
+        }
+        TIME_LOG << "[" << my_paxos_address_ << "] "
+                 << "Returning MultiGetResponse: [keys: "
+                 << response->pairs_size() << "].";
+        reactor->Finish(Status::OK);
+      });
+  return reactor;
+}
+
+grpc::ServerUnaryReactor* MultiPaxosServiceImpl::WriteBatch(
+    CallbackServerContext* context, const WriteBatchRequest* request,
+    CommitResponse* response) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  if (context->IsCancelled()) {
+    reactor->Finish(
+        Status(grpc::StatusCode::CANCELLED,
+               "Deadline exceeded or Client cancelled, abandoning."));
+    return reactor;
   }
-  if (key == "coordinator") {
-    return Status(grpc::StatusCode::ABORTED, "Illegal keyword");
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received Forwarded Request: WriteBatch [operations: "
+           << request->operations_size() << "].";
+  for (const Operation& operation : request->operations()) {
+    if (operation.key() == "coordinator" || operation.key() == kLogKey) {
+      reactor->Finish(Status(grpc::StatusCode::ABORTED, "Illegal keyword"));
+      return reactor;
+    }
+    if (operation.type() != OperationType::SET &&
+        operation.type() != OperationType::DELETE) {
+      reactor->Finish(Status(grpc::StatusCode::INVALID_ARGUMENT,
+                             "Only SET and DELETE can be written."));
+      return reactor;
+    }
   }
-  // Run a Paxos instance to reach consensus on the operation.
-  Status delete_status = RunPaxos(*request);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Returning Response to Request: Delete [key: " << key << "]."
-             << std::endl;
+  if (request->operations().empty()) {
+    reactor->Finish(Status::OK);
+    return reactor;
   }
-  return delete_status;
+  // One Submit() call, so that the whole batch commits in the same slot.
+  batcher_->Submit(
+      {request->operations().begin(), request->operations().end()},
+      [this, reactor, request, response](const Status& write_status,
+                                         int slot) {
+        TIME_LOG << "[" << my_paxos_address_ << "] "
+                 << "Returning Response to Request: WriteBatch [operations: "
+                 << request->operations_size() << "].";
+        response->set_slot(slot);
+        reactor->Finish(write_status);
+      });
+  return reactor;
 }
 
 Status MultiPaxosServiceImpl::ElectCoordinator(
@@ -150,20 +365,20 @@ Status MultiPaxosServiceImpl::ElectCoordinator(
     return Status(grpc::StatusCode::CANCELLED,
                   "Deadline exceeded or Client cancelled, abandoning.");
   }
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received ElectCoordinator Request: [coordinator: "
-             << request->coordinator() << "]." << std::endl;
-  }
-  // Run a Paxos instance to reach consensus on the operation.
-  Status set_status = RunPaxos(*request);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Returning Response to Request: ElectCoordinator [coordinator: "
-             << request->coordinator() << "]." << std::endl;
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received ElectCoordinator Request: [coordinator: "
+           << request->coordinator() << "].";
+  // A forwarded request found Coordinator unreachable. Elect only if it
+  // does not answer a Ping either; the requests forwarded with it that
+  // failed too are answered by the same election.
+  int seen_term = paxos_stubs_map_->GetCoordinatorTerm();
+  Status set_status;
+  if (!liveness_tracker_->Probe(paxos_stubs_map_->GetCoordinator())) {
+    set_status = Elect(*request, seen_term);
   }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Returning Response to Request: ElectCoordinator [coordinator: "
+           << request->coordinator() << "].";
   return set_status;
 }
 
@@ -174,23 +389,33 @@ Status MultiPaxosServiceImpl::GetCoordinator(grpc::ServerContext* context,
     return Status(grpc::StatusCode::CANCELLED,
                   "Deadline exceeded or Client cancelled, abandoning.");
   }
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received GetCoordinator Request." << std::endl;
-  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Received GetCoordinator Request.";
   assert(paxos_stubs_map_ != nullptr);
   std::string coordinator = paxos_stubs_map_->GetCoordinator();
   if (coordinator.empty()) {
     return Status(grpc::StatusCode::NOT_FOUND, "Coordinator not found.");
   }
   response->set_coordinator(coordinator);
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Returning GetCoordinatorResponse: [coordinator: "
-             << response->coordinator() << "]." << std::endl;
+  response->set_term(paxos_stubs_map_->GetCoordinatorTerm());
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Returning GetCoordinatorResponse: [coordinator: "
+           << response->coordinator() << "].";
+  return Status::OK;
+}
+
+// Role: Coordinator
+Status MultiPaxosServiceImpl::ReadIndex(grpc::ServerContext* context,
+                                        const ReadIndexRequest* request,
+                                        ReadIndexResponse* response) {
+  if (context->IsCancelled()) {
+    return Status(grpc::StatusCode::CANCELLED,
+                  "Deadline exceeded or Client cancelled, abandoning.");
   }
+  int read_index = 0;
+  Status confirm_status = ConfirmLeadership(&read_index);
+  if (!confirm_status.ok()) return confirm_status;
+  response->set_slot(read_index);
   return Status::OK;
 }
 
@@ -198,12 +423,19 @@ Status MultiPaxosServiceImpl::Ping(grpc::ServerContext* context,
                                    const EmptyMessage* request,
                                    EmptyMessage* response) {
   // {
-  //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
   //   TIME_LOG << "[" << my_paxos_address_ << "] "
-  //            << "Received Ping Request. Returning Response." << std::endl;
+  //            << "Received Ping Request. Returning Response.";
   // }
   return Status::OK;
 }
+
+Status MultiPaxosServiceImpl::Stats(grpc::ServerContext* context,
+                                    const EmptyMessage* request,
+                                    StatsResponse* response) {
+  stats_->Export(response);
+  return Status::OK;
+}
+
 // Logic upon receiving a Prepare message.
 // Role: Acceptor
 Status MultiPaxosServiceImpl::Prepare(grpc::ServerContext* context,
@@ -220,12 +452,9 @@ Status MultiPaxosServiceImpl::Prepare(grpc::ServerContext* context,
   kv_db_->AddPaxosLog(key, round);
   response->set_round(round);
   response->set_propose_id(propose_id);
-  PaxosLog paxos_log = kv_db_->GetPaxosLog(key, round);
-  std::stringstream promise_msg;
-  promise_msg << "[Promised] [key: " << key << ", round: " << round
-              << ", propose_id: " << propose_id;
+  AcceptorState state = kv_db_->GetAcceptorState(key, round);
   // Will NOT accept PrepareRequests with propose_id <= promised_id.
-  if (paxos_log.promised_id() >= propose_id) {
+  if (state.promised_id >= propose_id) {
     return Status(grpc::StatusCode::ABORTED,
                   "Aborted. Proposal ID is too low.");
   } else if (key != "coordinator" && RandomFail()) {
@@ -233,27 +462,61 @@ Status MultiPaxosServiceImpl::Prepare(grpc::ServerContext* context,
     fail_msg << "[Rejected] Acceptor random-failed on Prepare[key: " << key
              << ", round: " << round << ", propose_id: " << propose_id
              << "]. (fail_rate=" << fail_rate_ << ")";
-    {
-      std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      TIME_LOG << "[" << my_paxos_address_ << "] " << fail_msg.str()
-               << std::endl;
-    }
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] " << fail_msg.str();
+    stats_->Increment(Counter::kRandomFailRejections);
     return Status(grpc::StatusCode::ABORTED, fail_msg.str());
-  } else if (paxos_log.accepted_id() > 0) {
+  } else if (state.accepted_id > 0) {
     // Piggyback accepted proposal information in response.
-    response->set_accepted_id(paxos_log.accepted_id());
-    response->set_type(paxos_log.accepted_type());
-    response->set_value(paxos_log.accepted_value());
-    promise_msg << ", accepted_id: " << paxos_log.accepted_id()
-                << ", type: " << paxos_log.accepted_type()
-                << ", value: " << paxos_log.accepted_value();
-  }
-  promise_msg << "].";
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] " << promise_msg.str()
-             << std::endl;
+    response->set_accepted_id(state.accepted_id);
+    response->set_type(state.accepted_type);
+    response->set_value(state.accepted->value);
+  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Promised] [key: " << key << ", round: " << round
+           << ", propose_id: " << propose_id
+           << ", accepted_id: " << state.accepted_id
+           << ", type: " << state.accepted_type << ", value: "
+           << (state.accepted_id > 0 ? state.accepted->value : "") << "].";
+  return Status::OK;
+}
+
+// Logic upon receiving a PrepareLeader message.
+// Role: Acceptor
+Status MultiPaxosServiceImpl::PrepareLeader(
+    grpc::ServerContext* context, const LeaderPrepareRequest* request,
+    LeaderPromiseResponse* response) {
+  if (context->IsCancelled()) {
+    return Status(grpc::StatusCode::CANCELLED,
+                  "Deadline exceeded or Client cancelled, abandoning.");
   }
+  int ballot = request->ballot();
+  if (RandomFail()) {
+    std::stringstream fail_msg;
+    fail_msg << "[Rejected] Acceptor random-failed on PrepareLeader[ballot: "
+             << ballot << "]. (fail_rate=" << fail_rate_ << ")";
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] " << fail_msg.str();
+    stats_->Increment(Counter::kRandomFailRejections);
+    return Status(grpc::StatusCode::ABORTED, fail_msg.str());
+  }
+  // Will NOT promise ballots older than the promised one.
+  if (!kv_db_->PromiseBallot(ballot)) {
+    return Status(grpc::StatusCode::FAILED_PRECONDITION,
+                  "Aborted. Coordinator term is outdated.");
+  }
+  response->set_ballot(ballot);
+  // Piggyback every proposal accepted from from_slot on in response.
+  for (const auto& log :
+       kv_db_->GetPaxosLogs(kLogKey, request->from_slot(),
+                            std::numeric_limits<int>::max())) {
+    if (log.second.accepted_id() == 0) continue;
+    auto* accepted = response->add_accepted();
+    accepted->set_slot(log.first);
+    *accepted->mutable_log() = log.second;
+  }
+  response->set_compacted_slot(kv_db_->GetCompactedRound(kLogKey));
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Promised] [ballot: " << ballot
+           << ", accepted: " << response->accepted_size() << "].";
   return Status::OK;
 }
 
@@ -269,41 +532,37 @@ Status MultiPaxosServiceImpl::Propose(grpc::ServerContext* context,
   std::string key = request->key();
   int round = request->round();
   int propose_id = request->propose_id();
-  PaxosLog paxos_log = kv_db_->GetPaxosLog(key, round);
-  std::stringstream accept_msg;
-  // Will NOT accept ProposeRequests with propose_id < promised_id.
-  if (paxos_log.promised_id() > propose_id) {
-    return Status(grpc::StatusCode::ABORTED,
-                  "Aborted. Proposal ID is too low.");
-  } else if (key != "coordinator" && RandomFail()) {
+  if (key != "coordinator" && RandomFail()) {
     std::stringstream fail_msg;
     fail_msg << "[Rejected] Acceptor random-failed on Propose[key: " << key
              << ", round: " << round << ", propose_id: " << propose_id
              << "]. (fail_rate=" << fail_rate_ << ")";
-    {
-      std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      TIME_LOG << "[" << my_paxos_address_ << "] " << fail_msg.str()
-               << std::endl;
-    }
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] " << fail_msg.str();
+    stats_->Increment(Counter::kRandomFailRejections);
     return Status(grpc::StatusCode::ABORTED, fail_msg.str());
-  } else {
-    // Respond with acceptance and update accepted proposal in db.
-    auto type = request->type();
-    std::string value = request->value();
-    response->set_round(round);
-    response->set_propose_id(propose_id);
-    response->set_type(type);
-    response->set_value(value);
-    kv_db_->AddPaxosLog(key, round, propose_id, type, value);
-    accept_msg << "[Accepted] [key: " << key << ", round: " << round
-               << ", propose_id: " << propose_id << ", type: " << type
-               << ", value: " << value << "].";
   }
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] " << accept_msg.str()
-             << std::endl;
+  // Will NOT accept ProposeRequests with propose_id < promised_id, nor ones
+  // from a Coordinator whose term is older than the promised ballot.
+  auto type = request->type();
+  std::string value = request->value();
+  Status status =
+      type == OperationType::BATCH
+          ? kv_db_->AcceptIfNotSuperseded(key, round, propose_id,
+                                          request->operations())
+          : kv_db_->AcceptIfNotSuperseded(key, round, propose_id, type, value);
+  if (!status.ok()) return status;
+  // Respond with acceptance.
+  response->set_round(round);
+  response->set_propose_id(propose_id);
+  response->set_type(type);
+  response->set_value(value);
+  if (type == OperationType::BATCH) {
+    *response->mutable_operations() = request->operations();
   }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Accepted] [key: " << key << ", round: " << round
+           << ", propose_id: " << propose_id << ", type: " << type
+           << ", value: " << value << "].";
   return Status::OK;
 }
 
@@ -311,18 +570,55 @@ Status MultiPaxosServiceImpl::Propose(grpc::ServerContext* context,
 // Role: Learner
 Status MultiPaxosServiceImpl::Inform(grpc::ServerContext* context,
                                      const InformRequest* request,
-                                     EmptyMessage* response) {
+                                     InformResponse* response) {
   if (context->IsCancelled()) {
     return Status(grpc::StatusCode::CANCELLED,
                   "Deadline exceeded or Client cancelled, abandoning.");
   }
-  std::string key = request->key();
-  auto acceptance = request->acceptance();
+  {
+    std::lock_guard<std::mutex> compaction_lock(compaction_mtx_);
+    compactable_slot_ =
+        std::max(compactable_slot_, request->compactable_slot());
+  }
+  Status learn_status = Learn(request->key(), request->acceptance());
+  response->set_applied_slot(kv_db_->GetAppliedSlot());
+  return learn_status;
+}
+
+// Execute a chosen proposal.
+// Role: Learner
+Status MultiPaxosServiceImpl::Learn(const std::string& key,
+                                    const AcceptResponse& acceptance) {
+  if (key == kLogKey) {
+    // A batch of writes, or a no-op filling a slot left empty. Acceptors
+    // that accepted it already hold it.
+    if (kv_db_->GetAcceptorState(key, acceptance.round()).accepted_id !=
+        acceptance.propose_id()) {
+      if (acceptance.type() == OperationType::BATCH) {
+        kv_db_->AddPaxosLog(key, acceptance.round(), acceptance.propose_id(),
+                            acceptance.operations());
+      } else {
+        kv_db_->AddPaxosLog(key, acceptance.round(), acceptance.propose_id(),
+                            acceptance.type(), acceptance.value());
+      }
+    }
+    kv_db_->SetChosen(key, acceptance.round());
+    std::lock_guard<std::mutex> apply_lock(apply_mtx_);
+    if (acceptance.round() > kv_db_->GetAppliedSlot()) {
+      chosen_slots_.emplace(acceptance.round(), acceptance);
+    }
+    ExecuteChosenSlots();
+    return Status::OK;
+  }
   // Update Paxos log in db.
   kv_db_->AddPaxosLog(key, acceptance.round(), acceptance.propose_id(),
                       acceptance.type(), acceptance.value());
-  // Will NOT execute operation if it's not the latest round.
-  if (acceptance.round() < kv_db_->GetLatestRound(key)) {
+  kv_db_->SetChosen(key, acceptance.round());
+  // Will NOT execute operation if it's not the latest round. Coordinators
+  // are ordered by term in SetCoordinator() instead: a later round may only
+  // be prepared, by a concurrent election that is bound to fail.
+  if (acceptance.type() != OperationType::SET_COORDINATOR &&
+      acceptance.round() < kv_db_->GetLatestRound(key)) {
     return Status(grpc::StatusCode::ABORTED,
                   "Aborted. Operation overwritten by others.");
   }
@@ -330,30 +626,20 @@ Status MultiPaxosServiceImpl::Inform(grpc::ServerContext* context,
   switch (acceptance.type()) {
     case OperationType::SET:
       kv_db_->SetValue(key, acceptance.value());
-      {
-        std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-        TIME_LOG << "[" << my_paxos_address_ << "] "
-                 << "[Success] Set " << key << ":" << acceptance.value() << "."
-                 << std::endl;
-      }
+      TIME_LOG << "[" << my_paxos_address_ << "] "
+               << "[Success] Set " << key << ":" << acceptance.value() << ".";
       break;
     case OperationType::DELETE:
       kv_db_->DeleteEntry(key);
-      {
-        std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-        TIME_LOG << "[" << my_paxos_address_ << "] "
-                 << "[Success] Deleted " << key << "." << std::endl;
-      }
+      TIME_LOG << "[" << my_paxos_address_ << "] "
+               << "[Success] Deleted " << key << ".";
       break;
     case OperationType::SET_COORDINATOR:
       // kv_db_->SetValue("coordinator", acceptance.value());
-      paxos_stubs_map_->SetCoordinator(acceptance.value());
-      {
-        std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-        TIME_LOG << "[" << my_paxos_address_ << "] "
-                 << "[Success] Set Coordinator to [" << acceptance.value()
-                 << "]." << std::endl;
-      }
+      paxos_stubs_map_->SetCoordinator(acceptance.value(), acceptance.round());
+      TIME_LOG << "[" << my_paxos_address_ << "] "
+               << "[Success] Set Coordinator to [" << acceptance.value()
+               << "].";
       break;
     default:
       break;
@@ -361,140 +647,395 @@ Status MultiPaxosServiceImpl::Inform(grpc::ServerContext* context,
   return Status::OK;
 }
 
+// Execute chosen slots in slot order, starting right after the applied slot.
+// Role: Learner
+void MultiPaxosServiceImpl::ExecuteChosenSlots() {
+  // Executing on part of a recovery snapshot would be lost with it.
+  if (recovering_) return;
+  int applied_slot = kv_db_->GetAppliedSlot();
+  while (!chosen_slots_.empty() &&
+         chosen_slots_.begin()->first <= applied_slot + 1) {
+    auto slot = chosen_slots_.begin();
+    if (slot->first == applied_slot + 1) {
+      const AcceptResponse& acceptance = slot->second;
+      kv_db_->ApplyOperations({acceptance.operations().begin(),
+                               acceptance.operations().end()},
+                              slot->first);
+      applied_slot = slot->first;
+      TIME_LOG << "[" << my_paxos_address_ << "] "
+               << "[Success] Executed slot [slot: " << slot->first
+               << ", operations: " << acceptance.operations_size() << "].";
+    }
+    chosen_slots_.erase(slot);
+  }
+  ServeReadWaiters();
+  applied_cv_.notify_all();
+}
+
+Status MultiPaxosServiceImpl::WaitForApplied(
+    int slot, std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> apply_lock(apply_mtx_);
+  applied_cv_.wait_for(apply_lock, timeout, [this, slot] {
+    return stopped_ || IsExecuted(slot);
+  });
+  if (IsExecuted(slot)) return Status::OK;
+  return Status(stopped_ ? grpc::StatusCode::UNAVAILABLE
+                         : grpc::StatusCode::DEADLINE_EXCEEDED,
+                "Slot " + std::to_string(slot) +
+                    " is committed but not executed here yet.");
+}
+
+void MultiPaxosServiceImpl::WhenReadable(bool has_min_slot, int min_slot,
+                                         ReadFn read) {
+  if (!has_min_slot) {
+    // Only Coordinator is sure to have learned every committed write.
+    read(paxos_stubs_map_->GetCoordinator() == my_paxos_address_
+             ? Status::OK
+             : NotCoordinator());
+    return;
+  }
+  stats_->Increment(Counter::kLocalReads);
+  auto start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> apply_lock(apply_mtx_);
+  if (!IsExecuted(min_slot)) {
+    read_waiters_.emplace(min_slot, ReadWaiter{start, std::move(read)});
+    return;
+  }
+  apply_lock.unlock();
+  stats_->Record(Phase::kLocalReadWait,
+                 std::chrono::steady_clock::now() - start);
+  read(Status::OK);
+}
+
+bool MultiPaxosServiceImpl::IsExecuted(int slot) {
+  return !recovering_ && kv_db_->GetAppliedSlot() >= slot;
+}
+
+void MultiPaxosServiceImpl::ServeReadWaiters() {
+  auto now = std::chrono::steady_clock::now();
+  for (auto waiter = read_waiters_.begin(); waiter != read_waiters_.end();) {
+    bool applied = IsExecuted(waiter->first);
+    if (!applied && now - waiter->second.start < kLocalReadTimeout) {
+      ++waiter;
+      continue;
+    }
+    stats_->Record(Phase::kLocalReadWait, now - waiter->second.start);
+    waiter->second.read(
+        applied ? Status::OK
+                : Status(grpc::StatusCode::DEADLINE_EXCEEDED,
+                         "Replica has not executed the slot to read at."));
+    waiter = read_waiters_.erase(waiter);
+  }
+}
+
+// Logic upon receiving a GetChosen message.
+// Role: Coordinator
+Status MultiPaxosServiceImpl::GetChosen(grpc::ServerContext* context,
+                                        const GetChosenRequest* request,
+                                        GetChosenResponse* response) {
+  if (context->IsCancelled()) {
+    return Status(grpc::StatusCode::CANCELLED,
+                  "Deadline exceeded or Client cancelled, abandoning.");
+  }
+  for (const auto& log : kv_db_->GetPaxosLogs(kLogKey, request->from_slot(),
+                                              request->to_slot())) {
+    if (!log.second.chosen()) continue;
+    *response->add_slots() = ToAcceptance(log.first, log.second);
+  }
+  response->set_compacted_slot(kv_db_->GetCompactedRound(kLogKey));
+  return Status::OK;
+}
+
+// Fetch chosen slots this Learner missed, e.g. while it was considered down
+// and left out of Inform.
+// Role: Learner
+void MultiPaxosServiceImpl::CatchUp(int from_slot, int to_slot) {
+  if (paxos_stubs_map_->GetCoordinator() == my_paxos_address_) return;
+  auto* coordinator_stub = paxos_stubs_map_->GetCoordinatorStub();
+  if (coordinator_stub == nullptr) return;
+  ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + kPaxosRpcTimeout);
+  GetChosenRequest chosen_req;
+  chosen_req.set_from_slot(from_slot);
+  chosen_req.set_to_slot(to_slot);
+  GetChosenResponse chosen_resp;
+  Status chosen_status =
+      coordinator_stub->GetChosen(&context, chosen_req, &chosen_resp);
+  // Runs every few milliseconds while lagging, so only every 100th is logged.
+  TIME_LOG_EVERY_N(time_log::Level::kInfo, 100)
+      << "[" << my_paxos_address_ << "] "
+      << "Catching up on slots [" << from_slot << ", " << to_slot
+      << "]: " << chosen_resp.slots_size() << " fetched.";
+  if (!chosen_status.ok()) return;
+  // Coordinator no longer has the slots; start over from its snapshot.
+  if (chosen_resp.compacted_slot() >= from_slot) {
+    GetRecovery(coordinator_stub);
+    return;
+  }
+  for (const AcceptResponse& acceptance : chosen_resp.slots()) {
+    Learn(kLogKey, acceptance);
+  }
+}
+
+// Slots are routinely chosen out of order while several are in flight, so a
+// missing slot is only fetched once it has blocked execution, or a read, for
+// a whole kCatchUpInterval.
+void MultiPaxosServiceImpl::CatchUpLoop() {
+  std::unique_lock<std::mutex> apply_lock(apply_mtx_);
+  int stalled_slot = 0;
+  while (!applied_cv_.wait_for(apply_lock, kCatchUpInterval,
+                               [this] { return stopped_; })) {
+    ServeReadWaiters();
+    if (recovering_) continue;
+    // Fetch the slots that block execution, or else those reads wait for.
+    int next_slot = kv_db_->GetAppliedSlot() + 1;
+    int to_slot = next_slot - 1;
+    if (!chosen_slots_.empty()) {
+      to_slot = chosen_slots_.begin()->first - 1;
+    } else if (!read_waiters_.empty()) {
+      to_slot = read_waiters_.rbegin()->first;
+    }
+    if (to_slot < next_slot) {
+      stalled_slot = 0;
+      continue;
+    }
+    if (stalled_slot != next_slot) {
+      stalled_slot = next_slot;
+      continue;
+    }
+    apply_lock.unlock();
+    CatchUp(next_slot, to_slot);
+    apply_lock.lock();
+  }
+}
+
+void MultiPaxosServiceImpl::UpdateCompactableSlot(
+    const std::vector<QuorumReply<InformResponse>>& replies) {
+  std::lock_guard<std::mutex> compaction_lock(compaction_mtx_);
+  for (const auto& reply : replies) {
+    int& applied_slot = learner_applied_slots_[reply.address];
+    applied_slot = std::max(applied_slot, reply.response.applied_slot());
+  }
+  // A quorum of all replicas, not only of the live ones, must have executed
+  // a slot before it is compacted.
+  size_t quorum = paxos_stubs_map_->GetPaxosStubs().size() / 2 + 1;
+  if (learner_applied_slots_.size() < quorum) return;
+  std::vector<int> applied_slots;
+  for (const auto& learner : learner_applied_slots_) {
+    applied_slots.push_back(learner.second);
+  }
+  std::nth_element(applied_slots.begin(), applied_slots.begin() + quorum - 1,
+                   applied_slots.end(), std::greater<int>());
+  compactable_slot_ = std::max(compactable_slot_, applied_slots[quorum - 1]);
+}
+
+// Drop old rounds of the write log and of Coordinator elections. The
+// write-ahead log is rewritten without them far less often, once it has
+// grown enough.
+void MultiPaxosServiceImpl::Compact() {
+  int compactable_slot;
+  {
+    std::lock_guard<std::mutex> compaction_lock(compaction_mtx_);
+    compactable_slot = compactable_slot_;
+  }
+  int log_round = std::min(compactable_slot, kv_db_->GetAppliedSlot()) -
+                  compaction_retention_;
+  int coordinator_round =
+      kv_db_->GetLatestRound("coordinator") - compaction_retention_;
+  int num_of_log_rounds = 0;
+  int num_of_coordinator_rounds = 0;
+  size_t freed_bytes = 0;
+  if (log_round > 0) {
+    freed_bytes +=
+        kv_db_->CompactPaxosLogs(kLogKey, log_round, &num_of_log_rounds);
+  }
+  if (coordinator_round > 0) {
+    freed_bytes += kv_db_->CompactPaxosLogs("coordinator", coordinator_round,
+                                            &num_of_coordinator_rounds);
+  }
+  if (num_of_log_rounds + num_of_coordinator_rounds == 0) return;
+  Status checkpoint_status;
+  if (kv_db_->WalNeedsCheckpoint()) checkpoint_status = kv_db_->CheckpointWal();
+  size_t compacted_bytes;
+  {
+    std::lock_guard<std::mutex> compaction_lock(compaction_mtx_);
+    compacted_bytes_ += freed_bytes;
+    compacted_bytes = compacted_bytes_;
+  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Compaction] Dropped " << num_of_log_rounds
+           << " slots up to slot " << log_round << " and "
+           << num_of_coordinator_rounds
+           << " election rounds. Freed " << freed_bytes << " bytes ("
+           << compacted_bytes << " bytes in total).";
+  if (!checkpoint_status.ok()) {
+    TIME_LOG_ERROR << "[" << my_paxos_address_ << "] "
+                   << "Failed to checkpoint WAL: "
+                   << checkpoint_status.error_message();
+  }
+}
+
+void MultiPaxosServiceImpl::CompactionLoop() {
+  std::unique_lock<std::mutex> apply_lock(apply_mtx_);
+  while (!applied_cv_.wait_for(apply_lock, compaction_interval_,
+                               [this] { return stopped_; })) {
+    apply_lock.unlock();
+    Compact();
+    apply_lock.lock();
+  }
+}
+
+// Streams the write log slots after the requester's applied slot. If some
+// were compacted, streams a snapshot of the data, then the Paxos logs. Either
+// goes in chunks of about kRecoverChunkBytes.
 Status MultiPaxosServiceImpl::Recover(grpc::ServerContext* context,
-                                      const EmptyMessage* request,
-                                      RecoverResponse* response) {
-  auto kv_map = kv_db_->GetDataMap();
-  auto paxos_logs_map = kv_db_->GetPaxosLogsMap();
-  *response->mutable_kv_map() = google::protobuf::Map<std::string, std::string>(
-      kv_map.begin(), kv_map.end());
-  // for (const auto& kv : kv_map) {
-  //   const std::string& key = kv.first;
-  //   const auto& paxos_logs = kv_db_->GetPaxosLogs(key);
-  //   *(*response->mutable_paxos_logs())[key].mutable_logs() =
-  //       google::protobuf::Map<int, PaxosLog>(paxos_logs.begin(),
-  //                                            paxos_logs.end());
-  // }
-  for (const auto& paxos_logs : paxos_logs_map) {
-    const std::string& key = paxos_logs.first;
-    *(*response->mutable_paxos_logs())[key].mutable_logs() =
-        google::protobuf::Map<int, PaxosLog>(paxos_logs.second.begin(),
-                                             paxos_logs.second.end());
+                                      const RecoverRequest* request,
+                                      ServerWriter<RecoverChunk>* writer) {
+  int from_slot = request->applied_slot() + 1;
+  bool incremental = kv_db_->GetCompactedRound(kLogKey) < from_slot;
+  // Read before any shard is copied, so that the copies reflect it.
+  int applied_slot = kv_db_->GetAppliedSlot();
+  RecoverChunk chunk;
+  size_t chunk_bytes = 0;
+  auto write_chunk = [&]() {
+    chunk.set_applied_slot(applied_slot);
+    chunk.set_incremental(incremental);
+    bool written = writer->Write(chunk);
+    chunk.Clear();
+    chunk_bytes = 0;
+    return written;
+  };
+  // Only one data shard, or one window of Paxos rounds, is copied at a
+  // time, and only once the chunks before it are sent.
+  for (size_t index = 0; !incremental && index < KeyValueDataBase::kNumOfShards;
+       ++index) {
+    for (auto& kv : kv_db_->GetDataShard(index)) {
+      if (chunk_bytes >= kRecoverChunkBytes && !write_chunk()) {
+        return Status(grpc::StatusCode::CANCELLED, "Recovering replica left.");
+      }
+      chunk_bytes += kv.first.size() + kv.second.size();
+      (*chunk.mutable_kv_map())[kv.first] = std::move(kv.second);
+    }
+  }
+  chunk.set_data_complete(true);
+  for (const std::string& key : kv_db_->GetPaxosLogKeys()) {
+    int from_round = incremental && key == kLogKey
+                         ? from_slot
+                         : kv_db_->GetCompactedRound(key) + 1;
+    int to_round = kv_db_->GetLatestRound(key);
+    for (; from_round <= to_round; from_round += kRecoverRoundsPerCopy) {
+      auto logs = kv_db_->GetPaxosLogs(
+          key, from_round,
+          std::min(to_round, from_round + kRecoverRoundsPerCopy - 1));
+      for (auto& log : logs) {
+        if (chunk_bytes >= kRecoverChunkBytes && !write_chunk()) {
+          return Status(grpc::StatusCode::CANCELLED,
+                        "Recovering replica left.");
+        }
+        chunk_bytes += key.size() + log.second.ByteSizeLong();
+        auto* logs = (*chunk.mutable_paxos_logs())[key].mutable_logs();
+        (*logs)[log.first] = std::move(log.second);
+      }
+    }
+  }
+  if (!write_chunk()) {
+    return Status(grpc::StatusCode::CANCELLED, "Recovering replica left.");
   }
   return Status::OK;
 }
 
 void MultiPaxosServiceImpl::SetProposeValue(
-    const ElectCoordinatorRequest& set_cdnt_req, ProposeRequest* propose_req) {
-  propose_req->set_type(OperationType::SET_COORDINATOR);
-  propose_req->set_value(set_cdnt_req.coordinator());
+    const ElectCoordinatorRequest& set_cdnt_req, Operation* operation) {
+  operation->set_type(OperationType::SET_COORDINATOR);
+  operation->set_value(set_cdnt_req.coordinator());
 }
 void MultiPaxosServiceImpl::SetProposeValue(const PutRequest& put_req,
-                                            ProposeRequest* propose_req) {
-  propose_req->set_type(OperationType::SET);
-  propose_req->set_value(put_req.value());
+                                            Operation* operation) {
+  operation->set_type(OperationType::SET);
+  operation->set_value(put_req.value());
 }
 void MultiPaxosServiceImpl::SetProposeValue(const DeleteRequest& del_req,
-                                            ProposeRequest* propose_req) {
-  propose_req->set_type(OperationType::DELETE);
+                                            Operation* operation) {
+  operation->set_type(OperationType::DELETE);
 }
 
+// Writes are committed in batches by the stable Coordinator.
 template <typename Request>
-Status MultiPaxosServiceImpl::RunPaxos(const Request& req) {
+void MultiPaxosServiceImpl::SubmitWrite(const Request& req,
+                                        WriteBatcher::DoneFn done) {
+  Operation operation;
+  operation.set_key(req.key());
+  SetProposeValue(req, &operation);
+  batcher_->Submit({operation}, std::move(done));
+}
+
+Status MultiPaxosServiceImpl::RunPaxos(const ElectCoordinatorRequest& req) {
   std::string key = req.key();
+  std::map<std::string, MultiPaxos::Stub*> acceptor_stubs;
+  int phase1_quorum = 0;
+  int phase2_quorum = 0;
+  Status live_status =
+      GetLiveAcceptorStubs(&acceptor_stubs, &phase1_quorum, &phase2_quorum);
+  if (!live_status.ok()) return live_status;
+
   int round = kv_db_->GetLatestRound(key) + 1;
-  int propose_id = 1;
+  // Replicas propose with distinct ids, so that concurrent elections, e.g.
+  // on failover, cannot both have a value accepted in the same round.
   auto paxos_stubs = paxos_stubs_map_->GetPaxosStubs();
-  // Ping.
-  std::set<std::string> live_paxos_stubs;
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Sending PingRequest to " << paxos_stubs.size() << " Acceptors."
-             << std::endl;
-  }
-  for (const auto& stub : paxos_stubs) {
-    ClientContext context;
-    auto deadline =
-        std::chrono::system_clock::now() + std::chrono::milliseconds(500);
-    context.set_deadline(deadline);
-    EmptyMessage ping_req, ping_resp;
-    Status ping_status = stub.second->Ping(&context, ping_req, &ping_resp);
-    if (ping_status.ok()) {
-      live_paxos_stubs.insert(stub.first);
-    }
-  }
-  if (live_paxos_stubs.empty()) {
-    return Status(grpc::StatusCode::ABORTED,
-                  "Aborted. Can't connect to any PaxosStub.");
-  }
-  int num_of_acceptors = live_paxos_stubs.size();
+  int propose_id =
+      1 + std::distance(paxos_stubs.begin(),
+                        paxos_stubs.find(my_paxos_address_));
   // Prepare.
   PrepareRequest prepare_req;
   prepare_req.set_key(key);
   prepare_req.set_round(round);
   prepare_req.set_propose_id(propose_id);
 
-  int num_of_promised = 0;
   int accepted_id = 0;
   OperationType accepted_type = OperationType::NOT_SET;
   std::string accepted_value;
   // {
-  //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
   //   TIME_LOG << "[" << my_paxos_address_ << "] "
   //            << "Sending PrepareRequest [key: " << prepare_req.key()
   //            << ", round: " << prepare_req.round()
   //            << ", propose_id: " << prepare_req.propose_id() << "] to "
-  //            << num_of_acceptors << " Acceptors." << std::endl;
+  //            << num_of_acceptors << " Acceptors.";
   // }
-  for (const std::string& addr : live_paxos_stubs) {
-    const auto& stub = paxos_stubs[addr];
-    ClientContext context;
-    auto deadline =
-        std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-    context.set_deadline(deadline);
-    PromiseResponse promise_resp;
-    Status promise_status = stub->Prepare(&context, prepare_req, &promise_resp);
-    if (!promise_status.ok()) {
-      // std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      // TIME_LOG << "[" << my_paxos_address_ << "] "
-      //          << "  Acceptor " << addr
-      //          << " rejected Prepare: " << promise_status.error_message()
-      //          << std::endl;
-    } else {
-      // {
-      //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      //   TIME_LOG << "[" << my_paxos_address_ << "] "
-      //            << "  Acceptor " << addr << " promised." << std::endl;
-      // }
-      num_of_promised++;
-      if (promise_resp.accepted_id() > accepted_id) {
-        accepted_id = promise_resp.accepted_id();
-        accepted_type = promise_resp.type();
-        accepted_value = promise_resp.value();
-      }
+  // Prepare all Acceptors at once; stop waiting once a quorum promised.
+  std::vector<Status> prepare_errors;
+  auto prepare_start = std::chrono::steady_clock::now();
+  auto promises =
+      QuorumCall<PrepareRequest, PromiseResponse>(
+          &MultiPaxos::Stub::async::Prepare, kPaxosRpcTimeout)
+          .Run(acceptor_stubs, prepare_req, phase1_quorum, &prepare_errors);
+  stats_->Record(Phase::kPrepare,
+                 std::chrono::steady_clock::now() - prepare_start);
+  int num_of_promised = promises.size();
+  for (const auto& promise : promises) {
+    const PromiseResponse& promise_resp = promise.response;
+    if (promise_resp.accepted_id() > accepted_id) {
+      accepted_id = promise_resp.accepted_id();
+      accepted_type = promise_resp.type();
+      accepted_value = promise_resp.value();
     }
   }
-  std::stringstream quorum_msg;
-  quorum_msg << "[key: " << prepare_req.key()
-             << ", round: " << prepare_req.round()
-             << ", propose_id: " << prepare_req.propose_id()
-             << "]: " << num_of_promised << " Promise, "
-             << num_of_acceptors - num_of_promised << " Reject.";
-  if (num_of_promised <= num_of_acceptors / 2) {
-    {
-      std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      TIME_LOG << "[" << my_paxos_address_ << "] "
-               << "[Failed QUORUM] on " << quorum_msg.str() << std::endl;
-    }
-    return Status(grpc::StatusCode::ABORTED,
-                  "[Failed QUORUM] on " + quorum_msg.str());
-  }
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "[Reached QUORUM] on " << quorum_msg.str() << std::endl;
+  if (num_of_promised < phase1_quorum) {
+    stats_->Increment(Counter::kPrepareQuorumFailures);
+    std::stringstream quorum_msg;
+    quorum_msg << "[Failed QUORUM] on [key: " << prepare_req.key()
+               << ", round: " << prepare_req.round()
+               << ", propose_id: " << prepare_req.propose_id()
+               << "]: " << num_of_promised << " Promise, "
+               << prepare_errors.size() << " Reject.";
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] " << quorum_msg.str();
+    return Status(grpc::StatusCode::ABORTED, quorum_msg.str());
   }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Reached QUORUM] on [key: " << prepare_req.key()
+           << ", round: " << prepare_req.round()
+           << ", propose_id: " << prepare_req.propose_id()
+           << "]: " << num_of_promised << " Promise, "
+           << prepare_errors.size() << " Reject.";
 
   // Propose.
   ProposeRequest propose_req;
@@ -505,110 +1046,495 @@ Status MultiPaxosServiceImpl::RunPaxos(const Request& req) {
     propose_req.set_type(accepted_type);
     propose_req.set_value(accepted_value);
   } else {
-    SetProposeValue(req, &propose_req);
+    Operation operation;
+    SetProposeValue(req, &operation);
+    propose_req.set_type(operation.type());
+    propose_req.set_value(operation.value());
+  }
+  return ProposeAndInform(acceptor_stubs, phase2_quorum, propose_req);
+}
+
+Status MultiPaxosServiceImpl::GetLiveAcceptorStubs(
+    std::map<std::string, MultiPaxos::Stub*>* acceptor_stubs,
+    int* phase1_quorum, int* phase2_quorum) {
+  auto paxos_stubs = paxos_stubs_map_->GetPaxosStubs();
+  // Live Acceptors as last seen by the background heartbeat.
+  assert(liveness_tracker_ != nullptr);
+  std::set<std::string> live_paxos_stubs = liveness_tracker_->GetLiveReplicas();
+  if (live_paxos_stubs.empty()) {
+    return Status(grpc::StatusCode::ABORTED,
+                  "Aborted. Can't connect to any PaxosStub.");
+  }
+  for (const std::string& addr : live_paxos_stubs) {
+    (*acceptor_stubs)[addr] = paxos_stubs[addr];
+  }
+  // Quorums are sized against all Acceptors: shrinking them to the live
+  // ones would let two partitions each reach one.
+  Status quorum_status =
+      QuorumSizes(paxos_stubs.size(), phase1_quorum_, phase2_quorum_,
+                  phase1_quorum, phase2_quorum);
+  if (!quorum_status.ok()) return quorum_status;
+  if (static_cast<int>(acceptor_stubs->size()) < *phase2_quorum) {
+    return Status(grpc::StatusCode::UNAVAILABLE,
+                  "Aborted. Too few Acceptors are live for a quorum.");
+  }
+  return Status::OK;
+}
+
+Status MultiPaxosServiceImpl::QuorumSizes(int num_of_replicas,
+                                          int phase1_quorum,
+                                          int phase2_quorum, int* phase1,
+                                          int* phase2) {
+  int majority = num_of_replicas / 2 + 1;
+  *phase2 = phase2_quorum > 0 ? phase2_quorum : majority;
+  // Flexible Paxos: every Phase 1 quorum must intersect every Phase 2
+  // quorum, Phase 1 quorums need not intersect each other. An unset Phase 1
+  // quorum is raised as needed.
+  *phase1 = phase1_quorum > 0
+                ? phase1_quorum
+                : std::max(majority, num_of_replicas - *phase2 + 1);
+  if (*phase1 > num_of_replicas || *phase2 > num_of_replicas ||
+      *phase1 + *phase2 <= num_of_replicas) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                  "Phase 1 quorum " + std::to_string(*phase1) +
+                      " and Phase 2 quorum " + std::to_string(*phase2) +
+                      " must add up to more than the " +
+                      std::to_string(num_of_replicas) +
+                      " replicas, neither exceeding them.");
+  }
+  return Status::OK;
+}
+
+std::map<std::string, MultiPaxos::Stub*>
+MultiPaxosServiceImpl::FastestAcceptors(
+    const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs,
+    int count) {
+  std::map<std::string, ReplicaHealth> health =
+      liveness_tracker_->GetHealth();
+  std::vector<std::pair<double, std::string>> by_rtt;
+  for (const auto& stub : acceptor_stubs) {
+    // This replica accepts without a network hop.
+    double rtt_ms =
+        stub.first == my_paxos_address_ ? -1 : health[stub.first].rtt_ms;
+    by_rtt.push_back({rtt_ms, stub.first});
+  }
+  std::sort(by_rtt.begin(), by_rtt.end());
+  std::map<std::string, MultiPaxos::Stub*> fastest;
+  for (int i = 0; i < count && i < static_cast<int>(by_rtt.size()); ++i) {
+    fastest[by_rtt[i].second] = acceptor_stubs.at(by_rtt[i].second);
+  }
+  return fastest;
+}
+
+// Commits a batch of writes in the next slot of the write log. Several
+// batches may be in flight at once; Learners execute them in slot order.
+// Role: Coordinator
+Status MultiPaxosServiceImpl::ProposeBatch(
+    const std::vector<Operation>& operations, int* committed_slot) {
+  ServerStats::Timer timer(stats_, Phase::kCommitBatch);
+  std::map<std::string, MultiPaxos::Stub*> acceptor_stubs;
+  int phase1_quorum = 0;
+  int phase2_quorum = 0;
+  Status live_status =
+      GetLiveAcceptorStubs(&acceptor_stubs, &phase1_quorum, &phase2_quorum);
+  if (!live_status.ok()) return live_status;
+  // Stable Coordinator: Phase 1 of its term already covers this slot, so
+  // go straight to Propose.
+  int ballot = 0;
+  Status leader_status = EnsureLeadership(acceptor_stubs, phase1_quorum,
+                                          phase2_quorum, &ballot);
+  if (!leader_status.ok()) return leader_status;
+  int slot = NextSlot();
+  ProposeRequest propose_req;
+  propose_req.set_key(kLogKey);
+  propose_req.set_round(slot);
+  propose_req.set_propose_id(ballot);
+  propose_req.set_type(OperationType::BATCH);
+  *propose_req.mutable_operations() = {operations.begin(), operations.end()};
+  // An empty slot blocks every slot after it, so keep proposing the same
+  // batch. A different value must never be proposed for this slot under the
+  // same ballot.
+  Status propose_status;
+  for (int attempt = 0; attempt < kMaxProposeAttempts; ++attempt) {
+    propose_status =
+        ProposeAndInform(acceptor_stubs, phase2_quorum, propose_req);
+    if (propose_status.ok() ||
+        propose_status.error_code() == grpc::StatusCode::FAILED_PRECONDITION) {
+      break;
+    }
+  }
+  FinishSlot(slot);
+  if (!propose_status.ok()) {
+    // Superseded by a newer term, or the slot could not be chosen. Phase 1
+    // on the next batch finishes the slot or fills it with a no-op.
+    std::lock_guard<std::mutex> leader_lock(leader_mtx_);
+    leader_prepared_ = false;
+    return propose_status;
   }
+  stats_->Increment(Counter::kBatches);
+  stats_->Increment(Counter::kBatchedOperations, operations.size());
+  // Reply once the batch is executed here, so that a following GET on
+  // Coordinator observes it. Replying OK before that would break it.
+  Status applied_status = WaitForApplied(slot, kPaxosRpcTimeout);
+  if (!applied_status.ok()) return applied_status;
+  *committed_slot = slot;
+  return Status::OK;
+}
+
+// Paxos phases 2 and 3.
+// Role: Coordinator
+Status MultiPaxosServiceImpl::ProposeAndInform(
+    const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs, int quorum,
+    const ProposeRequest& propose_req) {
   // {
-  //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
   //   TIME_LOG << "[" << my_paxos_address_ << "] "
   //            << "Sending ProposeRequest [key: " << propose_req.key()
   //            << ", round: " << propose_req.round()
   //            << ", propose_id: " << propose_req.propose_id()
   //            << ", type: " << propose_req.type()
   //            << ", value: " << propose_req.value() << "] to "
-  //            << num_of_acceptors << " Acceptors." << std::endl;
+  //            << acceptor_stubs.size() << " Acceptors.";
   // }
-  int num_of_accepted = 0;
-  AcceptResponse acceptance;
-  for (const std::string& addr : live_paxos_stubs) {
-    const auto& stub = paxos_stubs[addr];
-    ClientContext context;
-    auto deadline =
-        std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-    context.set_deadline(deadline);
-    AcceptResponse accept_resp;
-    Status accept_status = stub->Propose(&context, propose_req, &accept_resp);
-    if (!accept_status.ok()) {
-      // std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      // TIME_LOG << "[" << my_paxos_address_ << "] "
-      //          << "  Acceptor " << addr
-      //          << " rejected Propose: " << accept_status.error_message()
-      //          << std::endl;
-    } else {
-      // {
-      //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      //   TIME_LOG << "[" << my_paxos_address_ << "] "
-      //            << "  Acceptor " << addr << " accepted." << std::endl;
-      // }
-      num_of_accepted++;
-      acceptance = accept_resp;
-    }
-  }
-  std::stringstream consensus_msg;
-  consensus_msg << "[key: " << propose_req.key()
-                << ", round: " << propose_req.round()
-                << ", propose_id: " << propose_req.propose_id()
-                << ", value: " << propose_req.value()
-                << "]: " << num_of_accepted << " Accept, "
-                << num_of_acceptors - num_of_accepted << " Reject.";
-  if (num_of_accepted <= num_of_acceptors / 2) {
-    {
-      std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      TIME_LOG << "[" << my_paxos_address_ << "] "
-               << "[Failed CONSENSUS] on " << consensus_msg.str() << std::endl;
+  std::vector<Status> propose_errors;
+  auto propose_start = std::chrono::steady_clock::now();
+  auto is_superseded = [](const Status& error) {
+    return error.error_code() == grpc::StatusCode::FAILED_PRECONDITION;
+  };
+  std::vector<QuorumReply<AcceptResponse>> acceptances;
+  if (thrifty_propose_ && quorum < static_cast<int>(acceptor_stubs.size())) {
+    // Thrifty: ask the fastest quorum first, and the other Acceptors only
+    // if it is slow or some of it rejects.
+    acceptances =
+        QuorumCall<ProposeRequest, AcceptResponse>(
+            &MultiPaxos::Stub::async::Propose, thrifty_timeout_)
+            .Run(FastestAcceptors(acceptor_stubs, quorum), propose_req,
+                 quorum, &propose_errors);
+    if (static_cast<int>(acceptances.size()) < quorum &&
+        std::none_of(propose_errors.begin(), propose_errors.end(),
+                     is_superseded)) {
+      stats_->Increment(Counter::kThriftyFallbacks);
+      std::map<std::string, MultiPaxos::Stub*> other_stubs = acceptor_stubs;
+      for (const auto& acceptance : acceptances) {
+        other_stubs.erase(acceptance.address);
+      }
+      propose_errors.clear();
+      auto other_acceptances =
+          QuorumCall<ProposeRequest, AcceptResponse>(
+              &MultiPaxos::Stub::async::Propose, kPaxosRpcTimeout)
+              .Run(other_stubs, propose_req, quorum - acceptances.size(),
+                   &propose_errors);
+      acceptances.insert(acceptances.end(), other_acceptances.begin(),
+                         other_acceptances.end());
     }
-    return Status(grpc::StatusCode::ABORTED,
-                  "[Failed CONSENSUS] on " + consensus_msg.str());
+  } else {
+    acceptances =
+        QuorumCall<ProposeRequest, AcceptResponse>(
+            &MultiPaxos::Stub::async::Propose, kPaxosRpcTimeout)
+            .Run(acceptor_stubs, propose_req, quorum, &propose_errors);
   }
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "[Reached CONSENSUS] on " << consensus_msg.str() << std::endl;
+  stats_->Record(Phase::kPropose,
+                 std::chrono::steady_clock::now() - propose_start);
+  int num_of_accepted = acceptances.size();
+  if (num_of_accepted < quorum) {
+    stats_->Increment(Counter::kProposeQuorumFailures);
+    std::stringstream consensus_msg;
+    consensus_msg << "[Failed CONSENSUS] on [key: " << propose_req.key()
+                  << ", round: " << propose_req.round()
+                  << ", propose_id: " << propose_req.propose_id()
+                  << ", value: " << propose_req.value()
+                  << ", operations: " << propose_req.operations_size()
+                  << "]: " << num_of_accepted << " Accept, "
+                  << propose_errors.size() << " Reject.";
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                     << consensus_msg.str();
+    // Tell the caller if an Acceptor has promised a newer term.
+    auto code = std::any_of(propose_errors.begin(), propose_errors.end(),
+                            is_superseded)
+                    ? grpc::StatusCode::FAILED_PRECONDITION
+                    : grpc::StatusCode::ABORTED;
+    return Status(code, consensus_msg.str());
+  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Reached CONSENSUS] on [key: " << propose_req.key()
+           << ", round: " << propose_req.round()
+           << ", propose_id: " << propose_req.propose_id()
+           << ", value: " << propose_req.value()
+           << ", operations: " << propose_req.operations_size()
+           << "]: " << num_of_accepted << " Accept, "
+           << propose_errors.size() << " Reject.";
+  if (propose_req.key() == kLogKey) {
+    std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+    chosen_slot_ = std::max(chosen_slot_, propose_req.round());
   }
   // Inform Learners.
   InformRequest inform_req;
-  inform_req.set_key(key);
-  *inform_req.mutable_acceptance() = acceptance;
+  inform_req.set_key(propose_req.key());
+  *inform_req.mutable_acceptance() = acceptances.front().response;
+  {
+    std::lock_guard<std::mutex> compaction_lock(compaction_mtx_);
+    inform_req.set_compactable_slot(compactable_slot_);
+  }
   // {
-  //   std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
   //   TIME_LOG << "[" << my_paxos_address_ << "] "
-  //            << "Informed " << num_of_acceptors << " Learners:"
+  //            << "Informed " << acceptor_stubs.size() << " Learners:"
   //            << " [key: " << inform_req.key()
   //            << ", type: " << inform_req.acceptance().type()
   //            << ", value: " << inform_req.acceptance().value() << "]."
-  //            << std::endl;
+  //;
   // }
-  for (const std::string& addr : live_paxos_stubs) {
-    const auto& stub = paxos_stubs[addr];
-    ClientContext context;
-    auto deadline =
-        std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-    context.set_deadline(deadline);
-    EmptyMessage inform_resp;
-    Status inform_status = stub->Inform(&context, inform_req, &inform_resp);
-    if (!inform_status.ok()) {
-      // std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      // TIME_LOG << "[" << my_paxos_address_ << "] "
-      //          << "  Learner " << addr
-      //          << " returned error: " << inform_status.error_message()
-      //          << std::endl;
+  // Return once a quorum of Learners, including this replica, has learned
+  // the value. The remaining Learners are informed in the background; a
+  // Learner that misses a slot would stall on it until it catches up.
+  auto inform_start = std::chrono::steady_clock::now();
+  auto informed =
+      QuorumCall<InformRequest, InformResponse>(
+          &MultiPaxos::Stub::async::Inform, kPaxosRpcTimeout,
+          /*cancel_stragglers=*/false)
+          .Run(acceptor_stubs, inform_req, quorum, nullptr, my_paxos_address_);
+  stats_->Record(Phase::kInform,
+                 std::chrono::steady_clock::now() - inform_start);
+  UpdateCompactableSlot(informed);
+  return Status::OK;
+}
+
+// Runs Phase 1 once per term for every slot of the write log that is not
+// executed yet, then finishes the slots that earlier proposals left accepted
+// but not chosen, and fills the empty ones with no-ops.
+// Role: Coordinator
+Status MultiPaxosServiceImpl::EnsureLeadership(
+    const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs,
+    int phase1_quorum, int phase2_quorum, int* ballot) {
+  std::lock_guard<std::mutex> leader_lock(leader_mtx_);
+  int term = paxos_stubs_map_->GetCoordinatorTerm();
+  if (paxos_stubs_map_->GetCoordinator() != my_paxos_address_) {
+    leader_prepared_ = false;
+    return NotCoordinator();
+  }
+  if (leader_prepared_ && leader_ballot_ == term) {
+    *ballot = term;
+    return Status::OK;
+  }
+  leader_prepared_ = false;
+  int from_slot = kv_db_->GetAppliedSlot() + 1;
+  int last_slot = from_slot - 1;
+  {
+    std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+    if (leader_ballot_ == term) {
+      // Slots reserved earlier in this term may have been left empty.
+      last_slot = std::max(last_slot, next_slot_ - 1);
     } else {
-      // std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-      // TIME_LOG << "[" << my_paxos_address_ << "] "
-      //          << "  Learner " << addr << " returned OK." << std::endl;
+      next_slot_ = 0;
     }
   }
+  leader_ballot_ = term;
+  LeaderPrepareRequest prepare_req;
+  prepare_req.set_ballot(term);
+  prepare_req.set_from_slot(from_slot);
+  std::vector<Status> prepare_errors;
+  auto prepare_start = std::chrono::steady_clock::now();
+  auto promises =
+      QuorumCall<LeaderPrepareRequest, LeaderPromiseResponse>(
+          &MultiPaxos::Stub::async::PrepareLeader, kPaxosRpcTimeout)
+          .Run(acceptor_stubs, prepare_req, phase1_quorum, &prepare_errors);
+  stats_->Record(Phase::kPrepareLeader,
+                 std::chrono::steady_clock::now() - prepare_start);
+  if (static_cast<int>(promises.size()) < phase1_quorum) {
+    stats_->Increment(Counter::kPrepareQuorumFailures);
+    std::stringstream quorum_msg;
+    quorum_msg << "[Failed QUORUM] on [ballot: " << term
+               << ", from_slot: " << from_slot << "]: " << promises.size()
+               << " Promise, " << prepare_errors.size() << " Reject.";
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] " << quorum_msg.str();
+    return Status(grpc::StatusCode::ABORTED, quorum_msg.str());
+  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Reached QUORUM] on [ballot: " << term
+           << ", from_slot: " << from_slot << "]: " << promises.size()
+           << " Promise, " << prepare_errors.size() << " Reject.";
+  // Slots this replica has not executed may already be compacted by
+  // others. They only survive in a snapshot, so recover one first.
+  for (const auto& promise : promises) {
+    if (promise.response.compacted_slot() < from_slot) continue;
+    Status recover_status =
+        GetRecovery(paxos_stubs_map_->GetStub(promise.address));
+    return Status(grpc::StatusCode::ABORTED,
+                  "Coordinator was behind the compacted log. " +
+                      (recover_status.ok() ? "Recovered, try again."
+                                           : recover_status.error_message()));
+  }
+
+  // Collect what the quorum accepted that this replica has not learned.
+  // A proposal some Learner knows to be chosen is learned directly; the
+  // others are proposed again with the highest accepted_id winning.
+  std::map<int, PaxosLog> chosen;
+  std::map<int, PaxosLog> unchosen;
+  for (const auto& promise : promises) {
+    for (const auto& accepted : promise.response.accepted()) {
+      int slot = accepted.slot();
+      last_slot = std::max(last_slot, slot);
+      if (kv_db_->GetAcceptorState(kLogKey, slot).chosen) continue;
+      if (accepted.log().chosen()) {
+        chosen[slot] = accepted.log();
+      } else if (accepted.log().accepted_id() >
+                 unchosen[slot].accepted_id()) {
+        unchosen[slot] = accepted.log();
+      }
+    }
+  }
+  // Slots nobody in the quorum accepted get a no-op, unless this replica is
+  // still proposing them.
+  int num_of_noops = 0;
+  {
+    std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+    for (int slot = from_slot; slot <= last_slot; ++slot) {
+      if (in_flight_slots_.count(slot) > 0) {
+        unchosen.erase(slot);
+        continue;
+      }
+      if (chosen.count(slot) > 0 || unchosen.count(slot) > 0 ||
+          kv_db_->GetAcceptorState(kLogKey, slot).chosen) {
+        continue;
+      }
+      unchosen[slot] = PaxosLog();
+      ++num_of_noops;
+    }
+    next_slot_ = std::max(next_slot_, last_slot + 1);
+  }
+  for (const auto& entry : chosen) {
+    Learn(kLogKey, ToAcceptance(entry.first, entry.second));
+    unchosen.erase(entry.first);
+  }
+  for (const auto& entry : unchosen) {
+    ProposeRequest propose_req;
+    propose_req.set_key(kLogKey);
+    propose_req.set_round(entry.first);
+    propose_req.set_propose_id(term);
+    propose_req.set_type(entry.second.accepted_type());
+    propose_req.set_value(entry.second.accepted_value());
+    *propose_req.mutable_operations() = entry.second.accepted_operations();
+    Status propose_status =
+        ProposeAndInform(acceptor_stubs, phase2_quorum, propose_req);
+    if (!propose_status.ok()) {
+      return Status(propose_status.error_code(),
+                    "Failed to finish earlier proposals. " +
+                        propose_status.error_message());
+    }
+  }
+  leader_prepared_ = true;
+  *ballot = term;
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Success] Leading with ballot " << term << ". Finished "
+           << chosen.size() + unchosen.size() << " earlier proposals ("
+           << num_of_noops << " no-ops).";
   return Status::OK;
 }
 
-Status MultiPaxosServiceImpl::GetCoordinator() {
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Sending Requests to get Coordinator address." << std::endl;
+// Role: Coordinator
+Status MultiPaxosServiceImpl::ConfirmLeadership(int* read_index) {
+  std::unique_lock<std::mutex> read_index_lock(read_index_mtx_);
+  // A confirmation already in flight may have read the executed slot before
+  // this read arrived, so wait for one started after it.
+  int64_t round = read_index_rounds_started_ + 1;
+  while (read_index_rounds_done_ < round) {
+    if (confirming_) {
+      read_index_cv_.wait(read_index_lock);
+      continue;
+    }
+    confirming_ = true;
+    int64_t started = ++read_index_rounds_started_;
+    read_index_lock.unlock();
+    ServerStats::Timer timer(stats_, Phase::kReadIndex);
+    stats_->Increment(Counter::kReadIndexRounds);
+    std::map<std::string, MultiPaxos::Stub*> acceptor_stubs;
+    int phase1_quorum = 0;
+    int phase2_quorum = 0;
+    int ballot = 0;
+    int slot = 0;
+    Status status =
+        GetLiveAcceptorStubs(&acceptor_stubs, &phase1_quorum, &phase2_quorum);
+    // A new term must finish the slots earlier terms left unchosen before
+    // its executed slot covers every acknowledged write.
+    if (status.ok()) {
+      status = EnsureLeadership(acceptor_stubs, phase1_quorum, phase2_quorum,
+                                &ballot);
+    }
+    if (status.ok()) {
+      // Every write acknowledged so far is in a slot chosen before now, if
+      // not executed yet.
+      {
+        std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+        slot = chosen_slot_;
+      }
+      slot = std::max(slot, kv_db_->GetAppliedSlot());
+      // Phase 1 again with the current ballot changes nothing on Acceptors
+      // that promised it, and is rejected by those that promised a later
+      // Coordinator. Every Phase 1 quorum of a later term meets this one.
+      // It goes to all Acceptors, since one suspected down may well answer.
+      LeaderPrepareRequest confirm_req;
+      confirm_req.set_ballot(ballot);
+      confirm_req.set_from_slot(std::numeric_limits<int>::max());
+      std::vector<Status> confirm_errors;
+      auto confirmations =
+          QuorumCall<LeaderPrepareRequest, LeaderPromiseResponse>(
+              &MultiPaxos::Stub::async::PrepareLeader, kPaxosRpcTimeout)
+              .Run(paxos_stubs_map_->GetPaxosStubs(), confirm_req,
+                   phase2_quorum, &confirm_errors);
+      if (static_cast<int>(confirmations.size()) < phase2_quorum) {
+        bool superseded = std::any_of(
+            confirm_errors.begin(), confirm_errors.end(),
+            [](const Status& error) {
+              return error.error_code() ==
+                     grpc::StatusCode::FAILED_PRECONDITION;
+            });
+        if (superseded) {
+          std::lock_guard<std::mutex> leader_lock(leader_mtx_);
+          leader_prepared_ = false;
+        }
+        status = superseded ? NotCoordinator()
+                            : Status(grpc::StatusCode::ABORTED,
+                                     "[Failed QUORUM] on read index.");
+      }
+    }
+    read_index_lock.lock();
+    confirming_ = false;
+    read_index_rounds_done_ = started;
+    read_index_status_ = status;
+    read_index_ = slot;
+    read_index_cv_.notify_all();
   }
+  *read_index = read_index_;
+  return read_index_status_;
+}
+
+Status MultiPaxosServiceImpl::NotCoordinator() const {
+  GetCoordinatorResponse hint;
+  hint.set_coordinator(paxos_stubs_map_->GetCoordinator());
+  hint.set_term(paxos_stubs_map_->GetCoordinatorTerm());
+  return Status(grpc::StatusCode::FAILED_PRECONDITION, "Not Coordinator.",
+                hint.SerializeAsString());
+}
+
+// Reserves the next slot, so that concurrent proposals of the same term
+// never share a slot.
+int MultiPaxosServiceImpl::NextSlot() {
+  std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+  next_slot_ = std::max(next_slot_, kv_db_->GetLatestRound(kLogKey) + 1);
+  in_flight_slots_.insert(next_slot_);
+  return next_slot_++;
+}
+
+void MultiPaxosServiceImpl::FinishSlot(int slot) {
+  std::lock_guard<std::mutex> slots_lock(slots_mtx_);
+  in_flight_slots_.erase(slot);
+}
+
+Status MultiPaxosServiceImpl::GetCoordinator() {
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Sending Requests to get Coordinator address.";
   assert(paxos_stubs_map_ != nullptr);
   auto stubs = paxos_stubs_map_->GetPaxosStubs();
   std::set<std::string> coordinators;
+  int term = 0;
   std::set<std::string> live_paxos_stubs;
   for (const auto& stub : stubs) {
     ClientContext context;
@@ -623,112 +1549,193 @@ Status MultiPaxosServiceImpl::GetCoordinator() {
       live_paxos_stubs.insert(stub.first);
       if (!get_cdnt_resp.coordinator().empty()) {
         coordinators.insert(get_cdnt_resp.coordinator());
+        term = std::max(term, get_cdnt_resp.term());
       }
     }
   }
   if (coordinators.size() != 1) {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Failed to get Coordinator addresses." << std::endl;
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                     << "Failed to get Coordinator addresses.";
     return Status(grpc::StatusCode::ABORTED,
                   "Failed to get Coordinator addresses.");
   }
   if (live_paxos_stubs.find(*coordinators.begin()) == live_paxos_stubs.end()) {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Coordinator is unavailable." << std::endl;
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                     << "Coordinator is unavailable.";
     return Status(grpc::StatusCode::ABORTED, "Coordinator is unavailable.");
   }
-  paxos_stubs_map_->SetCoordinator(*coordinators.begin());
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "[Success] Set Coordinator addresses to ["
-             << *coordinators.begin() << "]." << std::endl;
-  }
+  paxos_stubs_map_->SetCoordinator(*coordinators.begin(), term);
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Success] Set Coordinator addresses to ["
+           << *coordinators.begin() << "].";
   return Status::OK;
 }
 
 Status MultiPaxosServiceImpl::ElectNewCoordinator() {
-  {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Sending Request to elect Coordinator via Paxos." << std::endl;
-  }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Electing this replica Coordinator via Paxos.";
   assert(paxos_stubs_map_ != nullptr);
-  auto* my_paxos_stub = paxos_stubs_map_->GetStub(my_paxos_address_);
-  ClientContext context;
-  auto deadline =
-      std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-  context.set_deadline(deadline);
   ElectCoordinatorRequest set_cdnt_req;
   set_cdnt_req.set_key("coordinator");
   set_cdnt_req.set_coordinator(my_paxos_address_);
-  EmptyMessage set_cdnt_resp;
-  return my_paxos_stub->ElectCoordinator(&context, set_cdnt_req,
-                                         &set_cdnt_resp);
+  return Elect(set_cdnt_req, paxos_stubs_map_->GetCoordinatorTerm());
 }
 
-Status MultiPaxosServiceImpl::GetRecovery() {
+Status MultiPaxosServiceImpl::Elect(const ElectCoordinatorRequest& request,
+                                    int seen_term) {
+  std::lock_guard<std::mutex> election_lock(election_mtx_);
+  auto elected_since_seen = [this, seen_term]() {
+    return paxos_stubs_map_->GetCoordinatorTerm() > seen_term &&
+           liveness_tracker_->IsLive(paxos_stubs_map_->GetCoordinator());
+  };
+  // Requests that waited for another election are answered by it.
+  if (elected_since_seen()) return Status::OK;
+  stats_->Increment(Counter::kElections);
+  // Run a Paxos instance to reach consensus on the operation.
+  Status set_status;
   {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Sending RecoverRequest to Coordinator." << std::endl;
+    ServerStats::Timer timer(stats_, Phase::kElection);
+    set_status = RunPaxos(request);
   }
-  assert(paxos_stubs_map_ != nullptr);
-  auto* coordinator_stub = paxos_stubs_map_->GetCoordinatorStub();
-  ClientContext context;
-  auto deadline =
-      std::chrono::system_clock::now() + std::chrono::milliseconds(5000);
-  context.set_deadline(deadline);
-  EmptyMessage recover_req;
-  RecoverResponse recover_resp;
-  Status recover_status =
-      coordinator_stub->Recover(&context, recover_req, &recover_resp);
-  if (!recover_status.ok()) {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Failed to get Recovery from Coordinator." << std::endl;
-    return Status(grpc::StatusCode::ABORTED,
-                  "Failed to get Recovery from Coordinator.");
+  if (!set_status.ok()) {
+    stats_->Increment(Counter::kElectionFailures);
+    // Losing to a concurrent election still leaves a Coordinator.
+    if (elected_since_seen()) return Status::OK;
   }
+  return set_status;
+}
 
-  for (const auto& kv : recover_resp.kv_map()) {
-    kv_db_->SetValue(kv.first, kv.second);
-  }
-  for (const auto& entry : recover_resp.paxos_logs()) {
-    const std::string& key = entry.first;
-    const auto& paxos_logs = entry.second.logs();
-    for (const auto& log : paxos_logs) {
-      kv_db_->AddPaxosLog(key, log.first, log.second.promised_id(),
-                          log.second.accepted_id(), log.second.accepted_type(),
-                          log.second.accepted_value());
+// The first live replica in address order elects itself as soon as the
+// current Coordinator is suspected. The others back off by their rank, so
+// that they rarely race it, and only step in if it fails.
+// failover_mtx_ only guards the stop flag, so the checks and the election
+// run without any lock.
+void MultiPaxosServiceImpl::FailoverLoop() {
+  std::string suspected;
+  auto suspected_since = std::chrono::steady_clock::now();
+  while (true) {
+    {
+      std::unique_lock<std::mutex> failover_lock(failover_mtx_);
+      if (failover_cv_.wait_for(failover_lock, kFailoverCheckInterval,
+                                [this] { return failover_stopped_; })) {
+        return;
+      }
+    }
+    std::string coordinator = paxos_stubs_map_->GetCoordinator();
+    if (coordinator.empty() || coordinator == my_paxos_address_ ||
+        liveness_tracker_->IsLive(coordinator)) {
+      suspected.clear();
+      continue;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (suspected != coordinator) {
+      suspected = coordinator;
+      suspected_since = now;
+    }
+    std::set<std::string> live = liveness_tracker_->GetLiveReplicas();
+    auto rank =
+        std::distance(live.begin(), live.lower_bound(my_paxos_address_));
+    if (now - suspected_since < rank * kFailoverBackoff) continue;
+    ElectCoordinatorRequest set_cdnt_req;
+    set_cdnt_req.set_key("coordinator");
+    set_cdnt_req.set_coordinator(my_paxos_address_);
+    int term = paxos_stubs_map_->GetCoordinatorTerm();
+    stats_->Increment(Counter::kFailovers);
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                     << "Coordinator " << coordinator
+                     << " is suspected. Electing a new one.";
+    if (Elect(set_cdnt_req, term).ok()) {
+      stats_->Record(Phase::kFailover,
+                     std::chrono::steady_clock::now() - suspected_since);
     }
   }
-  auto tmp_kv_db = kv_db_->GetDataMap();
-  auto tmp_paxos_keys = kv_db_->GetPaxosLogKeys();
+}
+
+Status MultiPaxosServiceImpl::GetRecovery(MultiPaxos::Stub* stub) {
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "Sending RecoverRequest.";
+  assert(stub != nullptr);
+  stats_->Increment(Counter::kRecoveries);
+  ServerStats::Timer timer(stats_, Phase::kRecovery);
+  ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + kRecoverTimeout);
+  RecoverRequest recover_req;
+  RecoverChunk chunk;
+  int num_of_chunks = 0;
+  int num_of_keys = 0;
+  int num_of_logs = 0;
+  bool incremental = false;
+  bool load_data = false;
+  bool data_loaded = false;
+  Status recover_status;
+  // Chunks are applied as they arrive, without apply_mtx_. Learners and
+  // local reads wait until the recovery is over.
+  std::lock_guard<std::mutex> recovery_lock(recovery_mtx_);
   {
-    std::unique_lock<std::shared_mutex> writer_lock(log_mtx_);
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Received recovery snapshot:" << std::endl;
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "KV Data Map:" << std::endl;
-    for (const auto& kv : tmp_kv_db) {
-      TIME_LOG << "[" << my_paxos_address_ << "] "
-               << "  [key: " << kv.first << ", value: " << kv.second << "]"
-               << std::endl;
+    std::lock_guard<std::mutex> apply_lock(apply_mtx_);
+    recovering_ = true;
+    recover_req.set_applied_slot(kv_db_->GetAppliedSlot());
+  }
+  // Slots chosen after the snapshot was taken, to execute once it is loaded.
+  std::map<int, AcceptResponse> chosen_slots;
+  auto reader = stub->Recover(&context, recover_req);
+  while (reader->Read(&chunk)) {
+    // Skip the data if there is none, or if this replica already executed
+    // slots past the snapshot.
+    if (num_of_chunks++ == 0) {
+      incremental = chunk.incremental();
+      load_data =
+          !incremental && chunk.applied_slot() >= kv_db_->GetAppliedSlot();
     }
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "Paxos Logs:" << std::endl;
-    for (const auto& key : tmp_paxos_keys) {
-      TIME_LOG << "[" << my_paxos_address_ << "] "
-               << "  [key: " << key
-               << ", last round: " << kv_db_->GetLatestRound(key) << "]."
-               << std::endl;
+    if (load_data && !data_loaded) {
+      kv_db_->LoadSnapshotChunk(chunk.kv_map(), chunk.applied_slot(),
+                                /*first=*/num_of_chunks == 1,
+                                /*last=*/chunk.data_complete());
+      data_loaded = chunk.data_complete();
+      num_of_keys += chunk.kv_map_size();
     }
-    TIME_LOG << "[" << my_paxos_address_ << "] "
-             << "[Success] Recovered data and paxos logs." << std::endl;
+    for (const auto& entry : chunk.paxos_logs()) {
+      const std::string& key = entry.first;
+      for (const auto& log : entry.second.logs()) {
+        kv_db_->AddPaxosLog(key, log.first, log.second);
+        ++num_of_logs;
+        if (key == kLogKey && log.second.chosen() &&
+            log.first > kv_db_->GetAppliedSlot()) {
+          chosen_slots.emplace(log.first, ToAcceptance(log.first, log.second));
+        }
+      }
+    }
+  }
+  recover_status = reader->Finish();
+  // Part of a snapshot is no state at all. Start over from an empty
+  // datastore, which catches up or recovers again like a new replica.
+  if (load_data && !data_loaded) {
+    kv_db_->ResetData({}, 0);
+    if (recover_status.ok()) {
+      recover_status = Status(grpc::StatusCode::DATA_LOSS,
+                              "Recovery stream ended before the data did.");
+    }
+  }
+  {
+    std::lock_guard<std::mutex> apply_lock(apply_mtx_);
+    chosen_slots_.merge(chosen_slots);
+    recovering_ = false;
+    ExecuteChosenSlots();
+  }
+  if (!recover_status.ok()) {
+    stats_->Increment(Counter::kRecoveryFailures);
+    TIME_LOG_WARNING << "[" << my_paxos_address_ << "] "
+                     << "Failed to get Recovery: "
+                     << recover_status.error_message();
+    return Status(grpc::StatusCode::ABORTED,
+                  "Failed to get Recovery: " + recover_status.error_message());
   }
+  TIME_LOG << "[" << my_paxos_address_ << "] "
+           << "[Success] Recovered " << num_of_keys << " keys and "
+           << num_of_logs << " Paxos logs in " << num_of_chunks << " chunks "
+           << (incremental ? "after slot " : "from a snapshot past slot ")
+           << recover_req.applied_slot() << ", up to slot "
+           << kv_db_->GetAppliedSlot() << ".";
   return Status::OK;
 }
 
@@ -1,34 +1,89 @@
 #ifndef MULTI_PAXOS_SERVICE_IMPL_H
 #define MULTI_PAXOS_SERVICE_IMPL_H
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <grpcpp/grpcpp.h>
 
 #include "keyvaluestore.grpc.pb.h"
 #include "kv-database.h"
+#include "liveness-tracker.h"
 #include "paxos-stubs-map.h"
+#include "quorum-call.h"
+#include "server-stats.h"
 #include "time_log.h"
+#include "write-batcher.h"
 
 namespace keyvaluestore {
 
-class MultiPaxosServiceImpl final : public MultiPaxos::Service {
+// Reserved key of the write log. Its rounds are the slots of a single
+// replicated log, each holding a batch of writes committed by Coordinator.
+// Learners execute the slots strictly in slot order.
+constexpr char kLogKey[] = "#log";
+
+// Client reads and writes are served through the gRPC callback API: a write
+// waits in the WriteBatcher for its batch to commit, and a read at a minimum
+// slot waits for the slot to be executed, neither on a gRPC thread. The
+// other methods are synchronous.
+class MultiPaxosServiceImpl final
+    : public MultiPaxos::WithCallbackMethod_GetValue<
+          MultiPaxos::WithCallbackMethod_PutPair<
+              MultiPaxos::WithCallbackMethod_DeletePair<
+                  MultiPaxos::WithCallbackMethod_MultiGet<
+                      MultiPaxos::WithCallbackMethod_WriteBatch<
+                          MultiPaxos::Service>>>>> {
  public:
-  MultiPaxosServiceImpl(PaxosStubsMap* paxos_stubs_map, KeyValueDataBase* kv_db,
-                        const std::string& my_paxos_address, double fail_rate);
-  grpc::Status Initialize();
+  MultiPaxosServiceImpl(PaxosStubsMap* paxos_stubs_map,
+                        LivenessTracker* liveness_tracker,
+                        KeyValueDataBase* kv_db, ServerStats* stats,
+                        const std::string& my_paxos_address, double fail_rate,
+                        std::chrono::microseconds batch_window,
+                        int max_batch_size, int pipeline_depth,
+                        std::chrono::milliseconds compaction_interval,
+                        int compaction_retention, int phase1_quorum,
+                        int phase2_quorum, bool thrifty_propose,
+                        std::chrono::milliseconds thrifty_timeout);
+  ~MultiPaxosServiceImpl();
+  // Resolves the Phase 1 and Phase 2 quorum sizes configured for
+  // num_of_replicas Acceptors, 0 meaning the default. Fails unless every
+  // Phase 1 quorum intersects every Phase 2 quorum.
+  static grpc::Status QuorumSizes(int num_of_replicas, int phase1_quorum,
+                                  int phase2_quorum, int* phase1,
+                                  int* phase2);
+  // Finds Coordinator, or elects this replica if there is none, and
+  // recovers from it. If lead, this replica then becomes Coordinator.
+  grpc::Status Initialize(bool lead);
 
   // Get the corresponding value for a given key.
-  grpc::Status GetValue(grpc::ServerContext* context, const GetRequest* request,
-                        GetResponse* response) override;
+  grpc::ServerUnaryReactor* GetValue(grpc::CallbackServerContext* context,
+                                     const GetRequest* request,
+                                     GetResponse* response) override;
   // Put a (key, value) pair into the store.
-  grpc::Status PutPair(grpc::ServerContext* context, const PutRequest* request,
-                       EmptyMessage* response) override;
+  grpc::ServerUnaryReactor* PutPair(grpc::CallbackServerContext* context,
+                                    const PutRequest* request,
+                                    CommitResponse* response) override;
   // Delete the corresponding pair from the store for a given key.
-  grpc::Status DeletePair(grpc::ServerContext* context,
-                          const DeleteRequest* request,
-                          EmptyMessage* response) override;
+  grpc::ServerUnaryReactor* DeletePair(grpc::CallbackServerContext* context,
+                                       const DeleteRequest* request,
+                                       CommitResponse* response) override;
+  // Get the values of several keys at once.
+  grpc::ServerUnaryReactor* MultiGet(grpc::CallbackServerContext* context,
+                                     const MultiGetRequest* request,
+                                     MultiGetResponse* response) override;
+  // Commit a batch of writes in one slot of the write log.
+  grpc::ServerUnaryReactor* WriteBatch(grpc::CallbackServerContext* context,
+                                       const WriteBatchRequest* request,
+                                       CommitResponse* response) override;
   // Update coordinator when old coordinator is unavailable.
   grpc::Status ElectCoordinator(grpc::ServerContext* context,
                                 const ElectCoordinatorRequest* request,
@@ -37,11 +92,21 @@ class MultiPaxosServiceImpl final : public MultiPaxos::Service {
   grpc::Status GetCoordinator(grpc::ServerContext* context,
                               const EmptyMessage* request,
                               GetCoordinatorResponse* response) override;
+  // Get the write log slot a read on another replica must wait for.
+  // Replica -> Coordinator.
+  grpc::Status ReadIndex(grpc::ServerContext* context,
+                         const ReadIndexRequest* request,
+                         ReadIndexResponse* response) override;
 
   // Paxos phase 1. Coordinator -> Acceptor.
   grpc::Status Prepare(grpc::ServerContext* context,
                        const PrepareRequest* request,
                        PromiseResponse* response) override;
+  // Paxos phase 1 for all slots of the write log. Stable Coordinator ->
+  // Acceptor.
+  grpc::Status PrepareLeader(grpc::ServerContext* context,
+                             const LeaderPrepareRequest* request,
+                             LeaderPromiseResponse* response) override;
   // Paxos phase 2. Coordinator -> Acceptor.
   grpc::Status Propose(grpc::ServerContext* context,
                        const ProposeRequest* request,
@@ -49,35 +114,189 @@ class MultiPaxosServiceImpl final : public MultiPaxos::Service {
   // Paxos phase 3. Coordinator -> Learner.
   grpc::Status Inform(grpc::ServerContext* context,
                       const InformRequest* request,
-                      EmptyMessage* response) override;
+                      InformResponse* response) override;
+  // Return chosen slots of the write log. Learner -> Coordinator.
+  grpc::Status GetChosen(grpc::ServerContext* context,
+                         const GetChosenRequest* request,
+                         GetChosenResponse* response) override;
 
   // Test if the server is available.
   grpc::Status Ping(grpc::ServerContext* context, const EmptyMessage* request,
                     EmptyMessage* response) override;
 
-  // After brought up again, a server will catch up with others' logs.
+  // After brought up again, a server will catch up with others' logs. Only
+  // the write log slots it missed are sent, unless they were compacted; then
+  // the whole state is. Either is streamed in chunks of bounded size.
   grpc::Status Recover(grpc::ServerContext* context,
-                       const EmptyMessage* request,
-                       RecoverResponse* response) override;
+                       const RecoverRequest* request,
+                       grpc::ServerWriter<RecoverChunk>* writer) override;
+
+  // Get the counters and per-phase latencies of this replica.
+  grpc::Status Stats(grpc::ServerContext* context, const EmptyMessage* request,
+                     StatsResponse* response) override;
 
  private:
+  using ReadFn = std::function<void(const grpc::Status& status)>;
+
   void SetProposeValue(const ElectCoordinatorRequest& set_cdnt_req,
-                       ProposeRequest* propose_req);
-  void SetProposeValue(const PutRequest& put_req, ProposeRequest* propose_req);
-  void SetProposeValue(const DeleteRequest& del_req,
-                       ProposeRequest* propose_req);
+                       Operation* operation);
+  void SetProposeValue(const PutRequest& put_req, Operation* operation);
+  void SetProposeValue(const DeleteRequest& del_req, Operation* operation);
+  // Queues a write for the next batch of the write log. done is called once
+  // the batch is committed.
   template <typename Request>
-  grpc::Status RunPaxos(const Request& req);
+  void SubmitWrite(const Request& req, WriteBatcher::DoneFn done);
+  // Runs a Paxos instance on the "coordinator" key.
+  grpc::Status RunPaxos(const ElectCoordinatorRequest& req);
+  // Returns the stubs of live Acceptors and the Phase 1 and Phase 2 quorum
+  // sizes out of all Acceptors. Fails if fewer Acceptors than a Phase 2
+  // quorum are live.
+  grpc::Status GetLiveAcceptorStubs(
+      std::map<std::string, MultiPaxos::Stub*>* acceptor_stubs,
+      int* phase1_quorum, int* phase2_quorum);
+  // Returns the count Acceptors of acceptor_stubs with the lowest heartbeat
+  // round-trip time. This replica always comes first.
+  std::map<std::string, MultiPaxos::Stub*> FastestAcceptors(
+      const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs,
+      int count);
+  // Commits a batch of writes in the next slot of the write log, and sets
+  // *committed_slot to it once it is executed here. Fails if it is not
+  // executed in time, even though it may be committed.
+  grpc::Status ProposeBatch(const std::vector<Operation>& operations,
+                            int* committed_slot);
+  // Runs Paxos phases 2 and 3 for an already prepared proposal. quorum is
+  // the Phase 2 quorum.
+  grpc::Status ProposeAndInform(
+      const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs,
+      int quorum, const ProposeRequest& propose_req);
+  // Makes sure Phase 1 has been run for the current term if this replica is
+  // Coordinator, and sets *ballot to the term.
+  grpc::Status EnsureLeadership(
+      const std::map<std::string, MultiPaxos::Stub*>& acceptor_stubs,
+      int phase1_quorum, int phase2_quorum, int* ballot);
+  // Returns the FAILED_PRECONDITION a replica that is not Coordinator answers
+  // client requests with. Its details redirect to the Coordinator it knows.
+  grpc::Status NotCoordinator() const;
+  // Reserves the next slot of the write log and marks it in flight.
+  int NextSlot();
+  void FinishSlot(int slot);
+  grpc::Status Learn(const std::string& key, const AcceptResponse& acceptance);
+  // Executes the chosen slots that directly follow the applied slot, unless
+  // a recovery is in progress. Requires apply_mtx_.
+  void ExecuteChosenSlots();
+  // Returns whether slot is executed here and no recovery is in progress.
+  // Requires apply_mtx_.
+  bool IsExecuted(int slot);
+  // Blocks until slot is executed locally, or until timeout. Fails with
+  // DEADLINE_EXCEEDED if it is not executed in time, or UNAVAILABLE if this
+  // replica is stopping.
+  grpc::Status WaitForApplied(int slot, std::chrono::milliseconds timeout);
+  // Calls read once this replica may serve a read: right away on
+  // Coordinator, or once min_slot is executed here if has_min_slot. Fails
+  // it with NotCoordinator() or, if min_slot is not executed in time, with
+  // DEADLINE_EXCEEDED.
+  void WhenReadable(bool has_min_slot, int min_slot, ReadFn read);
+  // Calls the reads waiting for executed slots, and fails those past their
+  // deadline. Requires apply_mtx_.
+  void ServeReadWaiters();
+  // Confirms with a Phase 2 quorum of all Acceptors that no later
+  // Coordinator has prepared the write log, and sets *read_index to the
+  // highest slot chosen or executed here before. Reads that arrive while a
+  // confirmation is in flight share the next one.
+  grpc::Status ConfirmLeadership(int* read_index);
+  // Fetches chosen slots in [from_slot, to_slot] from Coordinator.
+  void CatchUp(int from_slot, int to_slot);
+  void CatchUpLoop();
+  // Records the applied slots Learners reported, and advances
+  // compactable_slot_ to the slot a quorum of replicas has executed.
+  void UpdateCompactableSlot(
+      const std::vector<QuorumReply<InformResponse>>& replies);
+  // Drops Paxos log rounds executed on a quorum, keeping the latest
+  // compaction_retention_ of them.
+  void Compact();
+  void CompactionLoop();
   grpc::Status GetCoordinator();
   grpc::Status ElectNewCoordinator();
-  grpc::Status GetRecovery();
+  // Runs an election unless a live Coordinator was elected after
+  // seen_term. One election runs at a time.
+  grpc::Status Elect(const ElectCoordinatorRequest& request, int seen_term);
+  // Elects a new Coordinator once the heartbeat suspects the current one.
+  void FailoverLoop();
+  // Recovers data and Paxos logs from the replica at stub: the write log
+  // slots this replica missed, or a snapshot if they were compacted.
+  grpc::Status GetRecovery(MultiPaxos::Stub* stub);
   bool RandomFail();
 
-  const std::string my_paxos_address_;
-  KeyValueDataBase* kv_db_;
   PaxosStubsMap* paxos_stubs_map_;
-  std::shared_mutex log_mtx_;
+  LivenessTracker* liveness_tracker_;
+  KeyValueDataBase* kv_db_;
+  ServerStats* stats_;
+  const std::string my_paxos_address_;
   double fail_rate_;  // Set Acceptor to randomly fail at a fail_rate_.
+  // Configured quorum sizes; 0 means a majority.
+  const int phase1_quorum_;
+  const int phase2_quorum_;
+  const bool thrifty_propose_;
+  const std::chrono::milliseconds thrifty_timeout_;
+
+  // Stable Coordinator state. Phase 1 has been run for every slot of the
+  // write log with leader_ballot_ when leader_prepared_ is true.
+  std::mutex leader_mtx_;
+  int leader_ballot_ = 0;
+  bool leader_prepared_ = false;
+  // Next slot to propose in the current term, the slots being proposed,
+  // and the highest slot known to be chosen.
+  int next_slot_ = 0;
+  std::set<int> in_flight_slots_;
+  int chosen_slot_ = 0;
+  std::mutex slots_mtx_;
+
+  // Learner state. Slots chosen ahead of the applied slot wait in
+  // chosen_slots_ until the slots before them are chosen, and all of them
+  // wait while recovering_.
+  std::map<int, AcceptResponse> chosen_slots_;
+  bool recovering_ = false;
+  bool stopped_ = false;
+  std::mutex apply_mtx_;
+  std::condition_variable applied_cv_;
+  // Held across a whole recovery, so that one runs at a time.
+  std::mutex recovery_mtx_;
+  // Reads waiting for a slot to be executed, by slot.
+  struct ReadWaiter {
+    std::chrono::steady_clock::time_point start;
+    ReadFn read;
+  };
+  std::multimap<int, ReadWaiter> read_waiters_;
+  std::thread catch_up_thread_;
+  std::thread failover_thread_;
+  bool failover_stopped_ = false;
+  std::mutex failover_mtx_;
+  std::condition_variable failover_cv_;
+  std::mutex election_mtx_;
+
+  // Read-index state of Coordinator: how many leadership confirmations were
+  // started and finished, and the outcome of the last one finished.
+  int64_t read_index_rounds_started_ = 0;
+  int64_t read_index_rounds_done_ = 0;
+  bool confirming_ = false;
+  grpc::Status read_index_status_;
+  int read_index_ = 0;
+  std::mutex read_index_mtx_;
+  std::condition_variable read_index_cv_;
+
+  // Compaction state. Write log slots up to compactable_slot_ are executed
+  // on a quorum; Coordinator learns it from the applied slots in Inform
+  // responses and passes it on to Learners.
+  const std::chrono::milliseconds compaction_interval_;
+  const int compaction_retention_;
+  int compactable_slot_ = 0;
+  std::map<std::string, int> learner_applied_slots_;
+  size_t compacted_bytes_ = 0;
+  std::mutex compaction_mtx_;
+  std::thread compaction_thread_;
+
+  // Declared last so that it stops before the state it proposes with.
+  std::unique_ptr<WriteBatcher> batcher_;
 };
 
 }  // namespace keyvaluestore
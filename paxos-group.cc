@@ -0,0 +1,89 @@
+#include "paxos-group.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include <grpcpp/support/client_interceptor.h>
+
+namespace keyvaluestore {
+
+using grpc::experimental::ClientInterceptorFactoryInterface;
+using grpc::experimental::ClientRpcInfo;
+using grpc::experimental::InterceptionHookPoints;
+using grpc::experimental::Interceptor;
+using grpc::experimental::InterceptorBatchMethods;
+
+// Adds the group to the initial metadata of every call.
+class GroupInterceptor : public Interceptor {
+ public:
+  explicit GroupInterceptor(const std::string& group) : group_(group) {}
+
+  void Intercept(InterceptorBatchMethods* methods) override {
+    if (methods->QueryInterceptionHookPoint(
+            InterceptionHookPoints::PRE_SEND_INITIAL_METADATA)) {
+      methods->GetSendInitialMetadata()->insert({kGroupMetadataKey, group_});
+    }
+    methods->Proceed();
+  }
+
+ private:
+  const std::string& group_;
+};
+
+class GroupInterceptorFactory : public ClientInterceptorFactoryInterface {
+ public:
+  explicit GroupInterceptorFactory(int group)
+      : group_(std::to_string(group)) {}
+
+  Interceptor* CreateClientInterceptor(ClientRpcInfo* info) override {
+    return new GroupInterceptor(group_);
+  }
+
+ private:
+  const std::string group_;
+};
+
+int GroupOf(const std::string& key, int num_of_groups) {
+  if (num_of_groups <= 1) return 0;
+  // 64-bit FNV-1a.
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : key) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return static_cast<int>(hash % num_of_groups);
+}
+
+std::string PreferredLeader(std::vector<std::string> replicas, int group) {
+  if (replicas.empty()) return "";
+  std::sort(replicas.begin(), replicas.end());
+  return replicas[group % replicas.size()];
+}
+
+std::shared_ptr<grpc::Channel> CreateGroupChannel(const std::string& address,
+                                                  int group) {
+  std::vector<std::unique_ptr<ClientInterceptorFactoryInterface>> creators;
+  creators.push_back(std::make_unique<GroupInterceptorFactory>(group));
+  return grpc::experimental::CreateCustomChannelWithInterceptors(
+      address, grpc::InsecureChannelCredentials(), grpc::ChannelArguments(),
+      std::move(creators));
+}
+
+int GetGroup(const grpc::ServerContextBase& context) {
+  const auto& metadata = context.client_metadata();
+  auto iter = metadata.find(kGroupMetadataKey);
+  if (iter == metadata.end()) return 0;
+  int group = 0;
+  for (char c : iter->second) {
+    if (c < '0' || c > '9' || group > 1000000) return -1;
+    group = group * 10 + (c - '0');
+  }
+  return iter->second.empty() ? -1 : group;
+}
+
+std::string GroupWalPath(const std::string& wal_path, int group) {
+  if (wal_path.empty() || group == 0) return wal_path;
+  return wal_path + ".group" + std::to_string(group);
+}
+
+}  // namespace keyvaluestore
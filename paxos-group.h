@@ -0,0 +1,47 @@
+#ifndef PAXOS_GROUP_H
+#define PAXOS_GROUP_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// The keyspace is hash-partitioned into independent Paxos groups. Each group
+// has its own Coordinator, write log, Acceptor state and datastore, so that
+// groups commit writes in parallel. Every replica takes part in every group.
+//
+// A replica serves all of its groups on one MultiPaxos port. Calls carry
+// their group in the kGroupMetadataKey metadata, which channels made by
+// CreateGroupChannel() attach to every call. Calls without it go to group 0.
+
+constexpr char kGroupMetadataKey[] = "paxos-group";
+
+// Returns the group of key among num_of_groups groups. The hash differs from
+// the one KeyValueDataBase shards by, so a group's keys use all its shards.
+int GroupOf(const std::string& key, int num_of_groups);
+
+// Returns the replica that should lead group: groups are dealt out to the
+// replicas round-robin, in address order.
+std::string PreferredLeader(std::vector<std::string> replicas, int group);
+
+// Returns a channel to the MultiPaxos service at address whose calls are
+// addressed to group.
+std::shared_ptr<grpc::Channel> CreateGroupChannel(const std::string& address,
+                                                  int group);
+
+// Returns the group a call is addressed to, 0 if it names none, or -1 if
+// the name is malformed.
+int GetGroup(const grpc::ServerContextBase& context);
+
+// Returns the write-ahead log file of group. Group 0 keeps wal_path, so that
+// a single-group replica finds its old log.
+std::string GroupWalPath(const std::string& wal_path, int group);
+
+}  // namespace keyvaluestore
+
+#endif
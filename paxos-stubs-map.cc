@@ -9,24 +9,52 @@ std::string PaxosStubsMap::GetCoordinator() {
   return coordinator_;
 }
 
-bool PaxosStubsMap::SetCoordinator(const std::string& coordinator) {
+int PaxosStubsMap::GetCoordinatorTerm() {
+  std::shared_lock<std::shared_mutex> reader_lock(coordinator_mtx_);
+  return coordinator_term_;
+}
+
+bool PaxosStubsMap::SetCoordinator(const std::string& coordinator, int term) {
   {
     std::shared_lock<std::shared_mutex> reader_lock(stubs_mtx_);
     if (stubs_.find(coordinator) == stubs_.end()) return false;
   }
   {
     std::unique_lock<std::shared_mutex> writer_lock(coordinator_mtx_);
+    if (term < coordinator_term_) return false;
+    if (coordinator != coordinator_) {
+      for (grpc::ClientContext* cc : coordinator_calls_) cc->TryCancel();
+      coordinator_calls_.clear();
+    }
     coordinator_ = coordinator;
+    coordinator_term_ = term;
   }
   return true;
 }
 
 MultiPaxos::Stub* PaxosStubsMap::GetCoordinatorStub() {
-  std::shared_lock<std::shared_mutex> reader_lock(stubs_mtx_);
+  std::shared_lock<std::shared_mutex> coordinator_reader_lock(coordinator_mtx_);
+  std::shared_lock<std::shared_mutex> stubs_reader_lock(stubs_mtx_);
   if (stubs_.find(coordinator_) == stubs_.end()) return nullptr;
   return stubs_[coordinator_].get();
 }
 
+MultiPaxos::Stub* PaxosStubsMap::StartCoordinatorCall(grpc::ClientContext* cc,
+                                                      int* term) {
+  std::unique_lock<std::shared_mutex> coordinator_writer_lock(
+      coordinator_mtx_);
+  std::shared_lock<std::shared_mutex> stubs_reader_lock(stubs_mtx_);
+  *term = coordinator_term_;
+  if (stubs_.find(coordinator_) == stubs_.end()) return nullptr;
+  coordinator_calls_.insert(cc);
+  return stubs_[coordinator_].get();
+}
+
+void PaxosStubsMap::EndCoordinatorCall(grpc::ClientContext* cc) {
+  std::unique_lock<std::shared_mutex> writer_lock(coordinator_mtx_);
+  coordinator_calls_.erase(cc);
+}
+
 MultiPaxos::Stub* PaxosStubsMap::GetStub(const std::string& address) {
   std::shared_lock<std::shared_mutex> coordinator_reader_lock(coordinator_mtx_);
   std::shared_lock<std::shared_mutex> stubs_reader_lock(stubs_mtx_);
@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
 #include <utility>
@@ -20,8 +21,17 @@ class PaxosStubsMap {
  public:
   PaxosStubsMap(PaxosStubs stubs) : stubs_(std::move(stubs)) {}
   std::string GetCoordinator();
-  bool SetCoordinator(const std::string& coordinator);
+  // Returns the round in which the current Coordinator was elected.
+  int GetCoordinatorTerm();
+  // Ignores coordinators elected in an older term than the current one.
+  // Calls in flight to the previous Coordinator are cancelled.
+  bool SetCoordinator(const std::string& coordinator, int term);
   MultiPaxos::Stub* GetCoordinatorStub();
+  // Returns the Coordinator stub and sets *term to its term, and tracks cc
+  // as a call to it until EndCoordinatorCall(cc). The call is cancelled if
+  // another Coordinator is set meanwhile, so that it can be retried there.
+  MultiPaxos::Stub* StartCoordinatorCall(grpc::ClientContext* cc, int* term);
+  void EndCoordinatorCall(grpc::ClientContext* cc);
   MultiPaxos::Stub* GetStub(const std::string& address);
   std::map<std::string, MultiPaxos::Stub*> GetPaxosStubs();
 
@@ -29,6 +39,8 @@ class PaxosStubsMap {
   PaxosStubs stubs_;
   std::shared_mutex stubs_mtx_;
   std::string coordinator_;
+  int coordinator_term_ = 0;
+  std::set<grpc::ClientContext*> coordinator_calls_;
   std::shared_mutex coordinator_mtx_;
 };
 
@@ -0,0 +1,147 @@
+#ifndef QUORUM_CALL_H
+#define QUORUM_CALL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// A successful reply collected by QuorumCall.
+template <typename Response>
+struct QuorumReply {
+  std::string address;
+  Response response;
+};
+
+// Sends one request to a set of Paxos stubs concurrently through the
+// callback stub API and returns as soon as `quorum` of them answered OK, or
+// as soon as a quorum can no longer be reached. If `required_address` is not
+// empty, the call also waits for that replica to answer before returning.
+//
+// Calls still in flight when QuorumCall returns complete on gRPC's own
+// threads, so the caller never waits on stragglers. They are cancelled
+// first unless `cancel_stragglers` is false, which lets slow replicas still
+// receive the request.
+template <typename Request, typename Response>
+class QuorumCall {
+ public:
+  using AsyncMethod = void (MultiPaxos::Stub::async::*)(
+      grpc::ClientContext*, const Request*, Response*,
+      std::function<void(grpc::Status)>);
+
+  QuorumCall(AsyncMethod method, std::chrono::milliseconds timeout,
+             bool cancel_stragglers = true)
+      : method_(method),
+        timeout_(timeout),
+        cancel_stragglers_(cancel_stragglers) {}
+
+  // Returns the OK replies received before the call finished. The error
+  // replies received are appended to *errors if it is not null.
+  std::vector<QuorumReply<Response>> Run(
+      const std::map<std::string, MultiPaxos::Stub*>& stubs,
+      const Request& request, int quorum, std::vector<grpc::Status>* errors,
+      const std::string& required_address = "");
+
+ private:
+  struct Call {
+    std::string address;
+    grpc::ClientContext context;
+    Response response;
+    bool done = false;
+  };
+  // Owned jointly by Run() and the callbacks of the calls, whichever
+  // finishes last.
+  struct State {
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<Call>> calls;
+    std::string required_address;
+    std::vector<QuorumReply<Response>> replies;
+    std::vector<grpc::Status> errors;
+    int pending = 0;
+    bool required_done = false;
+    // Set once Run() has returned; later replies are dropped.
+    bool finished = false;
+  };
+
+  AsyncMethod method_;
+  std::chrono::milliseconds timeout_;
+  bool cancel_stragglers_;
+};
+
+template <typename Request, typename Response>
+std::vector<QuorumReply<Response>> QuorumCall<Request, Response>::Run(
+    const std::map<std::string, MultiPaxos::Stub*>& stubs,
+    const Request& request, int quorum, std::vector<grpc::Status>* errors,
+    const std::string& required_address) {
+  auto state = std::make_shared<State>();
+  auto deadline = std::chrono::system_clock::now() + timeout_;
+  for (const auto& stub : stubs) {
+    auto call = std::make_unique<Call>();
+    call->address = stub.first;
+    call->context.set_deadline(deadline);
+    state->calls.push_back(std::move(call));
+  }
+  int num_of_calls = state->calls.size();
+  state->pending = num_of_calls;
+  state->required_address = required_address;
+  state->required_done = required_address.empty() ||
+                         stubs.find(required_address) == stubs.end();
+
+  // Each call serializes the request as it starts, so only the calls and
+  // their responses need to outlive Run().
+  auto stub = stubs.begin();
+  for (int i = 0; i < num_of_calls; ++i, ++stub) {
+    Call* call = state->calls[i].get();
+    (stub->second->async()->*method_)(
+        &call->context, &request, &call->response,
+        [state, call](grpc::Status status) {
+          std::lock_guard<std::mutex> lock(state->mtx);
+          call->done = true;
+          --state->pending;
+          if (state->finished) return;
+          if (call->address == state->required_address) {
+            state->required_done = true;
+          }
+          if (status.ok()) {
+            state->replies.push_back({call->address, call->response});
+          } else {
+            state->errors.push_back(std::move(status));
+          }
+          state->cv.notify_one();
+        });
+  }
+
+  std::unique_lock<std::mutex> lock(state->mtx);
+  state->cv.wait(lock, [&state, num_of_calls, quorum] {
+    bool reached = static_cast<int>(state->replies.size()) >= quorum;
+    bool impossible =
+        num_of_calls - static_cast<int>(state->errors.size()) < quorum;
+    return state->pending == 0 || (reached && state->required_done) ||
+           impossible;
+  });
+  state->finished = true;
+  if (errors != nullptr) {
+    errors->insert(errors->end(), state->errors.begin(), state->errors.end());
+  }
+  // Abandon stragglers; their callbacks still run, and drop the replies.
+  for (const auto& call : state->calls) {
+    if (!call->done && cancel_stragglers_) call->context.TryCancel();
+  }
+  return std::move(state->replies);
+}
+
+}  // namespace keyvaluestore
+
+#endif
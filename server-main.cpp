@@ -16,8 +16,13 @@
 
 #include "kv-database.h"
 #include "kv-store-service-impl.h"
+#include "liveness-tracker.h"
+#include "multi-paxos-router.h"
 #include "multi-paxos-service-impl.h"
+#include "paxos-group.h"
+#include "server-stats.h"
 #include "time_log.h"
+#include "wal.h"
 
 using google::protobuf::TextFormat;
 
@@ -33,7 +38,7 @@ std::unique_ptr<grpc::Server> InitializeService(
   // Finally assemble the server.
   std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
   // Wait for the server to shutdown.
-  TIME_LOG << service_name << " Listening On: " << server_address << std::endl;
+  TIME_LOG << service_name << " Listening On: " << server_address;
   return std::move(server);
 }
 void StartService(grpc::Server* server) { server->Wait(); }
@@ -58,39 +63,144 @@ int main(int argc, char** argv) {
   TextFormat::ParseFromString(std::string(argv[1]), &server_config);
   std::string server_cfg_str;
   TextFormat::PrintToString(server_config, &server_cfg_str);
-  TIME_LOG << "Server Config:" << std::endl << server_cfg_str << std::endl;
-
-  std::map<std::string, std::unique_ptr<keyvaluestore::MultiPaxos::Stub>> stubs;
-  for (int i = 0; i < server_config.replica_size(); ++i) {
-    const std::string& paxos_address = server_config.replica(i);
-    stubs[paxos_address] = std::make_unique<keyvaluestore::MultiPaxos::Stub>(
-        grpc::CreateChannel(paxos_address, grpc::InsecureChannelCredentials()));
-    TIME_LOG << "Adding " << paxos_address << " to the Paxos stubs list."
-             << std::endl;
+  if (!server_config.log_level().empty()) {
+    time_log::Level log_level;
+    if (!time_log::ParseLevel(server_config.log_level(), &log_level)) {
+      std::cerr << "Unknown log_level: " << server_config.log_level()
+                << std::endl;
+      return -1;
+    }
+    time_log::SetLevel(log_level);
   }
+  time_log::StartAsync();
+  TIME_LOG << "Server Config:\n" << server_cfg_str;
 
-  keyvaluestore::PaxosStubsMap paxos_stubs_map(std::move(stubs));
-  keyvaluestore::KeyValueDataBase kv_db;
   const std::string& my_kv_address = server_config.my_addr();
   const std::string& my_paxos_address = server_config.my_paxos();
   double fail_rate = server_config.fail_rate();
+  const int num_of_groups =
+      server_config.num_groups() > 0 ? server_config.num_groups() : 1;
+  const std::vector<std::string> replicas(server_config.replica().begin(),
+                                          server_config.replica().end());
+  for (const std::string& paxos_address : replicas) {
+    TIME_LOG << "Adding " << paxos_address << " to the Paxos stubs list.";
+  }
+  int phase1_quorum = 0;
+  int phase2_quorum = 0;
+  grpc::Status quorum_status =
+      keyvaluestore::MultiPaxosServiceImpl::QuorumSizes(
+          replicas.size(), server_config.phase1_quorum(),
+          server_config.phase2_quorum(), &phase1_quorum, &phase2_quorum);
+  if (!quorum_status.ok()) {
+    std::cerr << quorum_status.error_message() << std::endl;
+    return -1;
+  }
+  // Every Paxos group has its own stubs, datastore and write-ahead log.
+  std::vector<std::unique_ptr<keyvaluestore::PaxosStubsMap>> paxos_stubs_maps;
+  std::vector<std::unique_ptr<keyvaluestore::WriteAheadLog>> wals;
+  std::vector<std::unique_ptr<keyvaluestore::KeyValueDataBase>> kv_dbs;
+  for (int group = 0; group < num_of_groups; ++group) {
+    keyvaluestore::PaxosStubs stubs;
+    for (const std::string& paxos_address : replicas) {
+      stubs[paxos_address] = std::make_unique<keyvaluestore::MultiPaxos::Stub>(
+          keyvaluestore::CreateGroupChannel(paxos_address, group));
+    }
+    paxos_stubs_maps.push_back(
+        std::make_unique<keyvaluestore::PaxosStubsMap>(std::move(stubs)));
+    std::unique_ptr<keyvaluestore::WriteAheadLog> wal;
+    if (!server_config.wal_path().empty()) {
+      wal = std::make_unique<keyvaluestore::WriteAheadLog>(
+          keyvaluestore::GroupWalPath(server_config.wal_path(), group));
+    }
+    kv_dbs.push_back(
+        std::make_unique<keyvaluestore::KeyValueDataBase>(wal.get()));
+    wals.push_back(std::move(wal));
+    grpc::Status replay_status = kv_dbs.back()->ReplayWal();
+    if (!replay_status.ok()) {
+      std::cerr << replay_status.error_message() << std::endl;
+      return -1;
+    }
+  }
+  int heartbeat_interval_ms = server_config.heartbeat_interval_ms() > 0
+                                  ? server_config.heartbeat_interval_ms()
+                                  : 200;
+  int heartbeat_timeout_ms = server_config.heartbeat_timeout_ms() > 0
+                                 ? server_config.heartbeat_timeout_ms()
+                                 : 500;
+  keyvaluestore::ServerStats stats;
+  // Groups share the replicas, so one heartbeat serves them all.
+  keyvaluestore::LivenessTracker liveness_tracker(
+      paxos_stubs_maps[0].get(), &stats,
+      std::chrono::milliseconds(heartbeat_interval_ms),
+      std::chrono::milliseconds(heartbeat_timeout_ms),
+      /*suspicion_threshold=*/2);
 
+  std::vector<keyvaluestore::PaxosStubsMap*> group_stubs_maps;
+  std::vector<std::unique_ptr<keyvaluestore::MultiPaxosServiceImpl>>
+      multi_paxos_services;
+  std::vector<keyvaluestore::MultiPaxosServiceImpl*> group_services;
+  for (int group = 0; group < num_of_groups; ++group) {
+    group_stubs_maps.push_back(paxos_stubs_maps[group].get());
+    multi_paxos_services.push_back(
+        std::make_unique<keyvaluestore::MultiPaxosServiceImpl>(
+            paxos_stubs_maps[group].get(), &liveness_tracker,
+            kv_dbs[group].get(), &stats, my_paxos_address, fail_rate,
+            std::chrono::microseconds(server_config.batch_window_us()),
+            server_config.max_batch_size() > 0
+                ? server_config.max_batch_size()
+                : 64,
+            server_config.pipeline_depth() > 0
+                ? server_config.pipeline_depth()
+                : 4,
+            std::chrono::milliseconds(
+                server_config.compaction_interval_ms() > 0
+                    ? server_config.compaction_interval_ms()
+                    : 1000),
+            server_config.compaction_retention() > 0
+                ? server_config.compaction_retention()
+                : 1000,
+            server_config.phase1_quorum(), server_config.phase2_quorum(),
+            server_config.thrifty_propose(),
+            std::chrono::milliseconds(
+                server_config.thrifty_timeout_ms() > 0
+                    ? server_config.thrifty_timeout_ms()
+                    : 50)));
+    group_services.push_back(multi_paxos_services.back().get());
+  }
   keyvaluestore::KeyValueStoreServiceImpl keyvaluestore_service(
-      &paxos_stubs_map, my_kv_address, my_paxos_address);
-  keyvaluestore::MultiPaxosServiceImpl multi_paxos_service(
-      &paxos_stubs_map, &kv_db, my_paxos_address, fail_rate);
+      group_stubs_maps, &stats, my_kv_address, my_paxos_address,
+      server_config.follower_reads());
+  keyvaluestore::MultiPaxosRouter multi_paxos_router(group_services);
   std::unique_ptr<grpc::Server> keyvaluestore_server = InitializeService(
       "KeyValueStoreService", my_kv_address, &keyvaluestore_service);
   std::unique_ptr<grpc::Server> multi_paxos_server = InitializeService(
-      "MultiPaxosService", my_paxos_address, &multi_paxos_service);
+      "MultiPaxosService", my_paxos_address, &multi_paxos_router);
 
   // Starts KeyValueStoreService in a detached thread.
   std::thread keyvaluestore_thread(StartService, keyvaluestore_server.get());
   // Starts MultiPaxosService in a detached thread.
   std::thread multi_paxos_thread(StartService, multi_paxos_server.get());
-  assert(multi_paxos_service.Initialize().ok());
+  // Learn which replicas are alive before taking part in Paxos runs.
+  liveness_tracker.Start();
+  // Groups are initialized in parallel, so that a replica finds or elects
+  // the Coordinators of all groups about as fast as of one. Each replica
+  // leads the groups it is the preferred leader of.
+  std::vector<grpc::Status> initialize_statuses(num_of_groups);
+  std::vector<std::thread> initialize_threads;
+  for (int group = 0; group < num_of_groups; ++group) {
+    bool lead =
+        keyvaluestore::PreferredLeader(replicas, group) == my_paxos_address;
+    initialize_threads.emplace_back([&, group, lead]() {
+      initialize_statuses[group] =
+          multi_paxos_services[group]->Initialize(lead);
+    });
+  }
+  for (auto& initialize_thread : initialize_threads) initialize_thread.join();
+  for (const grpc::Status& initialize_status : initialize_statuses) {
+    assert(initialize_status.ok());
+  }
   keyvaluestore_thread.join();
   multi_paxos_thread.join();
-  TIME_LOG << "Shutting down!" << std::endl;
+  TIME_LOG << "Shutting down!";
   return 0;
 }
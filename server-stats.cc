@@ -0,0 +1,87 @@
+#include "server-stats.h"
+
+#include <cstdio>
+
+namespace keyvaluestore {
+
+// Names of the counters and phases, in enum order.
+static const char* const kCounterNames[] = {
+    "prepare_quorum_failures", "propose_quorum_failures",
+    "random_fail_rejections",  "elections",
+    "election_failures",       "recoveries",
+    "recovery_failures",       "forward_elections",
+    "batches",                 "batched_operations",
+    "coalesced_operations",    "thrifty_fallbacks",
+    "failovers",               "read_index_rounds",
+    "local_reads",
+};
+static const char* const kPhaseNames[] = {
+    "ping_sweep",   "prepare",  "prepare_leader", "propose", "inform",
+    "commit_batch", "election", "failover",       "recovery",
+    "forward",      "read_index", "local_read_wait",
+};
+static_assert(sizeof(kCounterNames) / sizeof(kCounterNames[0]) ==
+                  static_cast<size_t>(Counter::kNumOfCounters),
+              "Every counter needs a name.");
+static_assert(sizeof(kPhaseNames) / sizeof(kPhaseNames[0]) ==
+                  static_cast<size_t>(Phase::kNumOfPhases),
+              "Every phase needs a name.");
+
+void ServerStats::Record(Phase phase,
+                         std::chrono::steady_clock::duration latency) {
+  latencies_[static_cast<int>(phase)].Record(
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
+void ServerStats::Export(StatsResponse* response) const {
+  auto* counters = response->mutable_counters();
+  for (int i = 0; i < static_cast<int>(Counter::kNumOfCounters); ++i) {
+    (*counters)[kCounterNames[i]] =
+        counters_[i].load(std::memory_order_relaxed);
+  }
+  auto* latencies = response->mutable_latencies_us();
+  for (int i = 0; i < static_cast<int>(Phase::kNumOfPhases); ++i) {
+    Histogram histogram = latencies_[i].Snapshot();
+    LatencySummary& summary = (*latencies)[kPhaseNames[i]];
+    summary.set_count(histogram.Count());
+    summary.set_mean(histogram.Mean());
+    summary.set_min(histogram.Min());
+    summary.set_p50(histogram.Percentile(50));
+    summary.set_p90(histogram.Percentile(90));
+    summary.set_p99(histogram.Percentile(99));
+    summary.set_p999(histogram.Percentile(99.9));
+    summary.set_max(histogram.Max());
+  }
+  response->set_text(ToText());
+}
+
+std::string ServerStats::ToText() const {
+  std::string text;
+  char line[256];
+  for (int i = 0; i < static_cast<int>(Counter::kNumOfCounters); ++i) {
+    snprintf(line, sizeof(line), "%-24s %12lld\n", kCounterNames[i],
+             static_cast<long long>(
+                 counters_[i].load(std::memory_order_relaxed)));
+    text += line;
+  }
+  snprintf(line, sizeof(line), "%-24s %8s %10s %8s %8s %8s %8s %8s\n",
+           "latency_us", "count", "mean", "p50", "p90", "p99", "p999", "max");
+  text += line;
+  for (int i = 0; i < static_cast<int>(Phase::kNumOfPhases); ++i) {
+    Histogram histogram = latencies_[i].Snapshot();
+    snprintf(line, sizeof(line),
+             "%-24s %8llu %10.1f %8llu %8llu %8llu %8llu %8llu\n",
+             kPhaseNames[i],
+             static_cast<unsigned long long>(histogram.Count()),
+             histogram.Mean(),
+             static_cast<unsigned long long>(histogram.Percentile(50)),
+             static_cast<unsigned long long>(histogram.Percentile(90)),
+             static_cast<unsigned long long>(histogram.Percentile(99)),
+             static_cast<unsigned long long>(histogram.Percentile(99.9)),
+             static_cast<unsigned long long>(histogram.Max()));
+    text += line;
+  }
+  return text;
+}
+
+}  // namespace keyvaluestore
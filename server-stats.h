@@ -0,0 +1,112 @@
+#ifndef SERVER_STATS_H
+#define SERVER_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "histogram.h"
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// Events counted by a replica.
+enum class Counter {
+  kPrepareQuorumFailures,
+  kProposeQuorumFailures,
+  // Prepare/PrepareLeader/Propose requests this Acceptor random-failed.
+  kRandomFailRejections,
+  kElections,
+  kElectionFailures,
+  kRecoveries,
+  kRecoveryFailures,
+  // Forwarded requests that found Coordinator unreachable and elected one.
+  kForwardElections,
+  kBatches,
+  kBatchedOperations,
+  // Writes dropped from a batch because a later write in it set the same key.
+  kCoalescedOperations,
+  // Thrifty Proposes that had to ask the Acceptors outside the fastest
+  // quorum.
+  kThriftyFallbacks,
+  // Elections started because the heartbeat suspected Coordinator.
+  kFailovers,
+  // Leadership confirmations for read-index reads. Reads that arrive while
+  // one is in flight share the next.
+  kReadIndexRounds,
+  // Reads this replica served at a minimum slot instead of as Coordinator.
+  kLocalReads,
+  kNumOfCounters,
+};
+
+// Timed steps of a replica, recorded in microseconds.
+enum class Phase {
+  // One heartbeat Ping to every replica.
+  kPingSweep,
+  // Phase 1 of an election, until a quorum promised or failed.
+  kPrepare,
+  // Phase 1 of a Coordinator term, over the whole write log.
+  kPrepareLeader,
+  // Phase 2, until a quorum accepted or failed.
+  kPropose,
+  // Phase 3, until a quorum of Learners learned.
+  kInform,
+  // A batch of writes on Coordinator, from Propose until executed.
+  kCommitBatch,
+  kElection,
+  // From Coordinator suspected until this replica was elected in its place.
+  kFailover,
+  kRecovery,
+  // A client request forwarded to Coordinator, until it answered.
+  kForward,
+  // A leadership confirmation on Coordinator, until a quorum confirmed.
+  kReadIndex,
+  // A read at a minimum slot, until this replica executed the slot.
+  kLocalReadWait,
+  kNumOfPhases,
+};
+
+// Counters and latency histograms of a replica, shared by its services and
+// exported by the Stats RPC. Recording takes no locks. Thread-safe.
+class ServerStats {
+ public:
+  // Records the time from construction to destruction as a phase.
+  class Timer {
+   public:
+    Timer(ServerStats* stats, Phase phase)
+        : stats_(stats),
+          phase_(phase),
+          start_(std::chrono::steady_clock::now()) {}
+    ~Timer() {
+      stats_->Record(phase_, std::chrono::steady_clock::now() - start_);
+    }
+
+   private:
+    ServerStats* stats_;
+    Phase phase_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  void Increment(Counter counter, int64_t delta = 1) {
+    counters_[static_cast<int>(counter)].fetch_add(delta,
+                                                   std::memory_order_relaxed);
+  }
+  void Record(Phase phase, std::chrono::steady_clock::duration latency);
+
+  // Fills response with every counter and phase, and with ToText().
+  void Export(StatsResponse* response) const;
+  // Returns a table of every counter and phase, for operators.
+  std::string ToText() const;
+
+ private:
+  std::array<std::atomic<int64_t>, static_cast<int>(Counter::kNumOfCounters)>
+      counters_{};
+  std::array<ConcurrentHistogram, static_cast<int>(Phase::kNumOfPhases)>
+      latencies_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
@@ -0,0 +1,322 @@
+#include "time_log.h"
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace time_log {
+namespace internal {
+
+std::atomic<int> min_level{static_cast<int>(Level::kInfo)};
+
+// The coarse clock is read from the vDSO without a syscall, at the cost of
+// millisecond-ish resolution.
+int64_t CoarseNowUs() {
+  timespec now;
+  clock_gettime(CLOCK_REALTIME_COARSE, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+}  // namespace internal
+
+namespace {
+
+// Capacity of each thread's ring.
+constexpr size_t kRingSize = 1 << 16;
+// How often the background thread writes buffered lines out.
+constexpr std::chrono::milliseconds kDrainInterval(5);
+
+struct RecordHeader {
+  uint32_t size;
+  int32_t level;
+  int64_t timestamp_us;
+};
+
+// A single-producer, single-consumer byte ring holding the lines of one
+// thread as [RecordHeader][text] records.
+class Ring {
+ public:
+  // Called by the owning thread. Returns false, counting the line as
+  // dropped, if it does not fit.
+  bool Push(Level level, int64_t timestamp_us, const char* text,
+            size_t size) {
+    size_t record_size = sizeof(RecordHeader) + size;
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_acquire);
+    if (record_size > kRingSize - (tail - head)) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    RecordHeader header{static_cast<uint32_t>(size),
+                        static_cast<int32_t>(level), timestamp_us};
+    CopyIn(tail, &header, sizeof(header));
+    CopyIn(tail + sizeof(header), text, size);
+    tail_.store(tail + record_size, std::memory_order_release);
+    return true;
+  }
+
+  // Called by the background thread. Calls fn(header, text) on every record
+  // pushed so far.
+  template <typename Fn>
+  void Drain(const Fn& fn) {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    while (head < tail) {
+      RecordHeader header;
+      CopyOut(head, &header, sizeof(header));
+      std::string text(header.size, '\0');
+      CopyOut(head + sizeof(header), text.data(), header.size);
+      fn(header, std::move(text));
+      head += sizeof(header) + header.size;
+    }
+    head_.store(head, std::memory_order_release);
+  }
+
+  uint64_t TakeDropped() {
+    return dropped_.exchange(0, std::memory_order_relaxed);
+  }
+
+  // Set once the owning thread has exited.
+  std::atomic<bool> retired{false};
+
+ private:
+  void CopyIn(uint64_t position, const void* source, size_t size) {
+    size_t offset = position % kRingSize;
+    size_t first = std::min(size, kRingSize - offset);
+    memcpy(data_ + offset, source, first);
+    memcpy(data_, static_cast<const char*>(source) + first, size - first);
+  }
+  void CopyOut(uint64_t position, void* target, size_t size) const {
+    size_t offset = position % kRingSize;
+    size_t first = std::min(size, kRingSize - offset);
+    memcpy(target, data_ + offset, first);
+    memcpy(static_cast<char*>(target) + first, data_, size - first);
+  }
+
+  char data_[kRingSize];
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  alignas(64) std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> dropped_{0};
+};
+
+// Appends "Sat Oct 17 2026 00:12:38.958 " to out. Timestamps come from a
+// coarse clock that ticks every few milliseconds, so no finer digits are
+// printed. The formatted seconds are cached, so localtime_r only runs once
+// a second per thread.
+void AppendTimestamp(int64_t timestamp_us, std::string* out) {
+  static thread_local int64_t cached_second = -1;
+  static thread_local char cached[64];
+  static thread_local size_t cached_size = 0;
+  int64_t second = timestamp_us / 1000000;
+  if (second != cached_second) {
+    time_t now = static_cast<time_t>(second);
+    tm local;
+    localtime_r(&now, &local);
+    cached_size = strftime(cached, sizeof(cached), "%a %b %d %Y %T", &local);
+    cached_second = second;
+  }
+  out->append(cached, cached_size);
+  char millis[16];
+  int size = snprintf(millis, sizeof(millis), ".%03d ",
+                      static_cast<int>(timestamp_us % 1000000 / 1000));
+  out->append(millis, size);
+}
+
+void AppendLine(Level level, int64_t timestamp_us, const char* text,
+                size_t size, std::string* out) {
+  AppendTimestamp(timestamp_us, out);
+  switch (level) {
+    case Level::kDebug:
+      out->append("[DEBUG] ");
+      break;
+    case Level::kWarning:
+      out->append("[WARNING] ");
+      break;
+    case Level::kError:
+      out->append("[ERROR] ");
+      break;
+    default:
+      break;
+  }
+  out->append(text, size);
+  out->push_back('\n');
+}
+
+class AsyncWriter {
+ public:
+  AsyncWriter() { thread_ = std::thread(&AsyncWriter::WriteLoop, this); }
+
+  // Returns the ring of the calling thread, registering it on first use.
+  Ring* ThreadRing() {
+    thread_local RingHolder holder;
+    if (holder.ring == nullptr) {
+      holder.ring = std::make_shared<Ring>();
+      std::lock_guard<std::mutex> lock(rings_mtx_);
+      rings_.push_back(holder.ring);
+    }
+    return holder.ring.get();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    uint64_t request = ++flush_requests_;
+    drain_cv_.notify_one();
+    flushed_cv_.wait(lock, [this, request] { return flushed_ >= request; });
+  }
+
+ private:
+  struct RingHolder {
+    ~RingHolder() {
+      if (ring != nullptr) ring->retired.store(true, std::memory_order_release);
+    }
+    std::shared_ptr<Ring> ring;
+  };
+  struct Record {
+    RecordHeader header;
+    std::string text;
+  };
+
+  void WriteLoop() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    while (true) {
+      drain_cv_.wait_for(lock, kDrainInterval,
+                         [this] { return flush_requests_ > flushed_; });
+      uint64_t request = flush_requests_;
+      lock.unlock();
+      DrainAll();
+      lock.lock();
+      flushed_ = request;
+      flushed_cv_.notify_all();
+    }
+  }
+
+  // Writes out the lines of all threads, ordered by time.
+  void DrainAll() {
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+      std::lock_guard<std::mutex> lock(rings_mtx_);
+      rings = rings_;
+    }
+    std::vector<Record> records;
+    uint64_t dropped = 0;
+    for (const auto& ring : rings) {
+      // Checked first, so that a retired ring is known to be drained fully.
+      bool retired = ring->retired.load(std::memory_order_acquire);
+      ring->Drain([&records](const RecordHeader& header, std::string text) {
+        records.push_back({header, std::move(text)});
+      });
+      dropped += ring->TakeDropped();
+      if (retired) {
+        std::lock_guard<std::mutex> lock(rings_mtx_);
+        rings_.erase(std::find(rings_.begin(), rings_.end(), ring));
+      }
+    }
+    if (records.empty() && dropped == 0) return;
+    std::stable_sort(records.begin(), records.end(),
+                     [](const Record& a, const Record& b) {
+                       return a.header.timestamp_us < b.header.timestamp_us;
+                     });
+    std::string out;
+    for (const Record& record : records) {
+      AppendLine(static_cast<Level>(record.header.level),
+                 record.header.timestamp_us, record.text.data(),
+                 record.text.size(), &out);
+    }
+    if (dropped > 0) {
+      std::string message =
+          std::to_string(dropped) + " log lines dropped, rings were full.";
+      AppendLine(Level::kWarning, internal::CoarseNowUs(), message.data(),
+                 message.size(), &out);
+    }
+    fwrite(out.data(), 1, out.size(), stdout);
+    fflush(stdout);
+  }
+
+  std::mutex rings_mtx_;
+  std::vector<std::shared_ptr<Ring>> rings_;
+
+  std::mutex mtx_;
+  std::condition_variable drain_cv_;
+  std::condition_variable flushed_cv_;
+  uint64_t flush_requests_ = 0;
+  uint64_t flushed_ = 0;
+  std::thread thread_;
+};
+
+// Never destroyed: threads may still log while the process exits.
+std::atomic<AsyncWriter*> async_writer{nullptr};
+
+}  // namespace
+
+namespace internal {
+
+void Submit(Level level, int64_t timestamp_us, const char* text,
+            size_t size) {
+  AsyncWriter* writer = async_writer.load(std::memory_order_acquire);
+  if (writer != nullptr) {
+    writer->ThreadRing()->Push(level, timestamp_us, text, size);
+    return;
+  }
+  std::string line;
+  AppendLine(level, timestamp_us, text, size, &line);
+  fwrite(line.data(), 1, line.size(), stdout);
+  fflush(stdout);
+}
+
+}  // namespace internal
+
+void SetLevel(Level level) {
+  internal::min_level.store(static_cast<int>(level),
+                            std::memory_order_relaxed);
+}
+
+bool ParseLevel(const std::string& name, Level* level) {
+  if (name == "DEBUG") {
+    *level = Level::kDebug;
+  } else if (name == "INFO") {
+    *level = Level::kInfo;
+  } else if (name == "WARNING") {
+    *level = Level::kWarning;
+  } else if (name == "ERROR") {
+    *level = Level::kError;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void StartAsync() {
+  if (async_writer.load() != nullptr) return;
+  async_writer.store(new AsyncWriter(), std::memory_order_release);
+  std::atexit(Flush);
+}
+
+void Flush() {
+  AsyncWriter* writer = async_writer.load(std::memory_order_acquire);
+  if (writer != nullptr) {
+    writer->Flush();
+  } else {
+    fflush(stdout);
+  }
+}
+
+void Line::Append(const char* text, size_t size) {
+  if (overflow_.empty() && size_ + size <= kBufferSize) {
+    memcpy(buffer_ + size_, text, size);
+    size_ += size;
+    return;
+  }
+  if (overflow_.empty()) overflow_.assign(buffer_, size_);
+  overflow_.append(text, size);
+}
+
+}  // namespace time_log
@@ -1,23 +1,147 @@
 #ifndef TIME_LOG_H
 #define TIME_LOG_H
 
-#include <ctime>
-#include <iomanip>
-#include <iostream>
-#include <sstream>
-
-inline std::string TimeNow() {
-  const auto now = std::chrono::system_clock::now();
-  const auto now_as_time_t = std::chrono::system_clock::to_time_t(now);
-  const auto now_us = std::chrono::duration_cast<std::chrono::milliseconds>(
-                          now.time_since_epoch()) %
-                      1000000;
-  std::stringstream now_ss;
-  now_ss << std::put_time(std::localtime(&now_as_time_t), "%a %b %d %Y %T")
-         << '.' << std::setfill('0') << std::setw(3) << now_us.count();
-  return now_ss.str();
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Timestamped logging.
+//
+//   TIME_LOG << "Accepted " << key << " in round " << round;
+//
+// A line is built on the stack and handed off when the statement ends; no
+// newline is needed. Lines are stamped to the millisecond from a coarse
+// clock, so lines logged within one tick by different threads may appear
+// in any order. By default every line is written to stdout right away.
+// After time_log::StartAsync(), each thread appends lines to its own
+// lock-free ring buffer instead, and a background thread timestamps and
+// writes them out in batches. If a ring is full, the line is dropped and
+// counted rather than blocking the caller.
+//
+// Lines below the run-time level (SetLevel) cost one relaxed atomic load.
+// Lines below TIME_LOG_MIN_LEVEL, set at compile time, are compiled out
+// together with their arguments.
+
+namespace time_log {
+
+enum class Level { kDebug = 0, kInfo = 1, kWarning = 2, kError = 3 };
+
+// Lines below this level are compiled out. Defaults to kDebug, i.e. none.
+#ifndef TIME_LOG_MIN_LEVEL
+#define TIME_LOG_MIN_LEVEL 0
+#endif
+
+namespace internal {
+extern std::atomic<int> min_level;
+void Submit(Level level, int64_t timestamp_us, const char* text, size_t size);
+int64_t CoarseNowUs();
+}  // namespace internal
+
+// Returns whether lines of level are written at run time.
+inline bool Enabled(Level level) {
+  return static_cast<int>(level) >=
+         internal::min_level.load(std::memory_order_relaxed);
 }
+// Sets the lowest level written at run time. Defaults to kInfo.
+void SetLevel(Level level);
+// Parses "DEBUG", "INFO", "WARNING" or "ERROR" into *level. Returns false on
+// other names.
+bool ParseLevel(const std::string& name, Level* level);
+
+// Switches to buffered, asynchronous writing. Call once, early in main().
+void StartAsync();
+// Blocks until every line logged so far is written out.
+void Flush();
+
+// One log line, submitted when destroyed.
+class Line {
+ public:
+  explicit Line(Level level)
+      : level_(level), timestamp_us_(internal::CoarseNowUs()) {}
+  ~Line() {
+    if (overflow_.empty()) {
+      internal::Submit(level_, timestamp_us_, buffer_, size_);
+    } else {
+      internal::Submit(level_, timestamp_us_, overflow_.data(),
+                       overflow_.size());
+    }
+  }
+  Line(const Line&) = delete;
+  Line& operator=(const Line&) = delete;
+
+  Line& operator<<(std::string_view text) {
+    Append(text.data(), text.size());
+    return *this;
+  }
+  Line& operator<<(const char* text) { return *this << std::string_view(text); }
+  Line& operator<<(const std::string& text) {
+    return *this << std::string_view(text);
+  }
+  Line& operator<<(char c) {
+    Append(&c, 1);
+    return *this;
+  }
+  Line& operator<<(bool value) { return *this << (value ? "true" : "false"); }
+  Line& operator<<(double value) {
+    char digits[32];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    Append(digits, result.ptr - digits);
+    return *this;
+  }
+  template <typename T,
+            std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>,
+                             int> = 0>
+  Line& operator<<(T value) {
+    char digits[24];
+    std::to_chars_result result;
+    if constexpr (std::is_enum_v<T>) {
+      result = std::to_chars(digits, digits + sizeof(digits),
+                             static_cast<std::underlying_type_t<T>>(value));
+    } else {
+      result = std::to_chars(digits, digits + sizeof(digits), value);
+    }
+    Append(digits, result.ptr - digits);
+    return *this;
+  }
+
+ private:
+  void Append(const char* text, size_t size);
+
+  static constexpr size_t kBufferSize = 480;
+
+  const Level level_;
+  const int64_t timestamp_us_;
+  size_t size_ = 0;
+  char buffer_[kBufferSize];
+  // Takes over from buffer_ once a line outgrows it.
+  std::string overflow_;
+};
+
+}  // namespace time_log
+
+#define TIME_LOG_AT(level)                                 \
+  if (static_cast<int>(level) < TIME_LOG_MIN_LEVEL ||      \
+      !::time_log::Enabled(level)) {                       \
+  } else                                                   \
+    ::time_log::Line(level)
+
+// Writes one in every n lines of the call site, counted per thread.
+#define TIME_LOG_EVERY_N(level, n)                                   \
+  if (static_cast<int>(level) < TIME_LOG_MIN_LEVEL ||                \
+      !::time_log::Enabled(level) ||                                 \
+      []() -> uint64_t& {                                            \
+        static thread_local uint64_t count = 0;                      \
+        return count;                                                \
+      }()++ % (n) != 0) {                                            \
+  } else                                                             \
+    ::time_log::Line(level)
 
-#define TIME_LOG (std::cout << TimeNow() << " ")
+#define TIME_LOG_DEBUG TIME_LOG_AT(::time_log::Level::kDebug)
+#define TIME_LOG TIME_LOG_AT(::time_log::Level::kInfo)
+#define TIME_LOG_WARNING TIME_LOG_AT(::time_log::Level::kWarning)
+#define TIME_LOG_ERROR TIME_LOG_AT(::time_log::Level::kError)
 
-#endif
\ No newline at end of file
+#endif
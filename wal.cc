@@ -0,0 +1,262 @@
+#include "wal.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "time_log.h"
+
+namespace keyvaluestore {
+
+using grpc::Status;
+
+// Every record starts with its payload length and the CRC32 of its payload.
+constexpr size_t kHeaderSize = 8;
+// A log smaller than this is never worth a checkpoint.
+constexpr uint64_t kMinCheckpointBytes = 64 << 20;
+
+static const std::array<uint32_t, 256>& Crc32Table() {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> table;
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+      }
+      table[i] = crc;
+    }
+    return table;
+  }();
+  return table;
+}
+
+// CRC-32 (IEEE 802.3) of data.
+static uint32_t Crc32(const char* data, size_t size) {
+  const auto& table = Crc32Table();
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+// Little-endian, so that log files are portable between hosts.
+static void EncodeFixed32(char* dst, uint32_t value) {
+  for (int i = 0; i < 4; ++i) dst[i] = static_cast<char>(value >> (8 * i));
+}
+static uint32_t DecodeFixed32(const char* src) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(static_cast<uint8_t>(src[i])) << (8 * i);
+  }
+  return value;
+}
+
+WriteAheadLog::WriteAheadLog(const std::string& path) : path_(path) {}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stopped_ = true;
+  }
+  flush_cv_.notify_all();
+  // FlushLoop writes out what is still buffered before it returns.
+  if (flush_thread_.joinable()) flush_thread_.join();
+  if (fd_ >= 0) close(fd_);
+}
+
+Status WriteAheadLog::Open(const ReplayFn& replay) {
+  fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  if (fd_ < 0) {
+    return Status(grpc::StatusCode::INTERNAL,
+                  "Failed to open WAL " + path_ + ": " + strerror(errno));
+  }
+  std::string contents;
+  char chunk[1 << 16];
+  ssize_t num_of_read;
+  while ((num_of_read = read(fd_, chunk, sizeof(chunk))) > 0) {
+    contents.append(chunk, num_of_read);
+  }
+  if (num_of_read < 0) {
+    return Status(grpc::StatusCode::INTERNAL,
+                  "Failed to read WAL " + path_ + ": " + strerror(errno));
+  }
+
+  size_t offset = 0;
+  int num_of_records = 0;
+  WalRecord record;
+  while (offset + kHeaderSize <= contents.size()) {
+    uint32_t length = DecodeFixed32(&contents[offset]);
+    uint32_t crc = DecodeFixed32(&contents[offset + 4]);
+    if (length > contents.size() - offset - kHeaderSize) break;
+    const char* payload = &contents[offset + kHeaderSize];
+    if (Crc32(payload, length) != crc ||
+        !record.ParseFromArray(payload, length)) {
+      break;
+    }
+    replay(record);
+    offset += kHeaderSize + length;
+    ++num_of_records;
+  }
+  if (offset < contents.size()) {
+    TIME_LOG_WARNING << "WAL " << path_ << ": dropping "
+                     << contents.size() - offset
+                     << " bytes of torn or corrupt tail.";
+    if (ftruncate(fd_, offset) != 0) {
+      return Status(grpc::StatusCode::INTERNAL,
+                    "Failed to truncate WAL " + path_ + ": " + strerror(errno));
+    }
+  }
+  size_ = checkpointed_size_ = offset;
+  TIME_LOG << "WAL " << path_ << ": replayed " << num_of_records
+           << " records.";
+  flush_thread_ = std::thread(&WriteAheadLog::FlushLoop, this);
+  return Status::OK;
+}
+
+std::string WriteAheadLog::Frame(const WalRecord& record) {
+  std::string payload = record.SerializeAsString();
+  std::string framed(kHeaderSize, '\0');
+  EncodeFixed32(&framed[0], payload.size());
+  EncodeFixed32(&framed[4], Crc32(payload.data(), payload.size()));
+  return framed + payload;
+}
+
+uint64_t WriteAheadLog::Append(const WalRecord& record) {
+  std::string framed = Frame(record);
+  uint64_t lsn;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    buffer_.append(framed);
+    if (checkpointing_) checkpoint_tail_.append(framed);
+    size_ += framed.size();
+    lsn = ++appended_lsn_;
+  }
+  flush_cv_.notify_one();
+  return lsn;
+}
+
+void WriteAheadLog::Sync(uint64_t lsn) {
+  std::unique_lock<std::mutex> lock(mtx_);
+  durable_cv_.wait(lock, [this, lsn] { return durable_lsn_ >= lsn; });
+}
+
+// Writes all of data to fd. Returns false on I/O errors.
+static bool WriteFully(int fd, const std::string& data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t num_of_written =
+        write(fd, data.data() + written, data.size() - written);
+    if (num_of_written < 0 && errno == EINTR) continue;
+    if (num_of_written < 0) return false;
+    written += num_of_written;
+  }
+  return true;
+}
+
+bool WriteAheadLog::NeedsCheckpoint() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return size_ >= kMinCheckpointBytes && size_ >= 2 * checkpointed_size_;
+}
+
+void WriteAheadLog::BeginCheckpoint() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  checkpointing_ = true;
+  checkpoint_tail_.clear();
+}
+
+// Syncs the directory holding path, so that a rename in it is durable.
+static bool SyncDirectory(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  std::string dir = slash == std::string::npos ? "." : path.substr(0, slash);
+  int dir_fd = open(dir.empty() ? "/" : dir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (dir_fd < 0) return false;
+  bool synced = fsync(dir_fd) == 0;
+  close(dir_fd);
+  return synced;
+}
+
+// Writes the new log next to the old one, then renames it over, so a crash
+// leaves either of them intact. The checkpoint and the records appended
+// meanwhile are written without the lock; only the last few are written
+// with it held, once the old log is flushed.
+Status WriteAheadLog::Rewrite(const std::vector<WalRecord>& records) {
+  std::string tmp_path = path_ + ".tmp";
+  int tmp_fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  std::string contents;
+  for (const WalRecord& record : records) contents += Frame(record);
+  bool written = tmp_fd >= 0 && WriteFully(tmp_fd, contents);
+  uint64_t size = contents.size();
+  std::unique_lock<std::mutex> lock(mtx_);
+  while (written) {
+    // Let the flusher finish what is buffered for the old file, so that
+    // none of it is written again to the new one.
+    durable_cv_.wait(lock, [this] { return durable_lsn_ == appended_lsn_; });
+    if (checkpoint_tail_.empty()) break;
+    std::string tail;
+    tail.swap(checkpoint_tail_);
+    lock.unlock();
+    written = WriteFully(tmp_fd, tail);
+    size += tail.size();
+    lock.lock();
+  }
+  checkpointing_ = false;
+  checkpoint_tail_.clear();
+  if (!written || fdatasync(tmp_fd) != 0 ||
+      rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    Status error(grpc::StatusCode::INTERNAL,
+                 "Failed to rewrite WAL " + path_ + ": " + strerror(errno));
+    if (tmp_fd >= 0) close(tmp_fd);
+    unlink(tmp_path.c_str());
+    return error;
+  }
+  close(tmp_fd);
+  // Without this, a crash could bring the old log back, and with it the
+  // rounds dropped since.
+  if (!SyncDirectory(path_)) {
+    std::cerr << "Failed to sync the directory of WAL " << path_ << ": "
+              << strerror(errno) << std::endl;
+    std::abort();
+  }
+  int fd = open(path_.c_str(), O_RDWR | O_APPEND);
+  if (fd < 0) {
+    std::cerr << "Failed to reopen WAL " << path_ << ": " << strerror(errno)
+              << std::endl;
+    std::abort();
+  }
+  close(fd_);
+  fd_ = fd;
+  size_ = checkpointed_size_ = size;
+  return Status::OK;
+}
+
+void WriteAheadLog::FlushLoop() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  while (true) {
+    flush_cv_.wait(lock, [this] {
+      return stopped_ || appended_lsn_ > durable_lsn_;
+    });
+    if (appended_lsn_ == durable_lsn_) break;
+    std::string batch;
+    batch.swap(buffer_);
+    uint64_t batch_lsn = appended_lsn_;
+    lock.unlock();
+    // Records appended meanwhile go into the next flush.
+    if (!WriteFully(fd_, batch) || fdatasync(fd_) != 0) {
+      std::cerr << "Failed to write WAL " << path_ << ": " << strerror(errno)
+                << std::endl;
+      std::abort();
+    }
+    lock.lock();
+    durable_lsn_ = batch_lsn;
+    durable_cv_.notify_all();
+  }
+}
+
+}  // namespace keyvaluestore
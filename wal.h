@@ -0,0 +1,81 @@
+#ifndef WAL_H
+#define WAL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+
+namespace keyvaluestore {
+
+// An append-only write-ahead log of WalRecords on local disk.
+//
+// Each record is framed as [length][crc32][payload]. Appends go to an
+// in-memory buffer; a background thread writes the buffer out and fsyncs it,
+// so concurrent callers waiting in Sync() share one disk flush (group
+// commit).
+// Thread-safe.
+class WriteAheadLog {
+ public:
+  using ReplayFn = std::function<void(const WalRecord& record)>;
+
+  explicit WriteAheadLog(const std::string& path);
+  ~WriteAheadLog();
+
+  // Opens the log, calling replay on every intact record in order. A torn or
+  // corrupt tail, left by a crash in the middle of a write, is cut off.
+  grpc::Status Open(const ReplayFn& replay);
+
+  // Buffers a record and returns its sequence number.
+  uint64_t Append(const WalRecord& record);
+  // Blocks until the record numbered lsn and all before it are on disk.
+  // Crashes the process on I/O errors: state that could not be persisted
+  // must never be acknowledged.
+  void Sync(uint64_t lsn);
+
+  // Returns whether the log has grown enough since it was opened or last
+  // rewritten to be worth a checkpoint.
+  bool NeedsCheckpoint();
+  // Starts keeping aside the records appended from now on, so that a
+  // checkpoint of the state the log describes at this point can be taken
+  // while appends go on.
+  void BeginCheckpoint();
+  // Atomically replaces the whole log with records, the checkpoint, followed
+  // by the records appended since BeginCheckpoint(). Appends are held off
+  // only while the last of those are written and the new log is synced.
+  grpc::Status Rewrite(const std::vector<WalRecord>& records);
+
+ private:
+  // Returns record framed as [length][crc32][payload].
+  static std::string Frame(const WalRecord& record);
+  void FlushLoop();
+
+  const std::string path_;
+  int fd_ = -1;
+
+  std::string buffer_;
+  // Records appended since BeginCheckpoint(), while checkpointing_.
+  std::string checkpoint_tail_;
+  bool checkpointing_ = false;
+  // Bytes in the log, and in it when last opened or rewritten.
+  uint64_t size_ = 0;
+  uint64_t checkpointed_size_ = 0;
+  uint64_t appended_lsn_ = 0;
+  uint64_t durable_lsn_ = 0;
+  bool stopped_ = false;
+  std::mutex mtx_;
+  std::condition_variable flush_cv_;
+  std::condition_variable durable_cv_;
+  std::thread flush_thread_;
+};
+
+}  // namespace keyvaluestore
+
+#endif
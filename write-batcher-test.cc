@@ -0,0 +1,115 @@
+// Tests of WriteBatcher, with a fake propose in place of Paxos.
+//
+// Prints one line per failed check and exits non-zero if any failed.
+//
+// Usage: `./write-batcher-test`
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "server-stats.h"
+#include "write-batcher.h"
+
+using keyvaluestore::Operation;
+using keyvaluestore::ServerStats;
+using keyvaluestore::WriteBatcher;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                   \
+  do {                                                                     \
+    if (!(condition)) {                                                    \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "       \
+                << #condition << std::endl;                                \
+      ++failures;                                                          \
+    }                                                                      \
+  } while (false)
+
+// Proposes the operations of one write and waits for its result.
+grpc::Status Write(WriteBatcher& batcher, const std::string& key) {
+  Operation operation;
+  operation.set_key(key);
+  std::promise<grpc::Status> committed;
+  std::future<grpc::Status> result = committed.get_future();
+  batcher.Submit({operation},
+                 [&committed](const grpc::Status& status, int /*slot*/) {
+                   committed.set_value(status);
+                 });
+  return result.get();
+}
+
+// Threads left idle by a batch window must not propose empty batches.
+void TestNoEmptyBatches() {
+  constexpr int kWrites = 100;
+  for (int window_us : {0, 500}) {
+    ServerStats stats;
+    std::atomic<int> proposals{0};
+    std::atomic<int> empty_proposals{0};
+    std::atomic<int> slot{0};
+    {
+      WriteBatcher batcher(
+          [&](const std::vector<Operation>& operations, int* proposed_slot) {
+            ++proposals;
+            if (operations.empty()) ++empty_proposals;
+            *proposed_slot = ++slot;
+            return grpc::Status::OK;
+          },
+          &stats, std::chrono::microseconds(window_us),
+          /*max_batch_size=*/64, /*pipeline_depth=*/4);
+      for (int i = 0; i < kWrites; ++i) {
+        CHECK(Write(batcher, "k" + std::to_string(i)).ok());
+      }
+    }
+    CHECK(empty_proposals == 0);
+    CHECK(proposals == kWrites);
+  }
+}
+
+// Concurrent writes to one key are coalesced into few batches, and every
+// writer is answered.
+void TestConcurrentWritesAreBatched() {
+  constexpr int kWriters = 16;
+  ServerStats stats;
+  std::atomic<int> proposals{0};
+  std::atomic<int> answered{0};
+  {
+    WriteBatcher batcher(
+        [&](const std::vector<Operation>& /*operations*/, int* slot) {
+          ++proposals;
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          *slot = proposals;
+          return grpc::Status::OK;
+        },
+        &stats, std::chrono::microseconds(2000), /*max_batch_size=*/64,
+        /*pipeline_depth=*/2);
+    std::vector<std::thread> writers;
+    for (int i = 0; i < kWriters; ++i) {
+      writers.emplace_back([&batcher, &answered] {
+        if (Write(batcher, "hot").ok()) ++answered;
+      });
+    }
+    for (auto& writer : writers) writer.join();
+  }
+  CHECK(answered == kWriters);
+  CHECK(proposals >= 1 && proposals < kWriters);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  TestNoEmptyBatches();
+  TestConcurrentWritesAreBatched();
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed." << std::endl;
+    return 1;
+  }
+  std::cout << "All tests passed." << std::endl;
+  return 0;
+}
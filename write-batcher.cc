@@ -0,0 +1,106 @@
+#include "write-batcher.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace keyvaluestore {
+
+using grpc::Status;
+
+WriteBatcher::WriteBatcher(ProposeFn propose, ServerStats* stats,
+                           std::chrono::microseconds window,
+                           int max_batch_size, int pipeline_depth)
+    : propose_(std::move(propose)),
+      stats_(stats),
+      window_(window),
+      max_batch_size_(max_batch_size > 0 ? max_batch_size : 1) {
+  for (int i = 0; i < std::max(pipeline_depth, 1); ++i) {
+    batch_threads_.emplace_back(&WriteBatcher::BatchLoop, this);
+  }
+}
+
+WriteBatcher::~WriteBatcher() {
+  {
+    std::lock_guard<std::mutex> lock(pending_mtx_);
+    stopped_ = true;
+  }
+  pending_cv_.notify_all();
+  for (auto& batch_thread : batch_threads_) batch_thread.join();
+}
+
+void WriteBatcher::Submit(std::vector<Operation> operations, DoneFn done) {
+  {
+    std::lock_guard<std::mutex> lock(pending_mtx_);
+    if (stopped_) {
+      done(Status(grpc::StatusCode::UNAVAILABLE, "Server is shutting down."),
+           0);
+      return;
+    }
+    num_of_pending_operations_ += operations.size();
+    pending_.push_back({std::move(operations), std::move(done)});
+  }
+  pending_cv_.notify_all();
+}
+
+void WriteBatcher::BatchLoop() {
+  std::unique_lock<std::mutex> lock(pending_mtx_);
+  while (true) {
+    pending_cv_.wait(lock, [this] { return stopped_ || !pending_.empty(); });
+    if (stopped_) break;
+    // Give concurrent writers a chance to join the batch.
+    if (window_.count() > 0) {
+      pending_cv_.wait_for(lock, window_, [this] {
+        return stopped_ || num_of_pending_operations_ >= max_batch_size_;
+      });
+      // Another thread may have taken the whole queue meanwhile.
+      if (stopped_) break;
+      if (pending_.empty()) continue;
+    }
+    std::vector<PendingWrite> batch;
+    std::vector<Operation> operations;
+    // Index in operations of the write to each key. The batch size counts
+    // distinct keys, so writes to a hot key keep joining the batch.
+    std::unordered_map<std::string, size_t> index_of_key;
+    int64_t num_of_coalesced = 0;
+    while (!pending_.empty() &&
+           (operations.empty() || operations.size() +
+                                          pending_.front().operations.size() <=
+                                      max_batch_size_)) {
+      PendingWrite& write = pending_.front();
+      num_of_pending_operations_ -= write.operations.size();
+      for (Operation& operation : write.operations) {
+        auto inserted =
+            index_of_key.emplace(operation.key(), operations.size());
+        if (inserted.second) {
+          operations.push_back(std::move(operation));
+        } else {
+          // Last write wins.
+          operations[inserted.first->second] = std::move(operation);
+          ++num_of_coalesced;
+        }
+      }
+      batch.push_back(std::move(write));
+      pending_.pop_front();
+    }
+    lock.unlock();
+    if (num_of_coalesced > 0) {
+      stats_->Increment(Counter::kCoalescedOperations, num_of_coalesced);
+    }
+    // Writes arriving meanwhile form the next batch, proposed by another
+    // thread if one is idle.
+    int slot = 0;
+    Status status = propose_(operations, &slot);
+    for (auto& write : batch) write.done(status, slot);
+    lock.lock();
+  }
+  // Fail whatever is left.
+  for (auto& write : pending_) {
+    write.done(
+        Status(grpc::StatusCode::UNAVAILABLE, "Server is shutting down."), 0);
+  }
+  pending_.clear();
+}
+
+}  // namespace keyvaluestore
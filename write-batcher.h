@@ -0,0 +1,72 @@
+#ifndef WRITE_BATCHER_H
+#define WRITE_BATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "keyvaluestore.grpc.pb.h"
+#include "server-stats.h"
+
+namespace keyvaluestore {
+
+// Group commit for Coordinator. Collects writes submitted concurrently and
+// hands them to `propose` as one batch, so that a single Paxos instance
+// commits many writes. A batch is cut once `max_batch_size` operations are
+// pending, or `window` after the first of them arrived. The operations of
+// one Submit() call always end up in the same batch. Up to `pipeline_depth`
+// batches are proposed concurrently.
+//
+// Writes to the same key within a batch are coalesced: only the last one is
+// proposed, since Learners would overwrite the others anyway. Every writer
+// is still answered with the result of the batch, in submission order. A
+// hot key thus costs one operation per batch however many clients write it.
+// Thread-safe.
+class WriteBatcher {
+ public:
+  // Sets *slot to the write log slot the batch was committed in.
+  using ProposeFn = std::function<grpc::Status(
+      const std::vector<Operation>& operations, int* slot)>;
+  using DoneFn = std::function<void(const grpc::Status& status, int slot)>;
+
+  // Coalesced writes are counted in stats.
+  WriteBatcher(ProposeFn propose, ServerStats* stats,
+               std::chrono::microseconds window, int max_batch_size,
+               int pipeline_depth);
+  ~WriteBatcher();
+
+  // Queues operations to be committed together. `done` is called with the
+  // result and slot of the batch that carried them.
+  void Submit(std::vector<Operation> operations, DoneFn done);
+
+ private:
+  struct PendingWrite {
+    std::vector<Operation> operations;
+    DoneFn done;
+  };
+
+  void BatchLoop();
+
+  ProposeFn propose_;
+  ServerStats* stats_;
+  const std::chrono::microseconds window_;
+  const size_t max_batch_size_;
+
+  std::deque<PendingWrite> pending_;
+  size_t num_of_pending_operations_ = 0;
+  bool stopped_ = false;
+  std::mutex pending_mtx_;
+  std::condition_variable pending_cv_;
+  // One thread per batch in flight.
+  std::vector<std::thread> batch_threads_;
+};
+
+}  // namespace keyvaluestore
+
+#endif